@@ -0,0 +1,45 @@
+#!/bin/bash
+# Copyright 2024-present Alibaba Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Script which runs all paimon benchmarks and writes the results of each
+# benchmark as a JSON file for regression tracking.
+#
+# Arguments:
+#    $1 - Directory of benchmark executables (e.g. build/release).
+#    $2 - Output directory of JSON results.
+#    $ARGN - extra arguments for benchmarks (e.g. --benchmark_filter=Parquet)
+#
+
+set -e
+
+if [ $# -lt 2 ]; then
+  echo "Usage: $0 <benchmark-dir> <output-dir> [benchmark args...]"
+  exit 1
+fi
+
+BENCHMARK_DIR=$1
+OUTPUT_DIR=$2
+shift 2
+
+mkdir -p $OUTPUT_DIR
+
+for BENCHMARK in $BENCHMARK_DIR/paimon-*-benchmark; do
+  BENCHMARK_NAME=$(basename $BENCHMARK)
+  echo "Running $BENCHMARK_NAME"
+  $BENCHMARK \
+    --benchmark_out=$OUTPUT_DIR/$BENCHMARK_NAME.json \
+    --benchmark_out_format=json \
+    "$@"
+done
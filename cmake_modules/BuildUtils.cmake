@@ -327,3 +327,55 @@ function(add_paimon_test REL_TEST_NAME)
                   ${PCH_ARGS}
                   ${ARG_UNPARSED_ARGUMENTS})
 endfunction()
+
+#
+# Benchmarking
+#
+# Add a new benchmark executable, which is built by the "paimon_benchmarks" target.
+#
+# REL_BENCHMARK_NAME is the name of the benchmark, the executable is named
+# "paimon-REL_BENCHMARK_NAME" with hyphens instead of underscores.
+#
+# If given, SOURCES is the list of C++ source files to compile into the benchmark
+# executable.  Otherwise, "REL_BENCHMARK_NAME.cpp" is used.
+function(add_paimon_benchmark REL_BENCHMARK_NAME)
+    set(options)
+    set(one_value_args)
+    set(multi_value_args SOURCES STATIC_LINK_LIBS EXTRA_LINK_LIBS)
+    cmake_parse_arguments(ARG
+                          "${options}"
+                          "${one_value_args}"
+                          "${multi_value_args}"
+                          ${ARGN})
+    if(ARG_UNPARSED_ARGUMENTS)
+        message(SEND_ERROR "Error: unrecognized arguments: ${ARG_UNPARSED_ARGUMENTS}")
+    endif()
+
+    if(NOT PAIMON_BUILD_BENCHMARKS)
+        return()
+    endif()
+    get_filename_component(BENCHMARK_NAME ${REL_BENCHMARK_NAME} NAME_WE)
+
+    if(ARG_SOURCES)
+        set(SOURCES ${ARG_SOURCES})
+    else()
+        set(SOURCES "${REL_BENCHMARK_NAME}.cpp")
+    endif()
+
+    # Make sure the executable name contains only hyphens, not underscores
+    set(BENCHMARK_NAME "paimon-${BENCHMARK_NAME}")
+    string(REPLACE "_" "-" BENCHMARK_NAME ${BENCHMARK_NAME})
+    message(STATUS ${BENCHMARK_NAME})
+    add_executable(${BENCHMARK_NAME} ${SOURCES})
+    target_link_libraries(${BENCHMARK_NAME} PRIVATE ${ARG_STATIC_LINK_LIBS})
+
+    if(ARG_EXTRA_LINK_LIBS)
+        target_link_libraries(${BENCHMARK_NAME} PRIVATE ${ARG_EXTRA_LINK_LIBS})
+    endif()
+
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
+        target_compile_options(${BENCHMARK_NAME} PRIVATE -Wno-global-constructors)
+    endif()
+
+    add_dependencies(paimon_benchmarks ${BENCHMARK_NAME})
+endfunction()
@@ -147,6 +147,14 @@ else()
     )
 endif()
 
+if(DEFINED ENV{PAIMON_GBENCHMARK_URL})
+    set(GBENCHMARK_SOURCE_URL "$ENV{PAIMON_GBENCHMARK_URL}")
+else()
+    set_urls(GBENCHMARK_SOURCE_URL
+             "${THIRDPARTY_MIRROR_URL}https://github.com/google/benchmark/archive/${PAIMON_GBENCHMARK_BUILD_VERSION}.tar.gz"
+    )
+endif()
+
 if(DEFINED ENV{PAIMON_TBB_URL})
     set(TBB_SOURCE_URL "$ENV{PAIMON_TBB_URL}")
 else()
@@ -919,6 +927,60 @@ macro(build_gtest)
     set(GTEST_LINK_TOOLCHAIN GTest::gtest_main GTest::gtest GTest::gmock Threads::Threads)
 endmacro()
 
+macro(build_gbenchmark)
+    message(STATUS "Building benchmark from source")
+
+    set(GBENCHMARK_CMAKE_CXX_FLAGS "${EP_CXX_FLAGS} -Wno-error")
+    string(REPLACE "-Werror" "" GBENCHMARK_CMAKE_CXX_FLAGS ${GBENCHMARK_CMAKE_CXX_FLAGS})
+
+    set(GBENCHMARK_PREFIX "${CMAKE_CURRENT_BINARY_DIR}/gbenchmark_ep-install")
+    set(GBENCHMARK_INCLUDE_DIR "${GBENCHMARK_PREFIX}/include")
+    set(GBENCHMARK_STATIC_LIB
+        "${GBENCHMARK_PREFIX}/lib/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark${CMAKE_STATIC_LIBRARY_SUFFIX}"
+    )
+    set(GBENCHMARK_MAIN_STATIC_LIB
+        "${GBENCHMARK_PREFIX}/lib/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark_main${CMAKE_STATIC_LIBRARY_SUFFIX}"
+    )
+    set(GBENCHMARK_CMAKE_ARGS
+        ${EP_COMMON_CMAKE_ARGS}
+        "-DCMAKE_INSTALL_PREFIX=${GBENCHMARK_PREFIX}"
+        "-DCMAKE_CXX_FLAGS=${GBENCHMARK_CMAKE_CXX_FLAGS}"
+        "-DCMAKE_CXX_FLAGS_${UPPERCASE_BUILD_TYPE}=${GBENCHMARK_CMAKE_CXX_FLAGS}"
+        -DBENCHMARK_ENABLE_TESTING=OFF
+        -DBENCHMARK_ENABLE_GTEST_TESTS=OFF
+        -DBENCHMARK_ENABLE_WERROR=OFF)
+
+    externalproject_add(gbenchmark_ep
+                        URL ${GBENCHMARK_SOURCE_URL}
+                        URL_HASH "SHA256=${PAIMON_GBENCHMARK_BUILD_SHA256_CHECKSUM}"
+                        CMAKE_ARGS ${GBENCHMARK_CMAKE_ARGS}
+                        BUILD_BYPRODUCTS "${GBENCHMARK_STATIC_LIB}"
+                                         "${GBENCHMARK_MAIN_STATIC_LIB}")
+
+    # The include directory must exist before it is referenced by a target.
+    file(MAKE_DIRECTORY "${GBENCHMARK_INCLUDE_DIR}")
+
+    add_library(benchmark::benchmark STATIC IMPORTED)
+    set_target_properties(benchmark::benchmark
+                          PROPERTIES IMPORTED_LOCATION "${GBENCHMARK_STATIC_LIB}"
+                                     INTERFACE_INCLUDE_DIRECTORIES
+                                     "${GBENCHMARK_INCLUDE_DIR}"
+                                     INTERFACE_COMPILE_DEFINITIONS
+                                     "BENCHMARK_STATIC_DEFINE")
+
+    add_library(benchmark::benchmark_main STATIC IMPORTED)
+    set_target_properties(benchmark::benchmark_main
+                          PROPERTIES IMPORTED_LOCATION "${GBENCHMARK_MAIN_STATIC_LIB}"
+                                     INTERFACE_INCLUDE_DIRECTORIES
+                                     "${GBENCHMARK_INCLUDE_DIR}")
+    add_dependencies(benchmark::benchmark gbenchmark_ep)
+    add_dependencies(benchmark::benchmark_main gbenchmark_ep)
+
+    find_package(Threads REQUIRED)
+    set(GBENCHMARK_LINK_TOOLCHAIN benchmark::benchmark_main benchmark::benchmark
+                                  Threads::Threads)
+endmacro()
+
 macro(build_tbb)
     message(STATUS "Building Tbb from source")
 
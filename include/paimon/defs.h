@@ -144,6 +144,18 @@ struct PAIMON_EXPORT Options {
     /// compaction of manifest, default value is 16MB.
     static const char MANIFEST_FULL_COMPACTION_FILE_SIZE[];
 
+    /// "manifest.cache.max-memory-size" - Max memory size of the process-wide cache of manifest
+    /// files, manifest lists and index manifest files, which are immutable once written. Repeated
+    /// scans and commits on the same snapshot read these files from memory. The cache is shared by
+    /// all tables in the process, its capacity is the largest value configured by any of them.
+    /// Default value is 0, which disables the cache.
+    static const char MANIFEST_CACHE_MAX_MEMORY_SIZE[];
+
+    /// "lookup.cache-max-memory-size" - Max memory size of the in-memory lookup structures of data
+    /// files cached by a `TableQuery`. Least recently used files are evicted when the cache is
+    /// full. Default value is 256MB.
+    static const char LOOKUP_CACHE_MAX_MEMORY_SIZE[];
+
     /// "source.split.target-size" - Target size of a source split when scanning a bucket. Default
     /// value is 128MB.
     static const char SOURCE_SPLIT_TARGET_SIZE[];
@@ -172,6 +184,70 @@ struct PAIMON_EXPORT Options {
     /// on-disk file. The default value is 256 mb
     static const char WRITE_BUFFER_SIZE[];
 
+    /// "write-buffer-spillable" - Whether the write buffer of primary key tables can be spilled to
+    /// local disk. When enabled, a full write buffer is sorted and spilled as a compressed sorted
+    /// run instead of being flushed as a level 0 file, and all spilled runs are merged into level 0
+    /// files at the next flush. Default value is false.
+    static const char WRITE_BUFFER_SPILLABLE[];
+
+    /// "write-buffer-spill.max-disk-size" - The max disk size of the spilled runs of a writer, a
+    /// full write buffer is flushed instead of spilled once it is reached. Default value is
+    /// unlimited.
+    static const char WRITE_BUFFER_SPILL_MAX_DISK_SIZE[];
+
+    /// "write-buffer-spill.dir" - The local directory of the spilled runs, which should be on a
+    /// disk large enough for "write-buffer-spill.max-disk-size" rather than a memory-backed file
+    /// system. Default value is the temp directory of the system.
+    static const char WRITE_BUFFER_SPILL_DIR[];
+
+    /// "write.total-buffer-size" - Total memory of the write buffers of all bucket writers of a
+    /// write, including the row groups or stripes buffered by open data files of append tables.
+    /// When it is exceeded, the writer occupying the most memory is flushed (or spilled if
+    /// "write-buffer-spillable" is true) until the total fits again. Default value is unlimited.
+    static const char WRITE_TOTAL_BUFFER_SIZE[];
+
+    /// "write-only" - If set to true, compactions and snapshot expiration will be skipped. This
+    /// option is used along with dedicated compact jobs. Default value is false.
+    static const char WRITE_ONLY[];
+
+    /// "write.prepare-commit.parallelism" - Max number of bucket writers flushed concurrently on
+    /// the write executor when preparing a commit. A value of 1 flushes writers one by one in the
+    /// calling thread. Default value is 4.
+    static const char WRITE_PREPARE_COMMIT_PARALLELISM[];
+
+    /// "num-sorted-run.compaction-trigger" - The sorted run number to trigger compaction. Includes
+    /// level0 files (one file one sorted run) and high-level runs (one level one sorted run).
+    /// Default value is 5.
+    static const char NUM_SORTED_RUNS_COMPACTION_TRIGGER[];
+
+    /// "num-sorted-run.stop-trigger" - The number of sorted runs that trigger the stopping of
+    /// writes, writes will wait for the running compaction to finish. Default value is
+    /// "num-sorted-run.compaction-trigger" + 3.
+    static const char NUM_SORTED_RUNS_STOP_TRIGGER[];
+
+    /// "num-levels" - Total level number, for example, there are 3 levels, including 0, 1, 2
+    /// levels. Default value is "num-sorted-run.compaction-trigger" + 1.
+    static const char NUM_LEVELS[];
+
+    /// "compaction.max-size-amplification-percent" - The size amplification is defined as the
+    /// amount (in percentage) of additional storage needed to store a single byte of data in the
+    /// merge tree for changelog mode table. Default value is 200.
+    static const char COMPACTION_MAX_SIZE_AMPLIFICATION_PERCENT[];
+
+    /// "compaction.size-ratio" - Percentage flexibility while comparing sorted run size for
+    /// changelog mode table. If the candidate sorted run(s) size is 1% smaller than the next
+    /// sorted run's size, then include next sorted run into this candidate set. Default value is 1.
+    static const char COMPACTION_SIZE_RATIO[];
+
+    /// "compaction.min.file-num" - For file set [f_0,...,f_N], the minimum file number to trigger
+    /// a compaction for append-only table. Default value is 5.
+    static const char COMPACTION_MIN_FILE_NUM[];
+
+    /// "compaction.max.file-num" - For file set [f_0,...,f_N], the maximum file number to trigger
+    /// a compaction for append-only table, even if sum(size(f_i)) < targetFileSize. This value
+    /// avoids pending too much small files. Default value is 50.
+    static const char COMPACTION_MAX_FILE_NUM[];
+
     /// "snapshot.num-retained.min" - The minimum number of completed snapshots to retain. Should be
     /// greater than or equal to 1. Default value is 10
     static const char SNAPSHOT_NUM_RETAINED_MIN[];
@@ -258,6 +334,29 @@ struct PAIMON_EXPORT Options {
 
     /// "file-index.read.enabled" - Whether enabled read file index. Default value is "true".
     static const char FILE_INDEX_READ_ENABLED[];
+    /// "file-index.in-manifest-threshold" - The threshold to store file index bytes in manifest,
+    /// larger file indexes are written to separate index files. Default value is 500 bytes.
+    static const char FILE_INDEX_IN_MANIFEST_THRESHOLD[];
+
+    /// @name File Index Options
+    /// File indexes are built while writing data files of append tables, configured by:
+    /// - file-index.$index_type.columns (columns to build index of $index_type, split with
+    /// FIELDS_SEPARATOR)
+    /// - file-index.$index_type.$column_name.$option (option of index of a column)
+    /// - file-index.$index_type.$option (option of index of all columns)
+    ///
+    /// examples:
+    /// - file-index.bloom-filter.columns = f0,f1
+    /// - file-index.bloom-filter.f0.fpp = 0.01
+    /// - file-index.bitmap.columns = f2
+    ///
+    /// @{
+
+    /// FILE_INDEX_PREFIX is "file-index"
+    static const char FILE_INDEX_PREFIX[];
+    /// FILE_INDEX_COLUMNS is "columns"
+    static const char FILE_INDEX_COLUMNS[];
+    /// @}
 
     /// "data-file.external-paths" - The external paths where the data of this table will be
     /// written, multiple elements separated by commas.
@@ -287,6 +386,17 @@ struct PAIMON_EXPORT Options {
     /// "global-index.external-path" - Global index root directory, if not set, the global index
     /// files will be stored under the index directory.
     static const char GLOBAL_INDEX_EXTERNAL_PATH[];
+    /// "global-index.build.shard-rows" - Maximum number of rows of an index shard when building
+    /// global index for a row range. A larger range is split into shards which are read and
+    /// built concurrently. Default value is unlimited, which builds the range as one shard.
+    static const char GLOBAL_INDEX_BUILD_SHARD_ROWS[];
+    /// "global-index.build.parallelism" - Maximum number of index shards built concurrently.
+    /// Default value is 4.
+    static const char GLOBAL_INDEX_BUILD_PARALLELISM[];
+    /// "global-index.build.max-memory" - Memory of the memory pool used by concurrent index shard
+    /// builders. No more shard builder is started while it is exceeded, while at least one shard
+    /// is always being built. Default value is unlimited.
+    static const char GLOBAL_INDEX_BUILD_MAX_MEMORY[];
 };
 
 static constexpr int64_t BATCH_WRITE_COMMIT_IDENTIFIER = std::numeric_limits<int64_t>::max();
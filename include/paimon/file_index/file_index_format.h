@@ -17,17 +17,20 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "paimon/file_index/file_index_reader.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/result.h"
 #include "paimon/visibility.h"
 
 struct ArrowSchema;
 
 namespace paimon {
+class Bytes;
 class InputStream;
 class MemoryPool;
 
@@ -96,6 +99,16 @@ class PAIMON_EXPORT FileIndexFormat {
     static Result<std::unique_ptr<Reader>> CreateReader(
         const std::shared_ptr<InputStream>& input_stream, const std::shared_ptr<MemoryPool>& pool);
 
+    /// Serializes indexes of a data file into a index file.
+    ///
+    /// @param indexes Serialized indexes keyed by column name and index type, an empty (or null)
+    ///                index is written with `EMPTY_INDEX_FLAG`.
+    /// @param pool Memory pool for the returned bytes.
+    /// @return The bytes of the index file, or an error if a column or index name is too long.
+    static Result<PAIMON_UNIQUE_PTR<Bytes>> Write(
+        const std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>>& indexes,
+        const std::shared_ptr<MemoryPool>& pool);
+
  public:
     static const int64_t MAGIC;
     static const int32_t EMPTY_INDEX_FLAG;
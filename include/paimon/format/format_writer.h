@@ -63,6 +63,14 @@ class PAIMON_EXPORT FormatWriter {
     /// @return Error status returned if calculating the length fails.
     virtual Result<bool> ReachTargetSize(bool suggested_check, int64_t target_size) const = 0;
 
+    /// Get the memory occupied by data buffered in the writer, such as the open row group or
+    /// stripe, which is only released when the file is finished.
+    ///
+    /// @return The estimated buffered size in bytes, 0 if the writer does not buffer data.
+    virtual int64_t GetBufferedSize() const {
+        return 0;
+    }
+
     /// Get metrics of the writer
     /// @return The accumulated writer metrics to current state.
     virtual std::shared_ptr<Metrics> GetWriterMetrics() const = 0;
@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "paimon/global_index/global_index_result.h"
@@ -44,6 +45,13 @@ class PAIMON_EXPORT GlobalIndexReader : public FunctionVisitor<std::shared_ptr<G
     /// BitmapGlobalIndexReader call `VisitVectorSearch`).
     virtual Result<std::shared_ptr<VectorSearchGlobalIndexResult>> VisitVectorSearch(
         const std::shared_ptr<VectorSearch>& vector_search) = 0;
+
+    /// @return The distance metric of the indexed vectors, which decides how scores of
+    /// `VisitVectorSearch` are ordered, or std::nullopt if the index does not support vector
+    /// search.
+    virtual std::optional<VectorSearch::DistanceType> GetDistanceType() const {
+        return std::nullopt;
+    }
 };
 
 }  // namespace paimon
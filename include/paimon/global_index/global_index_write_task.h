@@ -34,6 +34,9 @@ class PAIMON_EXPORT GlobalIndexWriteTask {
     ~GlobalIndexWriteTask() = delete;
     /// Builds and writes a global index for the specified data range.
     ///
+    /// A range longer than `global-index.build.shard-rows` is split into shards, which are read
+    /// and built concurrently, each shard producing its own index files.
+    ///
     /// @param table_path   Path to the table root directory where index files are stored.
     /// @param field_name   Name of the indexed column (must be present in the table schema).
     /// @param index_type   Type of global index to build (e.g., "bitmap", "lumina").
@@ -21,16 +21,41 @@
 #include <memory>
 #include <string>
 
+#include "paimon/result.h"
+#include "paimon/status.h"
 #include "paimon/type_fwd.h"
 
 namespace paimon {
 
+/// Summary statistics of a histogram metric.
+///
+/// Histograms are kept in a fixed number of log-linear buckets, so percentiles are approximate
+/// with a relative error of at most 1/16 of the true value. `count`, `min`, `max` and `mean` are
+/// exact.
+struct PAIMON_EXPORT HistogramStats {
+    /// Number of recorded values.
+    uint64_t count = 0;
+    /// Smallest recorded value, 0 if no value has been recorded.
+    uint64_t min = 0;
+    /// Largest recorded value, 0 if no value has been recorded.
+    uint64_t max = 0;
+    /// Arithmetic mean of all recorded values.
+    double mean = 0.0;
+    /// Approximate 50th percentile.
+    uint64_t p50 = 0;
+    /// Approximate 95th percentile.
+    uint64_t p95 = 0;
+    /// Approximate 99th percentile.
+    uint64_t p99 = 0;
+};
+
 /// Abstract interface for collecting and managing performance metrics in Paimon operations.
 ///
 /// This class provides a unified interface for tracking various performance metrics
 /// such as counters for read/write operations, I/O statistics, and other operational
-/// measurements. It serves as the base class for concrete implementations like `MetricsImpl`.
-// TODO(yonghao.fyh): add histogram in the future
+/// measurements. Besides counters, it maintains histograms for distributions such as latencies
+/// (e.g. per-batch read latency or per-attempt commit duration). It serves as the base class for
+/// concrete implementations like `MetricsImpl`.
 class PAIMON_EXPORT Metrics {
  public:
     virtual ~Metrics() = default;
@@ -49,9 +74,32 @@ class PAIMON_EXPORT Metrics {
     /// @return A map containing all metric names and their current values.
     virtual std::map<std::string, uint64_t> GetAllCounters() const = 0;
 
+    /// Record a value into a histogram metric, creating the histogram if it does not exist.
+    /// @param metric_name The name/key of the histogram.
+    /// @param value The value to record, e.g., a latency in microseconds.
+    /// @note The default implementation ignores the value, for implementations without
+    /// histograms.
+    virtual void ObserveHistogram(const std::string& metric_name, uint64_t value) {}
+
+    /// Get the summary statistics of a specific histogram metric.
+    /// @param metric_name The name/key of the histogram to retrieve.
+    /// @return The statistics of the histogram, or `Status::KeyError` if it doesn't exist. The
+    /// default implementation returns `Status::NotImplemented`.
+    virtual Result<HistogramStats> GetHistogram(const std::string& metric_name) const {
+        return Status::NotImplemented("histogram is not supported by this metrics");
+    }
+
+    /// Get the summary statistics of all histogram metrics as a map.
+    /// @return A map containing all histogram names and their statistics. The default
+    /// implementation returns an empty map.
+    virtual std::map<std::string, HistogramStats> GetAllHistograms() const {
+        return {};
+    }
+
     /// Merge metrics from another Metrics instance into this one.
     ///
-    /// For metrics that exist in both instances, the values are added together.
+    /// For counters that exist in both instances, the values are added together.
+    /// For histograms that exist in both instances, the recorded distributions are combined.
     /// For metrics that only exist in the other instance, they are copied over.
     /// This operation is useful for aggregating metrics from multiple sources.
     ///
@@ -61,7 +109,8 @@ class PAIMON_EXPORT Metrics {
 
     /// Convert all metrics to a JSON string representation.
     /// @return A JSON string containing all metric names and values, e.g.,
-    /// `{"metric1":100,"metric2":200}`.
+    /// `{"metric1":100,"metric2":200}`. Histograms are rendered as nested objects, e.g.,
+    /// `{"latency":{"count":2,"min":1,"max":3,"mean":2.0,"p50":1,"p95":3,"p99":3}}`.
     virtual std::string ToString() const = 0;
 };
 
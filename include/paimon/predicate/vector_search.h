@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "paimon/predicate/predicate.h"
+#include "paimon/utils/roaring_bitmap64.h"
 #include "paimon/visibility.h"
 
 namespace paimon {
@@ -57,6 +58,15 @@ struct PAIMON_EXPORT VectorSearch {
                                               distance_type, options);
     }
 
+    /// Replaces the pre-filter with a bitmap of selected **local row ids**.
+    std::shared_ptr<VectorSearch> ReplacePreFilterBitmap(
+        const std::shared_ptr<const RoaringBitmap64>& _pre_filter_bitmap) const {
+        auto vector_search = std::make_shared<VectorSearch>(
+            field_name, limit, query, /*_pre_filter=*/nullptr, predicate, distance_type, options);
+        vector_search->pre_filter_bitmap = _pre_filter_bitmap;
+        return vector_search;
+    }
+
     /// Search field name.
     std::string field_name;
     /// Number of top results to return.
@@ -65,6 +75,11 @@ struct PAIMON_EXPORT VectorSearch {
     std::vector<float> query;
     /// A pre-filter based on **local row ids**, implemented by leveraging other global index
     std::function<bool(int64_t)> pre_filter;
+    /// The bitmap form of `pre_filter`: only the **local row ids** in the bitmap are included in
+    /// vector search. Index readers test it without an indirect call per candidate and skip the
+    /// search entirely when no indexed row survives. At most one of `pre_filter` and
+    /// `pre_filter_bitmap` can be set, a search with both is rejected.
+    std::shared_ptr<const RoaringBitmap64> pre_filter_bitmap;
     /// A runtime filtering condition that may involve graph traversal of
     /// structured attributes. **Using this parameter often yields better
     /// filtering accuracy** because during index construction, the underlying
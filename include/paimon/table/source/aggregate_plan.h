@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "paimon/predicate/literal.h"
+#include "paimon/table/source/plan.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+/// An aggregate function which `TableScan` may answer from file metadata.
+class PAIMON_EXPORT AggregateCall {
+ public:
+    enum class Kind {
+        /// `COUNT(*)`, result is a `BIGINT` literal.
+        COUNT_STAR = 1,
+        /// `MIN(field)`, result has the type of the field.
+        MIN = 2,
+        /// `MAX(field)`, result has the type of the field.
+        MAX = 3,
+    };
+
+    /// Create a `COUNT(*)` aggregate.
+    static AggregateCall CountStar() {
+        return AggregateCall(Kind::COUNT_STAR, "");
+    }
+
+    /// Create a `MIN(field)` aggregate.
+    /// @param field_name Name of the aggregated field.
+    static AggregateCall Min(const std::string& field_name) {
+        return AggregateCall(Kind::MIN, field_name);
+    }
+
+    /// Create a `MAX(field)` aggregate.
+    /// @param field_name Name of the aggregated field.
+    static AggregateCall Max(const std::string& field_name) {
+        return AggregateCall(Kind::MAX, field_name);
+    }
+
+    Kind GetKind() const {
+        return kind_;
+    }
+
+    /// Name of the aggregated field, empty for `COUNT(*)`.
+    const std::string& GetFieldName() const {
+        return field_name_;
+    }
+
+ private:
+    AggregateCall(Kind kind, std::string field_name)
+        : kind_(kind), field_name_(std::move(field_name)) {}
+
+    Kind kind_;
+    std::string field_name_;
+};
+
+/// %Result plan of `TableScan::CreateAggregatePlan()`.
+///
+/// Every split of the scanned snapshot is either answered from metadata (row count, value stats
+/// and deletion vector cardinality of its data files) or left in `Splits()`. The final result of
+/// an aggregate is `PartialResults()` combined with the same aggregate computed by reading
+/// `Splits()`: sum for `COUNT(*)`, min or max for `MIN` and `MAX`.
+class PAIMON_EXPORT AggregatePlan : public Plan {
+ public:
+    /// Results of the answered splits, one literal for each requested aggregate in order. `MIN`
+    /// and `MAX` are null literals if no answered split contains a non-null value.
+    virtual const std::vector<Literal>& PartialResults() const = 0;
+
+    /// Whether `PartialResults()` are the final results, i.e. no split needs to be read.
+    bool IsExact() const {
+        return Splits().empty();
+    }
+};
+}  // namespace paimon
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/read_context.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/table/source/split.h"
+#include "paimon/visibility.h"
+
+struct ArrowArray;
+struct ArrowSchema;
+
+namespace paimon {
+class ReadContext;
+
+/// Point lookup of a primary-key table. Given a batch of primary keys of a bucket, `TableQuery`
+/// returns their latest values, merged by the merge engine of the table as a full read of the
+/// bucket would do. Only files whose key range contains a key are looked up, each of them is
+/// loaded once into a cached in-memory lookup structure (see
+/// `Options::LOOKUP_CACHE_MAX_MEMORY_SIZE`), so the cost of a lookup depends on the number of
+/// candidate files rather than the size of the bucket.
+///
+/// @note `TableQuery` is not thread-safe.
+class PAIMON_EXPORT TableQuery {
+ public:
+    virtual ~TableQuery() = default;
+
+    /// Create an instance of `TableQuery`.
+    ///
+    /// @param context A unique pointer to the `ReadContext`, the read schema of which decides the
+    /// fields of lookup results. Predicate and prefetch settings are ignored.
+    /// @return A Result containing a unique pointer to the `TableQuery` instance.
+    static Result<std::unique_ptr<TableQuery>> Create(std::unique_ptr<ReadContext> context);
+
+    /// Set the data files to look up from, files set by previous calls are replaced.
+    ///
+    /// @param splits Splits of a full batch scan of the table (e.g., `TableScan` with
+    /// `StartupMode::LatestFull()`), all data files of a bucket are expected to be included.
+    /// @return Status indicating whether the operation was successful or not.
+    virtual Status RefreshFiles(const std::vector<std::shared_ptr<Split>>& splits) = 0;
+
+    /// Look up the latest values of keys in a bucket.
+    ///
+    /// @param partition Partition of the bucket, e.g., {{"dt", "20240101"}}.
+    /// @param bucket Bucket of the keys.
+    /// @param keys A struct array of keys, which contains all primary key fields except partition
+    /// keys. Other fields are ignored. It is released by this method.
+    /// @param key_schema Schema of `keys`, it is released by this method.
+    /// @return A Result containing a struct array in the read schema with one row for each key in
+    /// order. The row is null if the key does not exist or is deleted.
+    virtual Result<BatchReader::ReadBatch> Lookup(
+        const std::map<std::string, std::string>& partition, int32_t bucket, ArrowArray* keys,
+        ArrowSchema* key_schema) = 0;
+};
+}  // namespace paimon
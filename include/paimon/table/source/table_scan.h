@@ -17,8 +17,10 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "paimon/result.h"
+#include "paimon/table/source/aggregate_plan.h"
 #include "paimon/table/source/plan.h"
 #include "paimon/type_fwd.h"
 #include "paimon/visibility.h"
@@ -41,5 +43,15 @@ class PAIMON_EXPORT TableScan {
     ///
     /// @return A Result containing a shared pointer to the created `Plan` or an error status.
     virtual Result<std::shared_ptr<Plan>> CreatePlan() = 0;
+
+    /// Create a scan plan which answers `aggregates` from file metadata where it is provably
+    /// exact, and keeps the splits which still need to be read. Like `CreatePlan()`, it consumes
+    /// the scan.
+    ///
+    /// @param aggregates Aggregates to answer, all of them must be over the whole filtered scan.
+    /// @return A Result containing the created `AggregatePlan`, or NotImplemented if the scan does
+    ///         not support aggregate pushdown.
+    virtual Result<std::shared_ptr<AggregatePlan>> CreateAggregatePlan(
+        const std::vector<AggregateCall>& aggregates);
 };
 }  // namespace paimon
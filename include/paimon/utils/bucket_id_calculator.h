@@ -16,7 +16,9 @@
 
 #pragma once
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include "paimon/memory/memory_pool.h"
 #include "paimon/result.h"
@@ -32,7 +34,8 @@ class MemoryPool;
 /// Calculator for determining bucket ids based on the given bucket keys.
 ///
 /// @note `BucketIdCalculator` is compatible with the Java implementation and uses
-/// hash-based distribution to ensure even data distribution across buckets.
+/// hash-based distribution to ensure even data distribution across buckets. The hash is computed
+/// column by column from the arrow buffers, without materializing a row per record.
 class PAIMON_EXPORT BucketIdCalculator {
  public:
     /// Create `BucketIdCalculator` with custom memory pool.
@@ -57,6 +60,17 @@ class PAIMON_EXPORT BucketIdCalculator {
     Status CalculateBucketIds(ArrowArray* bucket_keys, ArrowSchema* bucket_schema,
                               int32_t* bucket_ids) const;
 
+    /// Calculate bucket ids for the given bucket keys and split the rows into per-bucket
+    /// selection vectors.
+    /// @param bucket_keys Arrow struct array containing the bucket key values.
+    /// @param bucket_schema Arrow schema describing the structure of bucket_keys.
+    /// @param bucket_selections Output map from bucket id to the ascending indices of the rows in
+    /// that bucket, buckets without any row are absent.
+    /// @note bucket_keys and bucket_schema have the same requirements as in
+    /// `CalculateBucketIds()`.
+    Status SplitByBucket(ArrowArray* bucket_keys, ArrowSchema* bucket_schema,
+                         std::map<int32_t, std::vector<int32_t>>* bucket_selections) const;
+
  private:
     BucketIdCalculator(int32_t num_buckets, const std::shared_ptr<MemoryPool>& pool)
         : num_buckets_(num_buckets), pool_(pool) {}
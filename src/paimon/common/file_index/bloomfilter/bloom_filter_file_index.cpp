@@ -19,8 +19,12 @@
 #include <cstddef>
 #include <functional>
 #include <utility>
+#include <vector>
 
+#include "arrow/array/array_nested.h"
 #include "fmt/format.h"
+#include "paimon/common/predicate/literal_converter.h"
+#include "paimon/common/utils/options_utils.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/memory/bytes.h"
 #include "paimon/predicate/literal.h"
@@ -29,7 +33,9 @@
 namespace paimon {
 class MemoryPool;
 
-BloomFilterFileIndex::BloomFilterFileIndex(const std::map<std::string, std::string>& options) {}
+BloomFilterFileIndex::BloomFilterFileIndex(const std::map<std::string, std::string>& options)
+    : options_(options) {}
+
 Result<std::shared_ptr<FileIndexReader>> BloomFilterFileIndex::CreateReader(
     ::ArrowSchema* c_arrow_schema, int32_t start, int32_t length,
     const std::shared_ptr<InputStream>& input_stream,
@@ -56,6 +62,84 @@ Result<std::shared_ptr<FileIndexReader>> BloomFilterFileIndex::CreateReader(
     return BloomFilterFileIndexReader::Create(arrow_type, bytes);
 }
 
+Result<std::shared_ptr<FileIndexWriter>> BloomFilterFileIndex::CreateWriter(
+    ::ArrowSchema* c_arrow_schema, const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for BloomFilterFileIndexWriter, supposed to have single "
+            "field.");
+    }
+    return BloomFilterFileIndexWriter::Create(arrow_schema->field(0), options_, pool);
+}
+
+Result<std::shared_ptr<BloomFilterFileIndexWriter>> BloomFilterFileIndexWriter::Create(
+    const std::shared_ptr<arrow::Field>& arrow_field,
+    const std::map<std::string, std::string>& options, const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(FastHash::HashFunction hash_function,
+                           FastHash::GetHashFunction(arrow_field->type()));
+    PAIMON_ASSIGN_OR_RAISE(
+        int64_t items, OptionsUtils::GetValueFromMap<int64_t>(options, BloomFilterFileIndex::ITEMS,
+                                                              BloomFilterFileIndex::DEFAULT_ITEMS));
+    PAIMON_ASSIGN_OR_RAISE(
+        double fpp, OptionsUtils::GetValueFromMap<double>(options, BloomFilterFileIndex::FPP,
+                                                          BloomFilterFileIndex::DEFAULT_FPP));
+    if (items <= 0 || fpp <= 0 || fpp >= 1) {
+        return Status::Invalid(fmt::format(
+            "invalid options for bloom filter index, items {} must be positive and fpp {} must be "
+            "in (0, 1)",
+            items, fpp));
+    }
+    return std::shared_ptr<BloomFilterFileIndexWriter>(new BloomFilterFileIndexWriter(
+        arrow::struct_({arrow_field}), hash_function, items, fpp, pool));
+}
+
+BloomFilterFileIndexWriter::BloomFilterFileIndexWriter(
+    const std::shared_ptr<arrow::DataType>& struct_type,
+    const FastHash::HashFunction& hash_function, int64_t items, double fpp,
+    const std::shared_ptr<MemoryPool>& pool)
+    : struct_type_(struct_type),
+      hash_function_(hash_function),
+      pool_(pool),
+      filter_(items, fpp, pool) {}
+
+Status BloomFilterFileIndexWriter::AddBatch(::ArrowArray* batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
+                                      arrow::ImportArray(batch, struct_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
+    if (!struct_array || struct_array->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid batch for BloomFilterFileIndexWriter, supposed to be struct array with "
+            "single field.");
+    }
+    // literals refer to the array data, which outlives them
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<Literal> array_values,
+        LiteralConverter::ConvertLiteralsFromArray(*(struct_array->field(0)), /*own_data=*/false));
+    for (const auto& value : array_values) {
+        if (!value.IsNull()) {
+            filter_.AddHash(hash_function_(value));
+        }
+    }
+    return Status::OK();
+}
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> BloomFilterFileIndexWriter::SerializedBytes() const {
+    const auto& bit_set = filter_.GetBitSet();
+    int32_t num_bytes = bit_set.BitSize() / 8;
+    auto bytes = Bytes::AllocateBytes(sizeof(int32_t) + num_bytes, pool_.get());
+    // compatible with java, big endian
+    auto num_hash_functions = static_cast<uint32_t>(filter_.GetNumHashFunctions());
+    char* data = bytes->data();
+    data[0] = static_cast<char>(num_hash_functions >> 24);
+    data[1] = static_cast<char>(num_hash_functions >> 16);
+    data[2] = static_cast<char>(num_hash_functions >> 8);
+    data[3] = static_cast<char>(num_hash_functions);
+    bit_set.ToByteArray(data + sizeof(int32_t), num_bytes);
+    return bytes;
+}
+
 Result<std::shared_ptr<BloomFilterFileIndexReader>> BloomFilterFileIndexReader::Create(
     const std::shared_ptr<arrow::DataType>& arrow_type, const std::shared_ptr<Bytes>& bytes) {
     // compatible with java, little endian
@@ -27,7 +27,9 @@
 #include "paimon/common/utils/bloom_filter64.h"
 #include "paimon/file_index/file_index_reader.h"
 #include "paimon/file_index/file_index_result.h"
+#include "paimon/file_index/file_index_writer.h"
 #include "paimon/file_index/file_indexer.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/result.h"
 namespace paimon {
 class Bytes;
@@ -53,11 +55,42 @@ class BloomFilterFileIndex : public FileIndexer {
         const std::shared_ptr<MemoryPool>& pool) const override;
 
     Result<std::shared_ptr<FileIndexWriter>> CreateWriter(
-        ::ArrowSchema* arrow_schema, const std::shared_ptr<MemoryPool>& pool) const override {
-        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::DataType> arrow_type,
-                                          arrow::ImportType(arrow_schema));
-        return Status::NotImplemented("do not support index writer in bloom filter");
-    }
+        ::ArrowSchema* arrow_schema, const std::shared_ptr<MemoryPool>& pool) const override;
+
+    /// Expected number of distinct values of a data file.
+    static constexpr char ITEMS[] = "items";
+    /// Expected false positive probability.
+    static constexpr char FPP[] = "fpp";
+    static constexpr int64_t DEFAULT_ITEMS = 1000000;
+    static constexpr double DEFAULT_FPP = 0.1;
+
+ private:
+    std::map<std::string, std::string> options_;
+};
+
+class BloomFilterFileIndexWriter : public FileIndexWriter {
+ public:
+    static Result<std::shared_ptr<BloomFilterFileIndexWriter>> Create(
+        const std::shared_ptr<arrow::Field>& arrow_field,
+        const std::map<std::string, std::string>& options, const std::shared_ptr<MemoryPool>& pool);
+
+    Status AddBatch(::ArrowArray* batch) override;
+
+    /// Serialized as the number of hash functions (big-endian int32) followed by the bit set.
+    Result<PAIMON_UNIQUE_PTR<Bytes>> SerializedBytes() const override;
+
+ private:
+    BloomFilterFileIndexWriter(const std::shared_ptr<arrow::DataType>& struct_type,
+                               const FastHash::HashFunction& hash_function, int64_t items,
+                               double fpp, const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    /// @note struct_type_ contains only one field with the indexed type, used for import from C
+    /// ArrowArray
+    std::shared_ptr<arrow::DataType> struct_type_;
+    FastHash::HashFunction hash_function_;
+    std::shared_ptr<MemoryPool> pool_;
+    BloomFilter64 filter_;
 };
 
 class BloomFilterFileIndexReader : public FileIndexReader {
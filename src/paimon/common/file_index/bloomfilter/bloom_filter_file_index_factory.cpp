@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "paimon/common/file_index/bloomfilter/bloom_filter_file_index.h"
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index.h"
 #include "paimon/factories/factory_creator.h"
 
 namespace paimon {
@@ -32,4 +33,13 @@ Result<std::unique_ptr<FileIndexer>> BloomFilterFileIndexFactory::Create(
 
 REGISTER_PAIMON_FACTORY(BloomFilterFileIndexFactory);
 
+const char SplitBlockBloomFilterFileIndexFactory::IDENTIFIER[] = "split-block-bloom-filter";
+
+Result<std::unique_ptr<FileIndexer>> SplitBlockBloomFilterFileIndexFactory::Create(
+    const std::map<std::string, std::string>& options) const {
+    return std::make_unique<SplitBlockBloomFilterFileIndex>(options);
+}
+
+REGISTER_PAIMON_FACTORY(SplitBlockBloomFilterFileIndexFactory);
+
 }  // namespace paimon
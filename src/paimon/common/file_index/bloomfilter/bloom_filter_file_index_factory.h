@@ -37,4 +37,17 @@ class BloomFilterFileIndexFactory : public FileIndexerFactory {
         const std::map<std::string, std::string>& options) const override;
 };
 
+/// Factory of the split block bloom filter index, which has a different format from
+/// "bloom-filter" and is not readable by Java paimon.
+class SplitBlockBloomFilterFileIndexFactory : public FileIndexerFactory {
+ public:
+    static const char IDENTIFIER[];
+
+    const char* Identifier() const override {
+        return IDENTIFIER;
+    }
+    Result<std::unique_ptr<FileIndexer>> Create(
+        const std::map<std::string, std::string>& options) const override;
+};
+
 }  // namespace paimon
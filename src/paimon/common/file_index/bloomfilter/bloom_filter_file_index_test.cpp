@@ -16,10 +16,16 @@
 
 #include "paimon/common/file_index/bloomfilter/bloom_filter_file_index.h"
 
+#include <map>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
 #include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/field_type_utils.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/defs.h"
@@ -47,6 +53,23 @@ class BloomFilterIndexReaderTest : public ::testing::Test {
         return c_schema;
     }
 
+    Result<PAIMON_UNIQUE_PTR<Bytes>> WriteIndex(const std::shared_ptr<arrow::DataType>& type,
+                                                const std::map<std::string, std::string>& options,
+                                                const std::string& data_json) const {
+        auto arrow_schema = arrow::schema({arrow::field("f0", type)});
+        BloomFilterFileIndex file_index(options);
+        ArrowSchema c_schema;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*arrow_schema, &c_schema));
+        PAIMON_ASSIGN_OR_RAISE(auto writer, file_index.CreateWriter(&c_schema, pool_));
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+            auto array, arrow::ipc::internal::json::ArrayFromJSON(
+                            arrow::struct_(arrow_schema->fields()), data_json));
+        ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        PAIMON_RETURN_NOT_OK(writer->AddBatch(&c_array));
+        return writer->SerializedBytes();
+    }
+
  private:
     std::shared_ptr<MemoryPool> pool_;
 };
@@ -174,4 +197,32 @@ TEST_F(BloomFilterIndexReaderTest, TestTimestampType) {
     ASSERT_TRUE(reader->VisitEqual(Literal(Timestamp(-1725l, 123000))).value()->IsRemain().value());
 }
 
+TEST_F(BloomFilterIndexReaderTest, TestWriteAndRead) {
+    auto type = arrow::int32();
+    std::map<std::string, std::string> options = {{BloomFilterFileIndex::ITEMS, "100"},
+                                                  {BloomFilterFileIndex::FPP, "0.01"}};
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> index_bytes,
+                         WriteIndex(type, options, "[[1], [2], [null], [-1], [123]]"));
+    auto input_stream =
+        std::make_shared<ByteArrayInputStream>(index_bytes->data(), index_bytes->size());
+    BloomFilterFileIndex file_index({});
+    ASSERT_OK_AND_ASSIGN(
+        auto reader,
+        file_index.CreateReader(CreateArrowSchema(type).get(), /*start=*/0,
+                                /*length=*/index_bytes->size(), input_stream, pool_));
+    for (int32_t value : {1, 2, -1, 123}) {
+        ASSERT_TRUE(reader->VisitEqual(Literal(value)).value()->IsRemain().value());
+    }
+    int32_t skipped = 0;
+    for (int32_t value = 1000; value < 1100; value++) {
+        if (!reader->VisitEqual(Literal(value)).value()->IsRemain().value()) {
+            skipped++;
+        }
+    }
+    ASSERT_GT(skipped, 0);
+
+    ASSERT_NOK_WITH_MSG(WriteIndex(type, {{BloomFilterFileIndex::FPP, "1.5"}}, "[[1]]"),
+                        "invalid options for bloom filter index");
+}
+
 }  // namespace paimon::test
@@ -19,8 +19,10 @@
 #include <cassert>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <utility>
 
+#include "arrow/array/array_binary.h"
 #include "fmt/format.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/field_type_utils.h"
@@ -93,6 +95,81 @@ Result<FastHash::HashFunction> FastHash::GetHashFunction(
     }
 }
 
+Status FastHash::HashArray(const arrow::Array& array, int64_t* hashes) {
+    PAIMON_ASSIGN_OR_RAISE(FieldType field_type,
+                           FieldTypeUtils::ConvertToFieldType(array.type_id()));
+    auto identity = [](auto value) -> int64_t { return static_cast<int64_t>(value); };
+    switch (field_type) {
+        case FieldType::TINYINT:
+            HashPrimitiveArray<arrow::Int8Type>(array, identity, hashes);
+            return Status::OK();
+        case FieldType::SMALLINT:
+            HashPrimitiveArray<arrow::Int16Type>(array, identity, hashes);
+            return Status::OK();
+        case FieldType::DATE:
+            HashPrimitiveArray<arrow::Date32Type>(array, identity, hashes);
+            return Status::OK();
+        case FieldType::INT:
+            HashPrimitiveArray<arrow::Int32Type>(array, identity, hashes);
+            return Status::OK();
+        case FieldType::BIGINT:
+            HashPrimitiveArray<arrow::Int64Type>(array, identity, hashes);
+            return Status::OK();
+        case FieldType::FLOAT:
+            HashPrimitiveArray<arrow::FloatType>(
+                array,
+                [](float value) -> int64_t {
+                    int32_t bits = 0;
+                    std::memcpy(&bits, &value, sizeof(value));
+                    return bits;
+                },
+                hashes);
+            return Status::OK();
+        case FieldType::DOUBLE:
+            HashPrimitiveArray<arrow::DoubleType>(
+                array,
+                [](double value) -> int64_t {
+                    int64_t bits = 0;
+                    std::memcpy(&bits, &value, sizeof(value));
+                    return bits;
+                },
+                hashes);
+            return Status::OK();
+        case FieldType::TIMESTAMP: {
+            auto ts_type =
+                arrow::internal::checked_pointer_cast<arrow::TimestampType>(array.type());
+            int32_t precision = DateTimeUtils::GetPrecisionFromType(ts_type);
+            DateTimeUtils::TimeType time_type = DateTimeUtils::GetTimeTypeFromArrowType(ts_type);
+            // same as the timestamp literal converted from array
+            HashPrimitiveArray<arrow::TimestampType>(
+                array,
+                [precision, time_type](int64_t value) -> int64_t {
+                    auto [milli, nano] = DateTimeUtils::TimestampConverter(
+                        value, time_type, DateTimeUtils::TimeType::MILLISECOND,
+                        DateTimeUtils::TimeType::NANOSECOND);
+                    Timestamp timestamp(milli, nano);
+                    return precision <= Timestamp::MILLIS_PRECISION ? timestamp.GetMillisecond()
+                                                                     : timestamp.ToMicrosecond();
+                },
+                hashes);
+            return Status::OK();
+        }
+        case FieldType::STRING:
+        case FieldType::BINARY: {
+            const auto& binary_array =
+                arrow::internal::checked_cast<const arrow::BinaryArray&>(array);
+            for (int64_t i = 0; i < binary_array.length(); i++) {
+                std::string_view value = binary_array.GetView(i);
+                hashes[i] = Hash64(value.data(), value.size());
+            }
+            return Status::OK();
+        }
+        default:
+            return Status::Invalid(fmt::format("bloom filter index does not support {}",
+                                               FieldTypeUtils::FieldTypeToString(field_type)));
+    }
+}
+
 int64_t FastHash::GetLongHash(int64_t key) {
     key = (~key) + (key << 21);  // key = (key << 21) - key - 1;
     key = key ^ (key >> 24);
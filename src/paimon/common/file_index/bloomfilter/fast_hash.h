@@ -21,10 +21,14 @@
 #include <functional>
 #include <memory>
 
+#include "arrow/array.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "paimon/file_index/file_index_result.h"
 #include "paimon/predicate/literal.h"
 #include "paimon/result.h"
+#include "paimon/status.h"
 
 namespace paimon {
 /// Hash literal to 64 bits hash code.
@@ -38,10 +42,27 @@ class FastHash {
 
     static Result<HashFunction> GetHashFunction(const std::shared_ptr<arrow::DataType>& arrow_type);
 
- private:
+    /// Hashes all values of `array` into `hashes` (at least `array.length()` elements), which
+    /// equals to hashing the literals of the values with `GetHashFunction()`, without
+    /// materializing literals. Hashes of null values are undefined.
+    static Status HashArray(const arrow::Array& array, int64_t* hashes);
+
     // Thomas Wang's integer hash function
     // http://web.archive.org/web/20071223173210/http://www.concentric.net/~Ttwang/tech/inthash.htm
     static int64_t GetLongHash(int64_t key);
+
+ private:
     static int64_t Hash64(const char* data, size_t length);
+
+    template <typename ArrowType, typename Converter>
+    static void HashPrimitiveArray(const arrow::Array& array, Converter converter,
+                                   int64_t* hashes) {
+        using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
+        const auto& typed_array = arrow::internal::checked_cast<const ArrayType&>(array);
+        const auto* values = typed_array.raw_values();
+        for (int64_t i = 0; i < typed_array.length(); i++) {
+            hashes[i] = GetLongHash(converter(values[i]));
+        }
+    }
 };
 }  // namespace paimon
@@ -20,7 +20,10 @@
 #include <string>
 #include <vector>
 
+#include "arrow/api.h"
+#include "arrow/ipc/json_simple.h"
 #include "gtest/gtest.h"
+#include "paimon/common/predicate/literal_converter.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/defs.h"
 #include "paimon/file_index/file_index_result.h"
@@ -162,4 +165,44 @@ TEST_F(FastHashTest, TestCompatibleWithJava) {
     }
 }
 
+TEST_F(FastHashTest, TestHashArray) {
+    auto check_array = [](const std::shared_ptr<arrow::DataType>& type,
+                          const std::string& data_json) {
+        auto array = arrow::ipc::internal::json::ArrayFromJSON(type, data_json).ValueOrDie();
+        ASSERT_OK_AND_ASSIGN(auto hash_function, FastHash::GetHashFunction(type));
+        ASSERT_OK_AND_ASSIGN(std::vector<Literal> literals,
+                             LiteralConverter::ConvertLiteralsFromArray(*array, /*own_data=*/true));
+        // hash of sliced array starts from the offset
+        for (int64_t offset : {0, 1}) {
+            auto sliced = array->Slice(offset);
+            std::vector<int64_t> hashes(sliced->length());
+            ASSERT_OK(FastHash::HashArray(*sliced, hashes.data()));
+            for (int64_t i = 0; i < sliced->length(); i++) {
+                if (!sliced->IsNull(i)) {
+                    ASSERT_EQ(hash_function(literals[i + offset]), hashes[i])
+                        << type->ToString() << " " << i;
+                }
+            }
+        }
+    };
+    check_array(arrow::int8(), "[-128, null, -1, 0, 1, 127]");
+    check_array(arrow::int16(), "[-32768, -1, null, 0, 1, 32767]");
+    check_array(arrow::int32(), "[-2147483648, -1, 0, null, 1, 2147483647]");
+    check_array(arrow::int64(), "[-9223372036854775808, -1, 0, 1, null, 9223372036854775807]");
+    check_array(arrow::date32(), "[-10, 0, 19000, null]");
+    check_array(arrow::float32(), "[-1.5, 0.0, null, 3.25]");
+    check_array(arrow::float64(), "[-1.5, 0.0, 3.25, null, 1e100]");
+    check_array(arrow::utf8(), R"(["", "a", null, "hello world"])");
+    check_array(arrow::binary(), R"(["", "abc", null, "xyz"])");
+    for (auto unit : {arrow::TimeUnit::SECOND, arrow::TimeUnit::MILLI, arrow::TimeUnit::MICRO,
+                      arrow::TimeUnit::NANO}) {
+        check_array(arrow::timestamp(unit), "[-1765123, -1, 0, null, 1745542802000123]");
+    }
+
+    auto array = arrow::ipc::internal::json::ArrayFromJSON(arrow::boolean(), "[true]").ValueOrDie();
+    std::vector<int64_t> hashes(1);
+    ASSERT_NOK_WITH_MSG(FastHash::HashArray(*array, hashes.data()),
+                        "bloom filter index does not support");
+}
+
 }  // namespace paimon::test
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index.h"
+
+#include <cstring>
+#include <utility>
+
+#include "arrow/array/array_nested.h"
+#include "fmt/format.h"
+#include "paimon/common/file_index/bloomfilter/bloom_filter_file_index.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/options_utils.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+SplitBlockBloomFilterFileIndex::SplitBlockBloomFilterFileIndex(
+    const std::map<std::string, std::string>& options)
+    : options_(options) {}
+
+Result<std::shared_ptr<FileIndexReader>> SplitBlockBloomFilterFileIndex::CreateReader(
+    ::ArrowSchema* c_arrow_schema, int32_t start, int32_t length,
+    const std::shared_ptr<InputStream>& input_stream,
+    const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for SplitBlockBloomFilterFileIndexReader, supposed to have single "
+            "field.");
+    }
+    auto arrow_type = arrow_schema->field(0)->type();
+    int32_t blocks_length = length - static_cast<int32_t>(sizeof(int8_t));
+    if (blocks_length <= 0 || blocks_length % SplitBlockBloomFilter::BYTES_PER_BLOCK != 0) {
+        return Status::Invalid(
+            fmt::format("invalid length {} of SplitBlockBloomFilterFileIndex", length));
+    }
+    PAIMON_RETURN_NOT_OK(input_stream->Seek(start, SeekOrigin::FS_SEEK_SET));
+    int8_t version = 0;
+    PAIMON_ASSIGN_OR_RAISE(int32_t version_read_len,
+                           input_stream->Read(reinterpret_cast<char*>(&version), sizeof(version)));
+    if (version_read_len != static_cast<int32_t>(sizeof(version)) || version > VERSION_1) {
+        return Status::Invalid(fmt::format(
+            "read split block bloom filter index fail, do not support version {}", version));
+    }
+    // blocks are read into a separate buffer to keep them aligned
+    auto bytes = std::make_shared<Bytes>(blocks_length, pool.get());
+    PAIMON_ASSIGN_OR_RAISE(int32_t actual_read_len,
+                           input_stream->Read(bytes->data(), bytes->size()));
+    if (static_cast<size_t>(actual_read_len) != bytes->size()) {
+        return Status::Invalid(
+            fmt::format("create reader for SplitBlockBloomFilterFileIndex failed, expected read "
+                        "len {}, actual read len {}",
+                        bytes->size(), actual_read_len));
+    }
+    return SplitBlockBloomFilterFileIndexReader::Create(arrow_type, bytes);
+}
+
+Result<std::shared_ptr<FileIndexWriter>> SplitBlockBloomFilterFileIndex::CreateWriter(
+    ::ArrowSchema* c_arrow_schema, const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for SplitBlockBloomFilterFileIndexWriter, supposed to have single "
+            "field.");
+    }
+    return SplitBlockBloomFilterFileIndexWriter::Create(arrow_schema->field(0), options_, pool);
+}
+
+Result<std::shared_ptr<SplitBlockBloomFilterFileIndexWriter>>
+SplitBlockBloomFilterFileIndexWriter::Create(const std::shared_ptr<arrow::Field>& arrow_field,
+                                             const std::map<std::string, std::string>& options,
+                                             const std::shared_ptr<MemoryPool>& pool) {
+    // check the type is supported
+    PAIMON_RETURN_NOT_OK(FastHash::GetHashFunction(arrow_field->type()));
+    PAIMON_ASSIGN_OR_RAISE(
+        int64_t items, OptionsUtils::GetValueFromMap<int64_t>(options, BloomFilterFileIndex::ITEMS,
+                                                              BloomFilterFileIndex::DEFAULT_ITEMS));
+    PAIMON_ASSIGN_OR_RAISE(
+        double fpp, OptionsUtils::GetValueFromMap<double>(options, BloomFilterFileIndex::FPP,
+                                                          BloomFilterFileIndex::DEFAULT_FPP));
+    if (items <= 0 || fpp <= 0 || fpp >= 1) {
+        return Status::Invalid(fmt::format(
+            "invalid options for split block bloom filter index, items {} must be positive and "
+            "fpp {} must be in (0, 1)",
+            items, fpp));
+    }
+    return std::shared_ptr<SplitBlockBloomFilterFileIndexWriter>(
+        new SplitBlockBloomFilterFileIndexWriter(arrow::struct_({arrow_field}), items, fpp, pool));
+}
+
+SplitBlockBloomFilterFileIndexWriter::SplitBlockBloomFilterFileIndexWriter(
+    const std::shared_ptr<arrow::DataType>& struct_type, int64_t items, double fpp,
+    const std::shared_ptr<MemoryPool>& pool)
+    : struct_type_(struct_type), pool_(pool), filter_(items, fpp, pool) {}
+
+Status SplitBlockBloomFilterFileIndexWriter::AddBatch(::ArrowArray* batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
+                                      arrow::ImportArray(batch, struct_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
+    if (!struct_array || struct_array->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid batch for SplitBlockBloomFilterFileIndexWriter, supposed to be struct array "
+            "with single field.");
+    }
+    const auto& values = *(struct_array->field(0));
+    hashes_.resize(values.length());
+    PAIMON_RETURN_NOT_OK(FastHash::HashArray(values, hashes_.data()));
+    if (values.null_count() == 0) {
+        filter_.AddHashes(hashes_.data(), values.length());
+        return Status::OK();
+    }
+    for (int64_t i = 0; i < values.length(); i++) {
+        if (!values.IsNull(i)) {
+            filter_.AddHash(hashes_[i]);
+        }
+    }
+    return Status::OK();
+}
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> SplitBlockBloomFilterFileIndexWriter::SerializedBytes() const {
+    const std::shared_ptr<Bytes>& blocks = filter_.GetBytes();
+    auto bytes = Bytes::AllocateBytes(sizeof(int8_t) + blocks->size(), pool_.get());
+    bytes->data()[0] = static_cast<char>(SplitBlockBloomFilterFileIndex::VERSION_1);
+    std::memcpy(bytes->data() + sizeof(int8_t), blocks->data(), blocks->size());
+    return bytes;
+}
+
+Result<std::shared_ptr<SplitBlockBloomFilterFileIndexReader>>
+SplitBlockBloomFilterFileIndexReader::Create(const std::shared_ptr<arrow::DataType>& arrow_type,
+                                             const std::shared_ptr<Bytes>& bytes) {
+    PAIMON_ASSIGN_OR_RAISE(FastHash::HashFunction hash_function,
+                           FastHash::GetHashFunction(arrow_type));
+    return std::shared_ptr<SplitBlockBloomFilterFileIndexReader>(
+        new SplitBlockBloomFilterFileIndexReader(hash_function, SplitBlockBloomFilter(bytes)));
+}
+
+SplitBlockBloomFilterFileIndexReader::SplitBlockBloomFilterFileIndexReader(
+    const FastHash::HashFunction& hash_function, SplitBlockBloomFilter&& filter)
+    : hash_function_(hash_function), filter_(std::move(filter)) {}
+
+Result<std::shared_ptr<FileIndexResult>> SplitBlockBloomFilterFileIndexReader::VisitEqual(
+    const Literal& literal) {
+    return literal.IsNull() || filter_.TestHash(hash_function_(literal)) ? FileIndexResult::Remain()
+                                                                         : FileIndexResult::Skip();
+}
+
+Result<std::shared_ptr<FileIndexResult>> SplitBlockBloomFilterFileIndexReader::VisitIn(
+    const std::vector<Literal>& literals) {
+    std::vector<int64_t> hashes;
+    hashes.reserve(literals.size());
+    for (const auto& literal : literals) {
+        if (literal.IsNull()) {
+            return FileIndexResult::Remain();
+        }
+        hashes.push_back(hash_function_(literal));
+    }
+    std::vector<uint8_t> results(hashes.size());
+    filter_.TestHashes(hashes.data(), hashes.size(), results.data());
+    for (uint8_t result : results) {
+        if (result) {
+            return FileIndexResult::Remain();
+        }
+    }
+    return FileIndexResult::Skip();
+}
+
+}  // namespace paimon
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/c/bridge.h"
+#include "paimon/common/file_index/bloomfilter/fast_hash.h"
+#include "paimon/common/utils/split_block_bloom_filter.h"
+#include "paimon/file_index/file_index_reader.h"
+#include "paimon/file_index/file_index_result.h"
+#include "paimon/file_index/file_index_writer.h"
+#include "paimon/file_index/file_indexer.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class InputStream;
+class Literal;
+class MemoryPool;
+
+/// Split block bloom filter for file index.
+///
+/// @note This class use `SplitBlockBloomFilter` as a base filter, which probes a single cache
+/// line per key. Store a version (one byte) and the blocks only. Values are hashed the same as
+/// `BloomFilterFileIndex`. Supports the same options as `BloomFilterFileIndex`.
+class SplitBlockBloomFilterFileIndex : public FileIndexer {
+ public:
+    explicit SplitBlockBloomFilterFileIndex(const std::map<std::string, std::string>& options);
+    ~SplitBlockBloomFilterFileIndex() override = default;
+
+    Result<std::shared_ptr<FileIndexReader>> CreateReader(
+        ::ArrowSchema* arrow_schema, int32_t start, int32_t length,
+        const std::shared_ptr<InputStream>& input_stream,
+        const std::shared_ptr<MemoryPool>& pool) const override;
+
+    Result<std::shared_ptr<FileIndexWriter>> CreateWriter(
+        ::ArrowSchema* arrow_schema, const std::shared_ptr<MemoryPool>& pool) const override;
+
+    static constexpr int8_t VERSION_1 = 1;
+
+ private:
+    std::map<std::string, std::string> options_;
+};
+
+class SplitBlockBloomFilterFileIndexWriter : public FileIndexWriter {
+ public:
+    static Result<std::shared_ptr<SplitBlockBloomFilterFileIndexWriter>> Create(
+        const std::shared_ptr<arrow::Field>& arrow_field,
+        const std::map<std::string, std::string>& options, const std::shared_ptr<MemoryPool>& pool);
+
+    Status AddBatch(::ArrowArray* batch) override;
+
+    Result<PAIMON_UNIQUE_PTR<Bytes>> SerializedBytes() const override;
+
+ private:
+    SplitBlockBloomFilterFileIndexWriter(const std::shared_ptr<arrow::DataType>& struct_type,
+                                         int64_t items, double fpp,
+                                         const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    /// @note struct_type_ contains only one field with the indexed type, used for import from C
+    /// ArrowArray
+    std::shared_ptr<arrow::DataType> struct_type_;
+    std::shared_ptr<MemoryPool> pool_;
+    SplitBlockBloomFilter filter_;
+    std::vector<int64_t> hashes_;
+};
+
+class SplitBlockBloomFilterFileIndexReader : public FileIndexReader {
+ public:
+    static Result<std::shared_ptr<SplitBlockBloomFilterFileIndexReader>> Create(
+        const std::shared_ptr<arrow::DataType>& arrow_type, const std::shared_ptr<Bytes>& bytes);
+
+    Result<std::shared_ptr<FileIndexResult>> VisitEqual(const Literal& literal) override;
+
+    Result<std::shared_ptr<FileIndexResult>> VisitIn(const std::vector<Literal>& literals) override;
+
+ private:
+    SplitBlockBloomFilterFileIndexReader(const FastHash::HashFunction& hash_function,
+                                         SplitBlockBloomFilter&& filter);
+
+ private:
+    FastHash::HashFunction hash_function_;
+    SplitBlockBloomFilter filter_;
+};
+}  // namespace paimon
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class SplitBlockBloomFilterFileIndexTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+    }
+    void TearDown() override {
+        pool_.reset();
+    }
+
+    std::unique_ptr<::ArrowSchema> CreateArrowSchema(
+        const std::shared_ptr<arrow::DataType>& data_type) const {
+        auto schema = arrow::schema({arrow::field("f0", data_type)});
+        auto c_schema = std::make_unique<::ArrowSchema>();
+        EXPECT_TRUE(arrow::ExportSchema(*schema, c_schema.get()).ok());
+        return c_schema;
+    }
+
+    Result<PAIMON_UNIQUE_PTR<Bytes>> WriteIndex(const std::shared_ptr<arrow::DataType>& type,
+                                                const std::map<std::string, std::string>& options,
+                                                const std::string& data_json) const {
+        auto arrow_schema = arrow::schema({arrow::field("f0", type)});
+        SplitBlockBloomFilterFileIndex file_index(options);
+        ArrowSchema c_schema;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*arrow_schema, &c_schema));
+        PAIMON_ASSIGN_OR_RAISE(auto writer, file_index.CreateWriter(&c_schema, pool_));
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+            auto array, arrow::ipc::internal::json::ArrayFromJSON(
+                            arrow::struct_(arrow_schema->fields()), data_json));
+        ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        PAIMON_RETURN_NOT_OK(writer->AddBatch(&c_array));
+        return writer->SerializedBytes();
+    }
+
+    Result<std::shared_ptr<FileIndexReader>> CreateReader(
+        const std::shared_ptr<arrow::DataType>& type, const Bytes& index_bytes) const {
+        auto input_stream =
+            std::make_shared<ByteArrayInputStream>(index_bytes.data(), index_bytes.size());
+        SplitBlockBloomFilterFileIndex file_index({});
+        return file_index.CreateReader(CreateArrowSchema(type).get(), /*start=*/0,
+                                       /*length=*/index_bytes.size(), input_stream, pool_);
+    }
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_F(SplitBlockBloomFilterFileIndexTest, TestIntegerType) {
+    auto type = arrow::int64();
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> index_bytes,
+                         WriteIndex(type, {{"items", "100"}, {"fpp", "0.01"}},
+                                    "[[1], [2], [null], [-1], [123]]"));
+    ASSERT_EQ(SplitBlockBloomFilterFileIndex::VERSION_1, index_bytes->data()[0]);
+    ASSERT_OK_AND_ASSIGN(auto reader, CreateReader(type, *index_bytes));
+    for (int64_t value : {1, 2, -1, 123}) {
+        ASSERT_TRUE(reader->VisitEqual(Literal(value)).value()->IsRemain().value());
+    }
+    ASSERT_TRUE(reader->VisitEqual(Literal(FieldType::BIGINT)).value()->IsRemain().value());
+    int32_t skipped = 0;
+    for (int64_t value = 1000; value < 1100; value++) {
+        if (!reader->VisitEqual(Literal(value)).value()->IsRemain().value()) {
+            skipped++;
+        }
+    }
+    ASSERT_GT(skipped, 0);
+
+    // in is remained if any of the literals is remained
+    std::vector<Literal> literals;
+    for (int64_t value = 1000; value < 1100; value++) {
+        literals.emplace_back(value);
+    }
+    ASSERT_EQ(skipped < 100, reader->VisitIn(literals).value()->IsRemain().value());
+    literals.emplace_back(static_cast<int64_t>(123));
+    ASSERT_TRUE(reader->VisitIn(literals).value()->IsRemain().value());
+}
+
+TEST_F(SplitBlockBloomFilterFileIndexTest, TestStringType) {
+    auto type = arrow::utf8();
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> index_bytes,
+                         WriteIndex(type, {}, R"([["a"], ["b"], [""], [null]])"));
+    ASSERT_OK_AND_ASSIGN(auto reader, CreateReader(type, *index_bytes));
+    ASSERT_TRUE(reader->VisitEqual(Literal(FieldType::STRING, "a", 1)).value()->IsRemain().value());
+    ASSERT_TRUE(reader->VisitEqual(Literal(FieldType::STRING, "b", 1)).value()->IsRemain().value());
+    ASSERT_TRUE(reader->VisitEqual(Literal(FieldType::STRING, "", 0)).value()->IsRemain().value());
+    ASSERT_TRUE(reader->VisitIn({Literal(FieldType::STRING, "x", 1), Literal(FieldType::STRING)})
+                    .value()
+                    ->IsRemain()
+                    .value());
+}
+
+TEST_F(SplitBlockBloomFilterFileIndexTest, TestInvalid) {
+    ASSERT_NOK_WITH_MSG(WriteIndex(arrow::int32(), {{"fpp", "0"}}, "[[1]]"),
+                        "invalid options for split block bloom filter index");
+    ASSERT_NOK_WITH_MSG(WriteIndex(arrow::boolean(), {}, "[[true]]"),
+                        "bloom filter index does not support");
+    auto bytes = std::make_unique<Bytes>(10, GetDefaultPool().get());
+    ASSERT_NOK_WITH_MSG(CreateReader(arrow::int32(), *bytes),
+                        "invalid length 10 of SplitBlockBloomFilterFileIndex");
+}
+
+}  // namespace paimon::test
@@ -16,11 +16,16 @@
 
 #include "paimon/common/file_index/bsi/bit_slice_index_bitmap_file_index.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 
+#include "arrow/array/array_nested.h"
 #include "fmt/format.h"
 #include "paimon/common/file_index/bsi/bit_slice_index_roaring_bitmap.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
+#include "paimon/common/predicate/literal_converter.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/field_type_utils.h"
 #include "paimon/data/timestamp.h"
@@ -89,6 +94,18 @@ Result<std::shared_ptr<FileIndexReader>> BitSliceIndexBitmapFileIndex::CreateRea
                                                                 negative);
 }
 
+Result<std::shared_ptr<FileIndexWriter>> BitSliceIndexBitmapFileIndex::CreateWriter(
+    ::ArrowSchema* c_arrow_schema, const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for BitSliceIndexBitmapFileIndexWriter, supposed to have single "
+            "field.");
+    }
+    return BitSliceIndexBitmapFileIndexWriter::Create(arrow_schema->field(0), pool);
+}
+
 // precondition, literal is not null
 Result<BitSliceIndexBitmapFileIndex::ValueMapperType> BitSliceIndexBitmapFileIndex::GetValueMapper(
     const std::shared_ptr<arrow::DataType>& arrow_type) {
@@ -289,4 +306,76 @@ Result<std::shared_ptr<FileIndexResult>> BitSliceIndexBitmapFileIndexReader::Vis
     return std::make_shared<BitmapIndexResult>(bitmap_supplier);
 }
 
+Result<std::shared_ptr<BitSliceIndexBitmapFileIndexWriter>>
+BitSliceIndexBitmapFileIndexWriter::Create(const std::shared_ptr<arrow::Field>& arrow_field,
+                                           const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(BitSliceIndexBitmapFileIndex::ValueMapperType value_mapper,
+                           BitSliceIndexBitmapFileIndex::GetValueMapper(arrow_field->type()));
+    return std::shared_ptr<BitSliceIndexBitmapFileIndexWriter>(
+        new BitSliceIndexBitmapFileIndexWriter(arrow::struct_({arrow_field}), value_mapper, pool));
+}
+
+BitSliceIndexBitmapFileIndexWriter::BitSliceIndexBitmapFileIndexWriter(
+    const std::shared_ptr<arrow::DataType>& struct_type,
+    const BitSliceIndexBitmapFileIndex::ValueMapperType& value_mapper,
+    const std::shared_ptr<MemoryPool>& pool)
+    : struct_type_(struct_type), value_mapper_(value_mapper), pool_(pool) {}
+
+Status BitSliceIndexBitmapFileIndexWriter::AddBatch(::ArrowArray* batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
+                                      arrow::ImportArray(batch, struct_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
+    if (!struct_array || struct_array->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid batch for BitSliceIndexBitmapFileIndexWriter, supposed to be struct array "
+            "with single field.");
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<Literal> array_values,
+        LiteralConverter::ConvertLiteralsFromArray(*(struct_array->field(0)), /*own_data=*/false));
+    for (const auto& literal : array_values) {
+        if (!literal.IsNull()) {
+            PAIMON_ASSIGN_OR_RAISE(int64_t value, value_mapper_(literal));
+            if (value == std::numeric_limits<int64_t>::min()) {
+                return Status::Invalid(
+                    fmt::format("value {} is not supported by bsi index", value));
+            }
+            IndexedValues& indexed_values = value >= 0 ? positive_ : negative_;
+            value = value >= 0 ? value : -value;
+            indexed_values.values.emplace_back(row_number_, value);
+            indexed_values.min = std::min(indexed_values.min, value);
+            indexed_values.max = std::max(indexed_values.max, value);
+        }
+        row_number_++;
+    }
+    return Status::OK();
+}
+
+Result<std::shared_ptr<Bytes>> BitSliceIndexBitmapFileIndexWriter::IndexedValues::Serialize(
+    const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BitSliceIndexRoaringBitmap::Appender> appender,
+                           BitSliceIndexRoaringBitmap::Appender::Create(min, max));
+    for (const auto& [row_id, value] : values) {
+        PAIMON_RETURN_NOT_OK(appender->Append(row_id, value));
+    }
+    return appender->Serialize(pool);
+}
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> BitSliceIndexBitmapFileIndexWriter::SerializedBytes() const {
+    MemorySegmentOutputStream output_stream(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE,
+                                            pool_);
+    output_stream.WriteValue<int8_t>(BitSliceIndexBitmapFileIndex::VERSION_1);
+    output_stream.WriteValue<int32_t>(row_number_);
+    for (const IndexedValues* indexed_values : {&positive_, &negative_}) {
+        bool not_empty = !indexed_values->values.empty();
+        output_stream.WriteValue<bool>(not_empty);
+        if (not_empty) {
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Bytes> bytes, indexed_values->Serialize(pool_));
+            output_stream.WriteBytes(bytes);
+        }
+    }
+    return MemorySegmentUtils::CopyToBytes(output_stream.Segments(), /*offset=*/0,
+                                           /*num_bytes=*/output_stream.CurrentSize(), pool_.get());
+}
+
 }  // namespace paimon
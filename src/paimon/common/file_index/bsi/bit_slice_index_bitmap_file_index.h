@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -29,7 +30,9 @@
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/file_index/file_index_reader.h"
 #include "paimon/file_index/file_index_result.h"
+#include "paimon/file_index/file_index_writer.h"
 #include "paimon/file_index/file_indexer.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/predicate/literal.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
@@ -52,18 +55,16 @@ class BitSliceIndexBitmapFileIndex : public FileIndexer {
         const std::shared_ptr<MemoryPool>& pool) const override;
 
     Result<std::shared_ptr<FileIndexWriter>> CreateWriter(
-        ::ArrowSchema* arrow_schema, const std::shared_ptr<MemoryPool>& pool) const override {
-        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::DataType> arrow_type,
-                                          arrow::ImportType(arrow_schema));
-        return Status::NotImplemented("do not support index writer in bsi");
-    }
+        ::ArrowSchema* arrow_schema, const std::shared_ptr<MemoryPool>& pool) const override;
 
     using ValueMapperType = std::function<Result<int64_t>(const Literal& literal)>;
 
- private:
     static Result<ValueMapperType> GetValueMapper(
         const std::shared_ptr<arrow::DataType>& arrow_type);
 
+    static constexpr int8_t VERSION_1 = 1;
+
+ private:
     template <typename T>
     static Result<int64_t> GetValueFromLiteral(const Literal& literal) {
         if (literal.IsNull()) {
@@ -72,9 +73,43 @@ class BitSliceIndexBitmapFileIndex : public FileIndexer {
         }
         return static_cast<int64_t>(literal.GetValue<T>());
     }
+};
+
+/// Collects values of a data file, non-negative values are indexed by a positive BSI and negative
+/// values are indexed by a negative BSI of their absolute values.
+class BitSliceIndexBitmapFileIndexWriter : public FileIndexWriter {
+ public:
+    static Result<std::shared_ptr<BitSliceIndexBitmapFileIndexWriter>> Create(
+        const std::shared_ptr<arrow::Field>& arrow_field, const std::shared_ptr<MemoryPool>& pool);
+
+    Status AddBatch(::ArrowArray* batch) override;
+
+    Result<PAIMON_UNIQUE_PTR<Bytes>> SerializedBytes() const override;
 
  private:
-    static constexpr int8_t VERSION_1 = 1;
+    BitSliceIndexBitmapFileIndexWriter(
+        const std::shared_ptr<arrow::DataType>& struct_type,
+        const BitSliceIndexBitmapFileIndex::ValueMapperType& value_mapper,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    /// Values with row ids, sorted by row id.
+    struct IndexedValues {
+        Result<std::shared_ptr<Bytes>> Serialize(const std::shared_ptr<MemoryPool>& pool) const;
+
+        std::vector<std::pair<int32_t, int64_t>> values;
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = 0;
+    };
+
+ private:
+    /// @note struct_type_ contains only one field with the indexed type, used for import from C
+    /// ArrowArray
+    std::shared_ptr<arrow::DataType> struct_type_;
+    BitSliceIndexBitmapFileIndex::ValueMapperType value_mapper_;
+    std::shared_ptr<MemoryPool> pool_;
+    int32_t row_number_ = 0;
+    IndexedValues positive_;
+    IndexedValues negative_;
 };
 
 class BitSliceIndexBitmapFileIndexReader
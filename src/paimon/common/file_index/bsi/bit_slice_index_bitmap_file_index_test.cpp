@@ -18,7 +18,11 @@
 
 #include <utility>
 
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
 #include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/field_type_utils.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/defs.h"
@@ -57,6 +61,22 @@ class BitSliceIndexBitmapIndexReaderTest : public ::testing::Test {
             << ", expected=" << RoaringBitmap32::From(expected).ToString();
     }
 
+    Result<PAIMON_UNIQUE_PTR<Bytes>> WriteIndex(const std::shared_ptr<arrow::DataType>& type,
+                                                const std::string& data_json) const {
+        auto arrow_schema = arrow::schema({arrow::field("f0", type)});
+        BitSliceIndexBitmapFileIndex file_index({});
+        ArrowSchema c_schema;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*arrow_schema, &c_schema));
+        PAIMON_ASSIGN_OR_RAISE(auto writer, file_index.CreateWriter(&c_schema, pool_));
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+            auto array, arrow::ipc::internal::json::ArrayFromJSON(
+                            arrow::struct_(arrow_schema->fields()), data_json));
+        ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        PAIMON_RETURN_NOT_OK(writer->AddBatch(&c_array));
+        return writer->SerializedBytes();
+    }
+
  private:
     std::shared_ptr<MemoryPool> pool_;
 };
@@ -116,6 +136,41 @@ TEST_F(BitSliceIndexBitmapIndexReaderTest, TestMix) {
     CheckResult(reader->VisitGreaterOrEqual(Literal(2)).value(), {1, 7, 9});
 }
 
+TEST_F(BitSliceIndexBitmapIndexReaderTest, TestWriteAndRead) {
+    auto type = arrow::int32();
+    auto create_reader = [&](const Bytes& index_bytes) {
+        auto input_stream =
+            std::make_shared<ByteArrayInputStream>(index_bytes.data(), index_bytes.size());
+        BitSliceIndexBitmapFileIndex file_index({});
+        return file_index.CreateReader(CreateArrowSchema(type).get(), /*start=*/0,
+                                       /*length=*/index_bytes.size(), input_stream, pool_);
+    };
+    {
+        // same data as TestMix
+        ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> index_bytes,
+                             WriteIndex(type,
+                                        "[[1], [2], [null], [-2], [-2], [-1], [null], [2], [0], "
+                                        "[5], [null]]"));
+        ASSERT_OK_AND_ASSIGN(auto reader, create_reader(*index_bytes));
+        CheckResult(reader->VisitEqual(Literal(2)).value(), {1, 7});
+        CheckResult(reader->VisitEqual(Literal(-2)).value(), {3, 4});
+        CheckResult(reader->VisitIsNull().value(), {2, 6, 10});
+        CheckResult(reader->VisitLessThan(Literal(-1)).value(), {3, 4});
+        CheckResult(reader->VisitGreaterOrEqual(Literal(2)).value(), {1, 7, 9});
+    }
+    {
+        // positive only
+        ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> index_bytes,
+                             WriteIndex(type, "[[0], [1], [null], [3]]"));
+        ASSERT_OK_AND_ASSIGN(auto reader, create_reader(*index_bytes));
+        CheckResult(reader->VisitLessThan(Literal(2)).value(), {0, 1});
+        CheckResult(reader->VisitIsNotNull().value(), {0, 1, 3});
+        CheckResult(reader->VisitEqual(Literal(-1)).value(), {});
+    }
+    ASSERT_NOK_WITH_MSG(WriteIndex(arrow::int64(), "[[-9223372036854775808]]"),
+                        "is not supported by bsi index");
+}
+
 TEST_F(BitSliceIndexBitmapIndexReaderTest, TestPositiveOnly) {
     // data: 0, 1, null, 3, 4, 5, 6, 0, null
     std::vector<char> index_bytes = {
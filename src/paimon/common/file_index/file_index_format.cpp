@@ -17,6 +17,7 @@
 #include "paimon/file_index/file_index_format.h"
 
 #include <cassert>
+#include <limits>
 #include <map>
 #include <unordered_map>
 #include <utility>
@@ -25,6 +26,8 @@
 #include "arrow/type.h"
 #include "fmt/format.h"
 #include "paimon/common/file_index/empty/empty_file_index_reader.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/file_index/file_indexer.h"
 #include "paimon/file_index/file_indexer_factory.h"
@@ -151,4 +154,67 @@ Result<std::unique_ptr<FileIndexFormat::Reader>> FileIndexFormat::CreateReader(
     const std::shared_ptr<InputStream>& input_stream, const std::shared_ptr<MemoryPool>& pool) {
     return FileIndexFormatReaderImpl::Create(input_stream, pool);
 }
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> FileIndexFormat::Write(
+    const std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>>& indexes,
+    const std::shared_ptr<MemoryPool>& pool) {
+    auto utf_length = [](const std::string& str) -> Result<int64_t> {
+        if (str.size() > std::numeric_limits<uint16_t>::max()) {
+            return Status::Invalid(fmt::format("name {} is too long for file index", str));
+        }
+        return sizeof(int16_t) + str.size();
+    };
+    // magic + version + head length + column number
+    int64_t head_length = 8 + 4 + 4 + 4;
+    for (const auto& [column_name, index_map] : indexes) {
+        PAIMON_ASSIGN_OR_RAISE(int64_t column_length, utf_length(column_name));
+        // column name + index number
+        head_length += column_length + 4;
+        for (const auto& [index_type, bytes] : index_map) {
+            PAIMON_ASSIGN_OR_RAISE(int64_t index_type_length, utf_length(index_type));
+            // index name + start pos + length
+            head_length += index_type_length + 4 + 4;
+        }
+    }
+    // redundant length
+    head_length += 4;
+
+    MemorySegmentOutputStream output_stream(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE,
+                                            pool);
+    output_stream.WriteValue<int64_t>(MAGIC);
+    output_stream.WriteValue<int32_t>(V_1);
+    output_stream.WriteValue<int32_t>(static_cast<int32_t>(head_length));
+    output_stream.WriteValue<int32_t>(static_cast<int32_t>(indexes.size()));
+    int64_t body_length = 0;
+    for (const auto& [column_name, index_map] : indexes) {
+        output_stream.WriteString(column_name);
+        output_stream.WriteValue<int32_t>(static_cast<int32_t>(index_map.size()));
+        for (const auto& [index_type, bytes] : index_map) {
+            output_stream.WriteString(index_type);
+            if (!bytes || bytes->size() == 0) {
+                output_stream.WriteValue<int32_t>(EMPTY_INDEX_FLAG);
+                output_stream.WriteValue<int32_t>(0);
+                continue;
+            }
+            int64_t start = head_length + body_length;
+            if (start + bytes->size() > std::numeric_limits<int32_t>::max()) {
+                return Status::Invalid("file index is too large, exceeds 2GB");
+            }
+            output_stream.WriteValue<int32_t>(static_cast<int32_t>(start));
+            output_stream.WriteValue<int32_t>(static_cast<int32_t>(bytes->size()));
+            body_length += bytes->size();
+        }
+    }
+    output_stream.WriteValue<int32_t>(0);
+    assert(output_stream.CurrentSize() == head_length);
+    for (const auto& [column_name, index_map] : indexes) {
+        for (const auto& [index_type, bytes] : index_map) {
+            if (bytes && bytes->size() > 0) {
+                output_stream.WriteBytes(bytes);
+            }
+        }
+    }
+    return MemorySegmentUtils::CopyToBytes(output_stream.Segments(), /*offset=*/0,
+                                           /*num_bytes=*/output_stream.CurrentSize(), pool.get());
+}
 }  // namespace paimon
@@ -15,7 +15,10 @@
  */
 #include "paimon/file_index/file_index_format.h"
 
+#include <cstring>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "paimon/common/file_index/bitmap/bitmap_file_index.h"
@@ -27,6 +30,7 @@
 #include "paimon/file_index/file_index_result.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/io/byte_array_input_stream.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/predicate/literal.h"
 #include "paimon/status.h"
@@ -149,6 +153,59 @@ TEST_F(FileIndexFormatTest, TestSimple) {
     }
 }
 
+TEST_F(FileIndexFormatTest, TestWrite) {
+    {
+        std::vector<char> expected = {0,  5,  78, 78, -48, 26, 53,  -82, 0,   0,   0,   1,
+                                      0,  0,  0,  47, 0,   0,  0,   1,   0,   2,   99,  49,
+                                      0,  0,  0,  1,  0,   5,  101, 109, 112, 116, 121, -1,
+                                      -1, -1, -1, 0,  0,   0,  0,   0,   0,   0,   0};
+        ASSERT_OK_AND_ASSIGN(auto index_file_bytes,
+                             FileIndexFormat::Write({{"c1", {{"empty", nullptr}}}}, pool_));
+        ASSERT_EQ(std::string(expected.data(), expected.size()),
+                  std::string(index_file_bytes->data(), index_file_bytes->size()));
+    }
+    {
+        // rewrite the bodies of the index file in TestSimple, the result should be the same
+        std::vector<uint8_t> index_file_bytes = {
+            0,   5,   78,  78,  208, 26,  53,  174, 0,   0,   0,   1,   0,   0,   0,   96,  0,
+            0,   0,   3,   0,   2,   102, 48,  0,   0,   0,   1,   0,   6,   98,  105, 116, 109,
+            97,  112, 0,   0,   0,   96,  0,   0,   0,   131, 0,   2,   102, 49,  0,   0,   0,
+            1,   0,   6,   98,  105, 116, 109, 97,  112, 0,   0,   0,   227, 0,   0,   0,   74,
+            0,   2,   102, 50,  0,   0,   0,   1,   0,   6,   98,  105, 116, 109, 97,  112, 0,
+            0,   1,   45,  0,   0,   0,   76,  0,   0,   0,   0,   1,   0,   0,   0,   8,   0,
+            0,   0,   5,   0,   0,   0,   0,   5,   65,  108, 105, 99,  101, 0,   0,   0,   0,
+            0,   0,   0,   4,   76,  117, 99,  121, 255, 255, 255, 251, 0,   0,   0,   3,   66,
+            111, 98,  0,   0,   0,   20,  0,   0,   0,   5,   69,  109, 105, 108, 121, 255, 255,
+            255, 253, 0,   0,   0,   4,   84,  111, 110, 121, 0,   0,   0,   40,  58,  48,  0,
+            0,   1,   0,   0,   0,   0,   0,   1,   0,   16,  0,   0,   0,   0,   0,   7,   0,
+            58,  48,  0,   0,   1,   0,   0,   0,   0,   0,   1,   0,   16,  0,   0,   0,   1,
+            0,   5,   0,   58,  48,  0,   0,   1,   0,   0,   0,   0,   0,   1,   0,   16,  0,
+            0,   0,   3,   0,   6,   0,   1,   0,   0,   0,   8,   0,   0,   0,   2,   0,   0,
+            0,   0,   20,  0,   0,   0,   0,   0,   0,   0,   10,  0,   0,   0,   22,  58,  48,
+            0,   0,   1,   0,   0,   0,   0,   0,   2,   0,   16,  0,   0,   0,   4,   0,   6,
+            0,   7,   0,   58,  48,  0,   0,   1,   0,   0,   0,   0,   0,   4,   0,   16,  0,
+            0,   0,   0,   0,   1,   0,   2,   0,   3,   0,   5,   0,   1,   0,   0,   0,   8,
+            0,   0,   0,   2,   1,   255, 255, 255, 248, 0,   0,   0,   0,   0,   0,   0,   0,
+            0,   0,   0,   1,   0,   0,   0,   22,  58,  48,  0,   0,   1,   0,   0,   0,   0,
+            0,   2,   0,   16,  0,   0,   0,   2,   0,   3,   0,   6,   0,   58,  48,  0,   0,
+            1,   0,   0,   0,   0,   0,   3,   0,   16,  0,   0,   0,   0,   0,   1,   0,   4,
+            0,   5,   0};
+        auto body = [&](int32_t start, int32_t length) {
+            auto bytes = std::make_shared<Bytes>(length, pool_.get());
+            memcpy(bytes->data(), index_file_bytes.data() + start, length);
+            return bytes;
+        };
+        ASSERT_OK_AND_ASSIGN(auto written_bytes,
+                             FileIndexFormat::Write({{"f0", {{"bitmap", body(96, 131)}}},
+                                                     {"f1", {{"bitmap", body(227, 74)}}},
+                                                     {"f2", {{"bitmap", body(301, 76)}}}},
+                                                    pool_));
+        ASSERT_EQ(std::string(reinterpret_cast<char*>(index_file_bytes.data()),
+                              index_file_bytes.size()),
+                  std::string(written_bytes->data(), written_bytes->size()));
+    }
+}
+
 // NOLINTNEXTLINE(google-readability-function-size)
 TEST_F(FileIndexFormatTest, TestBitmapIndexWithTimestamp) {
     auto schema = arrow::schema({
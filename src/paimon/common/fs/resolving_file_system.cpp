@@ -38,6 +38,14 @@ ResolvingFileSystem::ResolvingFileSystem(
     }
 }
 
+std::string ResolvingFileSystem::Identity() const {
+    std::string identity = default_fs_identifier_;
+    for (const auto& [scheme, identifier] : scheme_to_fs_identifier_) {
+        identity += ";" + scheme + "=" + identifier;
+    }
+    return identity;
+}
+
 Result<std::shared_ptr<FileSystem>> ResolvingFileSystem::GetRealFileSystem(
     const std::string& uri) const {
     PAIMON_ASSIGN_OR_RAISE(Path path, PathUtil::ToPath(uri));
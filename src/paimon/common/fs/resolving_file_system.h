@@ -53,6 +53,10 @@ class ResolvingFileSystem : public FileSystem {
         std::vector<std::unique_ptr<FileStatus>>* file_status_list) const override;
     Result<bool> Exists(const std::string& path) const override;
 
+    /// @return Identity of the file systems resolved by this instance, instances with the same
+    /// identity resolve a path to the same file system.
+    std::string Identity() const;
+
  private:
     Result<std::shared_ptr<FileSystem>> GetRealFileSystem(const std::string& uri) const;
 
@@ -0,0 +1,683 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/global_index/btree/btree_global_index.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
+#include "paimon/common/options/memory_size.h"
+#include "paimon/common/predicate/literal_converter.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/field_type_utils.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/global_index/bitmap_global_index_result.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/io/data_input_stream.h"
+
+namespace paimon {
+namespace {
+// int64 null bitmap offset, int32 null bitmap length, int64 block index offset, int32 block index
+// length, int8 version
+constexpr int64_t kFooterSize = 25;
+
+Status CheckKeyType(const FieldType& key_type) {
+    switch (key_type) {
+        case FieldType::BOOLEAN:
+        case FieldType::TINYINT:
+        case FieldType::SMALLINT:
+        case FieldType::INT:
+        case FieldType::BIGINT:
+        case FieldType::FLOAT:
+        case FieldType::DOUBLE:
+        case FieldType::STRING:
+        case FieldType::BINARY:
+        case FieldType::DATE:
+        case FieldType::TIMESTAMP:
+            return Status::OK();
+        default:
+            return Status::Invalid(fmt::format("not support field type {} in BTreeGlobalIndex",
+                                               FieldTypeUtils::FieldTypeToString(key_type)));
+    }
+}
+
+void WriteKey(const Literal& key, MemorySegmentOutputStream* out) {
+    switch (key.GetType()) {
+        case FieldType::BOOLEAN:
+            out->WriteValue<bool>(key.GetValue<bool>());
+            break;
+        case FieldType::TINYINT:
+            out->WriteValue<int8_t>(key.GetValue<int8_t>());
+            break;
+        case FieldType::SMALLINT:
+            out->WriteValue<int16_t>(key.GetValue<int16_t>());
+            break;
+        case FieldType::INT:
+        case FieldType::DATE:
+            out->WriteValue<int32_t>(key.GetValue<int32_t>());
+            break;
+        case FieldType::BIGINT:
+            out->WriteValue<int64_t>(key.GetValue<int64_t>());
+            break;
+        case FieldType::FLOAT:
+            out->WriteValue<float>(key.GetValue<float>());
+            break;
+        case FieldType::DOUBLE:
+            out->WriteValue<double>(key.GetValue<double>());
+            break;
+        case FieldType::STRING:
+        case FieldType::BINARY: {
+            auto value = key.GetValue<std::string>();
+            out->WriteValue<int32_t>(static_cast<int32_t>(value.size()));
+            out->Write(value.data(), value.size());
+            break;
+        }
+        case FieldType::TIMESTAMP: {
+            auto value = key.GetValue<Timestamp>();
+            out->WriteValue<int64_t>(value.GetMillisecond());
+            out->WriteValue<int32_t>(value.GetNanoOfMillisecond());
+            break;
+        }
+        default:
+            assert(false);
+    }
+}
+
+Result<Literal> ReadKey(const FieldType& key_type, const DataInputStream& in, MemoryPool* pool) {
+    switch (key_type) {
+        case FieldType::BOOLEAN: {
+            PAIMON_ASSIGN_OR_RAISE(bool value, in.ReadValue<bool>());
+            return Literal(value);
+        }
+        case FieldType::TINYINT: {
+            PAIMON_ASSIGN_OR_RAISE(int8_t value, in.ReadValue<int8_t>());
+            return Literal(value);
+        }
+        case FieldType::SMALLINT: {
+            PAIMON_ASSIGN_OR_RAISE(int16_t value, in.ReadValue<int16_t>());
+            return Literal(value);
+        }
+        case FieldType::INT: {
+            PAIMON_ASSIGN_OR_RAISE(int32_t value, in.ReadValue<int32_t>());
+            return Literal(value);
+        }
+        case FieldType::DATE: {
+            PAIMON_ASSIGN_OR_RAISE(int32_t value, in.ReadValue<int32_t>());
+            return Literal(FieldType::DATE, value);
+        }
+        case FieldType::BIGINT: {
+            PAIMON_ASSIGN_OR_RAISE(int64_t value, in.ReadValue<int64_t>());
+            return Literal(value);
+        }
+        case FieldType::FLOAT: {
+            PAIMON_ASSIGN_OR_RAISE(float value, in.ReadValue<float>());
+            return Literal(value);
+        }
+        case FieldType::DOUBLE: {
+            PAIMON_ASSIGN_OR_RAISE(double value, in.ReadValue<double>());
+            return Literal(value);
+        }
+        case FieldType::STRING:
+        case FieldType::BINARY: {
+            PAIMON_ASSIGN_OR_RAISE(int32_t length, in.ReadValue<int32_t>());
+            Bytes bytes(length, pool);
+            PAIMON_RETURN_NOT_OK(in.ReadBytes(&bytes));
+            return Literal(key_type, bytes.data(), bytes.size());
+        }
+        case FieldType::TIMESTAMP: {
+            PAIMON_ASSIGN_OR_RAISE(int64_t millisecond, in.ReadValue<int64_t>());
+            PAIMON_ASSIGN_OR_RAISE(int32_t nano_of_millisecond, in.ReadValue<int32_t>());
+            return Literal(Timestamp(millisecond, nano_of_millisecond));
+        }
+        default:
+            return Status::Invalid(fmt::format("not support field type {} in BTreeGlobalIndex",
+                                               FieldTypeUtils::FieldTypeToString(key_type)));
+    }
+}
+
+bool IsNaN(const Literal& key) {
+    switch (key.GetType()) {
+        case FieldType::FLOAT:
+            return std::isnan(key.GetValue<float>());
+        case FieldType::DOUBLE:
+            return std::isnan(key.GetValue<double>());
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+int32_t CompareFloatingKey(T lhs, T rhs) {
+    // total order, NaN is the largest and equals itself, -0.0 equals 0.0
+    bool lhs_nan = std::isnan(lhs);
+    bool rhs_nan = std::isnan(rhs);
+    if (lhs_nan || rhs_nan) {
+        return static_cast<int32_t>(lhs_nan) - static_cast<int32_t>(rhs_nan);
+    }
+    return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+}
+
+// Keys are compared after the literal is checked against the key type, which cannot fail.
+int32_t CompareKey(const Literal& lhs, const Literal& rhs) {
+    switch (lhs.GetType()) {
+        case FieldType::FLOAT:
+            return CompareFloatingKey(lhs.GetValue<float>(), rhs.GetValue<float>());
+        case FieldType::DOUBLE:
+            return CompareFloatingKey(lhs.GetValue<double>(), rhs.GetValue<double>());
+        default: {
+            Result<int32_t> result = lhs.CompareTo(rhs);
+            assert(result.ok());
+            return result.value_or(0);
+        }
+    }
+}
+
+Status WriteFully(OutputStream* out, const Bytes& bytes, uint64_t max_write_size) {
+    uint64_t total_write_size = 0;
+    while (total_write_size < bytes.size()) {
+        uint64_t current_write_size = std::min(bytes.size() - total_write_size, max_write_size);
+        PAIMON_ASSIGN_OR_RAISE(int32_t actual_size,
+                               out->Write(bytes.data() + total_write_size,
+                                          static_cast<uint32_t>(current_write_size)));
+        if (static_cast<uint64_t>(actual_size) != current_write_size) {
+            return Status::IOError(fmt::format("expect write len {} mismatch actual write len {}",
+                                               current_write_size, actual_size));
+        }
+        total_write_size += current_write_size;
+    }
+    return Status::OK();
+}
+
+// Returns the smallest string greater than all strings starting with `prefix`, or std::nullopt if
+// there is no such string.
+std::optional<std::string> PrefixUpperBound(std::string prefix) {
+    while (!prefix.empty() && static_cast<uint8_t>(prefix.back()) == 0xff) {
+        prefix.pop_back();
+    }
+    if (prefix.empty()) {
+        return std::nullopt;
+    }
+    prefix.back() = static_cast<char>(static_cast<uint8_t>(prefix.back()) + 1);
+    return prefix;
+}
+}  // namespace
+
+Result<std::shared_ptr<GlobalIndexWriter>> BTreeGlobalIndex::CreateWriter(
+    const std::string& field_name, ::ArrowSchema* c_arrow_schema,
+    const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+    const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    auto arrow_field = arrow_schema->GetFieldByName(field_name);
+    if (!arrow_field) {
+        return Status::Invalid(
+            fmt::format("field {} not in arrow_schema for BTreeGlobalIndexWriter", field_name));
+    }
+    PAIMON_ASSIGN_OR_RAISE(FieldType key_type,
+                           FieldTypeUtils::ConvertToFieldType(arrow_field->type()->id()));
+    PAIMON_RETURN_NOT_OK(CheckKeyType(key_type));
+    int64_t block_size = DEFAULT_BLOCK_SIZE;
+    auto iter = options_.find(BLOCK_SIZE);
+    if (iter != options_.end()) {
+        PAIMON_ASSIGN_OR_RAISE(block_size, MemorySize::ParseBytes(iter->second));
+    }
+    if (block_size <= 0) {
+        return Status::Invalid(
+            fmt::format("{} must be positive, but is {}", BLOCK_SIZE, block_size));
+    }
+    return std::make_shared<BTreeGlobalIndexWriter>(arrow::struct_({arrow_field}), key_type,
+                                                    block_size, file_writer, pool);
+}
+
+Result<std::shared_ptr<GlobalIndexReader>> BTreeGlobalIndex::CreateReader(
+    ::ArrowSchema* c_arrow_schema, const std::shared_ptr<GlobalIndexFileReader>& file_reader,
+    const std::vector<GlobalIndexIOMeta>& files, const std::shared_ptr<MemoryPool>& pool) const {
+    if (files.size() != 1) {
+        return Status::Invalid(
+            "invalid GlobalIndexIOMeta for BTreeGlobalIndex, exist multiple metas");
+    }
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for BTreeGlobalIndexReader, supposed to have single field.");
+    }
+    auto arrow_type = arrow_schema->field(0)->type();
+    PAIMON_ASSIGN_OR_RAISE(FieldType key_type,
+                           FieldTypeUtils::ConvertToFieldType(arrow_type->id()));
+    PAIMON_RETURN_NOT_OK(CheckKeyType(key_type));
+    const auto& meta = files[0];
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> in,
+                           file_reader->GetInputStream(meta.file_path));
+    return BTreeGlobalIndexReader::Create(key_type, meta, in, pool);
+}
+
+BTreeGlobalIndexWriter::BTreeGlobalIndexWriter(
+    const std::shared_ptr<arrow::DataType>& struct_type, const FieldType& key_type,
+    int64_t block_size, const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+    const std::shared_ptr<MemoryPool>& pool)
+    : struct_type_(struct_type),
+      key_type_(key_type),
+      block_size_(block_size),
+      file_writer_(file_writer),
+      pool_(pool) {}
+
+Status BTreeGlobalIndexWriter::AddBatch(::ArrowArray* c_arrow_array) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
+                                      arrow::ImportArray(c_arrow_array, struct_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
+    if (!struct_array || struct_array->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid batch for BTreeGlobalIndexWriter, supposed to be struct array with single "
+            "field.");
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<Literal> array_values,
+        LiteralConverter::ConvertLiteralsFromArray(*(struct_array->field(0)), /*own_data=*/true));
+    for (auto& value : array_values) {
+        if (value.IsNull()) {
+            null_bitmap_.Add(row_count_);
+        } else {
+            entries_.emplace_back(std::move(value), row_count_);
+        }
+        row_count_++;
+    }
+    return Status::OK();
+}
+
+Result<int64_t> BTreeGlobalIndexWriter::WriteIndexFile(OutputStream* out) const {
+    int64_t file_offset = 0;
+    auto new_buffer = [this]() {
+        auto buffer = std::make_unique<MemorySegmentOutputStream>(
+            MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool_);
+        buffer->SetOrder(ByteOrder::PAIMON_BIG_ENDIAN);
+        return buffer;
+    };
+    auto flush_buffer = [&](std::unique_ptr<MemorySegmentOutputStream>* buffer) -> Status {
+        PAIMON_UNIQUE_PTR<Bytes> bytes =
+            MemorySegmentUtils::CopyToBytes((*buffer)->Segments(), /*offset=*/0,
+                                            /*num_bytes=*/(*buffer)->CurrentSize(), pool_.get());
+        PAIMON_RETURN_NOT_OK(WriteFully(out, *bytes, kMaxWriteSize));
+        file_offset += bytes->size();
+        *buffer = new_buffer();
+        return Status::OK();
+    };
+
+    // 1.write blocks of sorted keys, a block is flushed once it exceeds the block size, so only
+    // one block is buffered in memory
+    struct WriteBlock {
+        Literal first_key;
+        Literal last_key;
+        int64_t offset;
+        int32_t length;
+        int32_t key_count;
+    };
+    std::vector<WriteBlock> blocks;
+    auto buffer = new_buffer();
+    int32_t key_count = 0;
+    size_t first_key_index = 0;
+    for (size_t begin = 0; begin < entries_.size();) {
+        const Literal& key = entries_[begin].first;
+        size_t end = begin + 1;
+        while (end < entries_.size() && CompareKey(entries_[end].first, key) == 0) {
+            ++end;
+        }
+        if (key_count == 0) {
+            first_key_index = begin;
+        }
+        WriteKey(key, buffer.get());
+        buffer->WriteValue<int32_t>(static_cast<int32_t>(end - begin));
+        for (size_t i = begin; i < end; ++i) {
+            buffer->WriteValue<int64_t>(entries_[i].second);
+        }
+        key_count++;
+        if (buffer->CurrentSize() >= block_size_ || end == entries_.size()) {
+            blocks.push_back({entries_[first_key_index].first, key, file_offset,
+                              static_cast<int32_t>(buffer->CurrentSize()), key_count});
+            PAIMON_RETURN_NOT_OK(flush_buffer(&buffer));
+            key_count = 0;
+        }
+        begin = end;
+    }
+
+    // 2.write null bitmap
+    int64_t null_bitmap_offset = file_offset;
+    std::shared_ptr<Bytes> null_bitmap_bytes = null_bitmap_.Serialize(pool_.get());
+    PAIMON_RETURN_NOT_OK(WriteFully(out, *null_bitmap_bytes, kMaxWriteSize));
+    file_offset += null_bitmap_bytes->size();
+
+    // 3.write block index
+    int64_t block_index_offset = file_offset;
+    buffer->WriteValue<int32_t>(static_cast<int32_t>(blocks.size()));
+    for (const auto& block : blocks) {
+        WriteKey(block.first_key, buffer.get());
+        WriteKey(block.last_key, buffer.get());
+        buffer->WriteValue<int64_t>(block.offset);
+        buffer->WriteValue<int32_t>(block.length);
+        buffer->WriteValue<int32_t>(block.key_count);
+    }
+    int64_t block_index_length = buffer->CurrentSize();
+
+    // 4.write footer
+    buffer->WriteValue<int64_t>(null_bitmap_offset);
+    buffer->WriteValue<int32_t>(static_cast<int32_t>(null_bitmap_bytes->size()));
+    buffer->WriteValue<int64_t>(block_index_offset);
+    buffer->WriteValue<int32_t>(static_cast<int32_t>(block_index_length));
+    buffer->WriteValue<int8_t>(BTreeGlobalIndex::VERSION_1);
+    PAIMON_RETURN_NOT_OK(flush_buffer(&buffer));
+    return file_offset;
+}
+
+Result<std::vector<GlobalIndexIOMeta>> BTreeGlobalIndexWriter::Finish() {
+    if (row_count_ == 0) {
+        return std::vector<GlobalIndexIOMeta>();
+    }
+    // row ids of a key stay in ascending order
+    std::stable_sort(entries_.begin(), entries_.end(),
+                     [](const std::pair<Literal, int64_t>& lhs,
+                        const std::pair<Literal, int64_t>& rhs) {
+                         return CompareKey(lhs.first, rhs.first) < 0;
+                     });
+    PAIMON_ASSIGN_OR_RAISE(std::string file_name, file_writer_->NewFileName(kIdentifier));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<OutputStream> out,
+                           file_writer_->NewOutputStream(file_name));
+    PAIMON_ASSIGN_OR_RAISE(int64_t file_size, WriteIndexFile(out.get()));
+    PAIMON_RETURN_NOT_OK(out->Flush());
+    PAIMON_RETURN_NOT_OK(out->Close());
+    GlobalIndexIOMeta meta(file_writer_->ToPath(file_name), file_size,
+                           /*range_end=*/row_count_ - 1, /*metadata=*/nullptr);
+    return std::vector<GlobalIndexIOMeta>({meta});
+}
+
+Result<std::shared_ptr<BTreeGlobalIndexReader>> BTreeGlobalIndexReader::Create(
+    const FieldType& key_type, const GlobalIndexIOMeta& meta,
+    const std::shared_ptr<InputStream>& input_stream, const std::shared_ptr<MemoryPool>& pool) {
+    if (meta.file_size < kFooterSize) {
+        return Status::Invalid(fmt::format("invalid btree global index file {} with size {}",
+                                           meta.file_path, meta.file_size));
+    }
+    DataInputStream in(input_stream);
+    PAIMON_RETURN_NOT_OK(in.Seek(meta.file_size - kFooterSize));
+    PAIMON_ASSIGN_OR_RAISE(int64_t null_bitmap_offset, in.ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t null_bitmap_length, in.ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t block_index_offset, in.ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t block_index_length, in.ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(int8_t version, in.ReadValue<int8_t>());
+    if (version != BTreeGlobalIndex::VERSION_1) {
+        return Status::Invalid(fmt::format("invalid version: {} for btree global index", version));
+    }
+
+    // load null bitmap
+    RoaringBitmap64 null_bitmap;
+    Bytes null_bitmap_bytes(null_bitmap_length, pool.get());
+    PAIMON_RETURN_NOT_OK(in.Seek(null_bitmap_offset));
+    PAIMON_RETURN_NOT_OK(in.ReadBytes(&null_bitmap_bytes));
+    PAIMON_RETURN_NOT_OK(
+        null_bitmap.Deserialize(null_bitmap_bytes.data(), null_bitmap_bytes.size()));
+
+    // load sparse block index
+    Bytes block_index_bytes(block_index_length, pool.get());
+    PAIMON_RETURN_NOT_OK(in.Seek(block_index_offset));
+    PAIMON_RETURN_NOT_OK(in.ReadBytes(&block_index_bytes));
+    DataInputStream block_index_in(std::make_shared<ByteArrayInputStream>(
+        block_index_bytes.data(), block_index_bytes.size()));
+    PAIMON_ASSIGN_OR_RAISE(int32_t block_count, block_index_in.ReadValue<int32_t>());
+    std::vector<BlockMeta> blocks;
+    blocks.reserve(block_count);
+    for (int32_t i = 0; i < block_count; ++i) {
+        PAIMON_ASSIGN_OR_RAISE(Literal first_key, ReadKey(key_type, block_index_in, pool.get()));
+        PAIMON_ASSIGN_OR_RAISE(Literal last_key, ReadKey(key_type, block_index_in, pool.get()));
+        PAIMON_ASSIGN_OR_RAISE(int64_t offset, block_index_in.ReadValue<int64_t>());
+        PAIMON_ASSIGN_OR_RAISE(int32_t length, block_index_in.ReadValue<int32_t>());
+        PAIMON_ASSIGN_OR_RAISE(int32_t key_count, block_index_in.ReadValue<int32_t>());
+        blocks.push_back({std::move(first_key), std::move(last_key), offset, length, key_count});
+    }
+    return std::shared_ptr<BTreeGlobalIndexReader>(
+        new BTreeGlobalIndexReader(key_type, meta.range_end, std::move(null_bitmap),
+                                   std::move(blocks), input_stream, pool));
+}
+
+BTreeGlobalIndexReader::BTreeGlobalIndexReader(const FieldType& key_type, int64_t range_end,
+                                               RoaringBitmap64&& null_bitmap,
+                                               std::vector<BlockMeta>&& blocks,
+                                               const std::shared_ptr<InputStream>& input_stream,
+                                               const std::shared_ptr<MemoryPool>& pool)
+    : key_type_(key_type),
+      range_end_(range_end),
+      null_bitmap_(std::move(null_bitmap)),
+      blocks_(std::move(blocks)),
+      input_stream_(input_stream),
+      pool_(pool) {}
+
+Status BTreeGlobalIndexReader::CheckLiteral(const Literal& literal) const {
+    if (literal.GetType() != key_type_) {
+        return Status::Invalid(fmt::format("literal type {} mismatch btree global index type {}",
+                                           FieldTypeUtils::FieldTypeToString(literal.GetType()),
+                                           FieldTypeUtils::FieldTypeToString(key_type_)));
+    }
+    return Status::OK();
+}
+
+Result<const Bytes*> BTreeGlobalIndexReader::ReadBlock(size_t block_index) {
+    if (cached_block_index_ == block_index) {
+        return cached_block_.get();
+    }
+    const auto& block = blocks_[block_index];
+    auto bytes = Bytes::AllocateBytes(block.length, pool_.get());
+    DataInputStream in(input_stream_);
+    PAIMON_RETURN_NOT_OK(in.Seek(block.offset));
+    PAIMON_RETURN_NOT_OK(in.ReadBytes(bytes.get()));
+    cached_block_ = std::move(bytes);
+    cached_block_index_ = block_index;
+    return cached_block_.get();
+}
+
+Status BTreeGlobalIndexReader::ReadRange(const std::optional<Bound>& lower,
+                                         const std::optional<Bound>& upper,
+                                         RoaringBitmap64* bitmap) {
+    // NaN never matches a range or equality predicate
+    if ((lower && IsNaN(lower->key)) || (upper && IsNaN(upper->key))) {
+        return Status::OK();
+    }
+    auto above_lower = [&lower](const Literal& key) {
+        if (!lower) {
+            return true;
+        }
+        int32_t cmp = CompareKey(key, lower->key);
+        return lower->inclusive ? cmp >= 0 : cmp > 0;
+    };
+    auto below_upper = [&upper](const Literal& key) {
+        // NaN keys are sorted last, they are above any upper bound
+        if (IsNaN(key)) {
+            return false;
+        }
+        if (!upper) {
+            return true;
+        }
+        int32_t cmp = CompareKey(key, upper->key);
+        return upper->inclusive ? cmp <= 0 : cmp < 0;
+    };
+    // blocks are sorted and do not overlap, skip blocks whose keys are all below the lower bound
+    auto iter = std::partition_point(blocks_.begin(), blocks_.end(), [&](const BlockMeta& block) {
+        return !above_lower(block.last_key);
+    });
+    for (; iter != blocks_.end() && below_upper(iter->first_key); ++iter) {
+        bool whole_block = above_lower(iter->first_key) && below_upper(iter->last_key);
+        PAIMON_ASSIGN_OR_RAISE(const Bytes* bytes,
+                               ReadBlock(static_cast<size_t>(iter - blocks_.begin())));
+        DataInputStream in(std::make_shared<ByteArrayInputStream>(bytes->data(), bytes->size()));
+        for (int32_t i = 0; i < iter->key_count; ++i) {
+            PAIMON_ASSIGN_OR_RAISE(Literal key, ReadKey(key_type_, in, pool_.get()));
+            PAIMON_ASSIGN_OR_RAISE(int32_t row_count, in.ReadValue<int32_t>());
+            if (!whole_block && !below_upper(key)) {
+                break;
+            }
+            if (whole_block || above_lower(key)) {
+                for (int32_t j = 0; j < row_count; ++j) {
+                    PAIMON_ASSIGN_OR_RAISE(int64_t row_id, in.ReadValue<int64_t>());
+                    bitmap->Add(row_id);
+                }
+            } else {
+                PAIMON_ASSIGN_OR_RAISE(int64_t pos, in.GetPos());
+                PAIMON_RETURN_NOT_OK(in.Seek(pos + row_count * sizeof(int64_t)));
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status BTreeGlobalIndexReader::ReadIn(const std::vector<Literal>& literals,
+                                      RoaringBitmap64* bitmap) {
+    for (const auto& literal : literals) {
+        PAIMON_RETURN_NOT_OK(CheckLiteral(literal));
+        if (literal.IsNull()) {
+            continue;
+        }
+        Bound bound{literal, /*inclusive=*/true};
+        PAIMON_RETURN_NOT_OK(ReadRange(bound, bound, bitmap));
+    }
+    return Status::OK();
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitRange(
+    const std::optional<Bound>& lower, const std::optional<Bound>& upper) {
+    for (const auto& bound : {lower, upper}) {
+        if (bound) {
+            PAIMON_RETURN_NOT_OK(CheckLiteral(bound->key));
+            if (bound->key.IsNull()) {
+                return ToGlobalIndexResult(RoaringBitmap64());
+            }
+        }
+    }
+    RoaringBitmap64 bitmap;
+    PAIMON_RETURN_NOT_OK(ReadRange(lower, upper, &bitmap));
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+RoaringBitmap64 BTreeGlobalIndexReader::NonNullRows() const {
+    RoaringBitmap64 bitmap;
+    bitmap.AddRange(0, range_end_ + 1);
+    bitmap -= null_bitmap_;
+    return bitmap;
+}
+
+std::shared_ptr<GlobalIndexResult> BTreeGlobalIndexReader::ToGlobalIndexResult(
+    RoaringBitmap64&& bitmap) {
+    return std::make_shared<BitmapGlobalIndexResult>(
+        [bitmap = std::move(bitmap)]() -> Result<RoaringBitmap64> { return bitmap; });
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitIsNotNull() {
+    return ToGlobalIndexResult(NonNullRows());
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitIsNull() {
+    return ToGlobalIndexResult(RoaringBitmap64(null_bitmap_));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitEqual(
+    const Literal& literal) {
+    return VisitRange(Bound{literal, /*inclusive=*/true}, Bound{literal, /*inclusive=*/true});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitNotEqual(
+    const Literal& literal) {
+    PAIMON_RETURN_NOT_OK(CheckLiteral(literal));
+    if (literal.IsNull()) {
+        return ToGlobalIndexResult(RoaringBitmap64());
+    }
+    RoaringBitmap64 equal_rows;
+    Bound bound{literal, /*inclusive=*/true};
+    PAIMON_RETURN_NOT_OK(ReadRange(bound, bound, &equal_rows));
+    RoaringBitmap64 bitmap = NonNullRows();
+    bitmap -= equal_rows;
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitLessThan(
+    const Literal& literal) {
+    return VisitRange(std::nullopt, Bound{literal, /*inclusive=*/false});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitLessOrEqual(
+    const Literal& literal) {
+    return VisitRange(std::nullopt, Bound{literal, /*inclusive=*/true});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitGreaterThan(
+    const Literal& literal) {
+    return VisitRange(Bound{literal, /*inclusive=*/false}, std::nullopt);
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitGreaterOrEqual(
+    const Literal& literal) {
+    return VisitRange(Bound{literal, /*inclusive=*/true}, std::nullopt);
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitIn(
+    const std::vector<Literal>& literals) {
+    RoaringBitmap64 bitmap;
+    PAIMON_RETURN_NOT_OK(ReadIn(literals, &bitmap));
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitNotIn(
+    const std::vector<Literal>& literals) {
+    RoaringBitmap64 in_rows;
+    PAIMON_RETURN_NOT_OK(ReadIn(literals, &in_rows));
+    RoaringBitmap64 bitmap = NonNullRows();
+    bitmap -= in_rows;
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitStartsWith(
+    const Literal& prefix) {
+    if (key_type_ != FieldType::STRING && key_type_ != FieldType::BINARY) {
+        return BitmapGlobalIndexResult::FromRanges({Range(0, range_end_)});
+    }
+    PAIMON_RETURN_NOT_OK(CheckLiteral(prefix));
+    if (prefix.IsNull()) {
+        return ToGlobalIndexResult(RoaringBitmap64());
+    }
+    // keys starting with the prefix are in [prefix, upper bound of prefix)
+    std::string prefix_str = prefix.GetValue<std::string>();
+    std::optional<Bound> upper;
+    std::optional<std::string> upper_str = PrefixUpperBound(prefix_str);
+    if (upper_str) {
+        upper = Bound{Literal(key_type_, upper_str->data(), upper_str->size()),
+                      /*inclusive=*/false};
+    }
+    return VisitRange(Bound{prefix, /*inclusive=*/true}, upper);
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitEndsWith(
+    const Literal& suffix) {
+    return BitmapGlobalIndexResult::FromRanges({Range(0, range_end_)});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> BTreeGlobalIndexReader::VisitContains(
+    const Literal& literal) {
+    return BitmapGlobalIndexResult::FromRanges({Range(0, range_end_)});
+}
+
+}  // namespace paimon
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "paimon/defs.h"
+#include "paimon/global_index/global_indexer.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/utils/roaring_bitmap64.h"
+
+namespace paimon {
+class InputStream;
+class OutputStream;
+
+/// A sorted global index, which answers equality, range and prefix predicates.
+///
+/// Keys of an index file are sorted and stored once with the row ids holding them. Keys are
+/// grouped into blocks of about `btree.block-size` bytes, and the first and last key of each
+/// block form a sparse block index. The block index is loaded when the reader is created, so a
+/// predicate only reads the blocks overlapping its key range. Layout of an index file:
+///
+///     | block 0 | ... | block n-1 | null bitmap | block index | footer |
+///
+/// - block: per key, the key, int32 row count and int64 row ids.
+/// - block index: int32 block count, then per block, the first key, last key, int64 offset,
+///   int32 length and int32 key count.
+/// - footer: int64 null bitmap offset, int32 null bitmap length, int64 block index offset,
+///   int32 block index length and int8 version.
+///
+/// Supported key types are BOOLEAN, TINYINT, SMALLINT, INT, BIGINT, FLOAT, DOUBLE, STRING,
+/// BINARY, DATE and TIMESTAMP. FLOAT and DOUBLE keys are sorted in a total order, where -0.0
+/// equals 0.0 and NaN is greater than all other keys. NaN keys never match a range or equality
+/// predicate.
+class BTreeGlobalIndex : public GlobalIndexer {
+ public:
+    static constexpr int8_t VERSION_1 = 1;
+    static constexpr char BLOCK_SIZE[] = "btree.block-size";
+    static constexpr int64_t DEFAULT_BLOCK_SIZE = 16 * 1024;
+
+    explicit BTreeGlobalIndex(const std::map<std::string, std::string>& options)
+        : options_(options) {}
+
+    Result<std::shared_ptr<GlobalIndexWriter>> CreateWriter(
+        const std::string& field_name, ::ArrowSchema* arrow_schema,
+        const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+        const std::shared_ptr<MemoryPool>& pool) const override;
+
+    Result<std::shared_ptr<GlobalIndexReader>> CreateReader(
+        ::ArrowSchema* arrow_schema, const std::shared_ptr<GlobalIndexFileReader>& file_reader,
+        const std::vector<GlobalIndexIOMeta>& files,
+        const std::shared_ptr<MemoryPool>& pool) const override;
+
+ private:
+    std::map<std::string, std::string> options_;
+};
+
+class BTreeGlobalIndexWriter : public GlobalIndexWriter {
+ public:
+    BTreeGlobalIndexWriter(const std::shared_ptr<arrow::DataType>& struct_type,
+                           const FieldType& key_type, int64_t block_size,
+                           const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+                           const std::shared_ptr<MemoryPool>& pool);
+
+    Status AddBatch(::ArrowArray* arrow_array) override;
+
+    Result<std::vector<GlobalIndexIOMeta>> Finish() override;
+
+ private:
+    /// Writes sorted entries block by block to `out`, returns the written length.
+    Result<int64_t> WriteIndexFile(OutputStream* out) const;
+
+ private:
+    static constexpr char kIdentifier[] = "btree";
+    static constexpr uint64_t kMaxWriteSize = std::numeric_limits<int32_t>::max();
+
+    std::shared_ptr<arrow::DataType> struct_type_;
+    FieldType key_type_;
+    int64_t block_size_;
+    std::shared_ptr<GlobalIndexFileWriter> file_writer_;
+    std::shared_ptr<MemoryPool> pool_;
+    int64_t row_count_ = 0;
+    RoaringBitmap64 null_bitmap_;
+    // (key, row id) of non-null rows, sorted by key when finishing
+    std::vector<std::pair<Literal, int64_t>> entries_;
+};
+
+class BTreeGlobalIndexReader : public GlobalIndexReader {
+ public:
+    struct BlockMeta {
+        Literal first_key;
+        Literal last_key;
+        int64_t offset;
+        int32_t length;
+        int32_t key_count;
+    };
+
+    static Result<std::shared_ptr<BTreeGlobalIndexReader>> Create(
+        const FieldType& key_type, const GlobalIndexIOMeta& meta,
+        const std::shared_ptr<InputStream>& input_stream, const std::shared_ptr<MemoryPool>& pool);
+
+    Result<std::shared_ptr<VectorSearchGlobalIndexResult>> VisitVectorSearch(
+        const std::shared_ptr<VectorSearch>& vector_search) override {
+        return Status::Invalid(
+            "BTreeGlobalIndexReader is not supposed to handle vector search query");
+    }
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitIsNotNull() override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitIsNull() override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitEqual(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitNotEqual(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitLessThan(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitLessOrEqual(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitGreaterThan(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitGreaterOrEqual(
+        const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitIn(
+        const std::vector<Literal>& literals) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitNotIn(
+        const std::vector<Literal>& literals) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitStartsWith(const Literal& prefix) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitEndsWith(const Literal& suffix) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitContains(const Literal& literal) override;
+
+    const std::vector<BlockMeta>& Blocks() const {
+        return blocks_;
+    }
+
+ private:
+    struct Bound {
+        Literal key;
+        bool inclusive;
+    };
+
+    BTreeGlobalIndexReader(const FieldType& key_type, int64_t range_end,
+                           RoaringBitmap64&& null_bitmap, std::vector<BlockMeta>&& blocks,
+                           const std::shared_ptr<InputStream>& input_stream,
+                           const std::shared_ptr<MemoryPool>& pool);
+
+    Status CheckLiteral(const Literal& literal) const;
+
+    /// Adds row ids of keys within the bounds to `bitmap`, a missing bound is unbounded.
+    Status ReadRange(const std::optional<Bound>& lower, const std::optional<Bound>& upper,
+                     RoaringBitmap64* bitmap);
+
+    Status ReadIn(const std::vector<Literal>& literals, RoaringBitmap64* bitmap);
+
+    Result<const Bytes*> ReadBlock(size_t block_index);
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitRange(const std::optional<Bound>& lower,
+                                                          const std::optional<Bound>& upper);
+
+    RoaringBitmap64 NonNullRows() const;
+
+    static std::shared_ptr<GlobalIndexResult> ToGlobalIndexResult(RoaringBitmap64&& bitmap);
+
+ private:
+    FieldType key_type_;
+    int64_t range_end_;
+    RoaringBitmap64 null_bitmap_;
+    std::vector<BlockMeta> blocks_;
+    std::shared_ptr<InputStream> input_stream_;
+    std::shared_ptr<MemoryPool> pool_;
+    // the last read block, which is likely read again by the keys of IN predicates
+    std::optional<size_t> cached_block_index_;
+    PAIMON_UNIQUE_PTR<Bytes> cached_block_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,359 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/global_index/btree/btree_global_index.h"
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/api.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/string_utils.h"
+#include "paimon/core/global_index/global_index_file_manager.h"
+#include "paimon/core/index/index_path_factory.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/global_index/bitmap_global_index_result.h"
+#include "paimon/global_index/global_index_result.h"
+#include "paimon/testing/utils/testharness.h"
+namespace paimon::test {
+class BTreeGlobalIndexTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        test_root_dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(test_root_dir_);
+    }
+    void TearDown() override {}
+
+    class FakeIndexPathFactory : public IndexPathFactory {
+     public:
+        explicit FakeIndexPathFactory(const std::string& index_path) : index_path_(index_path) {}
+        std::string NewPath() const override {
+            assert(false);
+            return "";
+        }
+        std::string ToPath(const std::shared_ptr<IndexFileMeta>& file) const override {
+            assert(false);
+            return "";
+        }
+        std::string ToPath(const std::string& file_name) const override {
+            return PathUtil::JoinPath(index_path_, file_name);
+        }
+        bool IsExternalPath() const override {
+            return false;
+        }
+
+     private:
+        std::string index_path_;
+    };
+
+    std::unique_ptr<::ArrowSchema> CreateArrowSchema(
+        const std::shared_ptr<arrow::DataType>& data_type) const {
+        auto schema = arrow::schema({arrow::field("f0", data_type)});
+        auto c_schema = std::make_unique<::ArrowSchema>();
+        EXPECT_TRUE(arrow::ExportSchema(*schema, c_schema.get()).ok());
+        return c_schema;
+    }
+
+    std::shared_ptr<GlobalIndexFileManager> CreateFileManager() const {
+        auto path_factory = std::make_shared<FakeIndexPathFactory>(test_root_dir_->Str());
+        return std::make_shared<GlobalIndexFileManager>(fs_, path_factory);
+    }
+
+    Result<GlobalIndexIOMeta> WriteGlobalIndex(const std::shared_ptr<arrow::DataType>& type,
+                                               const std::map<std::string, std::string>& options,
+                                               const std::shared_ptr<arrow::Array>& array) const {
+        BTreeGlobalIndex global_index(options);
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexWriter> global_writer,
+                               global_index.CreateWriter("f0", CreateArrowSchema(type).get(),
+                                                         CreateFileManager(), pool_));
+        ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        PAIMON_RETURN_NOT_OK(global_writer->AddBatch(&c_array));
+        PAIMON_ASSIGN_OR_RAISE(auto result_metas, global_writer->Finish());
+        // check meta
+        EXPECT_EQ(result_metas.size(), 1);
+        auto file_name = PathUtil::GetName(result_metas[0].file_path);
+        EXPECT_TRUE(StringUtils::StartsWith(file_name, "btree-global-index-"));
+        EXPECT_TRUE(StringUtils::EndsWith(file_name, ".index"));
+        EXPECT_EQ(result_metas[0].range_end, array->length() - 1);
+        EXPECT_FALSE(result_metas[0].metadata);
+        return result_metas[0];
+    }
+
+    std::shared_ptr<BTreeGlobalIndexReader> CreateGlobalIndexReader(
+        const std::shared_ptr<arrow::DataType>& type, const GlobalIndexIOMeta& meta) const {
+        BTreeGlobalIndex global_index({});
+        EXPECT_OK_AND_ASSIGN(auto global_index_reader,
+                             global_index.CreateReader(CreateArrowSchema(type).get(),
+                                                       CreateFileManager(), {meta}, pool_));
+        auto reader = std::dynamic_pointer_cast<BTreeGlobalIndexReader>(global_index_reader);
+        EXPECT_TRUE(reader);
+        return reader;
+    }
+
+    std::shared_ptr<arrow::Array> MakeArray(const std::shared_ptr<arrow::DataType>& type,
+                                            const std::string& json) const {
+        return arrow::ipc::internal::json::ArrayFromJSON(
+                   arrow::struct_({arrow::field("f0", type)}), json)
+            .ValueOrDie();
+    }
+
+    void CheckResult(const Result<std::shared_ptr<GlobalIndexResult>>& result,
+                     const std::vector<int64_t>& expected) const {
+        ASSERT_OK(result);
+        auto typed_result = std::dynamic_pointer_cast<BitmapGlobalIndexResult>(result.value());
+        ASSERT_TRUE(typed_result);
+        ASSERT_OK_AND_ASSIGN(const RoaringBitmap64* bitmap, typed_result->GetBitmap());
+        ASSERT_TRUE(bitmap);
+        ASSERT_EQ(*bitmap, RoaringBitmap64::From(expected))
+            << "result=" << bitmap->ToString()
+            << ", expected=" << RoaringBitmap64::From(expected).ToString();
+    }
+
+ private:
+    std::unique_ptr<UniqueTestDirectory> test_root_dir_;
+    std::shared_ptr<MemoryPool> pool_ = GetDefaultPool();
+    std::shared_ptr<FileSystem> fs_ = std::make_shared<LocalFileSystem>();
+};
+
+TEST_F(BTreeGlobalIndexTest, TestIntType) {
+    // data: 5, null, 3, 8, 3, 1, null, 10
+    auto type = arrow::int32();
+    auto array = MakeArray(type, R"([[5], [null], [3], [8], [3], [1], [null], [10]])");
+    auto check_index = [&](const std::map<std::string, std::string>& options,
+                           size_t expected_block_count) {
+        ASSERT_OK_AND_ASSIGN(auto meta, WriteGlobalIndex(type, options, array));
+        auto reader = CreateGlobalIndexReader(type, meta);
+        ASSERT_EQ(reader->Blocks().size(), expected_block_count);
+
+        Literal lit_0(static_cast<int32_t>(0));
+        Literal lit_3(static_cast<int32_t>(3));
+        Literal lit_5(static_cast<int32_t>(5));
+        Literal lit_8(static_cast<int32_t>(8));
+        Literal lit_11(static_cast<int32_t>(11));
+        CheckResult(reader->VisitIsNull(), {1, 6});
+        CheckResult(reader->VisitIsNotNull(), {0, 2, 3, 4, 5, 7});
+        CheckResult(reader->VisitEqual(lit_3), {2, 4});
+        CheckResult(reader->VisitEqual(lit_0), {});
+        CheckResult(reader->VisitEqual(Literal(FieldType::INT)), {});
+        CheckResult(reader->VisitNotEqual(lit_3), {0, 3, 5, 7});
+        CheckResult(reader->VisitLessThan(lit_5), {2, 4, 5});
+        CheckResult(reader->VisitLessOrEqual(lit_5), {0, 2, 4, 5});
+        CheckResult(reader->VisitGreaterThan(lit_5), {3, 7});
+        CheckResult(reader->VisitGreaterOrEqual(lit_5), {0, 3, 7});
+        CheckResult(reader->VisitGreaterOrEqual(lit_11), {});
+        CheckResult(reader->VisitLessThan(lit_0), {});
+        CheckResult(reader->VisitIn({lit_0, lit_3, lit_8, Literal(FieldType::INT)}), {2, 3, 4});
+        CheckResult(reader->VisitNotIn({lit_3, lit_8}), {0, 5, 7});
+        // not supported predicates return all rows
+        CheckResult(reader->VisitStartsWith(lit_3), {0, 1, 2, 3, 4, 5, 6, 7});
+
+        ASSERT_NOK_WITH_MSG(reader->VisitEqual(Literal(static_cast<int64_t>(3))),
+                            "literal type BIGINT mismatch btree global index type INT");
+        ASSERT_NOK_WITH_MSG(reader->VisitVectorSearch(std::make_shared<VectorSearch>(
+                                "f0", 10, std::vector<float>({1.0f, 2.0f}), nullptr, nullptr,
+                                std::nullopt, std::map<std::string, std::string>())),
+                            "BTreeGlobalIndexReader is not supposed to handle vector search query");
+    };
+    check_index(/*options=*/{}, /*expected_block_count=*/1);
+    // each key in its own block
+    check_index({{BTreeGlobalIndex::BLOCK_SIZE, "1"}}, /*expected_block_count=*/5);
+}
+
+TEST_F(BTreeGlobalIndexTest, TestStringType) {
+    auto type = arrow::utf8();
+    auto array = MakeArray(type, R"([
+        ["apple"], ["banana"], [null], ["app"], ["apricot"], [""], ["applet"], ["b"]
+    ])");
+    for (const auto& block_size : {"16kb", "8"}) {
+        ASSERT_OK_AND_ASSIGN(
+            auto meta, WriteGlobalIndex(type, {{BTreeGlobalIndex::BLOCK_SIZE, block_size}}, array));
+        auto reader = CreateGlobalIndexReader(type, meta);
+
+        auto lit = [](const std::string& str) {
+            return Literal(FieldType::STRING, str.data(), str.size());
+        };
+        CheckResult(reader->VisitEqual(lit("apple")), {0});
+        CheckResult(reader->VisitEqual(lit("")), {5});
+        CheckResult(reader->VisitStartsWith(lit("app")), {0, 3, 6});
+        CheckResult(reader->VisitStartsWith(lit("ap")), {0, 3, 4, 6});
+        CheckResult(reader->VisitStartsWith(lit("b")), {1, 7});
+        CheckResult(reader->VisitStartsWith(lit("c")), {});
+        CheckResult(reader->VisitStartsWith(lit("")), {0, 1, 3, 4, 5, 6, 7});
+        CheckResult(reader->VisitGreaterThan(lit("apricot")), {1, 7});
+        CheckResult(reader->VisitLessThan(lit("apple")), {3, 5});
+        CheckResult(reader->VisitIsNull(), {2});
+        // not supported predicates return all rows
+        CheckResult(reader->VisitEndsWith(lit("e")), {0, 1, 2, 3, 4, 5, 6, 7});
+        CheckResult(reader->VisitContains(lit("p")), {0, 1, 2, 3, 4, 5, 6, 7});
+    }
+}
+
+TEST_F(BTreeGlobalIndexTest, TestFloatingTypeWithNaN) {
+    auto check_type = [&](auto value_tag, const std::shared_ptr<arrow::DataType>& type,
+                          const std::shared_ptr<arrow::ArrayBuilder>& value_builder) {
+        using T = decltype(value_tag);
+        using BuilderType = typename arrow::TypeTraits<
+            typename arrow::CTypeTraits<T>::ArrowType>::BuilderType;
+        T nan = std::numeric_limits<T>::quiet_NaN();
+        T inf = std::numeric_limits<T>::infinity();
+        // data: 1.5, NaN, -0.0, null, 0.0, NaN, -2.0, inf
+        std::vector<std::optional<T>> values = {1.5, nan, -0.0, std::nullopt, 0.0, nan, -2.0, inf};
+        arrow::StructBuilder struct_builder(arrow::struct_({arrow::field("f0", type)}),
+                                           arrow::default_memory_pool(), {value_builder});
+        auto typed_builder = static_cast<BuilderType*>(struct_builder.field_builder(0));
+        for (const auto& value : values) {
+            ASSERT_TRUE(struct_builder.Append().ok());
+            if (value) {
+                ASSERT_TRUE(typed_builder->Append(value.value()).ok());
+            } else {
+                ASSERT_TRUE(typed_builder->AppendNull().ok());
+            }
+        }
+        std::shared_ptr<arrow::Array> array;
+        ASSERT_TRUE(struct_builder.Finish(&array).ok());
+
+        for (const auto& block_size : {"16kb", "1"}) {
+            ASSERT_OK_AND_ASSIGN(
+                auto meta,
+                WriteGlobalIndex(type, {{BTreeGlobalIndex::BLOCK_SIZE, block_size}}, array));
+            auto reader = CreateGlobalIndexReader(type, meta);
+            auto lit = [](T value) { return Literal(value); };
+            // -0.0 equals 0.0, NaN matches no equality or range predicate
+            CheckResult(reader->VisitEqual(lit(0.0)), {2, 4});
+            CheckResult(reader->VisitEqual(lit(-0.0)), {2, 4});
+            CheckResult(reader->VisitEqual(lit(nan)), {});
+            CheckResult(reader->VisitGreaterThan(lit(0.0)), {0, 7});
+            CheckResult(reader->VisitGreaterOrEqual(lit(-2.0)), {0, 2, 4, 6, 7});
+            CheckResult(reader->VisitGreaterThan(lit(nan)), {});
+            CheckResult(reader->VisitLessThan(lit(2.0)), {0, 2, 4, 6});
+            CheckResult(reader->VisitLessOrEqual(lit(nan)), {});
+            CheckResult(reader->VisitIn({lit(nan), lit(1.5)}), {0});
+            CheckResult(reader->VisitNotEqual(lit(1.5)), {1, 2, 4, 5, 6, 7});
+            CheckResult(reader->VisitNotEqual(lit(nan)), {0, 1, 2, 4, 5, 6, 7});
+            CheckResult(reader->VisitNotIn({lit(0.0)}), {0, 1, 5, 6, 7});
+            CheckResult(reader->VisitIsNotNull(), {0, 1, 2, 4, 5, 6, 7});
+            CheckResult(reader->VisitIsNull(), {3});
+        }
+    };
+    check_type(static_cast<float>(0), arrow::float32(), std::make_shared<arrow::FloatBuilder>());
+    check_type(static_cast<double>(0), arrow::float64(), std::make_shared<arrow::DoubleBuilder>());
+}
+
+TEST_F(BTreeGlobalIndexTest, TestTimestampType) {
+    // data:
+    // 1745542802000lms, 123000ns
+    // 1745542902000lms, 123000ns
+    // -1745lms, 123000ns
+    // null
+    // 1745542802000lms, 123001ns
+    auto type = arrow::timestamp(arrow::TimeUnit::NANO);
+    auto array = MakeArray(type, R"([
+        [1745542802000123000],
+        [1745542902000123000],
+        [-1744877000],
+        [null],
+        [1745542802000123001]
+    ])");
+    ASSERT_OK_AND_ASSIGN(auto meta, WriteGlobalIndex(type, /*options=*/{}, array));
+    auto reader = CreateGlobalIndexReader(type, meta);
+
+    Literal lit_0(Timestamp(1745542802000l, 123000));
+    Literal lit_1(Timestamp(1745542902000l, 123000));
+    CheckResult(reader->VisitEqual(lit_0), {0});
+    CheckResult(reader->VisitGreaterThan(lit_0), {1, 4});
+    CheckResult(reader->VisitLessThan(lit_1), {0, 2, 4});
+    CheckResult(reader->VisitLessThan(Literal(Timestamp(0, 0))), {2});
+    CheckResult(reader->VisitIsNull(), {3});
+}
+
+TEST_F(BTreeGlobalIndexTest, TestManyBlocks) {
+    auto type = arrow::int64();
+    arrow::StructBuilder struct_builder(arrow::struct_({arrow::field("f0", type)}),
+                                       arrow::default_memory_pool(),
+                                       {std::make_shared<arrow::Int64Builder>()});
+    auto int_builder = static_cast<arrow::Int64Builder*>(struct_builder.field_builder(0));
+    std::vector<int64_t> values;
+    for (int32_t i = 0; i < 10000; i++) {
+        ASSERT_TRUE(struct_builder.Append().ok());
+        int64_t value = paimon::test::RandomNumber(-5000, 5000);
+        ASSERT_TRUE(int_builder->Append(value).ok());
+        values.push_back(value);
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(struct_builder.Finish(&array).ok());
+
+    ASSERT_OK_AND_ASSIGN(auto meta,
+                         WriteGlobalIndex(type, {{BTreeGlobalIndex::BLOCK_SIZE, "1kb"}}, array));
+    auto reader = CreateGlobalIndexReader(type, meta);
+    ASSERT_GT(reader->Blocks().size(), 1);
+
+    auto expected_rows = [&](int64_t lower, int64_t upper) {
+        std::vector<int64_t> rows;
+        for (size_t i = 0; i < values.size(); i++) {
+            if (values[i] >= lower && values[i] <= upper) {
+                rows.push_back(i);
+            }
+        }
+        return rows;
+    };
+    for (int32_t i = 0; i < 10; i++) {
+        int64_t lower = paimon::test::RandomNumber(-6000, 6000);
+        int64_t upper = lower + paimon::test::RandomNumber(0, 500);
+        CheckResult(reader->VisitEqual(Literal(lower)), expected_rows(lower, lower));
+        CheckResult(reader->VisitGreaterOrEqual(Literal(lower)),
+                    expected_rows(lower, std::numeric_limits<int64_t>::max()));
+        CheckResult(reader->VisitLessOrEqual(Literal(upper)),
+                    expected_rows(std::numeric_limits<int64_t>::min(), upper));
+        ASSERT_OK_AND_ASSIGN(auto lower_result, reader->VisitGreaterOrEqual(Literal(lower)));
+        ASSERT_OK_AND_ASSIGN(auto upper_result, reader->VisitLessOrEqual(Literal(upper)));
+        CheckResult(lower_result->And(upper_result), expected_rows(lower, upper));
+    }
+}
+
+TEST_F(BTreeGlobalIndexTest, TestInvalid) {
+    BTreeGlobalIndex global_index({});
+    ASSERT_NOK(global_index.CreateWriter("f0", CreateArrowSchema(arrow::list(arrow::int32())).get(),
+                                         CreateFileManager(), GetDefaultPool()));
+    ASSERT_NOK_WITH_MSG(
+        BTreeGlobalIndex({{BTreeGlobalIndex::BLOCK_SIZE, "0"}})
+            .CreateWriter("f0", CreateArrowSchema(arrow::int32()).get(), CreateFileManager(),
+                          GetDefaultPool()),
+        "btree.block-size must be positive, but is 0");
+    ASSERT_NOK_WITH_MSG(global_index.CreateReader(CreateArrowSchema(arrow::int32()).get(),
+                                                  CreateFileManager(), /*files=*/{},
+                                                  GetDefaultPool()),
+                        "invalid GlobalIndexIOMeta for BTreeGlobalIndex, exist multiple metas");
+}
+
+TEST_F(BTreeGlobalIndexTest, TestEmpty) {
+    BTreeGlobalIndex global_index({});
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<GlobalIndexWriter> writer,
+                         global_index.CreateWriter("f0", CreateArrowSchema(arrow::int32()).get(),
+                                                   CreateFileManager(), GetDefaultPool()));
+    ASSERT_OK_AND_ASSIGN(auto metas, writer->Finish());
+    ASSERT_TRUE(metas.empty());
+}
+
+}  // namespace paimon::test
@@ -20,6 +20,7 @@
 
 #include "gtest/gtest.h"
 #include "paimon/common/global_index/bitmap/bitmap_global_index.h"
+#include "paimon/common/global_index/btree/btree_global_index.h"
 #include "paimon/testing/utils/testharness.h"
 
 namespace paimon::test {
@@ -30,6 +31,10 @@ TEST(GlobalIndexerFactoryTest, TestSimple) {
 
     auto bitmap_global_index = dynamic_cast<BitmapGlobalIndex*>(indexer.get());
     ASSERT_TRUE(bitmap_global_index);
+
+    ASSERT_OK_AND_ASSIGN(indexer, GlobalIndexerFactory::Get("btree", options));
+    auto btree_global_index = dynamic_cast<BTreeGlobalIndex*>(indexer.get());
+    ASSERT_TRUE(btree_global_index);
 }
 
 TEST(GlobalIndexerFactoryTest, TestNonExist) {
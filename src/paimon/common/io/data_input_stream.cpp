@@ -122,4 +122,5 @@ template Result<uint16_t> DataInputStream::ReadValue() const;
 template Result<int32_t> DataInputStream::ReadValue() const;
 template Result<int64_t> DataInputStream::ReadValue() const;
 template Result<float> DataInputStream::ReadValue() const;
+template Result<double> DataInputStream::ReadValue() const;
 }  // namespace paimon
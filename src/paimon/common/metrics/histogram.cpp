@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/metrics/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace paimon {
+
+size_t Histogram::BucketIndex(uint64_t value) {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+    int32_t exponent = 63 - __builtin_clzll(value);
+    if (exponent >= kMaxExponent) {
+        return kNumBuckets - 1;
+    }
+    uint64_t sub_bucket = (value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+    return static_cast<size_t>(kSubBuckets + (exponent - kSubBucketBits) * kSubBuckets +
+                               sub_bucket);
+}
+
+uint64_t Histogram::BucketLowerBound(size_t index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    uint64_t exponent = (index - kSubBuckets) / kSubBuckets + kSubBucketBits;
+    uint64_t sub_bucket = (index - kSubBuckets) % kSubBuckets;
+    return (1ull << exponent) + (sub_bucket << (exponent - kSubBucketBits));
+}
+
+void Histogram::Record(uint64_t value) {
+    if (buckets_.empty()) {
+        buckets_.resize(kNumBuckets, 0);
+    }
+    buckets_[BucketIndex(value)]++;
+    count_++;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+}
+
+void Histogram::Merge(const Histogram& other) {
+    if (other.count_ == 0) {
+        return;
+    }
+    if (buckets_.empty()) {
+        buckets_.resize(kNumBuckets, 0);
+    }
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+uint64_t Histogram::Percentile(double quantile) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    quantile = std::clamp(quantile, 0.0, 1.0);
+    auto rank = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(count_)));
+    rank = std::max<uint64_t>(rank, 1);
+    if (rank >= count_) {
+        return max_;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            return std::clamp(BucketLowerBound(i), min_, max_);
+        }
+    }
+    return max_;
+}
+
+HistogramStats Histogram::GetStats() const {
+    HistogramStats stats;
+    stats.count = Count();
+    stats.min = Min();
+    stats.max = Max();
+    stats.mean = Mean();
+    stats.p50 = Percentile(0.5);
+    stats.p95 = Percentile(0.95);
+    stats.p99 = Percentile(0.99);
+    return stats;
+}
+
+}  // namespace paimon
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "paimon/metrics.h"
+
+namespace paimon {
+
+/// A mergeable histogram with fixed memory footprint.
+///
+/// Values are kept in log-linear buckets: every power-of-two range is split into
+/// `kSubBuckets` equal-width buckets and values below `kSubBuckets` are kept exactly. This bounds
+/// the relative error of reported percentiles to 1/`kSubBuckets` regardless of the value range,
+/// while count, min, max and sum are tracked exactly. Values at or above 2^`kMaxExponent` share
+/// the last bucket. Two histograms can be merged by adding bucket counts.
+///
+/// Not thread-safe, callers are responsible for synchronization.
+class Histogram {
+ public:
+    static constexpr int32_t kSubBucketBits = 4;
+    static constexpr uint64_t kSubBuckets = 1ull << kSubBucketBits;
+    static constexpr int32_t kMaxExponent = 40;
+    static constexpr size_t kNumBuckets =
+        kSubBuckets + (kMaxExponent - kSubBucketBits) * kSubBuckets;
+
+    Histogram() = default;
+
+    void Record(uint64_t value);
+    void Merge(const Histogram& other);
+
+    uint64_t Count() const {
+        return count_;
+    }
+    uint64_t Min() const {
+        return count_ == 0 ? 0 : min_;
+    }
+    uint64_t Max() const {
+        return max_;
+    }
+    uint64_t Sum() const {
+        return sum_;
+    }
+    double Mean() const {
+        return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+    }
+
+    /// @param quantile Quantile in [0, 1], e.g., 0.99 for p99.
+    /// @return Approximate value at `quantile`, 0 if the histogram is empty.
+    uint64_t Percentile(double quantile) const;
+
+    HistogramStats GetStats() const;
+
+    static size_t BucketIndex(uint64_t value);
+    static uint64_t BucketLowerBound(size_t index);
+
+ private:
+    uint64_t count_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+    uint64_t sum_ = 0;
+    // allocated on first record, so that empty histograms stay cheap
+    std::vector<uint64_t> buckets_;
+};
+
+}  // namespace paimon
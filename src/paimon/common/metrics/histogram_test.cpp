@@ -0,0 +1,111 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/metrics/histogram.h"
+
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+namespace paimon::test {
+
+TEST(HistogramTest, TestEmpty) {
+    Histogram histogram;
+    HistogramStats stats = histogram.GetStats();
+    ASSERT_EQ(0, stats.count);
+    ASSERT_EQ(0, stats.min);
+    ASSERT_EQ(0, stats.max);
+    ASSERT_EQ(0.0, stats.mean);
+    ASSERT_EQ(0, stats.p50);
+    ASSERT_EQ(0, stats.p99);
+}
+
+TEST(HistogramTest, TestSmallValuesAreExact) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 10; ++i) {
+        histogram.Record(i);
+    }
+    HistogramStats stats = histogram.GetStats();
+    ASSERT_EQ(10, stats.count);
+    ASSERT_EQ(1, stats.min);
+    ASSERT_EQ(10, stats.max);
+    ASSERT_DOUBLE_EQ(5.5, stats.mean);
+    ASSERT_EQ(5, stats.p50);
+    ASSERT_EQ(10, stats.p95);
+    ASSERT_EQ(10, stats.p99);
+}
+
+TEST(HistogramTest, TestBucketBounds) {
+    for (uint64_t value : {0ull, 1ull, 15ull, 16ull, 17ull, 100ull, 1000ull, 123456789ull,
+                           (1ull << 39) + 12345}) {
+        size_t index = Histogram::BucketIndex(value);
+        ASSERT_LT(index, Histogram::kNumBuckets);
+        uint64_t lower = Histogram::BucketLowerBound(index);
+        ASSERT_LE(lower, value);
+        // relative error is bounded by 1/16
+        ASSERT_LE(value - lower, value / Histogram::kSubBuckets) << value;
+    }
+    ASSERT_EQ(Histogram::kNumBuckets - 1, Histogram::BucketIndex(UINT64_MAX));
+}
+
+TEST(HistogramTest, TestPercentileRelativeError) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 100000; ++i) {
+        histogram.Record(i);
+    }
+    auto check = [&](double quantile, uint64_t expected) {
+        uint64_t actual = histogram.Percentile(quantile);
+        ASSERT_LE(actual, expected);
+        ASSERT_GE(actual, expected - expected / Histogram::kSubBuckets);
+    };
+    check(0.5, 50000);
+    check(0.95, 95000);
+    check(0.99, 99000);
+    ASSERT_EQ(1, histogram.Percentile(0.0));
+    ASSERT_EQ(100000, histogram.Percentile(1.0));
+}
+
+TEST(HistogramTest, TestMerge) {
+    Histogram left;
+    Histogram right;
+    Histogram all;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        uint64_t value = i * 37 % 5000;
+        if (i % 2 == 0) {
+            left.Record(value);
+        } else {
+            right.Record(value);
+        }
+        all.Record(value);
+    }
+    Histogram empty;
+    left.Merge(empty);
+    left.Merge(right);
+    HistogramStats merged = left.GetStats();
+    HistogramStats expected = all.GetStats();
+    ASSERT_EQ(expected.count, merged.count);
+    ASSERT_EQ(expected.min, merged.min);
+    ASSERT_EQ(expected.max, merged.max);
+    ASSERT_DOUBLE_EQ(expected.mean, merged.mean);
+    ASSERT_EQ(expected.p50, merged.p50);
+    ASSERT_EQ(expected.p95, merged.p95);
+    ASSERT_EQ(expected.p99, merged.p99);
+
+    empty.Merge(all);
+    ASSERT_EQ(expected.p99, empty.GetStats().p99);
+}
+
+}  // namespace paimon::test
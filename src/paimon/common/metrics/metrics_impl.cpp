@@ -46,6 +46,34 @@ std::map<std::string, uint64_t> MetricsImpl::GetAllCounters() const {
     return counters_;
 }
 
+void MetricsImpl::ObserveHistogram(const std::string& metric_name, uint64_t value) {
+    std::lock_guard<std::mutex> guard(counter_lock_);
+    histograms_[metric_name].Record(value);
+}
+
+Result<HistogramStats> MetricsImpl::GetHistogram(const std::string& metric_name) const {
+    std::lock_guard<std::mutex> guard(counter_lock_);
+    auto iter = histograms_.find(metric_name);
+    if (iter != histograms_.end()) {
+        return iter->second.GetStats();
+    }
+    return Status::KeyError(fmt::format("metric '{}' not found", metric_name));
+}
+
+std::map<std::string, HistogramStats> MetricsImpl::GetAllHistograms() const {
+    std::lock_guard<std::mutex> guard(counter_lock_);
+    std::map<std::string, HistogramStats> result;
+    for (const auto& [name, histogram] : histograms_) {
+        result.emplace(name, histogram.GetStats());
+    }
+    return result;
+}
+
+std::map<std::string, Histogram> MetricsImpl::GetAllRawHistograms() const {
+    std::lock_guard<std::mutex> guard(counter_lock_);
+    return histograms_;
+}
+
 void MetricsImpl::Merge(const std::shared_ptr<Metrics>& other) {
     if (other && this != other.get()) {
         std::map<std::string, uint64_t> other_counters = other->GetAllCounters();
@@ -58,14 +86,29 @@ void MetricsImpl::Merge(const std::shared_ptr<Metrics>& other) {
                 counters_[kv.first] += kv.second;
             }
         }
+        // only raw buckets can be merged without losing the distribution
+        auto other_impl = std::dynamic_pointer_cast<MetricsImpl>(other);
+        if (other_impl) {
+            std::map<std::string, Histogram> other_histograms = other_impl->GetAllRawHistograms();
+            std::lock_guard<std::mutex> guard(counter_lock_);
+            for (const auto& [name, histogram] : other_histograms) {
+                histograms_[name].Merge(histogram);
+            }
+        }
     }
 }
 
 void MetricsImpl::Overwrite(const std::shared_ptr<Metrics>& other) {
     if (other && this != other.get()) {
         std::map<std::string, uint64_t> other_counters = other->GetAllCounters();
+        std::map<std::string, Histogram> other_histograms;
+        auto other_impl = std::dynamic_pointer_cast<MetricsImpl>(other);
+        if (other_impl) {
+            other_histograms = other_impl->GetAllRawHistograms();
+        }
         std::lock_guard<std::mutex> guard(counter_lock_);
         counters_.swap(other_counters);
+        histograms_.swap(other_histograms);
     }
 }
 
@@ -81,6 +124,18 @@ std::string MetricsImpl::ToString() const {
         doc.AddMember(rapidjson::Value(kv.first, allocator), rapidjson::Value(kv.second),
                       allocator);
     }
+    std::map<std::string, HistogramStats> histograms = GetAllHistograms();
+    for (const auto& [name, stats] : histograms) {
+        rapidjson::Value value(rapidjson::kObjectType);
+        value.AddMember("count", rapidjson::Value(stats.count), allocator);
+        value.AddMember("min", rapidjson::Value(stats.min), allocator);
+        value.AddMember("max", rapidjson::Value(stats.max), allocator);
+        value.AddMember("mean", rapidjson::Value(stats.mean), allocator);
+        value.AddMember("p50", rapidjson::Value(stats.p50), allocator);
+        value.AddMember("p95", rapidjson::Value(stats.p95), allocator);
+        value.AddMember("p99", rapidjson::Value(stats.p99), allocator);
+        doc.AddMember(rapidjson::Value(name, allocator), value, allocator);
+    }
     rapidjson::StringBuffer s;
     RapidWriter writer(s);
     doc.Accept(writer);
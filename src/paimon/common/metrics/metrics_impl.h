@@ -22,6 +22,7 @@
 #include <mutex>
 #include <string>
 
+#include "paimon/common/metrics/histogram.h"
 #include "paimon/metrics.h"
 #include "paimon/visibility.h"
 
@@ -34,6 +35,9 @@ class PAIMON_EXPORT MetricsImpl : public Metrics {
     void SetCounter(const std::string& metric_name, uint64_t metric_value) override;
     Result<uint64_t> GetCounter(const std::string& metric_name) const override;
     std::map<std::string, uint64_t> GetAllCounters() const override;
+    void ObserveHistogram(const std::string& metric_name, uint64_t value) override;
+    Result<HistogramStats> GetHistogram(const std::string& metric_name) const override;
+    std::map<std::string, HistogramStats> GetAllHistograms() const override;
     void Merge(const std::shared_ptr<Metrics>& other) override;
     std::string ToString() const override;
     void Overwrite(const std::shared_ptr<Metrics>& metrics);
@@ -54,8 +58,11 @@ class PAIMON_EXPORT MetricsImpl : public Metrics {
     }
 
  private:
+    std::map<std::string, Histogram> GetAllRawHistograms() const;
+
     mutable std::mutex counter_lock_;
     std::map<std::string, uint64_t> counters_;
+    std::map<std::string, Histogram> histograms_;
 };
 
 }  // namespace paimon
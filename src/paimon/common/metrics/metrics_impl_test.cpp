@@ -16,6 +16,10 @@
 
 #include "paimon/common/metrics/metrics_impl.h"
 
+#include <map>
+#include <memory>
+#include <string>
+
 #include "gtest/gtest.h"
 #include "paimon/testing/utils/testharness.h"
 
@@ -61,4 +65,81 @@ TEST(MetricsImplTest, TestToString) {
     EXPECT_EQ(metrics1->ToString(), "{\"k1\":1,\"k2\":7,\"m1\":3,\"m2\":4}");
 }
 
+TEST(MetricsImplTest, TestHistogram) {
+    auto metrics = std::make_shared<MetricsImpl>();
+    ASSERT_NOK_WITH_MSG(metrics->GetHistogram("latency"), "Key error: metric 'latency' not found");
+    metrics->ObserveHistogram("latency", 1);
+    metrics->ObserveHistogram("latency", 3);
+    ASSERT_OK_AND_ASSIGN(HistogramStats stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(2, stats.count);
+    ASSERT_EQ(1, stats.min);
+    ASSERT_EQ(3, stats.max);
+    ASSERT_DOUBLE_EQ(2.0, stats.mean);
+    // histograms and counters live in separate namespaces
+    ASSERT_NOK(metrics->GetCounter("latency"));
+
+    auto other = std::make_shared<MetricsImpl>();
+    other->ObserveHistogram("latency", 5);
+    other->ObserveHistogram("other_latency", 7);
+    metrics->Merge(other);
+    ASSERT_OK_AND_ASSIGN(stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(3, stats.count);
+    ASSERT_EQ(1, stats.min);
+    ASSERT_EQ(5, stats.max);
+    ASSERT_EQ(3, stats.p50);
+    ASSERT_EQ(2, metrics->GetAllHistograms().size());
+
+    metrics->Overwrite(other);
+    ASSERT_OK_AND_ASSIGN(stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(1, stats.count);
+    ASSERT_EQ(5, stats.min);
+}
+
+TEST(MetricsImplTest, TestHistogramToString) {
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->SetCounter("c", 1);
+    metrics->ObserveHistogram("h", 1);
+    metrics->ObserveHistogram("h", 3);
+    EXPECT_EQ(metrics->ToString(),
+              "{\"c\":1,\"h\":{\"count\":2,\"min\":1,\"max\":3,\"mean\":2.0,\"p50\":1,"
+              "\"p95\":3,\"p99\":3}}");
+}
+
+namespace {
+// a metrics implemented by user which only supports counters
+class CounterOnlyMetrics : public Metrics {
+ public:
+    void SetCounter(const std::string& metric_name, uint64_t metric_value) override {
+        counters_[metric_name] = metric_value;
+    }
+    Result<uint64_t> GetCounter(const std::string& metric_name) const override {
+        auto iter = counters_.find(metric_name);
+        if (iter == counters_.end()) {
+            return Status::KeyError(metric_name);
+        }
+        return iter->second;
+    }
+    std::map<std::string, uint64_t> GetAllCounters() const override {
+        return counters_;
+    }
+    void Merge(const std::shared_ptr<Metrics>& other) override {}
+    std::string ToString() const override {
+        return "";
+    }
+
+ private:
+    std::map<std::string, uint64_t> counters_;
+};
+}  // namespace
+
+TEST(MetricsImplTest, TestDefaultHistogramOfUserMetrics) {
+    CounterOnlyMetrics metrics;
+    metrics.ObserveHistogram("latency", 10);
+    ASSERT_NOK_WITH_MSG(metrics.GetHistogram("latency"), "histogram is not supported");
+    ASSERT_TRUE(metrics.GetAllHistograms().empty());
+    metrics.SetCounter("counter", 1);
+    ASSERT_OK_AND_ASSIGN(uint64_t counter, metrics.GetCounter("counter"));
+    ASSERT_EQ(1, counter);
+}
+
 }  // namespace paimon::test
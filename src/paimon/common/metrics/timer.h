@@ -0,0 +1,69 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "paimon/metrics.h"
+
+namespace paimon {
+
+/// Measures elapsed wall time with a monotonic clock.
+class Timer {
+ public:
+    Timer() : start_(std::chrono::steady_clock::now()) {}
+
+    void Reset() {
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    uint64_t ElapsedUs() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                         std::chrono::steady_clock::now() - start_)
+                                         .count());
+    }
+
+ private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+/// Records the lifetime of the enclosing scope in microseconds into a histogram of `metrics`.
+/// Does nothing if `metrics` is nullptr.
+class ScopedTimer {
+ public:
+    ScopedTimer(Metrics* metrics, std::string metric_name)
+        : metrics_(metrics), metric_name_(std::move(metric_name)) {}
+
+    ~ScopedTimer() {
+        if (metrics_) {
+            metrics_->ObserveHistogram(metric_name_, timer_.ElapsedUs());
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+    Metrics* metrics_;
+    std::string metric_name_;
+    Timer timer_;
+};
+
+}  // namespace paimon
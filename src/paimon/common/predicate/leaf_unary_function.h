@@ -23,6 +23,7 @@
 #include "arrow/util/checked_cast.h"
 #include "paimon/common/predicate/leaf_function.h"
 #include "paimon/common/predicate/literal_converter.h"
+#include "paimon/common/predicate/predicate_kernels.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/status.h"
 
@@ -31,6 +32,11 @@ class LeafUnaryFunction : public LeafFunction {
  public:
     Result<std::vector<char>> Test(const arrow::Array& array,
                                    const std::vector<Literal>& literals) const override {
+        std::optional<std::vector<char>> kernel_result =
+            PredicateKernels::IsNull(array, /*negate=*/GetType() == Type::IS_NOT_NULL);
+        if (kernel_result) {
+            return std::move(kernel_result).value();
+        }
         std::vector<char> is_valid(array.length(), false);
         PAIMON_ASSIGN_OR_RAISE(
             std::vector<Literal> array_values,
@@ -23,6 +23,7 @@
 #include "arrow/util/checked_cast.h"
 #include "paimon/common/predicate/leaf_function.h"
 #include "paimon/common/predicate/literal_converter.h"
+#include "paimon/common/predicate/predicate_kernels.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/status.h"
 
@@ -32,6 +33,11 @@ class MultiLiteralsLeafFunction : public LeafFunction {
  public:
     Result<std::vector<char>> Test(const arrow::Array& array,
                                    const std::vector<Literal>& literals) const override {
+        std::optional<std::vector<char>> kernel_result =
+            PredicateKernels::In(array, literals, /*negate=*/GetType() == Type::NOT_IN);
+        if (kernel_result) {
+            return std::move(kernel_result).value();
+        }
         PAIMON_ASSIGN_OR_RAISE(
             std::vector<Literal> array_values,
             LiteralConverter::ConvertLiteralsFromArray(array, /*own_data=*/false));
@@ -26,6 +26,7 @@
 #include "fmt/format.h"
 #include "paimon/common/predicate/compound_function.h"
 #include "paimon/common/predicate/predicate_filter.h"
+#include "paimon/common/predicate/predicate_kernels.h"
 #include "paimon/predicate/predicate.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
@@ -54,8 +55,9 @@ class Or : public CompoundFunction {
                     fmt::format("child filter {} does not support Test", child->ToString()));
             }
             PAIMON_ASSIGN_OR_RAISE(std::vector<char> child_valid, child_filter->Test(array));
-            for (size_t i = 0; i < is_valid.size(); i++) {
-                is_valid[i] = (is_valid[i] | child_valid[i]);
+            if (PredicateKernels::Or(child_valid, &is_valid) == array.length()) {
+                // all rows pass, the remaining children can be skipped
+                break;
             }
         }
         return is_valid;
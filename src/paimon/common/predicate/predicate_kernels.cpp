@@ -0,0 +1,314 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/predicate/predicate_kernels.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <string_view>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "paimon/defs.h"
+
+namespace paimon {
+namespace {
+// Comparisons follow `Literal::CompareTo()`: values are equal if `==` holds, otherwise the field
+// is less than the literal if `<` holds, and greater in all other cases (e.g., NaN).
+struct EqualOp {
+    template <typename T>
+    static bool Apply(const T& field, const T& literal) {
+        return field == literal;
+    }
+};
+
+struct NotEqualOp {
+    template <typename T>
+    static bool Apply(const T& field, const T& literal) {
+        return !(field == literal);
+    }
+};
+
+struct LessThanOp {
+    template <typename T>
+    static bool Apply(const T& field, const T& literal) {
+        return field < literal;
+    }
+};
+
+struct LessOrEqualOp {
+    template <typename T>
+    static bool Apply(const T& field, const T& literal) {
+        return field == literal || field < literal;
+    }
+};
+
+struct GreaterThanOp {
+    template <typename T>
+    static bool Apply(const T& field, const T& literal) {
+        return !(field == literal || field < literal);
+    }
+};
+
+struct GreaterOrEqualOp {
+    template <typename T>
+    static bool Apply(const T& field, const T& literal) {
+        return !(field < literal);
+    }
+};
+
+// the literal type which is comparable with values of the array
+std::optional<FieldType> KernelFieldType(arrow::Type::type type) {
+    switch (type) {
+        case arrow::Type::type::BOOL:
+            return FieldType::BOOLEAN;
+        case arrow::Type::type::INT8:
+            return FieldType::TINYINT;
+        case arrow::Type::type::INT16:
+            return FieldType::SMALLINT;
+        case arrow::Type::type::INT32:
+            return FieldType::INT;
+        case arrow::Type::type::INT64:
+            return FieldType::BIGINT;
+        case arrow::Type::type::FLOAT:
+            return FieldType::FLOAT;
+        case arrow::Type::type::DOUBLE:
+            return FieldType::DOUBLE;
+        case arrow::Type::type::DATE32:
+            return FieldType::DATE;
+        case arrow::Type::type::STRING:
+            return FieldType::STRING;
+        case arrow::Type::type::BINARY:
+            return FieldType::BINARY;
+        default:
+            return std::nullopt;
+    }
+}
+
+template <typename Op, typename ArrowType>
+void ComparePrimitive(const arrow::Array& array, const Literal& literal, char* out) {
+    using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
+    using CType = typename ArrowType::c_type;
+    const auto& typed_array = arrow::internal::checked_cast<const ArrayType&>(array);
+    const CType* values = typed_array.raw_values();
+    const CType value = literal.GetValue<CType>();
+    const int64_t length = array.length();
+    for (int64_t i = 0; i < length; ++i) {
+        out[i] = static_cast<char>(Op::Apply(values[i], value));
+    }
+}
+
+template <typename Op>
+void CompareBoolean(const arrow::Array& array, const Literal& literal, char* out) {
+    const auto& bool_array = arrow::internal::checked_cast<const arrow::BooleanArray&>(array);
+    const bool value = literal.GetValue<bool>();
+    const int64_t length = array.length();
+    for (int64_t i = 0; i < length; ++i) {
+        out[i] = static_cast<char>(Op::Apply(bool_array.Value(i), value));
+    }
+}
+
+template <typename Op, typename ArrowType>
+void CompareBinary(const arrow::Array& array, const Literal& literal, char* out) {
+    using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
+    const auto& typed_array = arrow::internal::checked_cast<const ArrayType&>(array);
+    const std::string value = literal.GetValue<std::string>();
+    const std::string_view value_view(value);
+    const int64_t length = array.length();
+    for (int64_t i = 0; i < length; ++i) {
+        out[i] = static_cast<char>(Op::Apply(typed_array.GetView(i), value_view));
+    }
+}
+
+// Precondition: type of array is supported by `KernelFieldType()` and matches the literal, null
+// values are not cleared
+template <typename Op>
+void CompareValues(const arrow::Array& array, const Literal& literal, char* out) {
+    switch (array.type_id()) {
+        case arrow::Type::type::BOOL:
+            return CompareBoolean<Op>(array, literal, out);
+        case arrow::Type::type::INT8:
+            return ComparePrimitive<Op, arrow::Int8Type>(array, literal, out);
+        case arrow::Type::type::INT16:
+            return ComparePrimitive<Op, arrow::Int16Type>(array, literal, out);
+        case arrow::Type::type::INT32:
+            return ComparePrimitive<Op, arrow::Int32Type>(array, literal, out);
+        case arrow::Type::type::INT64:
+            return ComparePrimitive<Op, arrow::Int64Type>(array, literal, out);
+        case arrow::Type::type::FLOAT:
+            return ComparePrimitive<Op, arrow::FloatType>(array, literal, out);
+        case arrow::Type::type::DOUBLE:
+            return ComparePrimitive<Op, arrow::DoubleType>(array, literal, out);
+        case arrow::Type::type::DATE32:
+            return ComparePrimitive<Op, arrow::Date32Type>(array, literal, out);
+        case arrow::Type::type::STRING:
+            return CompareBinary<Op, arrow::StringType>(array, literal, out);
+        case arrow::Type::type::BINARY:
+            return CompareBinary<Op, arrow::BinaryType>(array, literal, out);
+        default:
+            assert(false);
+            return;
+    }
+}
+
+bool IsComparable(const arrow::Array& array, const Literal& literal) {
+    std::optional<FieldType> field_type = KernelFieldType(array.type_id());
+    return field_type && !literal.IsNull() && literal.GetType() == field_type.value();
+}
+}  // namespace
+
+std::optional<std::vector<char>> PredicateKernels::Compare(Function::Type function,
+                                                           const arrow::Array& array,
+                                                           const Literal& literal) {
+    if (!IsComparable(array, literal)) {
+        return std::nullopt;
+    }
+    std::vector<char> mask(array.length());
+    switch (function) {
+        case Function::Type::EQUAL:
+            CompareValues<EqualOp>(array, literal, mask.data());
+            break;
+        case Function::Type::NOT_EQUAL:
+            CompareValues<NotEqualOp>(array, literal, mask.data());
+            break;
+        case Function::Type::LESS_THAN:
+            CompareValues<LessThanOp>(array, literal, mask.data());
+            break;
+        case Function::Type::LESS_OR_EQUAL:
+            CompareValues<LessOrEqualOp>(array, literal, mask.data());
+            break;
+        case Function::Type::GREATER_THAN:
+            CompareValues<GreaterThanOp>(array, literal, mask.data());
+            break;
+        case Function::Type::GREATER_OR_EQUAL:
+            CompareValues<GreaterOrEqualOp>(array, literal, mask.data());
+            break;
+        default:
+            return std::nullopt;
+    }
+    ClearNulls(array, &mask);
+    return mask;
+}
+
+std::optional<std::vector<char>> PredicateKernels::In(const arrow::Array& array,
+                                                      const std::vector<Literal>& literals,
+                                                      bool negate) {
+    if (!KernelFieldType(array.type_id())) {
+        return std::nullopt;
+    }
+    std::vector<const Literal*> values;
+    values.reserve(literals.size());
+    for (const auto& literal : literals) {
+        if (literal.IsNull()) {
+            if (negate) {
+                // nothing is not in a set containing null
+                return std::vector<char>(array.length(), 0);
+            }
+            continue;
+        }
+        if (!IsComparable(array, literal)) {
+            return std::nullopt;
+        }
+        values.push_back(&literal);
+    }
+    std::vector<char> mask(array.length(), 0);
+    std::vector<char> equal(array.length());
+    for (const Literal* value : values) {
+        CompareValues<EqualOp>(array, *value, equal.data());
+        Or(equal, &mask);
+    }
+    if (negate) {
+        for (auto& is_valid : mask) {
+            is_valid = static_cast<char>(!is_valid);
+        }
+    }
+    ClearNulls(array, &mask);
+    return mask;
+}
+
+std::optional<std::vector<char>> PredicateKernels::IsNull(const arrow::Array& array,
+                                                          bool negate) {
+    switch (array.type_id()) {
+        case arrow::Type::type::SPARSE_UNION:
+        case arrow::Type::type::DENSE_UNION:
+        case arrow::Type::type::RUN_END_ENCODED:
+            // nulls are not recorded in the validity bitmap
+            return std::nullopt;
+        default:
+            break;
+    }
+    const int64_t length = array.length();
+    const uint8_t* validity = array.null_bitmap_data();
+    if (validity == nullptr) {
+        bool all_null = array.null_count() == length;
+        return std::vector<char>(length, static_cast<char>(all_null != negate));
+    }
+    std::vector<char> mask(length);
+    const int64_t offset = array.offset();
+    for (int64_t i = 0; i < length; ++i) {
+        mask[i] = static_cast<char>(arrow::bit_util::GetBit(validity, offset + i) == negate);
+    }
+    return mask;
+}
+
+void PredicateKernels::ClearNulls(const arrow::Array& array, std::vector<char>* mask) {
+    if (array.null_count() == 0) {
+        return;
+    }
+    const uint8_t* validity = array.null_bitmap_data();
+    if (validity == nullptr) {
+        // all values are null, e.g., null array
+        std::fill(mask->begin(), mask->end(), 0);
+        return;
+    }
+    const int64_t offset = array.offset();
+    const int64_t length = array.length();
+    char* data = mask->data();
+    for (int64_t i = 0; i < length; ++i) {
+        data[i] &= static_cast<char>(arrow::bit_util::GetBit(validity, offset + i));
+    }
+}
+
+int64_t PredicateKernels::And(const std::vector<char>& other, std::vector<char>* mask) {
+    assert(other.size() == mask->size());
+    int64_t count = 0;
+    char* data = mask->data();
+    const size_t size = mask->size();
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>(data[i] != 0 && other[i] != 0);
+        count += data[i];
+    }
+    return count;
+}
+
+int64_t PredicateKernels::Or(const std::vector<char>& other, std::vector<char>* mask) {
+    assert(other.size() == mask->size());
+    int64_t count = 0;
+    char* data = mask->data();
+    const size_t size = mask->size();
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>(data[i] != 0 || other[i] != 0);
+        count += data[i];
+    }
+    return count;
+}
+
+}  // namespace paimon
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "paimon/predicate/function.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/visibility.h"
+
+namespace arrow {
+class Array;
+}  // namespace arrow
+
+namespace paimon {
+/// Typed kernels to evaluate leaf predicates on arrow arrays. Values are read from the array
+/// buffers directly instead of being converted to `Literal` one by one, and loops over primitive
+/// values are branch-free so that they can be vectorized by the compiler. Results are masks with
+/// one byte per row, the same as `PredicateFilter::Test()`.
+///
+/// Kernels return `std::nullopt` for the arrays they do not support (e.g., timestamp, decimal or
+/// dictionary arrays, or literal type mismatches), callers fall back to `Literal` comparisons.
+class PAIMON_EXPORT PredicateKernels {
+ public:
+    PredicateKernels() = delete;
+    ~PredicateKernels() = delete;
+
+    /// Evaluate `array[i] <function> literal`, null values never pass.
+    /// Precondition: `function` is a comparison function and `literal` is not null.
+    static std::optional<std::vector<char>> Compare(Function::Type function,
+                                                    const arrow::Array& array,
+                                                    const Literal& literal);
+
+    /// Evaluate `array[i] in literals` (`not in` if `negate`), null values never pass.
+    static std::optional<std::vector<char>> In(const arrow::Array& array,
+                                               const std::vector<Literal>& literals, bool negate);
+
+    /// Evaluate `array[i] is null` (`is not null` if `negate`).
+    static std::optional<std::vector<char>> IsNull(const arrow::Array& array, bool negate);
+
+    /// Clear rows of `mask` whose values in `array` are null.
+    static void ClearNulls(const arrow::Array& array, std::vector<char>* mask);
+
+    /// `mask[i] &= other[i]`, returns the number of rows still set in `mask`.
+    static int64_t And(const std::vector<char>& other, std::vector<char>* mask);
+
+    /// `mask[i] |= other[i]`, returns the number of rows set in `mask`.
+    static int64_t Or(const std::vector<char>& other, std::vector<char>* mask);
+};
+}  // namespace paimon
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/predicate/predicate_kernels.h"
+
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/defs.h"
+#include "paimon/predicate/function.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+namespace {
+std::shared_ptr<arrow::Array> MakeArray(const std::shared_ptr<arrow::DataType>& type,
+                                        const std::string& json) {
+    return arrow::ipc::internal::json::ArrayFromJSON(type, json).ValueOrDie();
+}
+}  // namespace
+
+TEST(PredicateKernelsTest, TestCompare) {
+    auto array = MakeArray(arrow::int32(), "[1, 2, null, 3, 4]");
+    Literal literal(3);
+    auto check = [&](Function::Type type, const std::vector<char>& expected) {
+        std::optional<std::vector<char>> result = PredicateKernels::Compare(type, *array, literal);
+        ASSERT_TRUE(result);
+        ASSERT_EQ(expected, result.value());
+    };
+    check(Function::Type::EQUAL, {0, 0, 0, 1, 0});
+    check(Function::Type::NOT_EQUAL, {1, 1, 0, 0, 1});
+    check(Function::Type::LESS_THAN, {1, 1, 0, 0, 0});
+    check(Function::Type::LESS_OR_EQUAL, {1, 1, 0, 1, 0});
+    check(Function::Type::GREATER_THAN, {0, 0, 0, 0, 1});
+    check(Function::Type::GREATER_OR_EQUAL, {0, 0, 0, 1, 1});
+}
+
+TEST(PredicateKernelsTest, TestCompareSlicedArray) {
+    auto array = MakeArray(arrow::int64(), "[5, null, 5, 6, null, 5]")->Slice(1, 4);
+    std::optional<std::vector<char>> result =
+        PredicateKernels::Compare(Function::Type::EQUAL, *array, Literal(5l));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({0, 1, 0, 0}), result.value());
+}
+
+TEST(PredicateKernelsTest, TestCompareNaN) {
+    // NaN is greater than any value, the same as Literal::CompareTo
+    auto array = MakeArray(arrow::float64(), "[1.5, NaN, 0.5]");
+    std::optional<std::vector<char>> result =
+        PredicateKernels::Compare(Function::Type::GREATER_THAN, *array, Literal(1.0));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({1, 1, 0}), result.value());
+    result = PredicateKernels::Compare(Function::Type::NOT_EQUAL, *array, Literal(std::nan("")));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({1, 1, 1}), result.value());
+}
+
+TEST(PredicateKernelsTest, TestCompareStringAndBoolean) {
+    auto array = MakeArray(arrow::utf8(), R"(["apple", "banana", null, "cherry"])");
+    std::string value = "banana";
+    std::optional<std::vector<char>> result = PredicateKernels::Compare(
+        Function::Type::GREATER_OR_EQUAL, *array,
+        Literal(FieldType::STRING, value.data(), value.size()));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({0, 1, 0, 1}), result.value());
+
+    auto bool_array = MakeArray(arrow::boolean(), "[true, false, null]");
+    result = PredicateKernels::Compare(Function::Type::EQUAL, *bool_array, Literal(false));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({0, 1, 0}), result.value());
+
+    auto date_array = MakeArray(arrow::date32(), "[100, 200]");
+    result = PredicateKernels::Compare(Function::Type::LESS_THAN, *date_array,
+                                       Literal(FieldType::DATE, 150));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({1, 0}), result.value());
+}
+
+TEST(PredicateKernelsTest, TestUnsupported) {
+    auto array = MakeArray(arrow::int32(), "[1, 2]");
+    // literal type mismatch
+    ASSERT_FALSE(PredicateKernels::Compare(Function::Type::EQUAL, *array, Literal(1l)));
+    ASSERT_FALSE(PredicateKernels::In(*array, {Literal(1), Literal(1l)}, /*negate=*/false));
+    // unsupported array type
+    auto decimal_array = MakeArray(arrow::decimal128(5, 2), R"(["1.00"])");
+    ASSERT_FALSE(PredicateKernels::In(*decimal_array, {}, /*negate=*/false));
+    auto union_array = MakeArray(arrow::sparse_union({arrow::field("f0", arrow::int32())}, {0}),
+                                 "[[0, 1], [0, null]]");
+    ASSERT_FALSE(PredicateKernels::IsNull(*union_array, /*negate=*/false));
+}
+
+TEST(PredicateKernelsTest, TestIn) {
+    auto array = MakeArray(arrow::int32(), "[1, 2, null, 3, 4]");
+    std::optional<std::vector<char>> result =
+        PredicateKernels::In(*array, {Literal(1), Literal(FieldType::INT), Literal(3)},
+                             /*negate=*/false);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({1, 0, 0, 1, 0}), result.value());
+
+    result = PredicateKernels::In(*array, {Literal(1), Literal(3)}, /*negate=*/true);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({0, 1, 0, 0, 1}), result.value());
+
+    // not in with null literal never passes
+    result = PredicateKernels::In(*array, {Literal(1), Literal(FieldType::INT)}, /*negate=*/true);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>(5, 0), result.value());
+}
+
+TEST(PredicateKernelsTest, TestIsNull) {
+    auto array = MakeArray(arrow::int32(), "[1, null, 3, null]")->Slice(1);
+    std::optional<std::vector<char>> result = PredicateKernels::IsNull(*array, /*negate=*/false);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({1, 0, 1}), result.value());
+    result = PredicateKernels::IsNull(*array, /*negate=*/true);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({0, 1, 0}), result.value());
+
+    // without validity bitmap
+    auto no_null_array = MakeArray(arrow::int32(), "[1, 2]");
+    result = PredicateKernels::IsNull(*no_null_array, /*negate=*/false);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({0, 0}), result.value());
+    auto null_array = MakeArray(arrow::null(), "[null, null]");
+    result = PredicateKernels::IsNull(*null_array, /*negate=*/false);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(std::vector<char>({1, 1}), result.value());
+}
+
+TEST(PredicateKernelsTest, TestAndOr) {
+    std::vector<char> mask = {1, 1, 0, 0};
+    ASSERT_EQ(1, PredicateKernels::And({1, 0, 1, 0}, &mask));
+    ASSERT_EQ(std::vector<char>({1, 0, 0, 0}), mask);
+    ASSERT_EQ(2, PredicateKernels::Or({0, 0, 1, 0}, &mask));
+    ASSERT_EQ(std::vector<char>({1, 0, 1, 0}), mask);
+}
+}  // namespace paimon::test
@@ -90,9 +90,19 @@ Result<RoaringBitmap32> PredicateBatchReader::Filter(
     PAIMON_ASSIGN_OR_RAISE(std::vector<char> result, predicate_filter_->Test(*array));
     assert(result.size() == static_cast<size_t>(array->length()));
     RoaringBitmap32 is_valid;
-    for (int32_t i = 0; i < static_cast<int32_t>(result.size()); i++) {
-        if (result[i]) {
-            is_valid.Add(i);
+    // add valid rows run by run, filters usually select continuous rows
+    const auto size = static_cast<int32_t>(result.size());
+    int32_t i = 0;
+    while (i < size) {
+        while (i < size && !result[i]) {
+            i++;
+        }
+        int32_t run_start = i;
+        while (i < size && result[i]) {
+            i++;
+        }
+        if (run_start < i) {
+            is_valid.AddRange(run_start, i);
         }
     }
     return is_valid;
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <utility>
 
 #include "paimon/memory/bytes.h"
@@ -48,6 +49,11 @@ int32_t BloomFilter64::BitSet::BitSize() const {
     return (bytes_->size() - offset_) * BloomFilter64::BYTE_SIZE;
 }
 
+void BloomFilter64::BitSet::ToByteArray(char* dest, int32_t length) const {
+    assert(length <= BitSize() / BloomFilter64::BYTE_SIZE);
+    std::memcpy(dest, bytes_->data() + offset_, length);
+}
+
 BloomFilter64::BloomFilter64(int64_t items, double fpp, const std::shared_ptr<MemoryPool>& pool)
     : pool_(pool) {
     auto nb = static_cast<int32_t>(-items * std::log(fpp) / (std::log(2) * std::log(2)));
@@ -52,6 +52,8 @@ class PAIMON_EXPORT BloomFilter64 {
         void Set(int32_t index);
         bool Get(int32_t index) const;
         int32_t BitSize() const;
+        /// Copy the first `length` bytes of the bit set to `dest`.
+        void ToByteArray(char* dest, int32_t length) const;
 
      private:
         static constexpr int8_t MASK = 0x07;
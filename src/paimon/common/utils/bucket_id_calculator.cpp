@@ -14,14 +14,13 @@
  * limitations under the License.
  */
 
+
 #include "paimon/utils/bucket_id_calculator.h"
 
+#include <algorithm>
 #include <cassert>
-#include <cmath>
 #include <cstdlib>
 #include <cstring>
-#include <functional>
-#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -40,200 +39,360 @@
 #include "arrow/util/decimal.h"
 #include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
-#include "paimon/common/data/binary_row_writer.h"
+#include "paimon/common/data/binary_section.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/date_time_utils.h"
+#include "paimon/common/utils/murmurhash_utils.h"
 #include "paimon/common/utils/scope_guard.h"
 #include "paimon/data/decimal.h"
 #include "paimon/data/timestamp.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/result.h"
 
 namespace paimon {
 namespace {
-#define CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id) \
-    if (typed_array->IsNull(row_id)) {                              \
-        row_writer->SetNullAt(col_id);                              \
-        return;                                                     \
+// The bucket id is the hash code of a BinaryRow holding the bucket keys. Instead of writing each
+// row into a BinaryRow, the hash is computed column by column: every row keeps a running murmur
+// hash and the columns feed it the words the BinaryRow would contain, in the order of the
+// BinaryRow layout, i.e. the null bits, the 8-byte fixed-length slots of all fields and then the
+// variable-length parts of all fields.
+
+inline void HashSlot(uint64_t slot, uint32_t* hash) {
+    *hash = MurmurHashUtils::HashWord(*hash, static_cast<uint32_t>(slot));
+    *hash = MurmurHashUtils::HashWord(*hash, static_cast<uint32_t>(slot >> 32));
+}
+
+// Fixed-length values are stored in the low bytes of a zeroed slot.
+template <typename T>
+inline uint64_t ToSlot(T value) {
+    static_assert(sizeof(T) <= sizeof(uint64_t));
+    uint64_t slot = 0;
+    memcpy(&slot, &value, sizeof(T));
+    return slot;
+}
+
+inline uint64_t ToOffsetAndSize(int32_t offset, int64_t size) {
+    return (static_cast<uint64_t>(offset) << 32) | static_cast<uint64_t>(size);
+}
+
+inline int32_t RoundToWord(int32_t num_bytes) {
+    return (num_bytes + 7) & ~7;
+}
+
+/// Hash the fixed-length slots of a column whose null values are written by
+/// `BinaryRowWriter::SetNullAt()`, which zeroes out the slot.
+template <typename GetSlot>
+void HashSlots(const arrow::Array& array, GetSlot&& get_slot, uint32_t* hashes) {
+    const int64_t length = array.length();
+    if (array.null_count() == 0) {
+        // branch-free loop, vectorized by the compiler for fixed-width keys
+        for (int64_t i = 0; i < length; i++) {
+            HashSlot(get_slot(i), &hashes[i]);
+        }
+    } else {
+        for (int64_t i = 0; i < length; i++) {
+            HashSlot(array.IsNull(i) ? 0 : get_slot(i), &hashes[i]);
+        }
     }
+}
 
-using WriteFunction = std::function<void(int32_t, BinaryRowWriter*)>;
-static Result<WriteFunction> WriteBucketRow(int32_t col_id,
-                                            const std::shared_ptr<arrow::Array>& field) {
-    arrow::Type::type type = field->type()->id();
-    switch (type) {
-        case arrow::Type::type::BOOL: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::BooleanArray*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteBoolean(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+/// Feeds the part of the BinaryRow hash contributed by one bucket key column.
+class FieldHasher {
+ public:
+    virtual ~FieldHasher() = default;
+
+    /// Mix the fixed-length slot of every row into `hashes`. Fields storing data in the
+    /// variable-length part use `cursors` as their offset and move it forward.
+    virtual void HashFixedPart(int32_t* cursors, uint32_t* hashes) const = 0;
+
+    /// Mix the variable-length part of every row into `hashes`.
+    virtual void HashVarPart(uint32_t* hashes) const {}
+
+    virtual bool HasVarPart() const {
+        return false;
+    }
+};
+
+template <typename ArrayType>
+class PrimitiveFieldHasher : public FieldHasher {
+ public:
+    explicit PrimitiveFieldHasher(const ArrayType* array) : array_(array) {}
+
+    void HashFixedPart(int32_t* cursors, uint32_t* hashes) const override {
+        const auto* values = array_->raw_values();
+        HashSlots(
+            *array_, [values](int64_t i) { return ToSlot(values[i]); }, hashes);
+    }
+
+ private:
+    const ArrayType* array_;
+};
+
+class BooleanFieldHasher : public FieldHasher {
+ public:
+    explicit BooleanFieldHasher(const arrow::BooleanArray* array) : array_(array) {}
+
+    void HashFixedPart(int32_t* cursors, uint32_t* hashes) const override {
+        HashSlots(
+            *array_, [this](int64_t i) { return ToSlot(array_->Value(i)); }, hashes);
+    }
+
+ private:
+    const arrow::BooleanArray* array_;
+};
+
+class BinaryFieldHasher : public FieldHasher {
+ public:
+    explicit BinaryFieldHasher(const arrow::BinaryArray* array) : array_(array) {}
+
+    void HashFixedPart(int32_t* cursors, uint32_t* hashes) const override {
+        for (int64_t i = 0; i < array_->length(); i++) {
+            if (array_->IsNull(i)) {
+                HashSlot(0, &hashes[i]);
+                continue;
+            }
+            std::string_view value = array_->GetView(i);
+            auto len = static_cast<int32_t>(value.size());
+            uint64_t slot = 0;
+            if (len <= BinarySection::MAX_FIX_PART_DATA_SIZE) {
+                // first byte is 0x80 | len, the other 7 bytes hold the data
+                memcpy(&slot, value.data(), len);
+                slot |= static_cast<uint64_t>(len | 0x80) << 56;
+            } else {
+                slot = ToOffsetAndSize(cursors[i], len);
+                cursors[i] += RoundToWord(len);
+            }
+            HashSlot(slot, &hashes[i]);
         }
-        case arrow::Type::type::INT8: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::Int8Array*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteByte(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+    }
+
+    void HashVarPart(uint32_t* hashes) const override {
+        for (int64_t i = 0; i < array_->length(); i++) {
+            if (array_->IsNull(i)) {
+                continue;
+            }
+            std::string_view value = array_->GetView(i);
+            auto len = static_cast<int32_t>(value.size());
+            if (len <= BinarySection::MAX_FIX_PART_DATA_SIZE) {
+                continue;
+            }
+            int32_t pos = 0;
+            for (; pos + 4 <= len; pos += 4) {
+                uint32_t word;
+                memcpy(&word, value.data() + pos, sizeof(word));
+                hashes[i] = MurmurHashUtils::HashWord(hashes[i], word);
+            }
+            if (pos < len) {
+                uint32_t word = 0;
+                memcpy(&word, value.data() + pos, len - pos);
+                hashes[i] = MurmurHashUtils::HashWord(hashes[i], word);
+                pos += 4;
+            }
+            // zero padding up to the word boundary
+            for (; pos < RoundToWord(len); pos += 4) {
+                hashes[i] = MurmurHashUtils::HashWord(hashes[i], 0);
+            }
         }
-        case arrow::Type::type::INT16: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::Int16Array*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteShort(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+    }
+
+    bool HasVarPart() const override {
+        return true;
+    }
+
+ private:
+    const arrow::BinaryArray* array_;
+};
+
+class TimestampFieldHasher : public FieldHasher {
+ public:
+    TimestampFieldHasher(const arrow::TimestampArray* array, int32_t precision,
+                         DateTimeUtils::TimeType time_type)
+        : array_(array), compact_(Timestamp::IsCompact(precision)), time_type_(time_type) {}
+
+    void HashFixedPart(int32_t* cursors, uint32_t* hashes) const override {
+        if (compact_) {
+            HashSlots(
+                *array_, [this](int64_t i) { return ToSlot(MilliAndNano(i).first); }, hashes);
+            return;
         }
-        case arrow::Type::type::INT32: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::Int32Array*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteInt(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+        // non-compact timestamp stores the millisecond in the variable-length part and the
+        // nanoOfMillisecond in the fixed-length part, null value still occupies 8 bytes
+        for (int64_t i = 0; i < array_->length(); i++) {
+            int64_t nano = array_->IsNull(i) ? 0 : MilliAndNano(i).second;
+            HashSlot(ToOffsetAndSize(cursors[i], nano), &hashes[i]);
+            cursors[i] += 8;
         }
-        case arrow::Type::type::INT64: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::Int64Array*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteLong(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+    }
+
+    void HashVarPart(uint32_t* hashes) const override {
+        if (compact_) {
+            return;
         }
-        case arrow::Type::type::FLOAT: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::FloatArray*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteFloat(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+        for (int64_t i = 0; i < array_->length(); i++) {
+            int64_t milli = array_->IsNull(i) ? 0 : MilliAndNano(i).first;
+            HashSlot(ToSlot(milli), &hashes[i]);
         }
-        case arrow::Type::type::DOUBLE: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::DoubleArray*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteDouble(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+    }
+
+    bool HasVarPart() const override {
+        return !compact_;
+    }
+
+ private:
+    std::pair<int64_t, int64_t> MilliAndNano(int64_t i) const {
+        return DateTimeUtils::TimestampConverter(array_->Value(i), time_type_,
+                                                 DateTimeUtils::TimeType::MILLISECOND,
+                                                 DateTimeUtils::TimeType::NANOSECOND);
+    }
+
+    const arrow::TimestampArray* array_;
+    bool compact_;
+    DateTimeUtils::TimeType time_type_;
+};
+
+class DecimalFieldHasher : public FieldHasher {
+ public:
+    DecimalFieldHasher(const arrow::Decimal128Array* array, int32_t precision, int32_t scale)
+        : array_(array),
+          compact_(Decimal::IsCompact(precision)),
+          precision_(precision),
+          scale_(scale) {}
+
+    void HashFixedPart(int32_t* cursors, uint32_t* hashes) const override {
+        if (compact_) {
+            // compact decimal is stored as the unscaled long
+            HashSlots(
+                *array_, [this](int64_t i) { return ToSlot(GetDecimal(i).ToUnscaledLong()); },
+                hashes);
+            return;
         }
-        case arrow::Type::type::DATE32: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::Date32Array*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                row_writer->WriteInt(col_id, typed_array->Value(row_id));
-            };
-            return writer_func;
+        // non-compact decimal stores its unscaled bytes in 16 bytes of the variable-length part,
+        // null value still occupies them
+        for (int64_t i = 0; i < array_->length(); i++) {
+            int64_t size = array_->IsNull(i) ? 0 : GetDecimal(i).ToUnscaledBytes().size();
+            HashSlot(ToOffsetAndSize(cursors[i], size), &hashes[i]);
+            cursors[i] += 16;
         }
-        case arrow::Type::type::STRING: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::StringArray*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                std::string_view value = typed_array->GetView(row_id);
-                row_writer->WriteStringView(col_id, value);
-            };
-            return writer_func;
+    }
+
+    void HashVarPart(uint32_t* hashes) const override {
+        if (compact_) {
+            return;
         }
-        case arrow::Type::type::BINARY: {
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::BinaryArray*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array](int32_t row_id,
-                                                              BinaryRowWriter* row_writer) {
-                CHECK_AND_SET_NULL(typed_array, row_writer, row_id, col_id);
-                std::string_view value = typed_array->GetView(row_id);
-                row_writer->WriteStringView(col_id, value);
-            };
-            return writer_func;
+        for (int64_t i = 0; i < array_->length(); i++) {
+            uint64_t words[2] = {0, 0};
+            if (!array_->IsNull(i)) {
+                std::vector<char> bytes = GetDecimal(i).ToUnscaledBytes();
+                assert(bytes.size() <= sizeof(words));
+                memcpy(words, bytes.data(), bytes.size());
+            }
+            HashSlot(words[0], &hashes[i]);
+            HashSlot(words[1], &hashes[i]);
         }
+    }
+
+    bool HasVarPart() const override {
+        return !compact_;
+    }
+
+ private:
+    Decimal GetDecimal(int64_t i) const {
+        arrow::Decimal128 decimal128(array_->GetValue(i));
+        return Decimal(precision_, scale_,
+                       static_cast<Decimal::int128_t>(decimal128.high_bits()) << 64 |
+                           decimal128.low_bits());
+    }
+
+    const arrow::Decimal128Array* array_;
+    bool compact_;
+    int32_t precision_;
+    int32_t scale_;
+};
+
+Result<std::unique_ptr<FieldHasher>> CreateFieldHasher(
+    const std::shared_ptr<arrow::Array>& field) {
+    arrow::Type::type type = field->type()->id();
+    switch (type) {
+        case arrow::Type::type::BOOL:
+            return std::make_unique<BooleanFieldHasher>(
+                arrow::internal::checked_cast<const arrow::BooleanArray*>(field.get()));
+        case arrow::Type::type::INT8:
+            return std::make_unique<PrimitiveFieldHasher<arrow::Int8Array>>(
+                arrow::internal::checked_cast<const arrow::Int8Array*>(field.get()));
+        case arrow::Type::type::INT16:
+            return std::make_unique<PrimitiveFieldHasher<arrow::Int16Array>>(
+                arrow::internal::checked_cast<const arrow::Int16Array*>(field.get()));
+        case arrow::Type::type::INT32:
+            return std::make_unique<PrimitiveFieldHasher<arrow::Int32Array>>(
+                arrow::internal::checked_cast<const arrow::Int32Array*>(field.get()));
+        case arrow::Type::type::INT64:
+            return std::make_unique<PrimitiveFieldHasher<arrow::Int64Array>>(
+                arrow::internal::checked_cast<const arrow::Int64Array*>(field.get()));
+        case arrow::Type::type::FLOAT:
+            return std::make_unique<PrimitiveFieldHasher<arrow::FloatArray>>(
+                arrow::internal::checked_cast<const arrow::FloatArray*>(field.get()));
+        case arrow::Type::type::DOUBLE:
+            return std::make_unique<PrimitiveFieldHasher<arrow::DoubleArray>>(
+                arrow::internal::checked_cast<const arrow::DoubleArray*>(field.get()));
+        case arrow::Type::type::DATE32:
+            return std::make_unique<PrimitiveFieldHasher<arrow::Date32Array>>(
+                arrow::internal::checked_cast<const arrow::Date32Array*>(field.get()));
+        case arrow::Type::type::STRING:
+        case arrow::Type::type::BINARY:
+            return std::make_unique<BinaryFieldHasher>(
+                arrow::internal::checked_cast<const arrow::BinaryArray*>(field.get()));
         case arrow::Type::type::TIMESTAMP: {
             auto timestamp_type =
                 arrow::internal::checked_pointer_cast<arrow::TimestampType>(field->type());
             assert(timestamp_type);
-            int32_t precision = DateTimeUtils::GetPrecisionFromType(timestamp_type);
-            DateTimeUtils::TimeType time_type =
-                DateTimeUtils::GetTimeTypeFromArrowType(timestamp_type);
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::TimestampArray*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [typed_array, col_id, precision, time_type](
-                                            int32_t row_id, BinaryRowWriter* row_writer) {
-                if (typed_array->IsNull(row_id)) {
-                    if (!Timestamp::IsCompact(precision)) {
-                        row_writer->WriteTimestamp(col_id, std::nullopt, precision);
-                    } else {
-                        row_writer->SetNullAt(col_id);
-                    }
-                    return;
-                }
-                int64_t ts_value = typed_array->Value(row_id);
-                auto [milli, nano] = DateTimeUtils::TimestampConverter(
-                    ts_value, time_type, DateTimeUtils::TimeType::MILLISECOND,
-                    DateTimeUtils::TimeType::NANOSECOND);
-                row_writer->WriteTimestamp(col_id, Timestamp(milli, nano), precision);
-            };
-            return writer_func;
+            return std::make_unique<TimestampFieldHasher>(
+                arrow::internal::checked_cast<const arrow::TimestampArray*>(field.get()),
+                DateTimeUtils::GetPrecisionFromType(timestamp_type),
+                DateTimeUtils::GetTimeTypeFromArrowType(timestamp_type));
         }
         case arrow::Type::type::DECIMAL: {
             const auto* decimal_type =
                 arrow::internal::checked_cast<const arrow::Decimal128Type*>(field->type().get());
             assert(decimal_type);
-            auto precision = decimal_type->precision();
-            auto scale = decimal_type->scale();
-            const auto* typed_array =
-                arrow::internal::checked_cast<const arrow::Decimal128Array*>(field.get());
-            assert(typed_array);
-            WriteFunction writer_func = [col_id, typed_array, precision, scale](
-                                            int32_t row_id, BinaryRowWriter* row_writer) {
-                if (typed_array->IsNull(row_id)) {
-                    if (!Decimal::IsCompact(precision)) {
-                        row_writer->WriteDecimal(col_id, std::nullopt, precision);
-                    } else {
-                        row_writer->SetNullAt(col_id);
-                    }
-                    return;
-                }
-                arrow::Decimal128 decimal128(typed_array->GetValue(row_id));
-                Decimal decimal(precision, scale,
-                                static_cast<Decimal::int128_t>(decimal128.high_bits()) << 64 |
-                                    decimal128.low_bits());
-                row_writer->WriteDecimal(col_id, decimal, precision);
-            };
-            return writer_func;
+            return std::make_unique<DecimalFieldHasher>(
+                arrow::internal::checked_cast<const arrow::Decimal128Array*>(field.get()),
+                decimal_type->precision(), decimal_type->scale());
         }
         default:
             return Status::Invalid(
                 fmt::format("type {} not support in write bucket row", field->type()->ToString()));
     }
 }
+
+/// Mix the null bits of the BinaryRow header into `hashes`. The first byte of the header is the
+/// row kind, which is not written for bucket rows and stays zero.
+void HashNullBits(const arrow::StructArray& struct_array, uint32_t* hashes) {
+    const int64_t length = struct_array.length();
+    const int32_t num_fields = struct_array.num_fields();
+    const int32_t num_words = BinaryRow::CalculateBitSetWidthInBytes(num_fields) / 4;
+    std::vector<uint32_t> words(length);
+    for (int32_t word = 0; word < num_words; word++) {
+        std::fill(words.begin(), words.end(), 0);
+        int32_t first_col = std::max(0, word * 32 - BinaryRow::HEADER_SIZE_IN_BITS);
+        int32_t end_col = std::min(num_fields, (word + 1) * 32 - BinaryRow::HEADER_SIZE_IN_BITS);
+        for (int32_t col = first_col; col < end_col; col++) {
+            const std::shared_ptr<arrow::Array>& field = struct_array.field(col);
+            if (field->null_count() == 0) {
+                continue;
+            }
+            uint32_t bit = 1u << ((col + BinaryRow::HEADER_SIZE_IN_BITS) % 32);
+            for (int64_t i = 0; i < length; i++) {
+                if (field->IsNull(i)) {
+                    words[i] |= bit;
+                }
+            }
+        }
+        for (int64_t i = 0; i < length; i++) {
+            hashes[i] = MurmurHashUtils::HashWord(hashes[i], words[i]);
+        }
+    }
+}
 }  // namespace
 
 Result<std::unique_ptr<BucketIdCalculator>> BucketIdCalculator::Create(
@@ -281,27 +440,61 @@ Status BucketIdCalculator::CalculateBucketIds(ArrowArray* bucket_keys, ArrowSche
     if (!struct_array) {
         return Status::Invalid("bucket keys is not a struct array");
     }
-    std::vector<WriteFunction> write_functions;
     int32_t num_fields = struct_array->num_fields();
-    write_functions.reserve(num_fields);
+    std::vector<std::unique_ptr<FieldHasher>> field_hashers;
+    field_hashers.reserve(num_fields);
+    bool has_var_part = false;
     for (int32_t col = 0; col < num_fields; col++) {
-        PAIMON_ASSIGN_OR_RAISE(WriteFunction write_func,
-                               WriteBucketRow(col, struct_array->field(col)));
-        write_functions.push_back(std::move(write_func));
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FieldHasher> field_hasher,
+                               CreateFieldHasher(struct_array->field(col)));
+        has_var_part |= field_hasher->HasVarPart();
+        field_hashers.push_back(std::move(field_hasher));
+    }
+
+    const auto length = static_cast<int32_t>(struct_array->length());
+    const int32_t fixed_size = BinaryRow::CalculateFixPartSizeInBytes(num_fields);
+    auto hash_buffer =
+        Bytes::AllocateBytes(static_cast<int32_t>(length * sizeof(uint32_t)), pool_.get());
+    auto* hashes = reinterpret_cast<uint32_t*>(hash_buffer->data());
+    std::fill(hashes, hashes + length, static_cast<uint32_t>(MurmurHashUtils::DEFAULT_SEED));
+    // per-row size of the BinaryRow, only grows beyond the fixed-length part for var-length data
+    PAIMON_UNIQUE_PTR<Bytes> cursor_buffer;
+    int32_t* cursors = nullptr;
+    if (has_var_part) {
+        cursor_buffer = Bytes::AllocateBytes(static_cast<int32_t>(length * sizeof(int32_t)),
+                                              pool_.get());
+        cursors = reinterpret_cast<int32_t*>(cursor_buffer->data());
+        std::fill(cursors, cursors + length, fixed_size);
     }
 
-    BinaryRow bucket_row(num_fields);
-    BinaryRowWriter row_writer(&bucket_row, /*initial_size=*/1024, pool_.get());
-    for (int32_t row = 0; row < struct_array->length(); row++) {
-        row_writer.Reset();
-        for (int32_t col = 0; col < num_fields; col++) {
-            write_functions[col](row, &row_writer);
+    HashNullBits(*struct_array, hashes);
+    for (const auto& field_hasher : field_hashers) {
+        field_hasher->HashFixedPart(cursors, hashes);
+    }
+    if (has_var_part) {
+        for (const auto& field_hasher : field_hashers) {
+            field_hasher->HashVarPart(hashes);
         }
-        row_writer.Complete();
-        bucket_ids[row] = std::abs(bucket_row.HashCode() % num_buckets_);
+    }
+    for (int32_t row = 0; row < length; row++) {
+        int32_t row_size = cursors ? cursors[row] : fixed_size;
+        int32_t hash_code = MurmurHashUtils::FinalizeHash(hashes[row], row_size);
+        bucket_ids[row] = std::abs(hash_code % num_buckets_);
     }
     guard.Release();
     return Status::OK();
 }
 
+Status BucketIdCalculator::SplitByBucket(
+    ArrowArray* bucket_keys, ArrowSchema* bucket_schema,
+    std::map<int32_t, std::vector<int32_t>>* bucket_selections) const {
+    std::vector<int32_t> bucket_ids(bucket_keys->length);
+    PAIMON_RETURN_NOT_OK(CalculateBucketIds(bucket_keys, bucket_schema, bucket_ids.data()));
+    bucket_selections->clear();
+    for (int32_t row = 0; row < static_cast<int32_t>(bucket_ids.size()); row++) {
+        (*bucket_selections)[bucket_ids[row]].push_back(row);
+    }
+    return Status::OK();
+}
+
 }  // namespace paimon
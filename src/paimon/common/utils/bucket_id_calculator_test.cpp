@@ -16,6 +16,9 @@
 
 #include "paimon/utils/bucket_id_calculator.h"
 
+#include <cstdlib>
+#include <map>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,9 +32,14 @@
 #include "arrow/ipc/json_simple.h"
 #include "arrow/util/checked_cast.h"
 #include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/binary_row_writer.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/date_time_utils.h"
+#include "paimon/data/decimal.h"
+#include "paimon/data/timestamp.h"
 #include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
 #include "paimon/testing/utils/testharness.h"
 
 namespace paimon::test {
@@ -63,6 +71,82 @@ class BucketIdCalculatorTest : public ::testing::Test {
                                               arrow::struct_(bucket_schema->fields()), data_str));
         return CalculateBucketIds(is_pk_table, num_buckets, bucket_schema, bucket_array);
     }
+
+    // calculate bucket ids by writing each row into a BinaryRow, supports the types generated in
+    // TestCompatibleWithBinaryRow
+    std::vector<int32_t> CalculateBucketIdsByBinaryRow(int32_t num_buckets,
+                                                       const arrow::StructArray& array) const {
+        using arrow::internal::checked_cast;
+        auto pool = GetDefaultPool();
+        BinaryRow row(array.num_fields());
+        BinaryRowWriter writer(&row, /*initial_size=*/1024, pool.get());
+        std::vector<int32_t> bucket_ids;
+        for (int64_t i = 0; i < array.length(); i++) {
+            writer.Reset();
+            for (int32_t col = 0; col < array.num_fields(); col++) {
+                const auto& field = array.field(col);
+                bool is_null = field->IsNull(i);
+                switch (field->type_id()) {
+                    case arrow::Type::type::INT32:
+                        if (is_null) {
+                            writer.SetNullAt(col);
+                        } else {
+                            writer.WriteInt(
+                                col, checked_cast<const arrow::Int32Array&>(*field).Value(i));
+                        }
+                        break;
+                    case arrow::Type::type::STRING:
+                        if (is_null) {
+                            writer.SetNullAt(col);
+                        } else {
+                            writer.WriteStringView(
+                                col, checked_cast<const arrow::StringArray&>(*field).GetView(i));
+                        }
+                        break;
+                    case arrow::Type::type::TIMESTAMP: {
+                        // timestamp(NANO) is not compact
+                        std::optional<Timestamp> value;
+                        if (!is_null) {
+                            int64_t nanos =
+                                checked_cast<const arrow::TimestampArray&>(*field).Value(i);
+                            auto [milli, nano] = DateTimeUtils::TimestampConverter(
+                                nanos, DateTimeUtils::TimeType::NANOSECOND,
+                                DateTimeUtils::TimeType::MILLISECOND,
+                                DateTimeUtils::TimeType::NANOSECOND);
+                            value = Timestamp(milli, nano);
+                        }
+                        writer.WriteTimestamp(col, value, /*precision=*/9);
+                        break;
+                    }
+                    case arrow::Type::type::DECIMAL: {
+                        const auto& decimal_type =
+                            checked_cast<const arrow::Decimal128Type&>(*field->type());
+                        int32_t precision = decimal_type.precision();
+                        if (is_null && Decimal::IsCompact(precision)) {
+                            writer.SetNullAt(col);
+                            break;
+                        }
+                        std::optional<Decimal> value;
+                        if (!is_null) {
+                            arrow::Decimal128 decimal128(
+                                checked_cast<const arrow::Decimal128Array&>(*field).GetValue(i));
+                            value = Decimal(
+                                precision, decimal_type.scale(),
+                                static_cast<Decimal::int128_t>(decimal128.high_bits()) << 64 |
+                                    decimal128.low_bits());
+                        }
+                        writer.WriteDecimal(col, value, precision);
+                        break;
+                    }
+                    default:
+                        ADD_FAILURE() << "unexpected type " << field->type()->ToString();
+                }
+            }
+            writer.Complete();
+            bucket_ids.push_back(std::abs(row.HashCode() % num_buckets));
+        }
+        return bucket_ids;
+    }
 };
 
 TEST_F(BucketIdCalculatorTest, TestCompatibleWithJava) {
@@ -304,4 +388,99 @@ TEST_F(BucketIdCalculatorTest, TestVariantType) {
         CalculateBucketIds(/*is_pk_table=*/true, 12345, bucket_schema, bucket_array));
     ASSERT_EQ(expected, result2);
 }
+
+TEST_F(BucketIdCalculatorTest, TestCompatibleWithBinaryRow) {
+    // more than 56 fields makes the null bits span two words, strings of different length mix
+    // inline and var-length values, non-compact timestamp and decimal use the var-length part
+    arrow::FieldVector fields;
+    for (int32_t i = 0; i < 60; i++) {
+        switch (i % 5) {
+            case 0:
+                fields.push_back(arrow::field("f" + std::to_string(i), arrow::int32()));
+                break;
+            case 1:
+                fields.push_back(arrow::field("f" + std::to_string(i), arrow::utf8()));
+                break;
+            case 2:
+                fields.push_back(
+                    arrow::field("f" + std::to_string(i), arrow::timestamp(arrow::TimeUnit::NANO)));
+                break;
+            case 3:
+                fields.push_back(arrow::field("f" + std::to_string(i), arrow::decimal128(30, 2)));
+                break;
+            default:
+                fields.push_back(arrow::field("f" + std::to_string(i), arrow::decimal128(10, 2)));
+        }
+    }
+    auto bucket_schema = arrow::schema(fields);
+
+    std::string data_str = "[";
+    for (int32_t row = 0; row < 200; row++) {
+        data_str += row == 0 ? "[" : ",[";
+        for (int32_t i = 0; i < 60; i++) {
+            if (i > 0) {
+                data_str += ",";
+            }
+            if (RandomNumber(0, 9) == 0) {
+                data_str += "null";
+                continue;
+            }
+            switch (i % 5) {
+                case 0:
+                    data_str += std::to_string(RandomNumber(-100000, 100000));
+                    break;
+                case 1:
+                    data_str += "\"" + std::string(RandomNumber(0, 20), 'a' + i % 26) + "\"";
+                    break;
+                case 2:
+                    data_str += std::to_string(RandomNumber(-1000000000000000l, 1000000000000000l));
+                    break;
+                default:
+                    data_str += "\"" + std::to_string(RandomNumber(-1000000, 1000000)) + ".25\"";
+            }
+        }
+        data_str += "]";
+    }
+    data_str += "]";
+    auto array = arrow::ipc::internal::json::ArrayFromJSON(
+                     arrow::struct_(bucket_schema->fields()), data_str)
+                     .ValueOrDie();
+    // sliced array checks that offsets of children are respected
+    auto sliced_array = array->Slice(/*offset=*/7, /*length=*/150);
+    ASSERT_OK_AND_ASSIGN(
+        std::vector<int32_t> result,
+        CalculateBucketIds(/*is_pk_table=*/true, 12345, bucket_schema, sliced_array));
+    ASSERT_EQ(CalculateBucketIdsByBinaryRow(
+                  12345, arrow::internal::checked_cast<const arrow::StructArray&>(*sliced_array)),
+              result);
+}
+
+TEST_F(BucketIdCalculatorTest, TestSplitByBucket) {
+    auto bucket_schema = arrow::schema(arrow::FieldVector(
+        {arrow::field("b0", arrow::int32()), arrow::field("b1", arrow::utf8())}));
+    std::string data_str =
+        R"([[1, "a"], [2, "b"], [3, "a long string value"], [1, "a"], [null, null], [2, "b"]])";
+    ASSERT_OK_AND_ASSIGN(auto bucket_ids, CalculateBucketIds(/*is_pk_table=*/true, 3,
+                                                             bucket_schema, data_str));
+    std::map<int32_t, std::vector<int32_t>> expected;
+    for (int32_t row = 0; row < static_cast<int32_t>(bucket_ids.size()); row++) {
+        expected[bucket_ids[row]].push_back(row);
+    }
+
+    auto array = arrow::ipc::internal::json::ArrayFromJSON(
+                     arrow::struct_(bucket_schema->fields()), data_str)
+                     .ValueOrDie();
+    ::ArrowArray c_array;
+    ASSERT_TRUE(arrow::ExportArray(*array, &c_array).ok());
+    ::ArrowSchema c_schema;
+    ASSERT_TRUE(arrow::ExportSchema(*bucket_schema, &c_schema).ok());
+    ASSERT_OK_AND_ASSIGN(auto bucket_id_cal,
+                         BucketIdCalculator::Create(/*is_pk_table=*/true, /*num_buckets=*/3));
+    std::map<int32_t, std::vector<int32_t>> bucket_selections;
+    ASSERT_OK(bucket_id_cal->SplitByBucket(&c_array, &c_schema, &bucket_selections));
+    ASSERT_EQ(expected, bucket_selections);
+    // rows with same keys are in the same bucket
+    ASSERT_EQ(bucket_ids[0], bucket_ids[3]);
+    ASSERT_EQ(bucket_ids[1], bucket_ids[5]);
+}
 }  // namespace paimon::test
@@ -164,6 +164,25 @@ class MurmurHashUtils {
         return HashBytes(segment, offset, length_in_bytes, DEFAULT_SEED);
     }
 
+    /// Mix one 4-byte word into a running hash, which starts from the seed. Feeding the words of
+    /// an aligned buffer in order and calling `FinalizeHash()` equals `HashBytesByWords()`.
+    ///
+    /// @param h1 running hash
+    /// @param word next 4-byte word
+    /// @return updated running hash
+    static uint32_t HashWord(uint32_t h1, uint32_t word) {
+        return MixH1(h1, MixK1(word));
+    }
+
+    /// Finalize a running hash built by `HashWord()`.
+    ///
+    /// @param h1 running hash
+    /// @param length_in_bytes total length of the hashed words in bytes
+    /// @return hash code
+    static int32_t FinalizeHash(uint32_t h1, uint32_t length_in_bytes) {
+        return Fmix(h1, length_in_bytes);
+    }
+
  private:
     static int32_t HashUnsafeBytesByWords(const void* base, int64_t offset, int32_t length_in_bytes,
                                           int32_t seed) {
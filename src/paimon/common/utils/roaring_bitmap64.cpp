@@ -172,6 +172,11 @@ void RoaringBitmap64::AddRange(int64_t min, int64_t max) {
     GetRoaringBitmap(roaring_bitmap_).addRange(min, max);
 }
 
+void RoaringBitmap64::AddMany(const std::vector<int64_t>& values) {
+    GetRoaringBitmap(roaring_bitmap_)
+        .addMany(values.size(), reinterpret_cast<const uint64_t*>(values.data()));
+}
+
 void RoaringBitmap64::RemoveRange(int64_t min, int64_t max) {
     GetRoaringBitmap(roaring_bitmap_).removeRange(min, max);
 }
@@ -51,6 +51,11 @@ TEST(RoaringBitmap64Test, TestSimple) {
     ASSERT_EQ("{4147483647,614748364720,614748364723,614748364724,8147483647210}",
               roaring.ToString());
     ASSERT_EQ(5, roaring.Cardinality());
+    roaring.AddMany({1, 2, 614748364721l, 9147483647210l});
+    ASSERT_EQ("{1,2,4147483647,614748364720,614748364721,614748364723,614748364724,8147483647210,"
+              "9147483647210}",
+              roaring.ToString());
+    ASSERT_EQ(9, roaring.Cardinality());
 }
 TEST(RoaringBitmap64Test, TestCompatibleWithJava) {
     auto pool = GetDefaultPool();
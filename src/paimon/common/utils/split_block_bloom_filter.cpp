@@ -0,0 +1,161 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/split_block_bloom_filter.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#if defined(PAIMON_HAVE_AVX2) || defined(PAIMON_HAVE_SSE4_2)
+#include <immintrin.h>
+#endif
+
+#include "paimon/macros.h"
+#include "paimon/memory/bytes.h"
+
+namespace paimon {
+class MemoryPool;
+
+namespace {
+// salts of parquet split block bloom filter, each of the 8 words selects a bit with a different
+// multiplicative hash of the lower 32 bits of the hash
+alignas(32) constexpr uint32_t SALT[SplitBlockBloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+#if defined(PAIMON_HAVE_AVX2)
+inline __m256i MakeMask(uint32_t key) {
+    const __m256i salt = _mm256_load_si256(reinterpret_cast<const __m256i*>(SALT));
+    __m256i hashes = _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int32_t>(key)), salt);
+    hashes = _mm256_srli_epi32(hashes, 27);
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), hashes);
+}
+
+inline void InsertBlock(uint32_t* block, uint32_t key) {
+    auto* block_ptr = reinterpret_cast<__m256i*>(block);
+    __m256i bits = _mm256_loadu_si256(block_ptr);
+    _mm256_storeu_si256(block_ptr, _mm256_or_si256(bits, MakeMask(key)));
+}
+
+inline bool CheckBlock(const uint32_t* block, uint32_t key) {
+    __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    // true if all bits of mask are set in block
+    return _mm256_testc_si256(bits, MakeMask(key)) != 0;
+}
+#elif defined(PAIMON_HAVE_SSE4_2)
+// SSE has no per lane variable shift, 1 << x is computed as the float 2^x converted to integer,
+// 2^31 overflows to 0x80000000 which is exactly 1 << 31
+inline __m128i ShiftOne(__m128i x) {
+    __m128i exponent = _mm_add_epi32(_mm_slli_epi32(x, 23), _mm_set1_epi32(0x3f800000));
+    return _mm_cvttps_epi32(_mm_castsi128_ps(exponent));
+}
+
+inline void MakeMask(uint32_t key, __m128i* low, __m128i* high) {
+    __m128i key_vec = _mm_set1_epi32(static_cast<int32_t>(key));
+    __m128i salt_low = _mm_load_si128(reinterpret_cast<const __m128i*>(SALT));
+    __m128i salt_high = _mm_load_si128(reinterpret_cast<const __m128i*>(SALT + 4));
+    *low = ShiftOne(_mm_srli_epi32(_mm_mullo_epi32(key_vec, salt_low), 27));
+    *high = ShiftOne(_mm_srli_epi32(_mm_mullo_epi32(key_vec, salt_high), 27));
+}
+
+inline void InsertBlock(uint32_t* block, uint32_t key) {
+    __m128i mask_low;
+    __m128i mask_high;
+    MakeMask(key, &mask_low, &mask_high);
+    auto* block_ptr = reinterpret_cast<__m128i*>(block);
+    _mm_storeu_si128(block_ptr, _mm_or_si128(_mm_loadu_si128(block_ptr), mask_low));
+    _mm_storeu_si128(block_ptr + 1, _mm_or_si128(_mm_loadu_si128(block_ptr + 1), mask_high));
+}
+
+inline bool CheckBlock(const uint32_t* block, uint32_t key) {
+    __m128i mask_low;
+    __m128i mask_high;
+    MakeMask(key, &mask_low, &mask_high);
+    const auto* block_ptr = reinterpret_cast<const __m128i*>(block);
+    return _mm_testc_si128(_mm_loadu_si128(block_ptr), mask_low) != 0 &&
+           _mm_testc_si128(_mm_loadu_si128(block_ptr + 1), mask_high) != 0;
+}
+#else
+inline void InsertBlock(uint32_t* block, uint32_t key) {
+    for (int32_t i = 0; i < SplitBlockBloomFilter::WORDS_PER_BLOCK; i++) {
+        block[i] |= static_cast<uint32_t>(1) << ((key * SALT[i]) >> 27);
+    }
+}
+
+inline bool CheckBlock(const uint32_t* block, uint32_t key) {
+    // no early exit, so that the loop can be vectorized by compiler
+    uint32_t missing = 0;
+    for (int32_t i = 0; i < SplitBlockBloomFilter::WORDS_PER_BLOCK; i++) {
+        uint32_t mask = static_cast<uint32_t>(1) << ((key * SALT[i]) >> 27);
+        missing |= mask & ~block[i];
+    }
+    return missing == 0;
+}
+#endif
+}  // namespace
+
+SplitBlockBloomFilter::SplitBlockBloomFilter(int64_t items, double fpp,
+                                             const std::shared_ptr<MemoryPool>& pool) {
+    int32_t num_bytes = OptimalNumBytes(items, fpp);
+    num_blocks_ = num_bytes / BYTES_PER_BLOCK;
+    bytes_ = std::make_shared<Bytes>(num_bytes, pool.get());
+}
+
+SplitBlockBloomFilter::SplitBlockBloomFilter(const std::shared_ptr<Bytes>& bytes)
+    : num_blocks_(bytes->size() / BYTES_PER_BLOCK), bytes_(bytes) {
+    assert(bytes_->size() > 0 && bytes_->size() % BYTES_PER_BLOCK == 0);
+}
+
+int32_t SplitBlockBloomFilter::OptimalNumBytes(int64_t items, double fpp) {
+    assert(items > 0 && fpp > 0 && fpp < 1);
+    // each key sets 8 bits in a block, m = -8 * n / ln(1 - fpp^(1/8))
+    double num_bits = -8.0 * static_cast<double>(items) / std::log(1 - std::pow(fpp, 1.0 / 8));
+    double num_bytes = std::ceil(num_bits / 8 / BYTES_PER_BLOCK) * BYTES_PER_BLOCK;
+    return static_cast<int32_t>(std::clamp(num_bytes, static_cast<double>(BYTES_PER_BLOCK),
+                                           static_cast<double>(MAX_BYTES)));
+}
+
+void SplitBlockBloomFilter::AddHash(int64_t hash64) {
+    auto hash = static_cast<uint64_t>(hash64);
+    InsertBlock(BlockOf(hash), static_cast<uint32_t>(hash));
+}
+
+void SplitBlockBloomFilter::AddHashes(const int64_t* hashes, int64_t num_hashes) {
+    for (int64_t i = 0; i < num_hashes; i++) {
+        AddHash(hashes[i]);
+    }
+}
+
+bool SplitBlockBloomFilter::TestHash(int64_t hash64) const {
+    auto hash = static_cast<uint64_t>(hash64);
+    return CheckBlock(BlockOf(hash), static_cast<uint32_t>(hash));
+}
+
+void SplitBlockBloomFilter::TestHashes(const int64_t* hashes, int64_t num_hashes,
+                                       uint8_t* results) const {
+    static constexpr int64_t PREFETCH_DISTANCE = 16;
+    for (int64_t i = 0; i < num_hashes; i++) {
+        if (i + PREFETCH_DISTANCE < num_hashes) {
+            // blocks of different keys are independent, prefetch hides the cache miss of later
+            // probes
+            PAIMON_PREFETCH(BlockOf(static_cast<uint64_t>(hashes[i + PREFETCH_DISTANCE])));
+        }
+        results[i] = TestHash(hashes[i]) ? 1 : 0;
+    }
+}
+
+}  // namespace paimon
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "paimon/memory/bytes.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+class MemoryPool;
+
+/// Split block bloom filter handles 64 bits hash, the bits of a key are all set in a single
+/// 256-bit block, so that adding or testing a key touches only one cache line. The block layout
+/// and the bit selection follow the parquet bloom filter spec
+/// (https://github.com/apache/parquet-format/blob/master/BloomFilter.md).
+///
+/// Probing is vectorized with AVX2 or SSE4.2 when paimon is built with `PAIMON_SIMD_LEVEL`,
+/// otherwise a scalar implementation is used.
+class PAIMON_EXPORT SplitBlockBloomFilter {
+ public:
+    static constexpr int32_t BYTES_PER_BLOCK = 32;
+    static constexpr int32_t WORDS_PER_BLOCK = 8;
+    static constexpr int32_t MAX_BYTES = 128 * 1024 * 1024;
+
+    SplitBlockBloomFilter(int64_t items, double fpp, const std::shared_ptr<MemoryPool>& pool);
+
+    /// Creates a filter on serialized blocks.
+    /// @param bytes Serialized blocks, size must be a positive multiple of `BYTES_PER_BLOCK`.
+    explicit SplitBlockBloomFilter(const std::shared_ptr<Bytes>& bytes);
+
+    /// @return The number of bytes needed for `items` distinct values with false positive
+    ///         probability `fpp`, which is a multiple of `BYTES_PER_BLOCK`.
+    static int32_t OptimalNumBytes(int64_t items, double fpp);
+
+    void AddHash(int64_t hash64);
+
+    void AddHashes(const int64_t* hashes, int64_t num_hashes);
+
+    bool TestHash(int64_t hash64) const;
+
+    /// Tests `num_hashes` hashes, `results[i]` is set to 1 if `hashes[i]` may be contained and 0
+    /// otherwise.
+    void TestHashes(const int64_t* hashes, int64_t num_hashes, uint8_t* results) const;
+
+    /// @return The serialized blocks, words are stored in little endian.
+    const std::shared_ptr<Bytes>& GetBytes() const {
+        return bytes_;
+    }
+
+ private:
+    uint32_t* BlockOf(uint64_t hash) const {
+        // fast range reduction, maps the upper 32 bits of hash to [0, num_blocks_)
+        uint64_t block_index = ((hash >> 32) * static_cast<uint64_t>(num_blocks_)) >> 32;
+        return reinterpret_cast<uint32_t*>(bytes_->data()) + block_index * WORDS_PER_BLOCK;
+    }
+
+ private:
+    int64_t num_blocks_ = 0;
+    std::shared_ptr<Bytes> bytes_;
+};
+}  // namespace paimon
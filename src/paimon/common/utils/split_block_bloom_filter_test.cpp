@@ -0,0 +1,124 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/split_block_bloom_filter.h"
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon::test {
+
+TEST(SplitBlockBloomFilterTest, TestSimple) {
+    int32_t items = 10000;
+    auto pool = GetDefaultPool();
+    SplitBlockBloomFilter bloom_filter(items, 0.02, pool);
+    std::mt19937_64 engine(std::random_device{}());  // NOLINT(whitespace/braces)
+    std::uniform_int_distribution<int64_t> distribution(std::numeric_limits<int64_t>::min(),
+                                                        std::numeric_limits<int64_t>::max());
+    std::set<int64_t> test_data;
+    for (int32_t i = 0; i < items; i++) {
+        int64_t random = distribution(engine);
+        test_data.insert(random);
+        bloom_filter.AddHash(random);
+    }
+
+    for (const auto& value : test_data) {
+        ASSERT_TRUE(bloom_filter.TestHash(value));
+    }
+
+    // test false positive
+    int32_t false_positives = 0;
+    int32_t num = 1000000;
+    for (int32_t i = 0; i < num; i++) {
+        int64_t random = distribution(engine);
+        if (bloom_filter.TestHash(random) && test_data.find(random) == test_data.end()) {
+            false_positives++;
+        }
+    }
+    ASSERT_TRUE(static_cast<double>(false_positives) / num < 0.03);
+}
+
+TEST(SplitBlockBloomFilterTest, TestBatch) {
+    auto pool = GetDefaultPool();
+    std::mt19937_64 engine(std::random_device{}());  // NOLINT(whitespace/braces)
+    std::vector<int64_t> added(1000);
+    for (auto& hash : added) {
+        hash = static_cast<int64_t>(engine());
+    }
+    SplitBlockBloomFilter bloom_filter(/*items=*/added.size(), /*fpp=*/0.01, pool);
+    bloom_filter.AddHashes(added.data(), added.size());
+
+    std::vector<int64_t> probes(added);
+    for (int32_t i = 0; i < 1000; i++) {
+        probes.push_back(static_cast<int64_t>(engine()));
+    }
+    std::vector<uint8_t> results(probes.size());
+    bloom_filter.TestHashes(probes.data(), probes.size(), results.data());
+    for (size_t i = 0; i < probes.size(); i++) {
+        ASSERT_EQ(bloom_filter.TestHash(probes[i]) ? 1 : 0, results[i]);
+        if (i < added.size()) {
+            ASSERT_EQ(1, results[i]);
+        }
+    }
+
+    // filter on the serialized blocks has the same results
+    const auto& bytes = bloom_filter.GetBytes();
+    auto copied = std::make_shared<Bytes>(bytes->size(), pool.get());
+    std::memcpy(copied->data(), bytes->data(), bytes->size());
+    SplitBlockBloomFilter copied_filter(copied);
+    std::vector<uint8_t> copied_results(probes.size());
+    copied_filter.TestHashes(probes.data(), probes.size(), copied_results.data());
+    ASSERT_EQ(results, copied_results);
+}
+
+TEST(SplitBlockBloomFilterTest, TestCompatibleWithParquet) {
+    // a single block filter, key 0 sets bit 0 of each word as all the salted hashes are 0
+    auto pool = GetDefaultPool();
+    SplitBlockBloomFilter bloom_filter(/*items=*/1, /*fpp=*/0.5, pool);
+    ASSERT_EQ(SplitBlockBloomFilter::BYTES_PER_BLOCK, bloom_filter.GetBytes()->size());
+    bloom_filter.AddHash(0);
+    const auto* words = reinterpret_cast<const uint32_t*>(bloom_filter.GetBytes()->data());
+    for (int32_t i = 0; i < SplitBlockBloomFilter::WORDS_PER_BLOCK; i++) {
+        ASSERT_EQ(1u, words[i]);
+    }
+    // key 1 sets bit (salt >> 27) of each word
+    bloom_filter.AddHash(1);
+    ASSERT_EQ(1u | (1u << (0x47b6137bU >> 27)), words[0]);
+    ASSERT_EQ(1u | (1u << (0x5c6bfb31U >> 27)), words[7]);
+}
+
+TEST(SplitBlockBloomFilterTest, TestOptimalNumBytes) {
+    ASSERT_EQ(SplitBlockBloomFilter::BYTES_PER_BLOCK,
+              SplitBlockBloomFilter::OptimalNumBytes(/*items=*/1, /*fpp=*/0.1));
+    for (int64_t items : {100, 10000, 1000000}) {
+        int32_t num_bytes = SplitBlockBloomFilter::OptimalNumBytes(items, /*fpp=*/0.01);
+        ASSERT_EQ(0, num_bytes % SplitBlockBloomFilter::BYTES_PER_BLOCK);
+        // about 9.7 bits per item for 1% fpp
+        ASSERT_GT(num_bytes * 8, items * 9);
+        ASSERT_LT(num_bytes * 8, items * 10 + 256);
+    }
+    ASSERT_EQ(SplitBlockBloomFilter::MAX_BYTES,
+              SplitBlockBloomFilter::OptimalNumBytes(/*items=*/1000000000000L, /*fpp=*/0.01));
+}
+
+}  // namespace paimon::test
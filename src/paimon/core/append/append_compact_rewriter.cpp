@@ -0,0 +1,205 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/append/append_compact_rewriter.h"
+
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "arrow/type.h"
+#include "paimon/common/metrics/timer.h"
+#include "paimon/common/reader/reader_utils.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/long_counter.h"
+#include "paimon/common/utils/scope_guard.h"
+#include "paimon/core/io/data_file_index_writer.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/io/data_file_writer.h"
+#include "paimon/core/io/field_mapping_reader.h"
+#include "paimon/core/io/rolling_file_writer.h"
+#include "paimon/core/io/single_file_writer.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/utils/field_mapping.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/file_format_factory.h"
+#include "paimon/format/format_stats_extractor.h"
+#include "paimon/format/reader_builder.h"
+#include "paimon/format/writer_builder.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/reader/file_batch_reader.h"
+
+namespace paimon {
+class MemoryPool;
+
+AppendCompactRewriter::AppendCompactRewriter(
+    const std::shared_ptr<TableSchema>& table_schema,
+    std::unique_ptr<SchemaManager>&& schema_manager, const std::shared_ptr<arrow::Schema>& schema,
+    std::unique_ptr<FieldMappingBuilder>&& field_mapping_builder, const BinaryRow& partition,
+    const std::shared_ptr<DataFilePathFactory>& path_factory, const CoreOptions& options,
+    const std::shared_ptr<MemoryPool>& pool)
+    : pool_(pool),
+      table_schema_(table_schema),
+      schema_manager_(std::move(schema_manager)),
+      schema_(schema),
+      field_mapping_builder_(std::move(field_mapping_builder)),
+      partition_(partition),
+      path_factory_(path_factory),
+      options_(options) {}
+
+AppendCompactRewriter::~AppendCompactRewriter() = default;
+
+Result<std::unique_ptr<AppendCompactRewriter>> AppendCompactRewriter::Create(
+    const std::shared_ptr<TableSchema>& table_schema, const std::string& root_path,
+    const std::shared_ptr<arrow::Schema>& schema, const BinaryRow& partition,
+    const std::shared_ptr<DataFilePathFactory>& path_factory, const CoreOptions& options,
+    const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FieldMappingBuilder> field_mapping_builder,
+                           FieldMappingBuilder::Create(schema, table_schema->PartitionKeys(),
+                                                       /*predicate=*/nullptr));
+    auto schema_manager =
+        std::make_unique<SchemaManager>(options.GetFileSystem(), root_path, options.GetBranch());
+    return std::unique_ptr<AppendCompactRewriter>(new AppendCompactRewriter(
+        table_schema, std::move(schema_manager), schema, std::move(field_mapping_builder),
+        partition, path_factory, options, pool));
+}
+
+Result<std::vector<std::shared_ptr<DataFileMeta>>> AppendCompactRewriter::Rewrite(
+    const std::vector<std::shared_ptr<DataFileMeta>>& to_compact,
+    const std::atomic<bool>& cancelled) const {
+    if (to_compact.empty()) {
+        return std::vector<std::shared_ptr<DataFileMeta>>();
+    }
+    // rewritten records take over the sequence numbers of the input files
+    auto seq_num_counter = std::make_shared<LongCounter>(to_compact[0]->min_sequence_number);
+    auto create_file_writer = [this, seq_num_counter]()
+        -> Result<std::unique_ptr<SingleFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>> {
+        ::ArrowSchema arrow_schema;
+        ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema_, &arrow_schema));
+        auto format = options_.GetWriteFileFormat();
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<WriterBuilder> writer_builder,
+            format->CreateWriterBuilder(&arrow_schema, options_.GetWriteBatchSize()));
+        writer_builder->WithMemoryPool(pool_);
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema_, &arrow_schema));
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
+                               format->CreateStatsExtractor(&arrow_schema));
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<DataFileIndexWriter> index_writer,
+            DataFileIndexWriter::Create(schema_, options_.GetFileIndexColumns(),
+                                        options_.GetFileIndexInManifestThreshold(), pool_));
+        auto writer = std::make_unique<DataFileWriter>(
+            options_.GetFileCompression(), std::function<Status(ArrowArray*, ArrowArray*)>(),
+            table_schema_->Id(), seq_num_counter, FileSource::Compact(), stats_extractor,
+            path_factory_->IsExternalPath(), /*write_cols=*/std::nullopt, std::move(index_writer),
+            pool_);
+        PAIMON_RETURN_NOT_OK(
+            writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
+        return writer;
+    };
+    auto rolling_writer =
+        std::make_unique<RollingFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>(
+            options_.GetTargetFileSize(), create_file_writer);
+    std::unique_ptr<BatchReader> reader;
+    ScopeGuard guard([&rolling_writer, &reader]() {
+        if (reader) {
+            reader->Close();
+        }
+        rolling_writer->Abort();
+    });
+    // input files are opened one at a time, so that only one reader holds its buffers
+    for (const auto& file : to_compact) {
+        PAIMON_ASSIGN_OR_RAISE(reader, CreateFileReader(file));
+        while (true) {
+            if (cancelled.load()) {
+                return Status::Invalid("compaction is cancelled");
+            }
+            PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatch batch, reader->NextBatch());
+            if (BatchReader::IsEofBatch(batch)) {
+                break;
+            }
+            // the array is moved into the writer, release whatever is left
+            ScopeGuard batch_guard([&batch]() { ReaderUtils::ReleaseReadBatch(std::move(batch)); });
+            PAIMON_RETURN_NOT_OK(rolling_writer->Write(batch.first.get()));
+        }
+        reader->Close();
+        reader.reset();
+    }
+    PAIMON_RETURN_NOT_OK(rolling_writer->Close());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> after,
+                           rolling_writer->GetResult());
+    guard.Release();
+    return after;
+}
+
+Status AppendCompactRewriter::DeleteFile(const std::shared_ptr<DataFileMeta>& file) const {
+    // also delete extra files (e.g. file index) of the data file
+    for (const auto& path : path_factory_->CollectFiles(file)) {
+        PAIMON_RETURN_NOT_OK(options_.GetFileSystem()->Delete(path, /*recursive=*/false));
+    }
+    return Status::OK();
+}
+
+Result<std::unique_ptr<BatchReader>> AppendCompactRewriter::CreateFileReader(
+    const std::shared_ptr<DataFileMeta>& file) const {
+    std::shared_ptr<TableSchema> data_schema = table_schema_;
+    if (file->schema_id != table_schema_->Id()) {
+        // load schema to get data schema
+        PAIMON_ASSIGN_OR_RAISE(data_schema, schema_manager_->ReadSchema(file->schema_id));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FieldMapping> field_mapping,
+                           field_mapping_builder_->CreateFieldMapping(data_schema->Fields()));
+    auto file_read_schema = DataField::ConvertDataFieldsToArrowSchema(
+        field_mapping->non_partition_info.non_partition_data_schema);
+
+    PAIMON_ASSIGN_OR_RAISE(std::string format_identifier, file->FileFormat());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileFormat> file_format,
+                           FileFormatFactory::Get(format_identifier, options_.ToMap()));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReaderBuilder> reader_builder,
+                           file_format->CreateReaderBuilder(options_.GetReadBatchSize()));
+    reader_builder->WithMemoryPool(pool_);
+    std::string file_path = path_factory_->ToPath(file);
+    std::unique_ptr<FileBatchReader> file_reader;
+    Timer file_open_timer;
+    if (format_identifier == "lance") {
+        // lance do not support stream build with input stream
+        PAIMON_ASSIGN_OR_RAISE(file_reader, reader_builder->Build(file_path));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> input_stream,
+                               options_.GetFileSystem()->Open(file_path));
+        PAIMON_ASSIGN_OR_RAISE(file_reader, reader_builder->Build(input_stream));
+    }
+    uint64_t file_open_latency_us = file_open_timer.ElapsedUs();
+    ::ArrowSchema c_read_schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*file_read_schema, &c_read_schema));
+    PAIMON_RETURN_NOT_OK(file_reader->SetReadSchema(&c_read_schema, /*predicate=*/nullptr,
+                                                    /*selection_bitmap=*/std::nullopt));
+    auto mapping_reader = std::make_unique<FieldMappingReader>(
+        field_mapping_builder_->GetReadFieldCount(), std::move(file_reader), partition_,
+        std::move(field_mapping), pool_);
+    mapping_reader->RecordFileOpenLatency(file_open_latency_us);
+    return std::unique_ptr<BatchReader>(std::move(mapping_reader));
+}
+
+}  // namespace paimon
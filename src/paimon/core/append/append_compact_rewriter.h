@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class BatchReader;
+class DataFilePathFactory;
+class FieldMappingBuilder;
+class MemoryPool;
+class SchemaManager;
+class TableSchema;
+
+/// Rewrite data files of one bucket of an append-only table into new files of target file size,
+/// records keep the order of input files. Files written with an old schema are evolved to the
+/// latest schema.
+class AppendCompactRewriter {
+ public:
+    /// @param schema arrow schema of all fields of `table_schema`
+    static Result<std::unique_ptr<AppendCompactRewriter>> Create(
+        const std::shared_ptr<TableSchema>& table_schema, const std::string& root_path,
+        const std::shared_ptr<arrow::Schema>& schema, const BinaryRow& partition,
+        const std::shared_ptr<DataFilePathFactory>& path_factory, const CoreOptions& options,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    ~AppendCompactRewriter();
+
+    /// Rewrite `to_compact` which is ordered by sequence number, sequence numbers of rewritten
+    /// records start from the min sequence number of the first file.
+    ///
+    /// @param cancelled checked between batches, rewriting stops and written files are cleaned up
+    /// once it is set
+    Result<std::vector<std::shared_ptr<DataFileMeta>>> Rewrite(
+        const std::vector<std::shared_ptr<DataFileMeta>>& to_compact,
+        const std::atomic<bool>& cancelled) const;
+
+    /// Delete a data file which is produced by compaction but not committed.
+    Status DeleteFile(const std::shared_ptr<DataFileMeta>& file) const;
+
+ private:
+    AppendCompactRewriter(const std::shared_ptr<TableSchema>& table_schema,
+                          std::unique_ptr<SchemaManager>&& schema_manager,
+                          const std::shared_ptr<arrow::Schema>& schema,
+                          std::unique_ptr<FieldMappingBuilder>&& field_mapping_builder,
+                          const BinaryRow& partition,
+                          const std::shared_ptr<DataFilePathFactory>& path_factory,
+                          const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool);
+
+    Result<std::unique_ptr<BatchReader>> CreateFileReader(
+        const std::shared_ptr<DataFileMeta>& file) const;
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<TableSchema> table_schema_;
+    // schema manager is not thread-safe, so each rewriter owns one
+    std::unique_ptr<SchemaManager> schema_manager_;
+    std::shared_ptr<arrow::Schema> schema_;
+    std::unique_ptr<FieldMappingBuilder> field_mapping_builder_;
+    BinaryRow partition_;
+    std::shared_ptr<DataFilePathFactory> path_factory_;
+    CoreOptions options_;
+};
+}  // namespace paimon
@@ -16,6 +16,7 @@
 
 #include "paimon/core/append/append_only_writer.h"
 
+#include <algorithm>
 #include <functional>
 #include <string>
 #include <utility>
@@ -25,11 +26,13 @@
 #include "arrow/c/helpers.h"
 #include "arrow/type.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/timer.h"
 #include "paimon/common/types/row_kind.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/long_counter.h"
 #include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/io/compact_increment.h"
+#include "paimon/core/io/data_file_index_writer.h"
 #include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/io/data_file_writer.h"
 #include "paimon/core/io/data_increment.h"
@@ -37,10 +40,12 @@
 #include "paimon/core/io/rolling_file_writer.h"
 #include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/manifest/file_source.h"
+#include "paimon/core/operation/metrics/write_metrics.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/file_format_factory.h"
 #include "paimon/format/writer_builder.h"
+#include "paimon/fs/file_system.h"
 #include "paimon/macros.h"
 #include "paimon/metrics.h"
 #include "paimon/record_batch.h"
@@ -55,7 +60,8 @@ AppendOnlyWriter::AppendOnlyWriter(const CoreOptions& options, int64_t schema_id
                                    const std::optional<std::vector<std::string>>& write_cols,
                                    int64_t max_sequence_number,
                                    const std::shared_ptr<DataFilePathFactory>& path_factory,
-                                   const std::shared_ptr<MemoryPool>& memory_pool)
+                                   const std::shared_ptr<MemoryPool>& memory_pool,
+                                   const std::shared_ptr<CompactManager>& compact_manager)
     : options_(options),
       schema_id_(schema_id),
       write_schema_(write_schema),
@@ -63,7 +69,8 @@ AppendOnlyWriter::AppendOnlyWriter(const CoreOptions& options, int64_t schema_id
       seq_num_counter_(std::make_shared<LongCounter>(max_sequence_number + 1)),
       path_factory_(path_factory),
       memory_pool_(memory_pool),
-      metrics_(std::make_shared<MetricsImpl>()) {}
+      metrics_(std::make_shared<MetricsImpl>()),
+      compact_manager_(compact_manager) {}
 
 AppendOnlyWriter::~AppendOnlyWriter() = default;
 
@@ -83,26 +90,93 @@ Status AppendOnlyWriter::Write(std::unique_ptr<RecordBatch>&& batch) {
 }
 
 Result<CommitIncrement> AppendOnlyWriter::PrepareCommit(bool wait_compaction) {
-    PAIMON_RETURN_NOT_OK(Flush());
+    PAIMON_RETURN_NOT_OK(Flush(/*wait_for_latest_compaction=*/false));
+    PAIMON_RETURN_NOT_OK(TrySyncLatestCompaction(wait_compaction));
     return DrainIncrement();
 }
 
 Result<CommitIncrement> AppendOnlyWriter::DrainIncrement() {
     DataIncrement data_increment(std::move(new_files_), std::move(deleted_files_), {});
-    CompactIncrement compact_increment({}, {}, {});
+    std::vector<std::shared_ptr<DataFileMeta>> compact_before;
+    compact_before.reserve(compact_before_.size());
+    for (const auto& [file_name, file] : compact_before_) {
+        compact_before.push_back(file);
+    }
+    CompactIncrement compact_increment(std::move(compact_before), std::move(compact_after_), {});
     new_files_.clear();
     deleted_files_.clear();
+    compact_before_.clear();
+    compact_after_.clear();
     return CommitIncrement(data_increment, compact_increment);
 }
 
-Status AppendOnlyWriter::Flush() {
-    if (writer_) {
-        PAIMON_RETURN_NOT_OK(writer_->Close());
-        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> flushed_files,
-                               writer_->GetResult());
-        new_files_.insert(new_files_.end(), flushed_files.begin(), flushed_files.end());
-        metrics_->Merge(writer_->GetMetrics());
-        writer_.reset();
+Status AppendOnlyWriter::FlushForCommit() {
+    return FlushWriter();
+}
+
+int64_t AppendOnlyWriter::MemoryOccupancy() const {
+    return writer_ ? writer_->GetBufferedSize() : 0;
+}
+
+Status AppendOnlyWriter::FlushMemory() {
+    return FlushWriter();
+}
+
+Status AppendOnlyWriter::FlushWriter() {
+    if (!writer_) {
+        return Status::OK();
+    }
+    ScopedTimer flush_timer(metrics_.get(), WriteMetrics::FLUSH_DURATION);
+    PAIMON_RETURN_NOT_OK(writer_->Close());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> flushed_files,
+                           writer_->GetResult());
+    for (const auto& file : flushed_files) {
+        new_files_.push_back(file);
+        compact_manager_->AddNewFile(file);
+    }
+    metrics_->Merge(writer_->GetMetrics());
+    writer_.reset();
+    return Status::OK();
+}
+
+Status AppendOnlyWriter::Flush(bool wait_for_latest_compaction) {
+    PAIMON_RETURN_NOT_OK(FlushWriter());
+    PAIMON_RETURN_NOT_OK(TrySyncLatestCompaction(wait_for_latest_compaction));
+    return compact_manager_->TriggerCompaction(/*full_compaction=*/false);
+}
+
+Status AppendOnlyWriter::TrySyncLatestCompaction(bool blocking) {
+    PAIMON_ASSIGN_OR_RAISE(std::optional<CompactResult> result,
+                           compact_manager_->GetCompactionResult(blocking));
+    if (result) {
+        return UpdateCompactResult(result.value());
+    }
+    return Status::OK();
+}
+
+Status AppendOnlyWriter::UpdateCompactResult(const CompactResult& result) {
+    // record the new files first, so that they are still cleaned up on close if deleting an
+    // intermediate file fails below
+    compact_after_.insert(compact_after_.end(), result.After().begin(), result.After().end());
+    for (const auto& file : result.Before()) {
+        auto iter = std::find_if(
+            compact_after_.begin(), compact_after_.end(),
+            [&file](const std::shared_ptr<DataFileMeta>& after) { return *after == *file; });
+        if (iter == compact_after_.end()) {
+            compact_before_.emplace(file->file_name, file);
+            continue;
+        }
+        compact_after_.erase(iter);
+        // This is an intermediate file (not a new data file) which is no longer needed after
+        // compaction. Append compaction always rewrites files, so it can be deleted directly.
+        PAIMON_RETURN_NOT_OK(DeleteFile(file));
+    }
+    return Status::OK();
+}
+
+Status AppendOnlyWriter::DeleteFile(const std::shared_ptr<DataFileMeta>& file) const {
+    for (const auto& path : path_factory_->CollectFiles(file)) {
+        PAIMON_RETURN_NOT_OK(options_.GetFileSystem()->Delete(path, /*recursive=*/false));
     }
     return Status::OK();
 }
@@ -136,10 +210,20 @@ AppendOnlyWriter::SingleFileWriterCreator AppendOnlyWriter::GetDataFileWriterCre
             PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &arrow_schema));
             PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
                                    format->CreateStatsExtractor(&arrow_schema));
+            std::unique_ptr<DataFileIndexWriter> index_writer;
+            if (!write_cols) {
+                // file indexes are only built when all columns are written
+                PAIMON_ASSIGN_OR_RAISE(
+                    index_writer,
+                    DataFileIndexWriter::Create(schema, options_.GetFileIndexColumns(),
+                                                options_.GetFileIndexInManifestThreshold(),
+                                                memory_pool_));
+            }
             auto writer = std::make_unique<DataFileWriter>(
                 options_.GetFileCompression(), std::function<Status(ArrowArray*, ArrowArray*)>(),
                 schema_id_, seq_num_counter_, FileSource::Append(), stats_extractor,
-                path_factory_->IsExternalPath(), write_cols, memory_pool_);
+                path_factory_->IsExternalPath(), write_cols, std::move(index_writer),
+                memory_pool_);
             PAIMON_RETURN_NOT_OK(
                 writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
             return writer;
@@ -157,7 +241,8 @@ AppendOnlyWriter::SingleFileWriterCreator AppendOnlyWriter::GetBlobFileWriterCre
             auto writer = std::make_unique<DataFileWriter>(
                 /*compression=*/"none", std::function<Status(ArrowArray*, ArrowArray*)>(),
                 schema_id_, seq_num_counter_, FileSource::Append(), stats_extractor,
-                path_factory_->IsExternalPath(), write_cols, memory_pool_);
+                path_factory_->IsExternalPath(), write_cols, /*index_writer=*/nullptr,
+                memory_pool_);
             PAIMON_RETURN_NOT_OK(writer->Init(options_.GetFileSystem(),
                                               path_factory_->NewBlobPath(), writer_builder));
             return writer;
@@ -202,7 +287,18 @@ Status AppendOnlyWriter::Close() {
         writer_->Abort();
         writer_.reset();
     }
-    return Status::OK();
+    // cancel compaction so that it does not block closing, a finished result still needs to be
+    // synced so that its files can be cleaned up below, a failure is reported after cleaning up
+    compact_manager_->CancelCompaction();
+    Status sync_status = TrySyncLatestCompaction(/*blocking=*/true);
+    PAIMON_RETURN_NOT_OK(compact_manager_->Close());
+    // delete compacted files which are not committed, append compaction never upgrades files
+    std::vector<std::shared_ptr<DataFileMeta>> to_delete;
+    to_delete.swap(compact_after_);
+    for (const auto& file : to_delete) {
+        PAIMON_RETURN_NOT_OK(DeleteFile(file));
+    }
+    return sync_status;
 }
 
 }  // namespace paimon
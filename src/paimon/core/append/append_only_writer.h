@@ -18,12 +18,16 @@
 
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
 #include "paimon/common/data/blob_utils.h"
+#include "paimon/core/compact/compact_manager.h"
+#include "paimon/core/compact/compact_result.h"
+#include "paimon/core/compact/noop_compact_manager.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/single_file_writer.h"
@@ -53,19 +57,28 @@ class WriterBuilder;
 
 class AppendOnlyWriter : public BatchWriter {
  public:
+    /// @param compact_manager manager of files in this bucket, new files are added to it after
+    /// flushing and compaction is triggered through it; no compaction by default
     AppendOnlyWriter(const CoreOptions& options, int64_t schema_id,
                      const std::shared_ptr<arrow::Schema>& write_schema,
                      const std::optional<std::vector<std::string>>& write_cols,
                      int64_t max_sequence_number,
                      const std::shared_ptr<DataFilePathFactory>& path_factory,
-                     const std::shared_ptr<MemoryPool>& memory_pool);
+                     const std::shared_ptr<MemoryPool>& memory_pool,
+                     const std::shared_ptr<CompactManager>& compact_manager =
+                         std::make_shared<NoopCompactManager>());
     ~AppendOnlyWriter() override;
 
     Status Write(std::unique_ptr<RecordBatch>&& batch) override;
     Result<CommitIncrement> PrepareCommit(bool wait_compaction) override;
+    Status FlushForCommit() override;
+    /// Memory of the row group or stripe buffered by the open file writer.
+    int64_t MemoryOccupancy() const override;
+    /// Finish the open files, whose buffered data is then released.
+    Status FlushMemory() override;
     Status Close() override;
     bool IsCompacting() const override {
-        return false;
+        return compact_manager_->CompactNotCompleted();
     }
     std::shared_ptr<Metrics> GetMetrics() const override {
         return metrics_;
@@ -82,7 +95,13 @@ class AppendOnlyWriter : public BatchWriter {
         const BlobUtils::SeparatedSchemas& schemas) const;
 
     Result<CommitIncrement> DrainIncrement();
-    Status Flush();
+    Status Flush(bool wait_for_latest_compaction);
+    // close the current rolling writer and collect its files, without touching compaction
+    Status FlushWriter();
+    Status TrySyncLatestCompaction(bool blocking);
+    Status UpdateCompactResult(const CompactResult& result);
+    // delete a data file together with its extra files
+    Status DeleteFile(const std::shared_ptr<DataFileMeta>& file) const;
 
     SingleFileWriterCreator GetDataFileWriterCreator(
         const std::shared_ptr<arrow::Schema>& schema,
@@ -101,9 +120,13 @@ class AppendOnlyWriter : public BatchWriter {
     std::shared_ptr<DataFilePathFactory> path_factory_;
     std::shared_ptr<MemoryPool> memory_pool_;
     std::shared_ptr<Metrics> metrics_;
+    std::shared_ptr<CompactManager> compact_manager_;
 
     std::vector<std::shared_ptr<DataFileMeta>> new_files_;
     std::vector<std::shared_ptr<DataFileMeta>> deleted_files_;
+    // compact before files keyed by file name, ordered for deterministic commit messages
+    std::map<std::string, std::shared_ptr<DataFileMeta>> compact_before_;
+    std::vector<std::shared_ptr<DataFileMeta>> compact_after_;
 
     std::unique_ptr<RollingFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>> writer_;
 };
@@ -31,6 +31,7 @@
 #include "arrow/type.h"
 #include "gtest/gtest.h"
 #include "paimon/common/fs/external_path_provider.h"
+#include "paimon/common/utils/string_utils.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/compact_increment.h"
 #include "paimon/core/io/data_file_path_factory.h"
@@ -179,6 +180,63 @@ TEST_F(AppendOnlyWriterTest, TestWriteAndClose) {
     ASSERT_TRUE(file_status_list.empty());
 }
 
+TEST_F(AppendOnlyWriterTest, TestCloseDeletesFileIndex) {
+    std::map<std::string, std::string> raw_options;
+    raw_options[Options::FILE_FORMAT] = "orc";
+    raw_options[Options::FILE_SYSTEM] = "local";
+    raw_options[Options::MANIFEST_FORMAT] = "orc";
+    // roll a new file after the first batch, and write file index into separate files
+    raw_options[Options::TARGET_FILE_SIZE] = "1b";
+    raw_options["file-index.bitmap.columns"] = "f0";
+    raw_options[Options::FILE_INDEX_IN_MANIFEST_THRESHOLD] = "1b";
+    ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8())};
+    auto schema = arrow::schema(fields);
+
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+    AppendOnlyWriter writer(options, /*schema_id=*/1, schema, /*write_cols=*/std::nullopt,
+                            /*max_sequence_number=*/-1, path_factory, memory_pool_);
+
+    auto write_batch = [&](int32_t row_count) {
+        arrow::StructBuilder struct_builder(arrow::struct_(fields), arrow::default_memory_pool(),
+                                            {std::make_shared<arrow::StringBuilder>()});
+        auto string_builder = static_cast<arrow::StringBuilder*>(struct_builder.field_builder(0));
+        for (int32_t j = 0; j < row_count; j++) {
+            ASSERT_TRUE(struct_builder.Append().ok());
+            ASSERT_TRUE(string_builder->Append(std::to_string(j % 10)).ok());
+        }
+        std::shared_ptr<arrow::Array> array;
+        ASSERT_TRUE(struct_builder.Finish(&array).ok());
+        ::ArrowArray arrow_array;
+        ASSERT_TRUE(arrow::ExportArray(*array, &arrow_array).ok());
+        RecordBatchBuilder batch_builder(&arrow_array);
+        ASSERT_OK_AND_ASSIGN(auto record_batch, batch_builder.Finish());
+        ASSERT_OK(writer.Write(std::move(record_batch)));
+    };
+    write_batch(1000);
+    write_batch(100);
+
+    auto file_system = std::make_shared<LocalFileSystem>();
+    std::vector<std::unique_ptr<BasicFileStatus>> file_status_list;
+    ASSERT_OK(file_system->ListDir(dir->Str(), &file_status_list));
+    bool has_index_file = false;
+    for (const auto& file_status : file_status_list) {
+        has_index_file |= StringUtils::EndsWith(file_status->GetPath(), ".orc.index");
+    }
+    ASSERT_TRUE(has_index_file);
+
+    // uncommitted data files and their index files are all deleted
+    ASSERT_OK(writer.Close());
+    file_status_list.clear();
+    ASSERT_OK(file_system->ListDir(dir->Str(), &file_status_list));
+    ASSERT_TRUE(file_status_list.empty());
+}
+
 TEST_F(AppendOnlyWriterTest, TestInvalidRowKind) {
     std::map<std::string, std::string> raw_options;
     raw_options[Options::FILE_FORMAT] = "orc";
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/append/bucketed_append_compact_manager.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "paimon/common/executor/future.h"
+#include "paimon/common/utils/bin_packing.h"
+#include "paimon/executor.h"
+
+namespace paimon {
+
+BucketedAppendCompactManager::BucketedAppendCompactManager(
+    const std::shared_ptr<Executor>& executor,
+    const std::vector<std::shared_ptr<DataFileMeta>>& restored, int32_t min_file_num,
+    int32_t max_file_num, int64_t target_file_size, int64_t compaction_file_size,
+    const CompactRewriter& rewriter)
+    : executor_(executor),
+      min_file_num_(min_file_num),
+      max_file_num_(max_file_num),
+      target_file_size_(target_file_size),
+      compaction_file_size_(compaction_file_size),
+      rewriter_(rewriter),
+      to_compact_(FileComparator(/*ignore_overlap=*/false)),
+      logger_(Logger::GetLogger("BucketedAppendCompactManager")) {
+    to_compact_.insert(restored.begin(), restored.end());
+}
+
+BucketedAppendCompactManager::~BucketedAppendCompactManager() {
+    // the running task refers to rewriter and files, make sure it is finished before destruction
+    CancelAndWaitCompaction();
+}
+
+std::vector<std::shared_ptr<DataFileMeta>> BucketedAppendCompactManager::AllFiles() const {
+    std::vector<std::shared_ptr<DataFileMeta>> all_files = compacting_;
+    all_files.insert(all_files.end(), to_compact_.begin(), to_compact_.end());
+    return all_files;
+}
+
+Status BucketedAppendCompactManager::TriggerCompaction(bool full_compaction) {
+    if (full_compaction) {
+        if (task_future_.valid()) {
+            return Status::Invalid(
+                "A compaction task is still running while the user forces a new compaction. This "
+                "is unexpected.");
+        }
+        if (to_compact_.size() < FULL_COMPACT_MIN_FILE) {
+            return Status::OK();
+        }
+        compacting_.assign(to_compact_.begin(), to_compact_.end());
+        to_compact_.clear();
+        SubmitCompaction(/*full_compaction=*/true);
+        return Status::OK();
+    }
+    if (task_future_.valid()) {
+        return Status::OK();
+    }
+    std::optional<std::vector<std::shared_ptr<DataFileMeta>>> picked = PickCompactBefore();
+    if (picked) {
+        compacting_ = std::move(picked).value();
+        SubmitCompaction(/*full_compaction=*/false);
+    }
+    return Status::OK();
+}
+
+std::optional<std::vector<std::shared_ptr<DataFileMeta>>>
+BucketedAppendCompactManager::PickCompactBefore() {
+    if (to_compact_.empty()) {
+        return std::nullopt;
+    }
+    std::vector<std::vector<std::shared_ptr<DataFileMeta>>> bins =
+        BinPacking::PackForOrdered<std::shared_ptr<DataFileMeta>>(
+            std::vector<std::shared_ptr<DataFileMeta>>(to_compact_.begin(), to_compact_.end()),
+            [](const std::shared_ptr<DataFileMeta>& file) -> int64_t { return file->file_size; },
+            target_file_size_);
+    std::optional<std::vector<std::shared_ptr<DataFileMeta>>> picked;
+    // the last bin is still growing, bins before it are closed as they reach target file size
+    size_t skipped_bins = bins.size() - 1;
+    for (size_t i = 0; i < bins.size(); ++i) {
+        auto& bin = bins[i];
+        bool closed = i + 1 < bins.size();
+        if (bin.size() >= static_cast<size_t>(max_file_num_)) {
+            bin.resize(max_file_num_);
+        } else if (!closed || bin.size() < static_cast<size_t>(min_file_num_)) {
+            continue;
+        }
+        picked = std::move(bin);
+        skipped_bins = i;
+        break;
+    }
+    for (size_t i = 0; i < skipped_bins; ++i) {
+        for (const auto& file : bins[i]) {
+            to_compact_.erase(file);
+        }
+    }
+    if (picked) {
+        for (const auto& file : picked.value()) {
+            to_compact_.erase(file);
+        }
+        PAIMON_LOG_DEBUG(logger_, "Pick %zu files to compact, %zu files remain",
+                         picked->size(), to_compact_.size());
+    }
+    return picked;
+}
+
+void BucketedAppendCompactManager::SubmitCompaction(bool full_compaction) {
+    PAIMON_LOG_DEBUG(logger_, "Submit %s compaction with %zu files",
+                     full_compaction ? "full" : "auto", compacting_.size());
+    task_future_ =
+        Via(executor_.get(), [files = compacting_, full_compaction,
+                              compaction_file_size = compaction_file_size_, rewriter = rewriter_,
+                              cancelled = NewCancelFlag()]() -> Result<CompactResult> {
+            if (full_compaction) {
+                return DoFullCompact(files, compaction_file_size, rewriter, *cancelled);
+            }
+            PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> after,
+                                   rewriter(files, *cancelled));
+            return CompactResult(files, after);
+        });
+}
+
+Result<CompactResult> BucketedAppendCompactManager::DoFullCompact(
+    std::vector<std::shared_ptr<DataFileMeta>> files, int64_t compaction_file_size,
+    const CompactRewriter& rewriter, const std::atomic<bool>& cancelled) {
+    auto is_small = [compaction_file_size](const std::shared_ptr<DataFileMeta>& file) {
+        return file->file_size < compaction_file_size;
+    };
+    // remove large files at the head, they are not necessary to be rewritten
+    files.erase(files.begin(), std::find_if(files.begin(), files.end(), is_small));
+    auto small = std::count_if(files.begin(), files.end(), is_small);
+    auto big = static_cast<int64_t>(files.size()) - small;
+    if (small <= big || files.size() < FULL_COMPACT_MIN_FILE) {
+        return CompactResult();
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> after,
+                           rewriter(files, cancelled));
+    return CompactResult(files, after);
+}
+
+Result<std::optional<CompactResult>> BucketedAppendCompactManager::GetCompactionResult(
+    bool blocking) {
+    Result<std::optional<CompactResult>> obtained = ObtainCompactResult(blocking);
+    if (!obtained.ok()) {
+        // the task failed, input files are still there to be compacted
+        to_compact_.insert(compacting_.begin(), compacting_.end());
+        compacting_.clear();
+        return obtained.status();
+    }
+    std::optional<CompactResult> result = std::move(obtained).value();
+    if (!result && !task_future_.valid()) {
+        // the task is cancelled, input files are still there to be compacted
+        to_compact_.insert(compacting_.begin(), compacting_.end());
+        compacting_.clear();
+    } else if (result) {
+        const auto& after = result->After();
+        // if the last compacted file is still small, compact it with following files later
+        if (!after.empty() && after.back()->file_size < compaction_file_size_) {
+            to_compact_.insert(after.back());
+        }
+        compacting_.clear();
+    }
+    return result;
+}
+
+}  // namespace paimon
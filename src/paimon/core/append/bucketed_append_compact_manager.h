@@ -16,17 +16,69 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <set>
+#include <vector>
 
+#include "paimon/core/compact/compact_future_manager.h"
+#include "paimon/core/compact/compact_result.h"
 #include "paimon/core/io/data_file_meta.h"
+#include "paimon/logging.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
 
 namespace paimon {
-/// Compact manager for `AppendOnlyFileStore`.
-class BucketedAppendCompactManager {
+class Executor;
+
+/// Compact manager for `AppendOnlyFileStore`, small files of a bucket are rewritten into files of
+/// target file size in `executor`, one task at a time.
+class BucketedAppendCompactManager : public CompactFutureManager {
  public:
-    BucketedAppendCompactManager() = delete;
-    ~BucketedAppendCompactManager() = delete;
+    /// Rewrite files ordered by sequence number into new files, the flag is set when the task is
+    /// cancelled.
+    using CompactRewriter = std::function<Result<std::vector<std::shared_ptr<DataFileMeta>>>(
+        const std::vector<std::shared_ptr<DataFileMeta>>&, const std::atomic<bool>&)>;
+
+    /// @param min_file_num a bin of files reaching target file size is compacted only if it
+    /// contains at least this number of files
+    /// @param max_file_num files are compacted once there are this number of files even if they do
+    /// not reach target file size
+    /// @param compaction_file_size files not smaller than this are skipped by full compaction
+    BucketedAppendCompactManager(const std::shared_ptr<Executor>& executor,
+                                 const std::vector<std::shared_ptr<DataFileMeta>>& restored,
+                                 int32_t min_file_num, int32_t max_file_num,
+                                 int64_t target_file_size, int64_t compaction_file_size,
+                                 const CompactRewriter& rewriter);
+
+    ~BucketedAppendCompactManager() override;
+
+    bool ShouldWaitForLatestCompaction() const override {
+        return false;
+    }
+
+    bool ShouldWaitForPreparingCheckpoint() const override {
+        return false;
+    }
+
+    void AddNewFile(const std::shared_ptr<DataFileMeta>& file) override {
+        to_compact_.insert(file);
+    }
+
+    std::vector<std::shared_ptr<DataFileMeta>> AllFiles() const override;
+
+    Status TriggerCompaction(bool full_compaction) override;
+
+    /// Finish current task, the last output file is compacted again later if it is still small.
+    Result<std::optional<CompactResult>> GetCompactionResult(bool blocking) override;
+
+    Status Close() override {
+        CancelAndWaitCompaction();
+        return Status::OK();
+    }
 
     /// New files may be created during the compaction process, then the results of the compaction
     /// may be put after the new files, and this order will be disrupted. We need to ensure this
@@ -47,10 +99,39 @@ class BucketedAppendCompactManager {
     }
 
  private:
+    static constexpr size_t FULL_COMPACT_MIN_FILE = 3;
+
+    using FileSet = std::set<std::shared_ptr<DataFileMeta>,
+                             std::function<bool(const std::shared_ptr<DataFileMeta>&,
+                                                const std::shared_ptr<DataFileMeta>&)>>;
+
     static bool IsOverlap(const std::shared_ptr<DataFileMeta>& o1,
                           const std::shared_ptr<DataFileMeta>& o2) {
         return o2->min_sequence_number <= o1->max_sequence_number &&
                o2->max_sequence_number >= o1->min_sequence_number;
     }
+
+    /// Pack files to compact into bins of target file size in sequence order, and pick the first
+    /// bin which has enough files. Files in bins before the picked one are large enough together,
+    /// they are not considered any more.
+    std::optional<std::vector<std::shared_ptr<DataFileMeta>>> PickCompactBefore();
+
+    void SubmitCompaction(bool full_compaction);
+
+    static Result<CompactResult> DoFullCompact(std::vector<std::shared_ptr<DataFileMeta>> files,
+                                               int64_t compaction_file_size,
+                                               const CompactRewriter& rewriter,
+                                               const std::atomic<bool>& cancelled);
+
+ private:
+    std::shared_ptr<Executor> executor_;
+    int32_t min_file_num_;
+    int32_t max_file_num_;
+    int64_t target_file_size_;
+    int64_t compaction_file_size_;
+    CompactRewriter rewriter_;
+    FileSet to_compact_;
+    std::vector<std::shared_ptr<DataFileMeta>> compacting_;
+    std::unique_ptr<Logger> logger_;
 };
 }  // namespace paimon
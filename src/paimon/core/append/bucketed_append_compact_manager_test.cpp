@@ -16,8 +16,10 @@
 
 #include "paimon/core/append/bucketed_append_compact_manager.h"
 
+#include <atomic>
 #include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -25,7 +27,9 @@
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/file_source.h"
 #include "paimon/core/stats/simple_stats.h"
+#include "paimon/executor.h"
 #include "paimon/result.h"
+#include "paimon/testing/utils/testharness.h"
 
 namespace paimon::test {
 
@@ -56,7 +60,57 @@ class BucketedAppendCompactManagerTest : public testing::Test {
         return metas;
     }
 
- private:
+    /// Create files of given sizes, each file has 10 records with increasing sequence numbers.
+    std::vector<std::shared_ptr<DataFileMeta>> GenerateDataFileMeta(
+        const std::vector<int64_t>& file_sizes) {
+        std::vector<std::shared_ptr<DataFileMeta>> metas;
+        for (size_t i = 0; i < file_sizes.size(); ++i) {
+            int64_t min_seq = static_cast<int64_t>(i) * 10;
+            metas.push_back(DataFileMeta::ForAppend(
+                                "file" + std::to_string(i), file_sizes[i], /*row_count=*/10,
+                                SimpleStats::EmptyStats(), min_seq, min_seq + 9, 0,
+                                FileSource::Append(), std::nullopt, std::nullopt, std::nullopt,
+                                std::nullopt)
+                                .value());
+        }
+        return metas;
+    }
+
+    /// A rewriter which merges all input files into one file of total size.
+    static BucketedAppendCompactManager::CompactRewriter MergeRewriter() {
+        return [](const std::vector<std::shared_ptr<DataFileMeta>>& files,
+                  const std::atomic<bool>& cancelled)
+                   -> Result<std::vector<std::shared_ptr<DataFileMeta>>> {
+            if (cancelled.load()) {
+                return Status::Invalid("compaction is cancelled");
+            }
+            int64_t file_size = 0;
+            int64_t row_count = 0;
+            for (const auto& file : files) {
+                file_size += file->file_size;
+                row_count += file->row_count;
+            }
+            PAIMON_ASSIGN_OR_RAISE(
+                std::shared_ptr<DataFileMeta> merged,
+                DataFileMeta::ForAppend("compacted-" + files[0]->file_name, file_size, row_count,
+                                        SimpleStats::EmptyStats(), files[0]->min_sequence_number,
+                                        files.back()->max_sequence_number, 0,
+                                        FileSource::Compact(), std::nullopt, std::nullopt,
+                                        std::nullopt, std::nullopt));
+            return std::vector<std::shared_ptr<DataFileMeta>>({merged});
+        };
+    }
+
+    std::unique_ptr<BucketedAppendCompactManager> CreateManager(
+        const std::vector<std::shared_ptr<DataFileMeta>>& restored, int32_t min_file_num,
+        int32_t max_file_num, int64_t target_file_size) {
+        return std::make_unique<BucketedAppendCompactManager>(
+            executor_, restored, min_file_num, max_file_num, target_file_size,
+            /*compaction_file_size=*/target_file_size * 7 / 10, MergeRewriter());
+    }
+
+ protected:
+    std::shared_ptr<Executor> executor_ = CreateDefaultExecutor(/*thread_count=*/1);
 };
 
 TEST_F(BucketedAppendCompactManagerTest, TestFileComparatorWithoutOverlap) {
@@ -96,4 +150,161 @@ TEST_F(BucketedAppendCompactManagerTest, TestIsOverlap) {
     EXPECT_FALSE(BucketedAppendCompactManager::IsOverlap(file2, file3));
 }
 
+TEST_F(BucketedAppendCompactManagerTest, TestPickFullBin) {
+    auto files = GenerateDataFileMeta({30, 30, 30, 30, 30});
+    auto manager = CreateManager(files, /*min_file_num=*/3, /*max_file_num=*/50,
+                                 /*target_file_size=*/100);
+    auto picked = manager->PickCompactBefore();
+    ASSERT_TRUE(picked);
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[0], files[1], files[2]}),
+              picked.value());
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[3], files[4]}),
+              manager->AllFiles());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestPickSkipLargeFiles) {
+    auto files = GenerateDataFileMeta({200, 40, 90, 10, 10});
+    auto manager = CreateManager(files, /*min_file_num=*/2, /*max_file_num=*/50,
+                                 /*target_file_size=*/100);
+    // [200] and [40] are closed bins without enough files, [90, 10] is picked
+    auto picked = manager->PickCompactBefore();
+    ASSERT_TRUE(picked);
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[2], files[3]}), picked.value());
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[4]}), manager->AllFiles());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestPickNothing) {
+    auto files = GenerateDataFileMeta({200, 10, 10, 10});
+    auto manager = CreateManager(files, /*min_file_num=*/5, /*max_file_num=*/50,
+                                 /*target_file_size=*/100);
+    ASSERT_FALSE(manager->PickCompactBefore());
+    // the large file is dropped, small files are waiting for more files
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[1], files[2], files[3]}),
+              manager->AllFiles());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestPickMaxFileNum) {
+    auto files = GenerateDataFileMeta({10, 10, 10, 10});
+    auto manager = CreateManager(files, /*min_file_num=*/2, /*max_file_num=*/3,
+                                 /*target_file_size=*/100);
+    auto picked = manager->PickCompactBefore();
+    ASSERT_TRUE(picked);
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[0], files[1], files[2]}),
+              picked.value());
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[3]}), manager->AllFiles());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestTriggerCompaction) {
+    auto files = GenerateDataFileMeta({50, 50, 50});
+    auto manager = CreateManager({files[0], files[1]}, /*min_file_num=*/2, /*max_file_num=*/50,
+                                 /*target_file_size=*/100);
+    // files do not exceed target file size yet
+    ASSERT_OK(manager->TriggerCompaction(/*full_compaction=*/false));
+    ASSERT_FALSE(manager->CompactNotCompleted());
+
+    manager->AddNewFile(files[2]);
+    ASSERT_OK(manager->TriggerCompaction(/*full_compaction=*/false));
+    ASSERT_TRUE(manager->CompactNotCompleted());
+    ASSERT_EQ(files, manager->AllFiles());
+
+    ASSERT_OK_AND_ASSIGN(std::optional<CompactResult> result,
+                         manager->GetCompactionResult(/*blocking=*/true));
+    ASSERT_TRUE(result);
+    ASSERT_FALSE(manager->CompactNotCompleted());
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[0], files[1]}),
+              result->Before());
+    ASSERT_EQ(1, result->After().size());
+    ASSERT_EQ(100, result->After()[0]->file_size);
+    ASSERT_EQ(0, result->After()[0]->min_sequence_number);
+    ASSERT_EQ(19, result->After()[0]->max_sequence_number);
+    // compacted file is not smaller than compaction file size, it is not compacted again
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>({files[2]}), manager->AllFiles());
+    ASSERT_OK(manager->Close());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestSmallResultCompactedAgain) {
+    auto files = GenerateDataFileMeta({10, 10, 10});
+    auto manager = CreateManager(files, /*min_file_num=*/2, /*max_file_num=*/3,
+                                 /*target_file_size=*/100);
+    ASSERT_OK(manager->TriggerCompaction(/*full_compaction=*/false));
+    ASSERT_OK_AND_ASSIGN(std::optional<CompactResult> result,
+                         manager->GetCompactionResult(/*blocking=*/true));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->After(), manager->AllFiles());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestFullCompaction) {
+    auto files = GenerateDataFileMeta({100, 10, 80, 10, 10});
+    auto manager = CreateManager(files, /*min_file_num=*/5, /*max_file_num=*/50,
+                                 /*target_file_size=*/100);
+    ASSERT_OK(manager->TriggerCompaction(/*full_compaction=*/true));
+    ASSERT_NOK_WITH_MSG(manager->TriggerCompaction(/*full_compaction=*/true),
+                        "A compaction task is still running");
+    ASSERT_OK_AND_ASSIGN(std::optional<CompactResult> result,
+                         manager->GetCompactionResult(/*blocking=*/true));
+    ASSERT_TRUE(result);
+    // the large file at the head is skipped, the large file in the middle is rewritten
+    ASSERT_EQ(std::vector<std::shared_ptr<DataFileMeta>>(files.begin() + 1, files.end()),
+              result->Before());
+    ASSERT_EQ(1, result->After().size());
+    ASSERT_EQ(110, result->After()[0]->file_size);
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestFullCompactionWithFewSmallFiles) {
+    auto files = GenerateDataFileMeta({10, 80, 80, 10});
+    auto manager = CreateManager(files, /*min_file_num=*/5, /*max_file_num=*/50,
+                                 /*target_file_size=*/100);
+    ASSERT_OK(manager->TriggerCompaction(/*full_compaction=*/true));
+    ASSERT_OK_AND_ASSIGN(std::optional<CompactResult> result,
+                         manager->GetCompactionResult(/*blocking=*/true));
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(result->Before().empty());
+    ASSERT_TRUE(result->After().empty());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestCancelledCompactionRestoresFiles) {
+    auto files = GenerateDataFileMeta({10, 10, 10});
+    // the task is blocked until it is cancelled
+    std::atomic<bool> release(false);
+    auto rewriter = [&release](const std::vector<std::shared_ptr<DataFileMeta>>& to_compact,
+                               const std::atomic<bool>& cancelled)
+        -> Result<std::vector<std::shared_ptr<DataFileMeta>>> {
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        if (cancelled.load()) {
+            return Status::Invalid("compaction is cancelled");
+        }
+        return to_compact;
+    };
+    BucketedAppendCompactManager manager(executor_, files, /*min_file_num=*/2,
+                                         /*max_file_num=*/3, /*target_file_size=*/100,
+                                         /*compaction_file_size=*/70, rewriter);
+    ASSERT_OK(manager.TriggerCompaction(/*full_compaction=*/false));
+    manager.CancelCompaction();
+    release = true;
+    // a cancelled task gives no result instead of an error
+    ASSERT_OK_AND_ASSIGN(std::optional<CompactResult> result,
+                         manager.GetCompactionResult(/*blocking=*/true));
+    ASSERT_FALSE(result);
+    ASSERT_FALSE(manager.CompactNotCompleted());
+    ASSERT_EQ(files, manager.AllFiles());
+}
+
+TEST_F(BucketedAppendCompactManagerTest, TestFailedCompactionRestoresFiles) {
+    auto files = GenerateDataFileMeta({10, 10, 10});
+    auto rewriter = [](const std::vector<std::shared_ptr<DataFileMeta>>& to_compact,
+                       const std::atomic<bool>& cancelled)
+        -> Result<std::vector<std::shared_ptr<DataFileMeta>>> {
+        return Status::IOError("disk is full");
+    };
+    BucketedAppendCompactManager manager(executor_, files, /*min_file_num=*/2,
+                                         /*max_file_num=*/3, /*target_file_size=*/100,
+                                         /*compaction_file_size=*/70, rewriter);
+    ASSERT_OK(manager.TriggerCompaction(/*full_compaction=*/false));
+    ASSERT_NOK_WITH_MSG(manager.GetCompactionResult(/*blocking=*/true), "disk is full");
+    ASSERT_FALSE(manager.CompactNotCompleted());
+    ASSERT_EQ(files, manager.AllFiles());
+}
+
 }  // namespace paimon::test
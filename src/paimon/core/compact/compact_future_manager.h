@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "paimon/core/compact/compact_manager.h"
+#include "paimon/core/compact/compact_result.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+/// Base implementation of `CompactManager` which runs at most one compaction task at a time and
+/// keeps its result in a future.
+class CompactFutureManager : public CompactManager {
+ public:
+    ~CompactFutureManager() override = default;
+
+    void CancelCompaction() override {
+        // std::future cannot be interrupted, the running task checks the flag and gives up as
+        // soon as possible
+        if (task_future_.valid()) {
+            cancelled_->store(true);
+        }
+    }
+
+    bool CompactNotCompleted() const override {
+        return task_future_.valid();
+    }
+
+ protected:
+    /// Returns the result of the submitted task, or `std::nullopt` if there is no submitted task,
+    /// the task is not finished and `blocking` is false, or the task gave up after being cancelled.
+    Result<std::optional<CompactResult>> ObtainCompactResult(bool blocking) {
+        if (!task_future_.valid()) {
+            return std::optional<CompactResult>();
+        }
+        if (!blocking &&
+            task_future_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return std::optional<CompactResult>();
+        }
+        Result<CompactResult> result = task_future_.get();
+        if (!result.ok()) {
+            if (cancelled_->load()) {
+                // a cancelled task is expected to give up, this is not a failure
+                return std::optional<CompactResult>();
+            }
+            return result.status();
+        }
+        return std::optional<CompactResult>(std::move(result).value());
+    }
+
+    /// Cancels the running task (if any) and waits for it, the result is discarded.
+    void CancelAndWaitCompaction() {
+        CancelCompaction();
+        if (task_future_.valid()) {
+            [[maybe_unused]] auto result = task_future_.get();
+        }
+    }
+
+    std::shared_ptr<std::atomic<bool>> NewCancelFlag() {
+        cancelled_ = std::make_shared<std::atomic<bool>>(false);
+        return cancelled_;
+    }
+
+ protected:
+    std::future<Result<CompactResult>> task_future_;
+
+ private:
+    std::shared_ptr<std::atomic<bool>> cancelled_ = std::make_shared<std::atomic<bool>>(false);
+};
+}  // namespace paimon
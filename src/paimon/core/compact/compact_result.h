@@ -0,0 +1,61 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "paimon/core/io/data_file_meta.h"
+
+namespace paimon {
+/// Result of compaction.
+class CompactResult {
+ public:
+    CompactResult() = default;
+    CompactResult(const std::vector<std::shared_ptr<DataFileMeta>>& before,
+                  const std::vector<std::shared_ptr<DataFileMeta>>& after)
+        : CompactResult(before, after, {}) {}
+    CompactResult(const std::vector<std::shared_ptr<DataFileMeta>>& before,
+                  const std::vector<std::shared_ptr<DataFileMeta>>& after,
+                  const std::vector<std::shared_ptr<DataFileMeta>>& changelog)
+        : before_(before), after_(after), changelog_(changelog) {}
+
+    const std::vector<std::shared_ptr<DataFileMeta>>& Before() const {
+        return before_;
+    }
+
+    const std::vector<std::shared_ptr<DataFileMeta>>& After() const {
+        return after_;
+    }
+
+    const std::vector<std::shared_ptr<DataFileMeta>>& Changelog() const {
+        return changelog_;
+    }
+
+    void Merge(const CompactResult& that) {
+        before_.insert(before_.end(), that.before_.begin(), that.before_.end());
+        after_.insert(after_.end(), that.after_.begin(), that.after_.end());
+        changelog_.insert(changelog_.end(), that.changelog_.begin(), that.changelog_.end());
+    }
+
+ private:
+    std::vector<std::shared_ptr<DataFileMeta>> before_;
+    std::vector<std::shared_ptr<DataFileMeta>> after_;
+    std::vector<std::shared_ptr<DataFileMeta>> changelog_;
+};
+}  // namespace paimon
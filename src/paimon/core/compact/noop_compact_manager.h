@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "paimon/core/compact/compact_manager.h"
+#include "paimon/core/compact/compact_result.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+/// A `CompactManager` which never compacts, used when compaction is disabled (e.g.,
+/// `write-only` is set) or not supported by the table.
+class NoopCompactManager : public CompactManager {
+ public:
+    bool ShouldWaitForLatestCompaction() const override {
+        return false;
+    }
+
+    bool ShouldWaitForPreparingCheckpoint() const override {
+        return false;
+    }
+
+    void AddNewFile(const std::shared_ptr<DataFileMeta>& file) override {}
+
+    std::vector<std::shared_ptr<DataFileMeta>> AllFiles() const override {
+        return {};
+    }
+
+    Status TriggerCompaction(bool full_compaction) override {
+        if (full_compaction) {
+            return Status::Invalid(
+                "NoopCompactManager does not support user triggered compaction. If you really "
+                "need a guaranteed compaction, please set write-only property of this table to "
+                "false.");
+        }
+        return Status::OK();
+    }
+
+    Result<std::optional<CompactResult>> GetCompactionResult(bool blocking) override {
+        return std::optional<CompactResult>();
+    }
+
+    void CancelCompaction() override {}
+
+    bool CompactNotCompleted() const override {
+        return false;
+    }
+
+    Status Close() override {
+        return Status::OK();
+    }
+};
+}  // namespace paimon
@@ -16,6 +16,7 @@
 
 #include "paimon/core/core_options.h"
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 #include <memory>
@@ -251,8 +252,15 @@ struct CoreOptions::Impl {
     int64_t source_split_open_file_cost = 4 * 1024 * 1024;
     int64_t manifest_target_file_size = 8 * 1024 * 1024;
     int64_t manifest_full_compaction_file_size = 16 * 1024 * 1024;
+    int64_t manifest_cache_max_memory_size = 0;
+    int64_t lookup_cache_max_memory_size = 256 * 1024 * 1024;
+    int64_t file_index_in_manifest_threshold = 500;
     int64_t write_buffer_size = 256 * 1024 * 1024;
+    int64_t write_buffer_spill_max_disk_size = std::numeric_limits<int64_t>::max();
+    int64_t write_total_buffer_size = std::numeric_limits<int64_t>::max();
     int64_t commit_timeout = std::numeric_limits<int64_t>::max();
+    int64_t global_index_build_shard_rows = std::numeric_limits<int64_t>::max();
+    int64_t global_index_build_max_memory = std::numeric_limits<int64_t>::max();
 
     std::shared_ptr<FileFormat> file_format;
     std::shared_ptr<FileSystem> file_system;
@@ -283,6 +291,15 @@ struct CoreOptions::Impl {
     int32_t read_batch_size = 1024;
     int32_t write_batch_size = 1024;
     int32_t commit_max_retries = 10;
+    int32_t write_prepare_commit_parallelism = 4;
+    int32_t global_index_build_parallelism = 4;
+    int32_t num_sorted_runs_compaction_trigger = 5;
+    std::optional<int32_t> num_sorted_runs_stop_trigger;
+    std::optional<int32_t> num_levels;
+    int32_t compaction_max_size_amplification_percent = 200;
+    int32_t compaction_size_ratio = 1;
+    int32_t compaction_min_file_num = 5;
+    int32_t compaction_max_file_num = 50;
 
     SortOrder sequence_field_sort_order = SortOrder::ASCENDING;
     MergeEngine merge_engine = MergeEngine::DEDUPLICATE;
@@ -293,6 +310,8 @@ struct CoreOptions::Impl {
     int32_t file_compression_zstd_level = 1;
 
     bool ignore_delete = false;
+    bool write_only = false;
+    bool write_buffer_spillable = false;
     bool deletion_vectors_enabled = false;
     bool force_lookup = false;
     bool partial_update_remove_record_on_delete = false;
@@ -304,6 +323,7 @@ struct CoreOptions::Impl {
     bool legacy_partition_name_enabled = true;
     bool global_index_enabled = true;
     std::optional<std::string> global_index_external_path;
+    std::optional<std::string> write_buffer_spill_dir;
 };
 
 // Parse configurations from a map and return a populated CoreOptions object
@@ -325,7 +345,57 @@ Result<CoreOptions> CoreOptions::FromMap(
     PAIMON_RETURN_NOT_OK(parser.Parse(Options::WRITE_BATCH_SIZE, &impl->write_batch_size));
     PAIMON_RETURN_NOT_OK(
         parser.ParseMemorySize(Options::WRITE_BUFFER_SIZE, &impl->write_buffer_size));
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse<bool>(Options::WRITE_BUFFER_SPILLABLE, &impl->write_buffer_spillable));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::WRITE_BUFFER_SPILL_MAX_DISK_SIZE,
+                                                &impl->write_buffer_spill_max_disk_size));
+    std::string write_buffer_spill_dir;
+    PAIMON_RETURN_NOT_OK(
+        parser.ParseString(Options::WRITE_BUFFER_SPILL_DIR, &write_buffer_spill_dir));
+    if (!write_buffer_spill_dir.empty()) {
+        impl->write_buffer_spill_dir = write_buffer_spill_dir;
+    }
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::WRITE_TOTAL_BUFFER_SIZE,
+                                                &impl->write_total_buffer_size));
     PAIMON_RETURN_NOT_OK(parser.Parse(Options::COMMIT_MAX_RETRIES, &impl->commit_max_retries));
+    // Parse compaction configurations
+    PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::WRITE_ONLY, &impl->write_only));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::WRITE_PREPARE_COMMIT_PARALLELISM,
+                                      &impl->write_prepare_commit_parallelism));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::NUM_SORTED_RUNS_COMPACTION_TRIGGER,
+                                      &impl->num_sorted_runs_compaction_trigger));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::NUM_SORTED_RUNS_STOP_TRIGGER,
+                                      &impl->num_sorted_runs_stop_trigger));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::NUM_LEVELS, &impl->num_levels));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::COMPACTION_MAX_SIZE_AMPLIFICATION_PERCENT,
+                                      &impl->compaction_max_size_amplification_percent));
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse(Options::COMPACTION_SIZE_RATIO, &impl->compaction_size_ratio));
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse(Options::COMPACTION_MIN_FILE_NUM, &impl->compaction_min_file_num));
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse(Options::COMPACTION_MAX_FILE_NUM, &impl->compaction_max_file_num));
+    if (impl->write_prepare_commit_parallelism <= 0) {
+        return Status::Invalid(fmt::format("{} must be positive, but is {}",
+                                           Options::WRITE_PREPARE_COMMIT_PARALLELISM,
+                                           impl->write_prepare_commit_parallelism));
+    }
+    if (impl->num_sorted_runs_compaction_trigger <= 0) {
+        return Status::Invalid(fmt::format("{} must be positive, but is {}",
+                                           Options::NUM_SORTED_RUNS_COMPACTION_TRIGGER,
+                                           impl->num_sorted_runs_compaction_trigger));
+    }
+    if (impl->compaction_min_file_num <= 0 ||
+        impl->compaction_max_file_num < impl->compaction_min_file_num) {
+        return Status::Invalid(fmt::format(
+            "{} must be positive and not greater than {}, but they are {} and {}",
+            Options::COMPACTION_MIN_FILE_NUM, Options::COMPACTION_MAX_FILE_NUM,
+            impl->compaction_min_file_num, impl->compaction_max_file_num));
+    }
+    if (impl->num_levels && impl->num_levels.value() <= 1) {
+        return Status::Invalid(fmt::format("{} must be greater than 1, but is {}",
+                                           Options::NUM_LEVELS, impl->num_levels.value()));
+    }
     PAIMON_RETURN_NOT_OK(parser.ParseString(Options::FILE_COMPRESSION, &impl->file_compression));
     PAIMON_RETURN_NOT_OK(
         parser.Parse(Options::FILE_COMPRESSION_ZSTD_LEVEL, &impl->file_compression_zstd_level));
@@ -349,6 +419,12 @@ Result<CoreOptions> CoreOptions::FromMap(
                                                 &impl->source_split_open_file_cost));
     PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::MANIFEST_FULL_COMPACTION_FILE_SIZE,
                                                 &impl->manifest_full_compaction_file_size));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::MANIFEST_CACHE_MAX_MEMORY_SIZE,
+                                                &impl->manifest_cache_max_memory_size));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::LOOKUP_CACHE_MAX_MEMORY_SIZE,
+                                                &impl->lookup_cache_max_memory_size));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::FILE_INDEX_IN_MANIFEST_THRESHOLD,
+                                                &impl->file_index_in_manifest_threshold));
 
     // Parse file format and file system configurations
     PAIMON_RETURN_NOT_OK(parser.ParseObject<FileFormatFactory>(
@@ -479,6 +555,23 @@ Result<CoreOptions> CoreOptions::FromMap(
     if (!global_index_external_path.empty()) {
         impl->global_index_external_path = global_index_external_path;
     }
+    // Parse global-index.build.*
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::GLOBAL_INDEX_BUILD_SHARD_ROWS,
+                                      &impl->global_index_build_shard_rows));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::GLOBAL_INDEX_BUILD_PARALLELISM,
+                                      &impl->global_index_build_parallelism));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::GLOBAL_INDEX_BUILD_MAX_MEMORY,
+                                                &impl->global_index_build_max_memory));
+    if (impl->global_index_build_shard_rows <= 0) {
+        return Status::Invalid(fmt::format("{} must be positive, but is {}",
+                                           Options::GLOBAL_INDEX_BUILD_SHARD_ROWS,
+                                           impl->global_index_build_shard_rows));
+    }
+    if (impl->global_index_build_parallelism <= 0) {
+        return Status::Invalid(fmt::format("{} must be positive, but is {}",
+                                           Options::GLOBAL_INDEX_BUILD_PARALLELISM,
+                                           impl->global_index_build_parallelism));
+    }
 
     return options;
 }
@@ -558,6 +651,14 @@ int64_t CoreOptions::GetManifestFullCompactionThresholdSize() const {
     return impl_->manifest_full_compaction_file_size;
 }
 
+int64_t CoreOptions::GetManifestCacheMaxMemorySize() const {
+    return impl_->manifest_cache_max_memory_size;
+}
+
+int64_t CoreOptions::GetLookupCacheMaxMemorySize() const {
+    return impl_->lookup_cache_max_memory_size;
+}
+
 const std::string& CoreOptions::GetManifestCompression() const {
     return impl_->manifest_compression;
 }
@@ -584,6 +685,22 @@ int64_t CoreOptions::GetWriteBufferSize() const {
     return impl_->write_buffer_size;
 }
 
+bool CoreOptions::WriteBufferSpillable() const {
+    return impl_->write_buffer_spillable;
+}
+
+int64_t CoreOptions::GetWriteBufferSpillMaxDiskSize() const {
+    return impl_->write_buffer_spill_max_disk_size;
+}
+
+std::optional<std::string> CoreOptions::GetWriteBufferSpillDir() const {
+    return impl_->write_buffer_spill_dir;
+}
+
+int64_t CoreOptions::GetWriteTotalBufferSize() const {
+    return impl_->write_total_buffer_size;
+}
+
 int64_t CoreOptions::GetCommitTimeout() const {
     return impl_->commit_timeout;
 }
@@ -592,6 +709,53 @@ int32_t CoreOptions::GetCommitMaxRetries() const {
     return impl_->commit_max_retries;
 }
 
+bool CoreOptions::WriteOnly() const {
+    return impl_->write_only;
+}
+
+int32_t CoreOptions::GetWritePrepareCommitParallelism() const {
+    return impl_->write_prepare_commit_parallelism;
+}
+
+int32_t CoreOptions::GetNumSortedRunsCompactionTrigger() const {
+    return impl_->num_sorted_runs_compaction_trigger;
+}
+
+int32_t CoreOptions::GetNumSortedRunsStopTrigger() const {
+    int32_t stop_trigger = impl_->num_sorted_runs_stop_trigger.value_or(
+        impl_->num_sorted_runs_compaction_trigger + 3);
+    return std::max(impl_->num_sorted_runs_compaction_trigger, stop_trigger);
+}
+
+int32_t CoreOptions::GetNumLevels() const {
+    // By default, this ensures that the compaction does not fall to level 0, but at least to
+    // level 1
+    return impl_->num_levels.value_or(impl_->num_sorted_runs_compaction_trigger + 1);
+}
+
+int32_t CoreOptions::GetCompactionMaxSizeAmplificationPercent() const {
+    return impl_->compaction_max_size_amplification_percent;
+}
+
+int32_t CoreOptions::GetCompactionSizeRatio() const {
+    return impl_->compaction_size_ratio;
+}
+
+int64_t CoreOptions::GetCompactionFileSize() const {
+    // file size to join the compaction, we don't process on middle file size to avoid compact a
+    // same file twice (the compression is not calculate so accurately. the output file maybe be
+    // smaller than target file size)
+    return static_cast<int64_t>(static_cast<double>(impl_->target_file_size) * 0.7);
+}
+
+int32_t CoreOptions::GetCompactionMinFileNum() const {
+    return impl_->compaction_min_file_num;
+}
+
+int32_t CoreOptions::GetCompactionMaxFileNum() const {
+    return impl_->compaction_max_file_num;
+}
+
 const ExpireConfig& CoreOptions::GetExpireConfig() const {
     return impl_->expire_config;
 }
@@ -700,6 +864,54 @@ bool CoreOptions::FileIndexReadEnabled() const {
     return impl_->file_index_read_enabled;
 }
 
+int64_t CoreOptions::GetFileIndexInManifestThreshold() const {
+    return impl_->file_index_in_manifest_threshold;
+}
+
+std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>
+CoreOptions::GetFileIndexColumns() const {
+    const auto& raw_options = impl_->raw_options;
+    std::string prefix = std::string(Options::FILE_INDEX_PREFIX) + ".";
+    std::string columns_suffix = std::string(".") + Options::FILE_INDEX_COLUMNS;
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> index_columns;
+    for (const auto& [key, value] : raw_options) {
+        if (key.size() <= prefix.size() + columns_suffix.size() ||
+            !StringUtils::StartsWith(key, prefix) || !StringUtils::EndsWith(key, columns_suffix)) {
+            continue;
+        }
+        std::string index_type =
+            key.substr(prefix.size(), key.size() - prefix.size() - columns_suffix.size());
+        for (std::string column : StringUtils::Split(value, Options::FIELDS_SEPARATOR)) {
+            StringUtils::Trim(&column);
+            if (!column.empty()) {
+                index_columns[column][index_type] = {};
+            }
+        }
+    }
+    for (auto& [column, index_types] : index_columns) {
+        for (auto& [index_type, index_options] : index_types) {
+            // options of the column override options of the index type
+            std::string type_prefix = prefix + index_type + ".";
+            std::string column_prefix = type_prefix + column + ".";
+            for (const auto& [key, value] : raw_options) {
+                if (!StringUtils::StartsWith(key, type_prefix)) {
+                    continue;
+                }
+                if (StringUtils::StartsWith(key, column_prefix)) {
+                    index_options[key.substr(column_prefix.size())] = value;
+                    continue;
+                }
+                std::string option = key.substr(type_prefix.size());
+                if (option.find('.') == std::string::npos &&
+                    option != Options::FILE_INDEX_COLUMNS) {
+                    index_options.emplace(option, value);
+                }
+            }
+        }
+    }
+    return index_columns;
+}
+
 std::optional<std::string> CoreOptions::GetDataFileExternalPaths() const {
     return impl_->data_file_external_paths;
 }
@@ -757,6 +969,18 @@ bool CoreOptions::GlobalIndexEnabled() const {
     return impl_->global_index_enabled;
 }
 
+int64_t CoreOptions::GetGlobalIndexBuildShardRows() const {
+    return impl_->global_index_build_shard_rows;
+}
+
+int32_t CoreOptions::GetGlobalIndexBuildParallelism() const {
+    return impl_->global_index_build_parallelism;
+}
+
+int64_t CoreOptions::GetGlobalIndexBuildMaxMemory() const {
+    return impl_->global_index_build_max_memory;
+}
+
 std::optional<std::string> CoreOptions::GetGlobalIndexExternalPath() const {
     return impl_->global_index_external_path;
 }
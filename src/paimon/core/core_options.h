@@ -65,6 +65,8 @@ class PAIMON_EXPORT CoreOptions {
     const std::string& GetManifestCompression() const;
     int32_t GetManifestMergeMinCount() const;
     int64_t GetManifestFullCompactionThresholdSize() const;
+    int64_t GetManifestCacheMaxMemorySize() const;
+    int64_t GetLookupCacheMaxMemorySize() const;
     int64_t GetSourceSplitTargetSize() const;
     int64_t GetSourceSplitOpenFileCost() const;
     std::optional<int64_t> GetScanSnapshotId() const;
@@ -75,6 +77,21 @@ class PAIMON_EXPORT CoreOptions {
     int32_t GetReadBatchSize() const;
     int32_t GetWriteBatchSize() const;
     int64_t GetWriteBufferSize() const;
+    bool WriteBufferSpillable() const;
+    int64_t GetWriteBufferSpillMaxDiskSize() const;
+    std::optional<std::string> GetWriteBufferSpillDir() const;
+    int64_t GetWriteTotalBufferSize() const;
+
+    bool WriteOnly() const;
+    int32_t GetWritePrepareCommitParallelism() const;
+    int32_t GetNumSortedRunsCompactionTrigger() const;
+    int32_t GetNumSortedRunsStopTrigger() const;
+    int32_t GetNumLevels() const;
+    int32_t GetCompactionMaxSizeAmplificationPercent() const;
+    int32_t GetCompactionSizeRatio() const;
+    int64_t GetCompactionFileSize() const;
+    int32_t GetCompactionMinFileNum() const;
+    int32_t GetCompactionMaxFileNum() const;
 
     const ExpireConfig& GetExpireConfig() const;
 
@@ -94,6 +111,10 @@ class PAIMON_EXPORT CoreOptions {
     ChangelogProducer GetChangelogProducer() const;
     bool NeedLookup() const;
     bool FileIndexReadEnabled() const;
+    int64_t GetFileIndexInManifestThreshold() const;
+    /// @return Map of indexed column name to its index types and options of each index type.
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>
+    GetFileIndexColumns() const;
 
     std::map<std::string, std::string> GetFieldsSequenceGroups() const;
     bool PartialUpdateRemoveRecordOnDelete() const;
@@ -117,6 +138,9 @@ class PAIMON_EXPORT CoreOptions {
 
     bool GlobalIndexEnabled() const;
     Result<std::optional<std::string>> CreateGlobalIndexExternalPath() const;
+    int64_t GetGlobalIndexBuildShardRows() const;
+    int32_t GetGlobalIndexBuildParallelism() const;
+    int64_t GetGlobalIndexBuildMaxMemory() const;
 
     const std::map<std::string, std::string>& ToMap() const;
 
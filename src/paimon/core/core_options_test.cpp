@@ -47,14 +47,29 @@ TEST(CoreOptionsTest, TestDefaultValue) {
     ASSERT_EQ(StartupMode::LatestFull(), core_options.GetStartupMode());
     ASSERT_EQ(8 * 1024 * 1024L, core_options.GetManifestTargetFileSize());
     ASSERT_EQ(16 * 1024 * 1024L, core_options.GetManifestFullCompactionThresholdSize());
+    ASSERT_EQ(0, core_options.GetManifestCacheMaxMemorySize());
+    ASSERT_EQ(256 * 1024 * 1024L, core_options.GetLookupCacheMaxMemorySize());
     ASSERT_EQ(30, core_options.GetManifestMergeMinCount());
     ASSERT_EQ(128 * 1024 * 1024L, core_options.GetSourceSplitTargetSize());
     ASSERT_EQ(4 * 1024 * 1024L, core_options.GetSourceSplitOpenFileCost());
     ASSERT_EQ(1024, core_options.GetReadBatchSize());
     ASSERT_EQ(1024, core_options.GetWriteBatchSize());
     ASSERT_EQ(256 * 1024 * 1024, core_options.GetWriteBufferSize());
+    ASSERT_FALSE(core_options.WriteBufferSpillable());
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), core_options.GetWriteBufferSpillMaxDiskSize());
+    ASSERT_EQ(std::nullopt, core_options.GetWriteBufferSpillDir());
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), core_options.GetWriteTotalBufferSize());
     ASSERT_EQ(std::numeric_limits<int64_t>::max(), core_options.GetCommitTimeout());
     ASSERT_EQ(10, core_options.GetCommitMaxRetries());
+    ASSERT_FALSE(core_options.WriteOnly());
+    ASSERT_EQ(4, core_options.GetWritePrepareCommitParallelism());
+    ASSERT_EQ(5, core_options.GetNumSortedRunsCompactionTrigger());
+    ASSERT_EQ(8, core_options.GetNumSortedRunsStopTrigger());
+    ASSERT_EQ(6, core_options.GetNumLevels());
+    ASSERT_EQ(200, core_options.GetCompactionMaxSizeAmplificationPercent());
+    ASSERT_EQ(1, core_options.GetCompactionSizeRatio());
+    ASSERT_EQ(5, core_options.GetCompactionMinFileNum());
+    ASSERT_EQ(50, core_options.GetCompactionMaxFileNum());
     ExpireConfig expire_config = core_options.GetExpireConfig();
     ASSERT_EQ(10, expire_config.GetSnapshotRetainMin());
     ASSERT_EQ(std::numeric_limits<int32_t>::max(), expire_config.GetSnapshotRetainMax());
@@ -78,6 +93,8 @@ TEST(CoreOptionsTest, TestDefaultValue) {
     ASSERT_EQ(std::nullopt, core_options.GetScanFallbackBranch());
     ASSERT_EQ("main", core_options.GetBranch());
     ASSERT_TRUE(core_options.FileIndexReadEnabled());
+    ASSERT_EQ(500, core_options.GetFileIndexInManifestThreshold());
+    ASSERT_TRUE(core_options.GetFileIndexColumns().empty());
     ASSERT_EQ(std::nullopt, core_options.GetDataFileExternalPaths());
     ASSERT_EQ(ExternalPathStrategy::NONE, core_options.GetExternalPathStrategy());
     ASSERT_TRUE(core_options.EnableAdaptivePrefetchStrategy());
@@ -88,6 +105,9 @@ TEST(CoreOptionsTest, TestDefaultValue) {
     ASSERT_TRUE(core_options.LegacyPartitionNameEnabled());
     ASSERT_TRUE(core_options.GlobalIndexEnabled());
     ASSERT_FALSE(core_options.GetGlobalIndexExternalPath());
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), core_options.GetGlobalIndexBuildShardRows());
+    ASSERT_EQ(4, core_options.GetGlobalIndexBuildParallelism());
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), core_options.GetGlobalIndexBuildMaxMemory());
 }
 
 TEST(CoreOptionsTest, TestFromMap) {
@@ -102,14 +122,29 @@ TEST(CoreOptionsTest, TestFromMap) {
         {Options::PARTITION_DEFAULT_NAME, "foo"},
         {Options::MANIFEST_TARGET_FILE_SIZE, "16MB"},
         {Options::MANIFEST_FULL_COMPACTION_FILE_SIZE, "32MB"},
+        {Options::MANIFEST_CACHE_MAX_MEMORY_SIZE, "64MB"},
+        {Options::LOOKUP_CACHE_MAX_MEMORY_SIZE, "128MB"},
         {Options::MANIFEST_MERGE_MIN_COUNT, "2"},
         {Options::SOURCE_SPLIT_TARGET_SIZE, "24MB"},
         {Options::SOURCE_SPLIT_OPEN_FILE_COST, "32MB"},
         {Options::READ_BATCH_SIZE, "2048"},
         {Options::WRITE_BUFFER_SIZE, "16MB"},
+        {Options::WRITE_BUFFER_SPILLABLE, "true"},
+        {Options::WRITE_BUFFER_SPILL_MAX_DISK_SIZE, "1GB"},
+        {Options::WRITE_BUFFER_SPILL_DIR, "/data/spill"},
+        {Options::WRITE_TOTAL_BUFFER_SIZE, "512MB"},
         {Options::WRITE_BATCH_SIZE, "1234"},
         {Options::COMMIT_TIMEOUT, "120s"},
         {Options::COMMIT_MAX_RETRIES, "20"},
+        {Options::WRITE_ONLY, "true"},
+        {Options::WRITE_PREPARE_COMMIT_PARALLELISM, "8"},
+        {Options::NUM_SORTED_RUNS_COMPACTION_TRIGGER, "3"},
+        {Options::NUM_SORTED_RUNS_STOP_TRIGGER, "10"},
+        {Options::NUM_LEVELS, "4"},
+        {Options::COMPACTION_MAX_SIZE_AMPLIFICATION_PERCENT, "100"},
+        {Options::COMPACTION_SIZE_RATIO, "2"},
+        {Options::COMPACTION_MIN_FILE_NUM, "10"},
+        {Options::COMPACTION_MAX_FILE_NUM, "20"},
         {Options::SCAN_SNAPSHOT_ID, "5"},
         {Options::SNAPSHOT_NUM_RETAINED_MIN, "15"},
         {Options::SNAPSHOT_NUM_RETAINED_MAX, "30"},
@@ -146,6 +181,9 @@ TEST(CoreOptionsTest, TestFromMap) {
         {Options::PARTITION_GENERATE_LEGACY_NAME, "false"},
         {Options::GLOBAL_INDEX_ENABLED, "false"},
         {Options::GLOBAL_INDEX_EXTERNAL_PATH, "FILE:///tmp/global_index/"},
+        {Options::GLOBAL_INDEX_BUILD_SHARD_ROWS, "1000000"},
+        {Options::GLOBAL_INDEX_BUILD_PARALLELISM, "8"},
+        {Options::GLOBAL_INDEX_BUILD_MAX_MEMORY, "1GB"},
     };
 
     ASSERT_OK_AND_ASSIGN(CoreOptions core_options, CoreOptions::FromMap(options));
@@ -165,14 +203,29 @@ TEST(CoreOptionsTest, TestFromMap) {
     ASSERT_EQ("foo", core_options.GetPartitionDefaultName());
     ASSERT_EQ(16 * 1024 * 1024L, core_options.GetManifestTargetFileSize());
     ASSERT_EQ(32 * 1024 * 1024L, core_options.GetManifestFullCompactionThresholdSize());
+    ASSERT_EQ(64 * 1024 * 1024L, core_options.GetManifestCacheMaxMemorySize());
+    ASSERT_EQ(128 * 1024 * 1024L, core_options.GetLookupCacheMaxMemorySize());
     ASSERT_EQ(2, core_options.GetManifestMergeMinCount());
     ASSERT_EQ(24 * 1024 * 1024L, core_options.GetSourceSplitTargetSize());
     ASSERT_EQ(32 * 1024 * 1024L, core_options.GetSourceSplitOpenFileCost());
     ASSERT_EQ(2048, core_options.GetReadBatchSize());
     ASSERT_EQ(1234, core_options.GetWriteBatchSize());
     ASSERT_EQ(16 * 1024 * 1024, core_options.GetWriteBufferSize());
+    ASSERT_TRUE(core_options.WriteBufferSpillable());
+    ASSERT_EQ(1024 * 1024 * 1024L, core_options.GetWriteBufferSpillMaxDiskSize());
+    ASSERT_EQ(std::optional<std::string>("/data/spill"), core_options.GetWriteBufferSpillDir());
+    ASSERT_EQ(512 * 1024 * 1024L, core_options.GetWriteTotalBufferSize());
     ASSERT_EQ(120 * 1000, core_options.GetCommitTimeout());
     ASSERT_EQ(20, core_options.GetCommitMaxRetries());
+    ASSERT_TRUE(core_options.WriteOnly());
+    ASSERT_EQ(8, core_options.GetWritePrepareCommitParallelism());
+    ASSERT_EQ(3, core_options.GetNumSortedRunsCompactionTrigger());
+    ASSERT_EQ(10, core_options.GetNumSortedRunsStopTrigger());
+    ASSERT_EQ(4, core_options.GetNumLevels());
+    ASSERT_EQ(100, core_options.GetCompactionMaxSizeAmplificationPercent());
+    ASSERT_EQ(2, core_options.GetCompactionSizeRatio());
+    ASSERT_EQ(10, core_options.GetCompactionMinFileNum());
+    ASSERT_EQ(20, core_options.GetCompactionMaxFileNum());
     ASSERT_EQ(5, core_options.GetScanSnapshotId().value_or(-1));
     ExpireConfig expire_config = core_options.GetExpireConfig();
     ASSERT_EQ(15, expire_config.GetSnapshotRetainMin());
@@ -216,6 +269,28 @@ TEST(CoreOptionsTest, TestFromMap) {
     ASSERT_FALSE(core_options.GlobalIndexEnabled());
     ASSERT_TRUE(core_options.GetGlobalIndexExternalPath());
     ASSERT_EQ(core_options.GetGlobalIndexExternalPath().value(), "FILE:///tmp/global_index/");
+    ASSERT_EQ(1000000, core_options.GetGlobalIndexBuildShardRows());
+    ASSERT_EQ(8, core_options.GetGlobalIndexBuildParallelism());
+    ASSERT_EQ(1024 * 1024 * 1024L, core_options.GetGlobalIndexBuildMaxMemory());
+}
+
+TEST(CoreOptionsTest, TestFileIndexOptions) {
+    ASSERT_OK_AND_ASSIGN(CoreOptions core_options,
+                         CoreOptions::FromMap({
+                             {Options::FILE_INDEX_IN_MANIFEST_THRESHOLD, "1KB"},
+                             {"file-index.bloom-filter.columns", "f0, f1"},
+                             {"file-index.bloom-filter.fpp", "0.1"},
+                             {"file-index.bloom-filter.f1.fpp", "0.01"},
+                             {"file-index.bloom-filter.f1.items", "100"},
+                             {"file-index.bitmap.columns", "f1"},
+                             {"file-index.bsi.f2.foo", "bar"},
+                         }));
+    ASSERT_EQ(1024, core_options.GetFileIndexInManifestThreshold());
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> expected = {
+        {"f0", {{"bloom-filter", {{"fpp", "0.1"}}}}},
+        {"f1", {{"bloom-filter", {{"fpp", "0.01"}, {"items", "100"}}}, {"bitmap", {}}}},
+    };
+    ASSERT_EQ(expected, core_options.GetFileIndexColumns());
 }
 
 TEST(CoreOptionsTest, TestInvalidCase) {
@@ -231,6 +306,16 @@ TEST(CoreOptionsTest, TestInvalidCase) {
                         "invalid merge engine: invalid");
     ASSERT_NOK_WITH_MSG(CoreOptions::FromMap({{Options::CHANGELOG_PRODUCER, "invalid"}}),
                         "invalid changelog producer: invalid");
+    ASSERT_NOK_WITH_MSG(CoreOptions::FromMap({{Options::COMPACTION_MIN_FILE_NUM, "60"}}),
+                        "compaction.min.file-num must be positive and not greater than "
+                        "compaction.max.file-num, but they are 60 and 50");
+    ASSERT_NOK_WITH_MSG(
+        CoreOptions::FromMap({{Options::WRITE_PREPARE_COMMIT_PARALLELISM, "0"}}),
+        "write.prepare-commit.parallelism must be positive, but is 0");
+    ASSERT_NOK_WITH_MSG(CoreOptions::FromMap({{Options::GLOBAL_INDEX_BUILD_SHARD_ROWS, "0"}}),
+                        "global-index.build.shard-rows must be positive, but is 0");
+    ASSERT_NOK_WITH_MSG(CoreOptions::FromMap({{Options::GLOBAL_INDEX_BUILD_PARALLELISM, "-1"}}),
+                        "global-index.build.parallelism must be positive, but is -1");
 }
 
 TEST(CoreOptionsTest, TestCreateExternalPath) {
@@ -18,10 +18,28 @@
 
 #include "fmt/format.h"
 #include "paimon/common/predicate/predicate_utils.h"
+#include "paimon/core/global_index/vector_search_top_k_merger.h"
 #include "paimon/global_index/bitmap_global_index_result.h"
 #include "paimon/predicate/leaf_predicate.h"
 
 namespace paimon {
+namespace {
+// Returns row ids in [offset, offset + row_count) of `bitmap`, shifted to start from `offset`.
+std::shared_ptr<const RoaringBitmap64> ShiftBitmap(const RoaringBitmap64& bitmap, int64_t offset,
+                                                   int64_t row_count) {
+    // only visit row ids of the shard and add them in one batch, which is much cheaper than adding
+    // them one by one as the row ids are sorted
+    int64_t end = offset + row_count;
+    std::vector<int64_t> row_ids;
+    for (auto iter = bitmap.EqualOrLarger(offset); iter != bitmap.End() && *iter < end; ++iter) {
+        row_ids.push_back(*iter - offset);
+    }
+    auto shifted = std::make_shared<RoaringBitmap64>();
+    shifted->AddMany(row_ids);
+    return shifted;
+}
+}  // namespace
+
 Result<std::optional<std::shared_ptr<GlobalIndexResult>>> GlobalIndexEvaluatorImpl::Evaluate(
     const std::shared_ptr<Predicate>& predicate,
     const std::shared_ptr<VectorSearch>& vector_search) {
@@ -37,39 +55,69 @@ Result<std::optional<std::shared_ptr<GlobalIndexResult>>> GlobalIndexEvaluatorIm
     return compound_result;
 }
 
-Result<std::vector<std::shared_ptr<GlobalIndexReader>>> GlobalIndexEvaluatorImpl::GetIndexReaders(
+Result<std::vector<GlobalIndexEvaluatorImpl::IndexShard>> GlobalIndexEvaluatorImpl::GetIndexShards(
     const std::string& field_name) {
     PAIMON_ASSIGN_OR_RAISE(DataField data_field, table_schema_->GetField(field_name));
     int32_t field_id = data_field.Id();
-    // get or create global index readers for current field
-    std::vector<std::shared_ptr<GlobalIndexReader>> readers;
-    auto iter = index_readers_cache_.find(field_id);
-    if (iter != index_readers_cache_.end()) {
-        readers = iter->second;
-    } else {
-        PAIMON_ASSIGN_OR_RAISE(readers, create_index_readers_(field_id));
-        index_readers_cache_.insert({field_id, readers});
-    }
-    return readers;
+    auto iter = index_shards_cache_.find(field_id);
+    if (iter != index_shards_cache_.end()) {
+        return iter->second;
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::vector<IndexShard> shards, create_index_shards_(field_id));
+    index_shards_cache_.insert({field_id, shards});
+    return shards;
+}
+
+Result<std::optional<VectorSearch::DistanceType>> GlobalIndexEvaluatorImpl::GetDistanceType(
+    const std::string& field_name,
+    const std::optional<VectorSearch::DistanceType>& search_distance_type) {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<IndexShard> shards, GetIndexShards(field_name));
+    if (shards.empty()) {
+        return std::optional<VectorSearch::DistanceType>();
+    }
+    if (search_distance_type) {
+        return search_distance_type;
+    }
+    std::optional<VectorSearch::DistanceType> distance_type;
+    for (const auto& shard : shards) {
+        std::optional<VectorSearch::DistanceType> shard_distance_type =
+            shard.reader->GetDistanceType();
+        if (!shard_distance_type) {
+            return Status::Invalid(
+                fmt::format("global index {} of field {} does not support vector search",
+                            shard.index_type, field_name));
+        }
+        if (distance_type && distance_type.value() != shard_distance_type.value()) {
+            return Status::Invalid(fmt::format(
+                "index shards of field {} have different distance types", field_name));
+        }
+        distance_type = shard_distance_type;
+    }
+    return distance_type;
 }
 
 Result<std::optional<std::shared_ptr<GlobalIndexResult>>>
 GlobalIndexEvaluatorImpl::EvaluateVectorSearch(
     const std::shared_ptr<VectorSearch>& vector_search,
     const std::optional<std::shared_ptr<GlobalIndexResult>>& predicate_result) {
-    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<GlobalIndexReader>> readers,
-                           GetIndexReaders(vector_search->field_name));
-    if (readers.empty()) {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<IndexShard> shards,
+                           GetIndexShards(vector_search->field_name));
+    if (shards.empty()) {
         return predicate_result;
     }
-    if (readers.size() > 1) {
-        return Status::Invalid("Vector search cannot have multiple global indexes");
+    for (const auto& shard : shards) {
+        if (shard.index_type != shards[0].index_type) {
+            return Status::Invalid("Vector search cannot have multiple global indexes");
+        }
+    }
+    if (vector_search->pre_filter != nullptr && vector_search->pre_filter_bitmap != nullptr) {
+        return Status::Invalid("pre_filter and pre_filter_bitmap in VectorSearch conflict");
     }
-    const auto& vector_search_reader = readers[0];
-    if (predicate_result && vector_search->pre_filter != nullptr) {
+    if (predicate_result &&
+        (vector_search->pre_filter != nullptr || vector_search->pre_filter_bitmap != nullptr)) {
         return Status::Invalid("Predicate result and pre_filter in VectorSearch conflict");
     }
-    auto final_vector_search = vector_search;
+    std::shared_ptr<const RoaringBitmap64> filter_bitmap = vector_search->pre_filter_bitmap;
     if (predicate_result) {
         auto bitmap_global_index_result =
             std::dynamic_pointer_cast<BitmapGlobalIndexResult>(predicate_result.value());
@@ -80,14 +128,50 @@ GlobalIndexEvaluatorImpl::EvaluateVectorSearch(
         PAIMON_ASSIGN_OR_RAISE(const RoaringBitmap64* bitmap,
                                bitmap_global_index_result->GetBitmap());
         assert(bitmap);
-        final_vector_search = vector_search->ReplacePreFilter(
-            [bitmap_global_index_result, bitmap](int64_t row_id) -> bool {
-                return bitmap->Contains(row_id);
-            });
-    }
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexResult> vector_search_result,
-                           vector_search_reader->VisitVectorSearch(final_vector_search));
-    return std::optional<std::shared_ptr<GlobalIndexResult>>(vector_search_result);
+        // the bitmap is owned by the predicate result
+        filter_bitmap = std::shared_ptr<const RoaringBitmap64>(bitmap_global_index_result, bitmap);
+    }
+
+    // Pre-filters work on local row ids of the scanner while each shard searches with its own
+    // local row ids, so shift the shard row ids before filtering and after searching.
+    auto search_shard = [&](const IndexShard& shard) -> Result<std::shared_ptr<GlobalIndexResult>> {
+        int64_t row_offset = shard.row_offset;
+        auto shard_vector_search = vector_search;
+        if (filter_bitmap) {
+            shard_vector_search = vector_search->ReplacePreFilterBitmap(
+                row_offset == 0 ? filter_bitmap
+                                : ShiftBitmap(*filter_bitmap, row_offset, shard.row_count));
+        } else if (vector_search->pre_filter && row_offset != 0) {
+            shard_vector_search = vector_search->ReplacePreFilter(
+                [pre_filter = vector_search->pre_filter, row_offset](int64_t row_id) -> bool {
+                    return pre_filter(row_id + row_offset);
+                });
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexResult> shard_result,
+                               shard.reader->VisitVectorSearch(shard_vector_search));
+        if (row_offset == 0) {
+            return shard_result;
+        }
+        return shard_result->AddOffset(row_offset);
+    };
+
+    if (shards.size() == 1) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexResult> vector_search_result,
+                               search_shard(shards[0]));
+        return std::optional<std::shared_ptr<GlobalIndexResult>>(vector_search_result);
+    }
+    // index is built incrementally over multiple row ranges, merge top-k of each shard
+    PAIMON_ASSIGN_OR_RAISE(
+        std::optional<VectorSearch::DistanceType> distance_type,
+        GetDistanceType(vector_search->field_name, vector_search->distance_type));
+    assert(distance_type);
+    VectorSearchTopKMerger merger(vector_search->limit, distance_type.value());
+    for (const auto& shard : shards) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexResult> shard_result,
+                               search_shard(shard));
+        PAIMON_RETURN_NOT_OK(merger.Add(shard_result));
+    }
+    return std::optional<std::shared_ptr<GlobalIndexResult>>(merger.GetResult());
 }
 
 Result<std::optional<std::shared_ptr<GlobalIndexResult>>>
@@ -100,15 +184,27 @@ GlobalIndexEvaluatorImpl::EvaluatePredicate(const std::shared_ptr<Predicate>& pr
         return EvaluateCompoundPredicate(compound_predicate);
     } else if (auto leaf_predicate = std::dynamic_pointer_cast<LeafPredicate>(predicate)) {
         const std::string& field_name = leaf_predicate->FieldName();
-        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<GlobalIndexReader>> readers,
-                               GetIndexReaders(field_name));
-        // calculate compound result as field may has multiple indexes
-        std::optional<std::shared_ptr<GlobalIndexResult>> compound_result;
-        for (const auto& index_reader : readers) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<IndexShard> shards, GetIndexShards(field_name));
+        // an index may be built in multiple shards, union the results of its shards
+        std::map<std::string, std::shared_ptr<GlobalIndexResult>> index_type_to_result;
+        for (const auto& shard : shards) {
             PAIMON_ASSIGN_OR_RAISE(
-                std::shared_ptr<GlobalIndexResult> sub_result,
+                std::shared_ptr<GlobalIndexResult> shard_result,
                 PredicateUtils::VisitPredicate<std::shared_ptr<GlobalIndexResult>>(leaf_predicate,
-                                                                                   index_reader));
+                                                                                   shard.reader));
+            if (shard.row_offset != 0) {
+                PAIMON_ASSIGN_OR_RAISE(shard_result, shard_result->AddOffset(shard.row_offset));
+            }
+            auto iter = index_type_to_result.find(shard.index_type);
+            if (iter == index_type_to_result.end()) {
+                index_type_to_result.emplace(shard.index_type, std::move(shard_result));
+            } else {
+                PAIMON_ASSIGN_OR_RAISE(iter->second, iter->second->Or(shard_result));
+            }
+        }
+        // calculate compound result as field may has multiple indexes
+        std::optional<std::shared_ptr<GlobalIndexResult>> compound_result;
+        for (const auto& [_, sub_result] : index_type_to_result) {
             if (!compound_result) {
                 compound_result = sub_result;
             } else {
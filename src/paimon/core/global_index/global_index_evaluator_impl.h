@@ -31,17 +31,33 @@
 namespace paimon {
 class GlobalIndexEvaluatorImpl : public GlobalIndexEvaluator {
  public:
-    using IndexReadersCreator =
-        std::function<Result<std::vector<std::shared_ptr<GlobalIndexReader>>>(int32_t)>;
+    /// Reader of a single index shard, i.e., the index files built for one row range of a field.
+    struct IndexShard {
+        std::string index_type;
+        /// Offset of the first row of the shard relative to the first indexed row of the scanner.
+        int64_t row_offset;
+        /// Number of rows covered by the shard.
+        int64_t row_count;
+        std::shared_ptr<GlobalIndexReader> reader;
+    };
+
+    using IndexShardsCreator = std::function<Result<std::vector<IndexShard>>(int32_t)>;
 
     GlobalIndexEvaluatorImpl(const std::shared_ptr<TableSchema>& table_schema,
-                             IndexReadersCreator create_index_readers)
-        : table_schema_(table_schema), create_index_readers_(std::move(create_index_readers)) {}
+                             IndexShardsCreator create_index_shards)
+        : table_schema_(table_schema), create_index_shards_(std::move(create_index_shards)) {}
 
     Result<std::optional<std::shared_ptr<GlobalIndexResult>>> Evaluate(
         const std::shared_ptr<Predicate>& predicate,
         const std::shared_ptr<VectorSearch>& vector_search) override;
 
+    /// @return The distance type that orders scores of vector search on `field_name`, which is
+    /// the one specified by the search or else the one of the index, std::nullopt if the field
+    /// has no vector index.
+    Result<std::optional<VectorSearch::DistanceType>> GetDistanceType(
+        const std::string& field_name,
+        const std::optional<VectorSearch::DistanceType>& search_distance_type);
+
  private:
     Result<std::optional<std::shared_ptr<GlobalIndexResult>>> EvaluateVectorSearch(
         const std::shared_ptr<VectorSearch>& vector_search,
@@ -53,15 +69,14 @@ class GlobalIndexEvaluatorImpl : public GlobalIndexEvaluator {
     Result<std::optional<std::shared_ptr<GlobalIndexResult>>> EvaluateCompoundPredicate(
         const std::shared_ptr<CompoundPredicate>& compound_predicate);
 
-    Result<std::vector<std::shared_ptr<GlobalIndexReader>>> GetIndexReaders(
-        const std::string& field_name);
+    Result<std::vector<IndexShard>> GetIndexShards(const std::string& field_name);
 
  private:
     std::shared_ptr<TableSchema> table_schema_;
-    // create_index_readers_(field_id)
-    IndexReadersCreator create_index_readers_;
-    // [field_id, vector<reader>]
-    std::map<int32_t, std::vector<std::shared_ptr<GlobalIndexReader>>> index_readers_cache_;
+    // create_index_shards_(field_id)
+    IndexShardsCreator create_index_shards_;
+    // [field_id, vector<shard>]
+    std::map<int32_t, std::vector<IndexShard>> index_shards_cache_;
 };
 
 }  // namespace paimon
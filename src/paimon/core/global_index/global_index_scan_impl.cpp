@@ -20,7 +20,9 @@
 #include <utility>
 
 #include "paimon/common/executor/future.h"
+#include "paimon/core/global_index/global_index_evaluator_impl.h"
 #include "paimon/core/global_index/row_range_global_index_scanner_impl.h"
+#include "paimon/core/global_index/vector_search_top_k_merger.h"
 #include "paimon/core/index/index_file_handler.h"
 #include "paimon/global_index/bitmap_global_index_result.h"
 namespace paimon {
@@ -160,15 +162,23 @@ Result<std::optional<std::shared_ptr<GlobalIndexResult>>> GlobalIndexScanImpl::P
         range_scanners.push_back(scanner_impl);
     }
 
+    std::vector<std::shared_ptr<GlobalIndexEvaluatorImpl>> evaluators;
+    evaluators.reserve(range_scanners.size());
+    for (const auto& scanner : range_scanners) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexEvaluator> evaluator,
+                               scanner->CreateIndexEvaluator());
+        auto evaluator_impl = std::dynamic_pointer_cast<GlobalIndexEvaluatorImpl>(evaluator);
+        assert(evaluator_impl);
+        evaluators.push_back(evaluator_impl);
+    }
+
     std::vector<std::future<Result<std::optional<std::shared_ptr<GlobalIndexResult>>>>> futures;
-    for (size_t i = 0; i < range_scanners.size(); i++) {
-        const auto& scanner = range_scanners[i];
+    for (size_t i = 0; i < evaluators.size(); i++) {
+        const auto& evaluator = evaluators[i];
         const auto& range = ranges[i];
         auto search_index =
-            [&scanner, &predicate, &vector_search,
+            [&evaluator, &predicate, &vector_search,
              &range]() -> Result<std::optional<std::shared_ptr<GlobalIndexResult>>> {
-            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexEvaluator> evaluator,
-                                   scanner->CreateIndexEvaluator());
             PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<GlobalIndexResult>> index_result,
                                    evaluator->Evaluate(predicate, vector_search));
             if (!index_result) {
@@ -185,11 +195,16 @@ Result<std::optional<std::shared_ptr<GlobalIndexResult>>> GlobalIndexScanImpl::P
     // collect inner result and check all null
     bool all_null = true;
     std::vector<std::optional<std::shared_ptr<GlobalIndexResult>>> results;
+    // indexes of results which are scored by vector search
+    std::vector<size_t> vector_search_results;
     for (auto& result : collected_results) {
         PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<GlobalIndexResult>> inner_result,
                                result);
         if (inner_result) {
             all_null = false;
+            if (std::dynamic_pointer_cast<VectorSearchGlobalIndexResult>(inner_result.value())) {
+                vector_search_results.push_back(results.size());
+            }
         }
         results.push_back(std::move(inner_result));
     }
@@ -197,10 +212,37 @@ Result<std::optional<std::shared_ptr<GlobalIndexResult>>> GlobalIndexScanImpl::P
         return std::optional<std::shared_ptr<GlobalIndexResult>>();
     }
 
-    // union result from multiple ranges
+    // each range only keeps its own top-k rows, merge them into the global top-k
     std::optional<std::shared_ptr<GlobalIndexResult>> final_global_index_result;
+    std::vector<bool> merged_into_top_k(results.size(), false);
+    if (vector_search && vector_search_results.size() > 1) {
+        std::optional<VectorSearch::DistanceType> distance_type;
+        for (size_t idx : vector_search_results) {
+            PAIMON_ASSIGN_OR_RAISE(distance_type,
+                                   evaluators[idx]->GetDistanceType(vector_search->field_name,
+                                                                    vector_search->distance_type));
+            if (distance_type) {
+                break;
+            }
+        }
+        if (!distance_type) {
+            return Status::Invalid(fmt::format(
+                "cannot merge vector search results of field {} without distance type",
+                vector_search->field_name));
+        }
+        VectorSearchTopKMerger merger(vector_search->limit, distance_type.value());
+        for (size_t idx : vector_search_results) {
+            PAIMON_RETURN_NOT_OK(merger.Add(results[idx].value()));
+            merged_into_top_k[idx] = true;
+        }
+        final_global_index_result = merger.GetResult();
+    }
 
+    // union result from multiple ranges
     for (size_t i = 0; i < results.size(); ++i) {
+        if (merged_into_top_k[i]) {
+            continue;
+        }
         std::shared_ptr<GlobalIndexResult> result =
             results[i] ? results[i].value() : BitmapGlobalIndexResult::FromRanges({ranges[i]});
         if (!final_global_index_result) {
@@ -16,19 +16,31 @@
 
 #include "paimon/global_index/global_index_write_task.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <utility>
+
 #include "arrow/c/bridge.h"
+#include "paimon/common/executor/future.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/global_index/global_index_file_manager.h"
+#include "paimon/core/global_index/indexed_split_impl.h"
 #include "paimon/core/io/data_increment.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/table/sink/commit_message_impl.h"
 #include "paimon/core/table/source/data_split_impl.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/executor.h"
 #include "paimon/global_index/global_indexer.h"
 #include "paimon/global_index/global_indexer_factory.h"
+#include "paimon/logging.h"
 #include "paimon/read_context.h"
 #include "paimon/table/source/table_read.h"
 namespace paimon {
@@ -118,29 +130,127 @@ Result<std::vector<GlobalIndexIOMeta>> BuildIndex(const std::string& field_name,
     return global_index_writer->Finish();
 }
 
+std::vector<Range> SplitToShards(const Range& range, int64_t shard_rows) {
+    std::vector<Range> shards;
+    for (int64_t from = range.from; from <= range.to;) {
+        int64_t to = range.to - from < shard_rows ? range.to : from + shard_rows - 1;
+        shards.emplace_back(from, to);
+        from = to + 1;
+    }
+    return shards;
+}
+
+/// Runs `build_shard` for every shard, with at most `parallelism` shards in progress. A new shard
+/// is only started when no other shard is in progress or the memory allocated from `pool` since
+/// the start is below `max_memory`, so the memory of concurrent builders stays bounded.
+std::vector<Result<std::vector<GlobalIndexIOMeta>>> BuildShards(
+    size_t shard_count, int32_t parallelism, int64_t max_memory,
+    const std::shared_ptr<MemoryPool>& pool,
+    const std::function<Result<std::vector<GlobalIndexIOMeta>>(size_t)>& build_shard) {
+    std::vector<Result<std::vector<GlobalIndexIOMeta>>> results(
+        shard_count, Status::Invalid("index shard is not built"));
+    size_t worker_count = std::min(static_cast<size_t>(parallelism), shard_count);
+    if (worker_count <= 1) {
+        for (size_t i = 0; i < shard_count; ++i) {
+            results[i] = build_shard(i);
+            if (!results[i].ok()) {
+                break;
+            }
+        }
+        return results;
+    }
+
+    const int64_t base_usage = static_cast<int64_t>(pool->CurrentUsage());
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t next_shard = 0;
+    size_t running = 0;
+    bool failed = false;
+    // each worker repeatedly takes the next shard, the calling thread works as one of them
+    auto build_shards = [&]() {
+        while (true) {
+            size_t shard;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() {
+                    return failed || next_shard >= shard_count || running == 0 ||
+                           static_cast<int64_t>(pool->CurrentUsage()) - base_usage < max_memory;
+                });
+                if (failed || next_shard >= shard_count) {
+                    return;
+                }
+                shard = next_shard++;
+                running++;
+            }
+            Result<std::vector<GlobalIndexIOMeta>> result = build_shard(shard);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                failed = failed || !result.ok();
+                results[shard] = std::move(result);
+                running--;
+            }
+            cv.notify_all();
+        }
+    };
+    // shard builders use a dedicated executor, the prefetching readers they create schedule
+    // their own tasks on the global executor
+    std::unique_ptr<Executor> executor =
+        CreateDefaultExecutor(static_cast<uint32_t>(worker_count - 1));
+    std::vector<std::future<void>> futures;
+    {
+        ScopeGuard guard([&futures]() { Wait(futures); });
+        for (size_t i = 1; i < worker_count; ++i) {
+            futures.push_back(Via(executor.get(), build_shards));
+        }
+        build_shards();
+    }
+    return results;
+}
+
+/// Deletes the index files of the shards built successfully, which are not committed when any
+/// other shard fails.
+void DeleteShardFiles(const std::shared_ptr<FileSystem>& fs,
+                      const std::vector<Result<std::vector<GlobalIndexIOMeta>>>& shard_results) {
+    auto logger = Logger::GetLogger("GlobalIndexWriteTask");
+    for (const auto& shard_result : shard_results) {
+        if (!shard_result.ok()) {
+            continue;
+        }
+        for (const auto& io_meta : shard_result.value()) {
+            Status status = fs->Delete(io_meta.file_path, /*recursive=*/false);
+            if (!status.ok()) {
+                PAIMON_LOG_WARN(logger, "Exception occurs when deleting %s: %s",
+                                io_meta.file_path.c_str(), status.ToString().c_str());
+            }
+        }
+    }
+}
+
 Result<std::shared_ptr<CommitMessage>> ToCommitMessage(
-    const std::string& index_type, int32_t field_id, const Range& range,
-    const std::vector<GlobalIndexIOMeta>& global_index_io_metas, const BinaryRow& partition,
-    int32_t bucket, const std::shared_ptr<GlobalIndexFileManager>& file_manager) {
+    const std::string& index_type, int32_t field_id,
+    const std::vector<std::pair<Range, std::vector<GlobalIndexIOMeta>>>& shard_io_metas,
+    const BinaryRow& partition, int32_t bucket,
+    const std::shared_ptr<GlobalIndexFileManager>& file_manager) {
     std::vector<std::shared_ptr<IndexFileMeta>> index_file_metas;
-    index_file_metas.reserve(global_index_io_metas.size());
     bool is_external_path = file_manager->IsExternalPath();
-    for (const auto& io_meta : global_index_io_metas) {
-        if (range.Count() != io_meta.range_end + 1) {
-            return Status::Invalid(
-                fmt::format("specified range length {} mismatch indexed range length {}",
-                            range.Count(), io_meta.range_end + 1));
+    for (const auto& [range, global_index_io_metas] : shard_io_metas) {
+        for (const auto& io_meta : global_index_io_metas) {
+            if (range.Count() != io_meta.range_end + 1) {
+                return Status::Invalid(
+                    fmt::format("specified range length {} mismatch indexed range length {}",
+                                range.Count(), io_meta.range_end + 1));
+            }
+            std::optional<std::string> external_path;
+            if (is_external_path) {
+                PAIMON_ASSIGN_OR_RAISE(Path path, PathUtil::ToPath(io_meta.file_path));
+                external_path = path.ToString();
+            }
+            index_file_metas.push_back(std::make_shared<IndexFileMeta>(
+                index_type, PathUtil::GetName(io_meta.file_path), io_meta.file_size,
+                io_meta.range_end + 1, /*dv_ranges=*/std::nullopt, external_path,
+                GlobalIndexMeta(range.from, io_meta.range_end + range.from, field_id,
+                                /*extra_field_ids=*/std::nullopt, io_meta.metadata)));
         }
-        std::optional<std::string> external_path;
-        if (is_external_path) {
-            PAIMON_ASSIGN_OR_RAISE(Path path, PathUtil::ToPath(io_meta.file_path));
-            external_path = path.ToString();
-        }
-        index_file_metas.push_back(std::make_shared<IndexFileMeta>(
-            index_type, PathUtil::GetName(io_meta.file_path), io_meta.file_size,
-            io_meta.range_end + 1, /*dv_ranges=*/std::nullopt, external_path,
-            GlobalIndexMeta(range.from, io_meta.range_end + range.from, field_id,
-                            /*extra_field_ids=*/std::nullopt, io_meta.metadata)));
     }
     DataIncrement data_increment(std::move(index_file_metas));
     return std::make_shared<CommitMessageImpl>(partition, bucket,
@@ -184,25 +294,50 @@ Result<std::shared_ptr<CommitMessage>> GlobalIndexWriteTask::WriteIndex(
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<GlobalIndexFileManager> index_file_manager,
         CreateGlobalIndexFileManager(table_path, table_schema, core_options, pool));
-
-    // create global index writer
     PAIMON_ASSIGN_OR_RAISE(DataField field, table_schema->GetField(field_name));
-    PAIMON_ASSIGN_OR_RAISE(
-        std::shared_ptr<GlobalIndexWriter> global_index_writer,
-        CreateGlobalIndexWriter(index_type, field, index_file_manager, core_options, pool));
 
-    // create batch reader
-    PAIMON_ASSIGN_OR_RAISE(
-        std::unique_ptr<BatchReader> batch_reader,
-        CreateBatchReader(table_path, field_name, indexed_split, core_options, pool));
+    // split the range into shards, each shard is read and indexed by its own reader and writer
+    std::vector<Range> shard_ranges =
+        SplitToShards(range, core_options.GetGlobalIndexBuildShardRows());
+    auto build_shard = [&](size_t shard) -> Result<std::vector<GlobalIndexIOMeta>> {
+        std::shared_ptr<IndexedSplit> shard_split = indexed_split;
+        if (shard_ranges.size() > 1) {
+            shard_split = std::make_shared<IndexedSplitImpl>(
+                data_split, std::vector<Range>({shard_ranges[shard]}));
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<GlobalIndexWriter> global_index_writer,
+            CreateGlobalIndexWriter(index_type, field, index_file_manager, core_options, pool));
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<BatchReader> batch_reader,
+            CreateBatchReader(table_path, field_name, shard_split, core_options, pool));
+        // read from data split and write to index writer
+        return BuildIndex(field_name, batch_reader.get(), global_index_writer.get());
+    };
+    std::vector<Result<std::vector<GlobalIndexIOMeta>>> shard_results =
+        BuildShards(shard_ranges.size(), core_options.GetGlobalIndexBuildParallelism(),
+                    core_options.GetGlobalIndexBuildMaxMemory(), pool, build_shard);
 
-    // read from data split and write to index writer
-    PAIMON_ASSIGN_OR_RAISE(std::vector<GlobalIndexIOMeta> global_index_io_metas,
-                           BuildIndex(field_name, batch_reader.get(), global_index_writer.get()));
+    for (const auto& shard_result : shard_results) {
+        if (!shard_result.ok()) {
+            DeleteShardFiles(core_options.GetFileSystem(), shard_results);
+            return shard_result.status();
+        }
+    }
 
-    // generate commit message
-    return ToCommitMessage(index_type, field.Id(), range, global_index_io_metas,
-                           data_split->Partition(), data_split->Bucket(), index_file_manager);
+    // generate one commit message for all shards
+    std::vector<std::pair<Range, std::vector<GlobalIndexIOMeta>>> shard_io_metas;
+    shard_io_metas.reserve(shard_ranges.size());
+    for (size_t i = 0; i < shard_ranges.size(); ++i) {
+        shard_io_metas.emplace_back(shard_ranges[i], shard_results[i].value());
+    }
+    Result<std::shared_ptr<CommitMessage>> commit_message =
+        ToCommitMessage(index_type, field.Id(), shard_io_metas, data_split->Partition(),
+                        data_split->Bucket(), index_file_manager);
+    if (!commit_message.ok()) {
+        DeleteShardFiles(core_options.GetFileSystem(), shard_results);
+    }
+    return commit_message;
 }
 
 }  // namespace paimon
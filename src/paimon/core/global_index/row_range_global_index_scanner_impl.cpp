@@ -16,7 +16,10 @@
 
 #include "paimon/core/global_index/row_range_global_index_scanner_impl.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -38,16 +41,30 @@ RowRangeGlobalIndexScannerImpl::RowRangeGlobalIndexScannerImpl(
       options_(options),
       grouped_entries_(grouped_entries),
       index_file_manager_(
-          std::make_shared<GlobalIndexFileManager>(options.GetFileSystem(), path_factory)) {}
+          std::make_shared<GlobalIndexFileManager>(options.GetFileSystem(), path_factory)) {
+    std::optional<int64_t> first_row_id;
+    for (const auto& [field_id, index_type_to_entries] : grouped_entries_) {
+        for (const auto& [index_type, entries] : index_type_to_entries) {
+            for (const auto& entry : entries) {
+                assert(entry.index_file->GetGlobalIndexMeta());
+                int64_t row_range_start = entry.index_file->GetGlobalIndexMeta()->row_range_start;
+                if (!first_row_id || row_range_start < first_row_id.value()) {
+                    first_row_id = row_range_start;
+                }
+            }
+        }
+    }
+    first_row_id_ = first_row_id.value_or(0);
+}
 
 Result<std::shared_ptr<GlobalIndexEvaluator>> RowRangeGlobalIndexScannerImpl::CreateIndexEvaluator()
     const {
-    GlobalIndexEvaluatorImpl::IndexReadersCreator create_index_readers =
+    GlobalIndexEvaluatorImpl::IndexShardsCreator create_index_shards =
         [scanner = shared_from_this()](
-            int32_t field_id) -> Result<std::vector<std::shared_ptr<GlobalIndexReader>>> {
-        return scanner->CreateReaders(field_id);
+            int32_t field_id) -> Result<std::vector<GlobalIndexEvaluatorImpl::IndexShard>> {
+        return scanner->CreateIndexShards(field_id);
     };
-    return std::make_shared<GlobalIndexEvaluatorImpl>(table_schema_, create_index_readers);
+    return std::make_shared<GlobalIndexEvaluatorImpl>(table_schema_, create_index_shards);
 }
 
 Result<std::shared_ptr<GlobalIndexReader>> RowRangeGlobalIndexScannerImpl::CreateReader(
@@ -97,6 +114,39 @@ RowRangeGlobalIndexScannerImpl::CreateReaders(const DataField& field) const {
     return readers;
 }
 
+Result<std::vector<GlobalIndexEvaluatorImpl::IndexShard>>
+RowRangeGlobalIndexScannerImpl::CreateIndexShards(int32_t field_id) const {
+    PAIMON_ASSIGN_OR_RAISE(DataField field, table_schema_->GetField(field_id));
+    std::vector<GlobalIndexEvaluatorImpl::IndexShard> shards;
+    auto field_iter = grouped_entries_.find(field.Id());
+    if (field_iter == grouped_entries_.end()) {
+        return shards;
+    }
+    for (const auto& [index_type, entries] : field_iter->second) {
+        // row range start -> entries
+        std::map<int64_t, std::vector<IndexManifestEntry>> shard_to_entries;
+        for (const auto& entry : entries) {
+            assert(entry.index_file->GetGlobalIndexMeta());
+            shard_to_entries[entry.index_file->GetGlobalIndexMeta()->row_range_start].push_back(
+                entry);
+        }
+        for (const auto& [row_range_start, shard_entries] : shard_to_entries) {
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexReader> reader,
+                                   CreateReader(field, index_type, shard_entries));
+            if (reader) {
+                int64_t row_range_end = row_range_start;
+                for (const auto& entry : shard_entries) {
+                    row_range_end = std::max(row_range_end,
+                                             entry.index_file->GetGlobalIndexMeta()->row_range_end);
+                }
+                shards.push_back({index_type, row_range_start - first_row_id_,
+                                  row_range_end - row_range_start + 1, std::move(reader)});
+            }
+        }
+    }
+    return shards;
+}
+
 Result<std::shared_ptr<GlobalIndexReader>> RowRangeGlobalIndexScannerImpl::CreateReader(
     const DataField& field, const std::string& index_type,
     const std::vector<IndexManifestEntry>& entries) const {
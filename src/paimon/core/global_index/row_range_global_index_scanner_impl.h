@@ -23,6 +23,7 @@
 
 #include "paimon/core/core_options.h"
 #include "paimon/core/global_index/global_index_evaluator.h"
+#include "paimon/core/global_index/global_index_evaluator_impl.h"
 #include "paimon/core/global_index/global_index_file_manager.h"
 #include "paimon/core/manifest/index_manifest_entry.h"
 #include "paimon/core/schema/table_schema.h"
@@ -56,6 +57,11 @@ class RowRangeGlobalIndexScannerImpl
     Result<std::vector<std::shared_ptr<GlobalIndexReader>>> CreateReaders(
         const DataField& field) const;
 
+    /// Creates one reader per index shard of the field, entries of the same index type are split
+    /// into shards by the start of their row range.
+    Result<std::vector<GlobalIndexEvaluatorImpl::IndexShard>> CreateIndexShards(
+        int32_t field_id) const;
+
     Result<std::shared_ptr<GlobalIndexReader>> CreateReader(
         const DataField& field, const std::string& index_type,
         const std::vector<IndexManifestEntry>& entries) const;
@@ -71,6 +77,8 @@ class RowRangeGlobalIndexScannerImpl
     CoreOptions options_;
     IndexManifestEntryGroup grouped_entries_;
     std::shared_ptr<GlobalIndexFileManager> index_file_manager_;
+    // the first indexed row id, local row ids of this scanner start from it
+    int64_t first_row_id_ = 0;
 };
 
 }  // namespace paimon
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/global_index/vector_search_top_k_merger.h"
+
+#include <algorithm>
+#include <map>
+
+#include "fmt/format.h"
+
+namespace paimon {
+VectorSearchTopKMerger::VectorSearchTopKMerger(int32_t limit,
+                                               VectorSearch::DistanceType distance_type)
+    : limit_(static_cast<size_t>(std::max(limit, 0))),
+      comparator_(distance_type),
+      heap_(comparator_) {}
+
+bool VectorSearchTopKMerger::IsCloser(VectorSearch::DistanceType distance_type, float lhs,
+                                      float rhs) {
+    if (distance_type == VectorSearch::DistanceType::INNER_PRODUCT) {
+        return lhs > rhs;
+    }
+    return lhs < rhs;
+}
+
+Status VectorSearchTopKMerger::Add(const std::shared_ptr<GlobalIndexResult>& result) {
+    auto vector_search_result = std::dynamic_pointer_cast<VectorSearchGlobalIndexResult>(result);
+    if (!vector_search_result) {
+        return Status::Invalid(fmt::format("cannot merge non vector search result {} into top-k",
+                                           result ? result->ToString() : "null"));
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<VectorSearchGlobalIndexResult::VectorSearchIterator> iter,
+        vector_search_result->CreateVectorSearchIterator());
+    while (iter->HasNext()) {
+        auto [row_id, score] = iter->NextWithScore();
+        Candidate candidate(score, row_id);
+        if (heap_.size() < limit_) {
+            heap_.push(candidate);
+        } else if (limit_ > 0 && comparator_(candidate, heap_.top())) {
+            heap_.pop();
+            heap_.push(candidate);
+        }
+    }
+    return Status::OK();
+}
+
+std::shared_ptr<BitmapVectorSearchGlobalIndexResult> VectorSearchTopKMerger::GetResult() const {
+    std::map<int64_t, float> id_to_score;
+    auto heap = heap_;
+    while (!heap.empty()) {
+        id_to_score[heap.top().second] = heap.top().first;
+        heap.pop();
+    }
+    RoaringBitmap64 bitmap;
+    std::vector<float> scores;
+    scores.reserve(id_to_score.size());
+    for (const auto& [id, score] : id_to_score) {
+        bitmap.Add(id);
+        scores.push_back(score);
+    }
+    return std::make_shared<BitmapVectorSearchGlobalIndexResult>(std::move(bitmap),
+                                                                 std::move(scores));
+}
+}  // namespace paimon
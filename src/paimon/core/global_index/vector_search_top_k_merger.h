@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "paimon/global_index/bitmap_vector_search_global_index_result.h"
+#include "paimon/predicate/vector_search.h"
+#include "paimon/status.h"
+
+namespace paimon {
+/// Merges vector search results of disjoint index shards into the global top-k. Only the best
+/// `limit` rows seen so far are kept in a bounded heap, ordered by `DistanceType`: smaller scores
+/// are better for EUCLIDEAN and COSINE distances, larger scores are better for INNER_PRODUCT.
+/// Ties are broken by the smaller row id so the merged result is deterministic.
+class VectorSearchTopKMerger {
+ public:
+    VectorSearchTopKMerger(int32_t limit, VectorSearch::DistanceType distance_type);
+
+    /// Adds candidates of one shard, `result` must be a `VectorSearchGlobalIndexResult` whose row
+    /// ids do not overlap with previously added results.
+    Status Add(const std::shared_ptr<GlobalIndexResult>& result);
+
+    /// @return The merged top-k rows, ordered by ascending row id.
+    std::shared_ptr<BitmapVectorSearchGlobalIndexResult> GetResult() const;
+
+    /// @return True if `lhs` score is strictly closer to the query than `rhs` score.
+    static bool IsCloser(VectorSearch::DistanceType distance_type, float lhs, float rhs);
+
+ private:
+    // (score, row id)
+    using Candidate = std::pair<float, int64_t>;
+
+    class CandidateComparator {
+     public:
+        explicit CandidateComparator(VectorSearch::DistanceType distance_type)
+            : distance_type_(distance_type) {}
+
+        // return true if lhs is better than rhs, so that the worst candidate is on the top of
+        // priority queue
+        bool operator()(const Candidate& lhs, const Candidate& rhs) const {
+            if (IsCloser(distance_type_, lhs.first, rhs.first)) {
+                return true;
+            }
+            if (IsCloser(distance_type_, rhs.first, lhs.first)) {
+                return false;
+            }
+            return lhs.second < rhs.second;
+        }
+
+     private:
+        VectorSearch::DistanceType distance_type_;
+    };
+
+    size_t limit_;
+    CandidateComparator comparator_;
+    std::priority_queue<Candidate, std::vector<Candidate>, CandidateComparator> heap_;
+};
+}  // namespace paimon
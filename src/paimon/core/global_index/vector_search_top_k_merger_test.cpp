@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/global_index/vector_search_top_k_merger.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/global_index/bitmap_global_index_result.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+namespace {
+std::shared_ptr<GlobalIndexResult> CreateResult(const std::vector<int64_t>& ids,
+                                                std::vector<float> scores) {
+    return std::make_shared<BitmapVectorSearchGlobalIndexResult>(RoaringBitmap64::From(ids),
+                                                                 std::move(scores));
+}
+
+void CheckResult(const std::shared_ptr<BitmapVectorSearchGlobalIndexResult>& result,
+                 const std::vector<int64_t>& expected_ids,
+                 const std::vector<float>& expected_scores) {
+    ASSERT_OK_AND_ASSIGN(const RoaringBitmap64* bitmap, result->GetBitmap());
+    ASSERT_EQ(*bitmap, RoaringBitmap64::From(expected_ids));
+    ASSERT_EQ(result->GetScores(), expected_scores);
+}
+}  // namespace
+
+TEST(VectorSearchTopKMergerTest, TestMergeDistance) {
+    VectorSearchTopKMerger merger(/*limit=*/3, VectorSearch::DistanceType::EUCLIDEAN);
+    ASSERT_OK(merger.Add(CreateResult({0, 2, 5}, {4.0f, 1.0f, 3.0f})));
+    ASSERT_OK(merger.Add(CreateResult({10, 12}, {0.5f, 6.0f})));
+    ASSERT_OK(merger.Add(CreateResult({}, {})));
+    ASSERT_OK(merger.Add(CreateResult({20, 21, 22}, {2.0f, 7.0f, 3.5f})));
+    CheckResult(merger.GetResult(), {2, 10, 20}, {1.0f, 0.5f, 2.0f});
+}
+
+TEST(VectorSearchTopKMergerTest, TestMergeInnerProduct) {
+    VectorSearchTopKMerger merger(/*limit=*/2, VectorSearch::DistanceType::INNER_PRODUCT);
+    ASSERT_OK(merger.Add(CreateResult({0, 2, 5}, {4.0f, 1.0f, 3.0f})));
+    ASSERT_OK(merger.Add(CreateResult({10, 12}, {0.5f, 6.0f})));
+    CheckResult(merger.GetResult(), {0, 12}, {4.0f, 6.0f});
+}
+
+TEST(VectorSearchTopKMergerTest, TestTieBreakByRowId) {
+    VectorSearchTopKMerger merger(/*limit=*/2, VectorSearch::DistanceType::COSINE);
+    ASSERT_OK(merger.Add(CreateResult({30, 31}, {1.0f, 1.0f})));
+    ASSERT_OK(merger.Add(CreateResult({3, 40}, {1.0f, 2.0f})));
+    CheckResult(merger.GetResult(), {3, 30}, {1.0f, 1.0f});
+}
+
+TEST(VectorSearchTopKMergerTest, TestLessCandidatesThanLimit) {
+    VectorSearchTopKMerger merger(/*limit=*/10, VectorSearch::DistanceType::EUCLIDEAN);
+    ASSERT_OK(merger.Add(CreateResult({7, 8}, {1.5f, 0.5f})));
+    CheckResult(merger.GetResult(), {7, 8}, {1.5f, 0.5f});
+
+    VectorSearchTopKMerger empty_merger(/*limit=*/0, VectorSearch::DistanceType::EUCLIDEAN);
+    ASSERT_OK(empty_merger.Add(CreateResult({7, 8}, {1.5f, 0.5f})));
+    CheckResult(empty_merger.GetResult(), {}, {});
+}
+
+TEST(VectorSearchTopKMergerTest, TestInvalidResult) {
+    VectorSearchTopKMerger merger(/*limit=*/3, VectorSearch::DistanceType::EUCLIDEAN);
+    ASSERT_NOK_WITH_MSG(merger.Add(BitmapGlobalIndexResult::FromRanges({Range(0, 3)})),
+                        "cannot merge non vector search result");
+}
+}  // namespace paimon::test
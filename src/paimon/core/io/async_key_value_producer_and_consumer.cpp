@@ -18,11 +18,13 @@
 
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <type_traits>
 
 #include "arrow/c/abi.h"
 #include "arrow/c/helpers.h"
+#include "fmt/format.h"
 #include "paimon/common/reader/reader_utils.h"
 #include "paimon/reader/batch_reader.h"
 
@@ -39,7 +41,8 @@ AsyncKeyValueProducerAndConsumer<T, R>::AsyncKeyValueProducerAndConsumer(
       pool_(pool),
       sort_merge_reader_(std::move(sort_merge_reader)),
       create_consumer_(create_consumer) {
-    kv_queue_.set_capacity(batch_size);
+    chunk_size_ = std::max(batch_size_ / std::max(consumer_thread_num_, 1), 1);
+    chunk_queue_.set_capacity(std::max(consumer_thread_num_, 1) * CHUNK_COUNT_PER_CONSUMER);
     result_queue_.set_capacity(RESULT_BATCH_COUNT);
 }
 
@@ -80,8 +83,8 @@ Result<R> AsyncKeyValueProducerAndConsumer<T, R>::NextBatch() {
             Result<std::unique_ptr<RowToArrowArrayConverter<T, R>>> consumer = create_consumer_();
             PAIMON_RETURN_NOT_OK(consumer.status());
             auto async_consumer = std::make_unique<AsyncKeyValueConsumer<T, R>>(
-                batch_size_ / consumer_thread_num_, std::move(consumer).value(), consume_finished_,
-                consumer_finished_count_, kv_queue_, result_queue_);
+                std::move(consumer).value(), consume_finished_, consumer_finished_count_,
+                chunk_queue_, result_queue_);
             consumers_.push_back(std::move(async_consumer));
         }
     }
@@ -92,28 +95,50 @@ Result<R> AsyncKeyValueProducerAndConsumer<T, R>::NextBatch() {
         return R();
     }
 
-    R result;
-    while (!result_queue_.try_pop(result)) {
+    while (true) {
+        // consumers may finish chunks out of order, return results in chunk sequence
+        auto iter = pending_results_.begin();
+        if (iter != pending_results_.end() && iter->first == next_result_sequence_) {
+            R result = std::move(iter->second);
+            pending_results_.erase(iter);
+            next_result_sequence_++;
+            return result;
+        }
+        std::pair<int64_t, R> sequenced_result;
+        if (result_queue_.try_pop(sequenced_result)) {
+            pending_results_.emplace(std::move(sequenced_result));
+            continue;
+        }
         PAIMON_RETURN_NOT_OK(CheckStatusAndCleanUp());
         if (consumer_finished_count_ == consumer_thread_num_ && result_queue_.empty()) {
             // all consume thread finished
+            if (!pending_results_.empty()) {
+                CleanUp();
+                return Status::Invalid(fmt::format(
+                    "async key value consumer lost result of chunk {}", next_result_sequence_));
+            }
             next_batch_finished_ = true;
             return R();
         }
         usleep(1000);
     }
-
-    return result;
 }
 
 template <typename T, typename R>
 Status AsyncKeyValueProducerAndConsumer<T, R>::ProduceLoop() {
+    int64_t sequence = 0;
+    KeyValueChunk chunk;
+    chunk.key_values.reserve(chunk_size_);
     while (!consume_finished_) {
         PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SortMergeReader::Iterator> iterator,
                                sort_merge_reader_->NextBatch());
         if (iterator == nullptr) {
             // all iterator is all visited
-            kv_queue_.push(std::nullopt);
+            if (!chunk.key_values.empty()) {
+                chunk.sequence = sequence++;
+                chunk_queue_.push(std::move(chunk));
+            }
+            chunk_queue_.push(std::nullopt);
             break;
         }
         while (!consume_finished_) {
@@ -122,8 +147,13 @@ Status AsyncKeyValueProducerAndConsumer<T, R>::ProduceLoop() {
                 // current iterator is all visited
                 break;
             }
-            std::optional<KeyValue> kv = std::move(iterator->Next());
-            kv_queue_.push(std::move(kv));
+            chunk.key_values.push_back(iterator->Next());
+            if (chunk.key_values.size() >= chunk_size_) {
+                chunk.sequence = sequence++;
+                chunk_queue_.push(std::move(chunk));
+                chunk = KeyValueChunk();
+                chunk.key_values.reserve(chunk_size_);
+            }
         }
     }
     return Status::OK();
@@ -145,8 +175,7 @@ void AsyncKeyValueProducerAndConsumer<T, R>::CleanUp() {
 
 template <typename T, typename R>
 void AsyncKeyValueProducerAndConsumer<T, R>::CleanUpQueue() {
-    R read_batch;
-    while (result_queue_.try_pop(read_batch)) {
+    auto release = [](R&& read_batch) {
         if constexpr (std::is_same_v<R, BatchReader::ReadBatch>) {
             if (!BatchReader::IsEofBatch(read_batch)) {
                 ReaderUtils::ReleaseReadBatch(std::move(read_batch));
@@ -156,10 +185,18 @@ void AsyncKeyValueProducerAndConsumer<T, R>::CleanUpQueue() {
                 ArrowArrayRelease(read_batch.batch.get());
             }
         }
+    };
+    std::pair<int64_t, R> sequenced_result;
+    while (result_queue_.try_pop(sequenced_result)) {
+        release(std::move(sequenced_result.second));
     }
+    for (auto& [sequence, read_batch] : pending_results_) {
+        release(std::move(read_batch));
+    }
+    pending_results_.clear();
 
-    std::optional<KeyValue> kv;
-    while (kv_queue_.try_pop(kv)) {
+    std::optional<KeyValueChunk> chunk;
+    while (chunk_queue_.try_pop(chunk)) {
     }
 }
 
@@ -168,15 +205,14 @@ template class AsyncKeyValueProducerAndConsumer<KeyValue, KeyValueBatch>;
 
 template <typename T, typename R>
 AsyncKeyValueConsumer<T, R>::AsyncKeyValueConsumer(
-    int32_t batch_size, std::unique_ptr<RowToArrowArrayConverter<T, R>>&& key_value_consumer,
+    std::unique_ptr<RowToArrowArrayConverter<T, R>>&& key_value_consumer,
     std::atomic<bool>& consume_finished, std::atomic<int32_t>& consumer_finished_count,
-    tbb::concurrent_bounded_queue<std::optional<KeyValue>>& kv_queue,
-    tbb::concurrent_bounded_queue<R>& result_queue)
-    : batch_size_(batch_size),
-      key_value_consumer_(std::move(key_value_consumer)),
+    tbb::concurrent_bounded_queue<std::optional<KeyValueChunk>>& chunk_queue,
+    tbb::concurrent_bounded_queue<std::pair<int64_t, R>>& result_queue)
+    : key_value_consumer_(std::move(key_value_consumer)),
       consume_finished_(consume_finished),
       consumer_finished_count_(consumer_finished_count),
-      kv_queue_(kv_queue),
+      chunk_queue_(chunk_queue),
       result_queue_(result_queue) {
     consumer_future_ =
         std::async(std::launch::async, &AsyncKeyValueConsumer<T, R>::ConsumeLoop, this).share();
@@ -196,30 +232,18 @@ Status AsyncKeyValueConsumer<T, R>::GetStatus() const {
 template <typename T, typename R>
 Status AsyncKeyValueConsumer<T, R>::ConsumeLoop() {
     while (!consume_finished_) {
-        int32_t cur_batch_size = 0;
-        std::vector<KeyValue> key_value_vec;
-        key_value_vec.reserve(batch_size_);
-        while (!consume_finished_) {
-            std::optional<KeyValue> kv;
-            if (!kv_queue_.try_pop(kv)) {
-                usleep(1);
-                continue;
-            }
-            if (!kv) {
-                consume_finished_ = true;
-                break;
-            }
-            key_value_vec.push_back(std::move(kv).value());
-            cur_batch_size++;
-            if (cur_batch_size >= batch_size_) {
-                break;
-            }
+        std::optional<KeyValueChunk> chunk;
+        if (!chunk_queue_.try_pop(chunk)) {
+            usleep(1);
+            continue;
         }
-
-        if (cur_batch_size > 0) {
-            PAIMON_ASSIGN_OR_RAISE(R result, key_value_consumer_->NextBatch(key_value_vec));
-            result_queue_.push(std::move(result));
+        if (!chunk) {
+            // all chunks before the end marker have been taken by consumers
+            consume_finished_ = true;
+            break;
         }
+        PAIMON_ASSIGN_OR_RAISE(R result, key_value_consumer_->NextBatch(chunk->key_values));
+        result_queue_.push(std::make_pair(chunk->sequence, std::move(result)));
     }
     consumer_finished_count_++;
     return Status::OK();
@@ -20,7 +20,9 @@
 #include <cstdint>
 #include <functional>
 #include <future>
+#include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -38,8 +40,17 @@ class AsyncKeyValueConsumer;
 class MemoryPool;
 class Metrics;
 
+// Consecutive merged KeyValues handed from producer to consumer as a whole, `sequence` is the
+// position of chunk in producer output, which is used to restore the order of converted batches.
+struct KeyValueChunk {
+    int64_t sequence = 0;
+    std::vector<KeyValue> key_values;
+};
+
 // Asynchronous iterate SortMergeReader (producer) and row-to-array conversion (consumer), support
-// multi-threaded conversion, R can be BatchReader::ReadBatch, KeyValueBatch
+// multi-threaded conversion, R can be BatchReader::ReadBatch, KeyValueBatch. The producer hands
+// KeyValues to consumers in chunks of one result batch, so that queue operations are per batch
+// rather than per row, and the result batches are returned in producer order.
 template <typename T, typename R>
 class AsyncKeyValueProducerAndConsumer {
  public:
@@ -66,6 +77,8 @@ class AsyncKeyValueProducerAndConsumer {
 
  private:
     static constexpr int32_t RESULT_BATCH_COUNT = 3;
+    // chunks queued per consumer, so that consumers do not wait for producer between chunks
+    static constexpr int32_t CHUNK_COUNT_PER_CONSUMER = 2;
     void CleanUpQueue();
     Status ProduceLoop();
     void CleanUp();
@@ -75,30 +88,34 @@ class AsyncKeyValueProducerAndConsumer {
  private:
     int32_t batch_size_;
     int32_t consumer_thread_num_;
+    // number of KeyValues in a chunk, also the row count of a result batch
+    size_t chunk_size_;
     std::shared_ptr<MemoryPool> pool_;
     std::unique_ptr<SortMergeReader> sort_merge_reader_;
     std::function<Result<std::unique_ptr<RowToArrowArrayConverter<T, R>>>()> create_consumer_;
 
-    // produce: merge sort KeyValue and push result KeyValue to kv_queue_, consume: project KeyValue
-    // to arrow array and push result array to result_queue_
+    // produce: merge sort KeyValue and push chunks of result KeyValue to chunk_queue_, consume:
+    // project a chunk to arrow array and push result array with chunk sequence to result_queue_
     std::atomic<bool> consume_finished_ = false;
     std::atomic<bool> next_batch_finished_ = false;
     std::shared_future<Status> producer_future_;
     std::vector<std::unique_ptr<AsyncKeyValueConsumer<T, R>>> consumers_;
     std::atomic<int32_t> consumer_finished_count_ = 0;
-    tbb::concurrent_bounded_queue<std::optional<KeyValue>> kv_queue_;
-    tbb::concurrent_bounded_queue<R> result_queue_;
+    tbb::concurrent_bounded_queue<std::optional<KeyValueChunk>> chunk_queue_;
+    tbb::concurrent_bounded_queue<std::pair<int64_t, R>> result_queue_;
+    // results popped ahead of their turn, keyed by chunk sequence
+    std::map<int64_t, R> pending_results_;
+    int64_t next_result_sequence_ = 0;
 };
 
 template <typename T, typename R>
 class AsyncKeyValueConsumer {
  public:
-    AsyncKeyValueConsumer(int32_t batch_size,
-                          std::unique_ptr<RowToArrowArrayConverter<T, R>>&& key_value_consumer,
+    AsyncKeyValueConsumer(std::unique_ptr<RowToArrowArrayConverter<T, R>>&& key_value_consumer,
                           std::atomic<bool>& consume_finished,
                           std::atomic<int32_t>& consumer_finished_count,
-                          tbb::concurrent_bounded_queue<std::optional<KeyValue>>& kv_queue,
-                          tbb::concurrent_bounded_queue<R>& result_queue);
+                          tbb::concurrent_bounded_queue<std::optional<KeyValueChunk>>& chunk_queue,
+                          tbb::concurrent_bounded_queue<std::pair<int64_t, R>>& result_queue);
 
     ~AsyncKeyValueConsumer() {
         CleanUp();
@@ -111,13 +128,12 @@ class AsyncKeyValueConsumer {
     Status ConsumeLoop();
 
  private:
-    int32_t batch_size_;
     std::unique_ptr<RowToArrowArrayConverter<T, R>> key_value_consumer_;
     std::shared_future<Status> consumer_future_;
     std::atomic<bool>& consume_finished_;
     std::atomic<int32_t>& consumer_finished_count_;
-    tbb::concurrent_bounded_queue<std::optional<KeyValue>>& kv_queue_;
-    tbb::concurrent_bounded_queue<R>& result_queue_;
+    tbb::concurrent_bounded_queue<std::optional<KeyValueChunk>>& chunk_queue_;
+    tbb::concurrent_bounded_queue<std::pair<int64_t, R>>& result_queue_;
 };
 
 }  // namespace paimon
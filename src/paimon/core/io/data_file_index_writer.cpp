@@ -0,0 +1,121 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/data_file_index_writer.h"
+
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/file_index/file_index_format.h"
+#include "paimon/file_index/file_index_writer.h"
+#include "paimon/file_index/file_indexer.h"
+#include "paimon/file_index/file_indexer_factory.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/memory/bytes.h"
+
+namespace paimon {
+class MemoryPool;
+
+Result<std::unique_ptr<DataFileIndexWriter>> DataFileIndexWriter::Create(
+    const std::shared_ptr<arrow::Schema>& schema, const IndexColumns& index_columns,
+    int64_t in_manifest_threshold, const std::shared_ptr<MemoryPool>& pool) {
+    std::vector<IndexWriter> index_writers;
+    for (const auto& [column_name, index_types] : index_columns) {
+        int32_t field_index = schema->GetFieldIndex(column_name);
+        if (field_index < 0) {
+            return Status::Invalid(
+                fmt::format("cannot find index column {} in write schema", column_name));
+        }
+        const auto& field = schema->field(field_index);
+        for (const auto& [index_type, options] : index_types) {
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileIndexer> file_indexer,
+                                   FileIndexerFactory::Get(index_type, options));
+            if (!file_indexer) {
+                return Status::Invalid(fmt::format("unknown file index type {} of column {}",
+                                                   index_type, column_name));
+            }
+            ::ArrowSchema c_schema;
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(
+                arrow::ExportSchema(*arrow::schema({field}), &c_schema));
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileIndexWriter> writer,
+                                   file_indexer->CreateWriter(&c_schema, pool));
+            index_writers.push_back(
+                {field_index, column_name, index_type, arrow::struct_({field}), writer});
+        }
+    }
+    if (index_writers.empty()) {
+        return std::unique_ptr<DataFileIndexWriter>();
+    }
+    return std::unique_ptr<DataFileIndexWriter>(new DataFileIndexWriter(
+        arrow::struct_(schema->fields()), std::move(index_writers), in_manifest_threshold, pool));
+}
+
+DataFileIndexWriter::DataFileIndexWriter(const std::shared_ptr<arrow::DataType>& write_type,
+                                         std::vector<IndexWriter>&& index_writers,
+                                         int64_t in_manifest_threshold,
+                                         const std::shared_ptr<MemoryPool>& pool)
+    : write_type_(write_type),
+      index_writers_(std::move(index_writers)),
+      in_manifest_threshold_(in_manifest_threshold),
+      pool_(pool) {}
+
+Status DataFileIndexWriter::Write(::ArrowArray* batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                      arrow::ImportArray(batch, write_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(array);
+    if (!struct_array) {
+        return Status::Invalid(
+            "invalid batch for DataFileIndexWriter, supposed to be struct array");
+    }
+    for (auto& index_writer : index_writers_) {
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+            std::shared_ptr<arrow::StructArray> column_array,
+            arrow::StructArray::Make({struct_array->field(index_writer.field_index)},
+                                     index_writer.struct_type->fields()));
+        ::ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*column_array, &c_array));
+        PAIMON_RETURN_NOT_OK(index_writer.writer->AddBatch(&c_array));
+    }
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, batch));
+    return Status::OK();
+}
+
+Result<DataFileIndexWriter::IndexResult> DataFileIndexWriter::Finish(
+    const std::shared_ptr<FileSystem>& fs, const std::string& index_path) const {
+    std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>> indexes;
+    for (const auto& index_writer : index_writers_) {
+        PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> bytes,
+                               index_writer.writer->SerializedBytes());
+        indexes[index_writer.column_name][index_writer.index_type] = std::move(bytes);
+    }
+    PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> index_bytes,
+                           FileIndexFormat::Write(indexes, pool_));
+    IndexResult result;
+    if (static_cast<int64_t>(index_bytes->size()) > in_manifest_threshold_) {
+        std::string content(index_bytes->data(), index_bytes->size());
+        PAIMON_RETURN_NOT_OK(fs->WriteFile(index_path, content, /*overwrite=*/false));
+        result.index_file_name = PathUtil::GetName(index_path);
+    } else {
+        result.embedded_index = std::move(index_bytes);
+    }
+    return result;
+}
+
+}  // namespace paimon
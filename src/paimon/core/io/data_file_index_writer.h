@@ -0,0 +1,87 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/c/abi.h"
+#include "arrow/type_fwd.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class Bytes;
+class FileIndexWriter;
+class FileSystem;
+class MemoryPool;
+
+/// Builds the file indexes configured by `file-index.<type>.columns` while a data file is being
+/// written. Small indexes are embedded in the data file meta, large ones are written to a
+/// separate index file next to the data file.
+class DataFileIndexWriter {
+ public:
+    /// column name -> index type -> index options
+    using IndexColumns =
+        std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>;
+
+    struct IndexResult {
+        /// Index bytes embedded in the data file meta.
+        std::shared_ptr<Bytes> embedded_index;
+        /// Name of the separate index file.
+        std::optional<std::string> index_file_name;
+    };
+
+    /// @return nullptr if no index is configured.
+    static Result<std::unique_ptr<DataFileIndexWriter>> Create(
+        const std::shared_ptr<arrow::Schema>& schema, const IndexColumns& index_columns,
+        int64_t in_manifest_threshold, const std::shared_ptr<MemoryPool>& pool);
+
+    /// Adds a batch to all indexes, `batch` is imported and exported again so it is still valid
+    /// for the format writer afterwards.
+    Status Write(::ArrowArray* batch);
+
+    /// Serializes all indexes, writes them to `index_path` if larger than the in-manifest
+    /// threshold.
+    Result<IndexResult> Finish(const std::shared_ptr<FileSystem>& fs,
+                               const std::string& index_path) const;
+
+ private:
+    struct IndexWriter {
+        int32_t field_index;
+        std::string column_name;
+        std::string index_type;
+        std::shared_ptr<arrow::DataType> struct_type;
+        std::shared_ptr<FileIndexWriter> writer;
+    };
+
+    DataFileIndexWriter(const std::shared_ptr<arrow::DataType>& write_type,
+                        std::vector<IndexWriter>&& index_writers, int64_t in_manifest_threshold,
+                        const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::shared_ptr<arrow::DataType> write_type_;
+    std::vector<IndexWriter> index_writers_;
+    int64_t in_manifest_threshold_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+}  // namespace paimon
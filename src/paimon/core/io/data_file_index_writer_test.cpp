@@ -0,0 +1,149 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/data_file_index_writer.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/file_index/file_index_format.h"
+#include "paimon/file_index/file_index_result.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class DataFileIndexWriterTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        schema_ = arrow::schema({arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32()),
+                                 arrow::field("f2", arrow::float64())});
+        index_columns_ = {{"f0", {{"bitmap", {}}}},
+                          {"f1", {{"bloom-filter", {{"items", "100"}}}, {"bsi", {}}}}};
+    }
+
+    void WriteData(DataFileIndexWriter* index_writer) const {
+        auto array = arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(schema_->fields()),
+                                                               R"([
+        ["a", 1, 0.1],
+        ["b", 2, 0.2],
+        [null, null, 0.3],
+        ["a", 10, 0.4]
+    ])")
+                         .ValueOrDie();
+        ::ArrowArray c_array;
+        ASSERT_TRUE(arrow::ExportArray(*array, &c_array).ok());
+        ASSERT_OK(index_writer->Write(&c_array));
+        // the batch is still valid after written to index
+        auto imported = arrow::ImportArray(&c_array, arrow::struct_(schema_->fields()));
+        ASSERT_TRUE(imported.ok());
+        ASSERT_TRUE(imported.ValueOrDie()->Equals(array));
+    }
+
+    void CheckIndex(const std::shared_ptr<InputStream>& input_stream) const {
+        ASSERT_OK_AND_ASSIGN(auto reader, FileIndexFormat::CreateReader(input_stream, pool_));
+        ::ArrowSchema c_schema;
+        ASSERT_TRUE(arrow::ExportSchema(*schema_, &c_schema).ok());
+        ASSERT_OK_AND_ASSIGN(auto f0_readers, reader->ReadColumnIndex("f0", &c_schema));
+        ASSERT_EQ(1, f0_readers.size());
+        ASSERT_OK_AND_ASSIGN(auto result,
+                             f0_readers[0]->VisitEqual(Literal(FieldType::STRING, "a", 1)));
+        ASSERT_EQ("{0,3}", result->ToString());
+
+        ASSERT_TRUE(arrow::ExportSchema(*schema_, &c_schema).ok());
+        ASSERT_OK_AND_ASSIGN(auto f1_readers, reader->ReadColumnIndex("f1", &c_schema));
+        ASSERT_EQ(2, f1_readers.size());
+        for (const auto& f1_reader : f1_readers) {
+            ASSERT_OK_AND_ASSIGN(auto remain_result, f1_reader->VisitEqual(Literal(10)));
+            ASSERT_TRUE(remain_result->IsRemain().value());
+        }
+
+        ASSERT_TRUE(arrow::ExportSchema(*schema_, &c_schema).ok());
+        ASSERT_OK_AND_ASSIGN(auto f2_readers, reader->ReadColumnIndex("f2", &c_schema));
+        ASSERT_TRUE(f2_readers.empty());
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<arrow::Schema> schema_;
+    DataFileIndexWriter::IndexColumns index_columns_;
+};
+
+TEST_F(DataFileIndexWriterTest, TestNoIndex) {
+    ASSERT_OK_AND_ASSIGN(auto index_writer, DataFileIndexWriter::Create(
+                                                schema_, /*index_columns=*/{},
+                                                /*in_manifest_threshold=*/500, pool_));
+    ASSERT_FALSE(index_writer);
+}
+
+TEST_F(DataFileIndexWriterTest, TestEmbeddedIndex) {
+    ASSERT_OK_AND_ASSIGN(auto index_writer,
+                         DataFileIndexWriter::Create(schema_, index_columns_,
+                                                     /*in_manifest_threshold=*/1024 * 1024, pool_));
+    ASSERT_TRUE(index_writer);
+    WriteData(index_writer.get());
+    auto dir = UniqueTestDirectory::Create();
+    std::string index_path = dir->Str() + "/data-0.orc.index";
+    ASSERT_OK_AND_ASSIGN(DataFileIndexWriter::IndexResult result,
+                         index_writer->Finish(dir->GetFileSystem(), index_path));
+    ASSERT_FALSE(result.index_file_name);
+    ASSERT_TRUE(result.embedded_index);
+    ASSERT_OK_AND_ASSIGN(bool exist, dir->GetFileSystem()->Exists(index_path));
+    ASSERT_FALSE(exist);
+    CheckIndex(std::make_shared<ByteArrayInputStream>(result.embedded_index->data(),
+                                                      result.embedded_index->size()));
+}
+
+TEST_F(DataFileIndexWriterTest, TestIndexFile) {
+    ASSERT_OK_AND_ASSIGN(auto index_writer,
+                         DataFileIndexWriter::Create(schema_, index_columns_,
+                                                     /*in_manifest_threshold=*/0, pool_));
+    ASSERT_TRUE(index_writer);
+    WriteData(index_writer.get());
+    auto dir = UniqueTestDirectory::Create();
+    std::string index_path = dir->Str() + "/data-0.orc.index";
+    ASSERT_OK_AND_ASSIGN(DataFileIndexWriter::IndexResult result,
+                         index_writer->Finish(dir->GetFileSystem(), index_path));
+    ASSERT_EQ("data-0.orc.index", result.index_file_name.value());
+    ASSERT_FALSE(result.embedded_index);
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<InputStream> input_stream,
+                         dir->GetFileSystem()->Open(index_path));
+    CheckIndex(input_stream);
+}
+
+TEST_F(DataFileIndexWriterTest, TestInvalidIndex) {
+    ASSERT_NOK_WITH_MSG(DataFileIndexWriter::Create(schema_, {{"f3", {{"bitmap", {}}}}},
+                                                    /*in_manifest_threshold=*/500, pool_),
+                        "cannot find index column f3 in write schema");
+    ASSERT_NOK_WITH_MSG(DataFileIndexWriter::Create(schema_, {{"f0", {{"unknown", {}}}}},
+                                                    /*in_manifest_threshold=*/500, pool_),
+                        "unknown file index type unknown of column f0");
+    ASSERT_NOK_WITH_MSG(DataFileIndexWriter::Create(schema_, {{"f0", {{"bsi", {}}}}},
+                                                    /*in_manifest_threshold=*/500, pool_),
+                        "BitSliceIndexBitmapFileIndex only support");
+}
+
+}  // namespace paimon::test
@@ -17,6 +17,7 @@
 #include "paimon/core/io/data_file_meta.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <utility>
 
@@ -211,6 +212,13 @@ bool DataFileMeta::TEST_Equal(const DataFileMeta& other) const {
            first_row_id == other.first_row_id && write_cols == other.write_cols;
 }
 
+std::shared_ptr<DataFileMeta> DataFileMeta::Upgrade(int32_t new_level) const {
+    assert(new_level > level);
+    auto upgraded = std::make_shared<DataFileMeta>(*this);
+    upgraded->level = new_level;
+    return upgraded;
+}
+
 std::string DataFileMeta::ToString() const {
     std::vector<std::string> extra_files_str;
     for (const auto& file : extra_files) {
@@ -98,6 +98,9 @@ struct DataFileMeta {
         first_row_id = _first_row_id;
     }
 
+    /// Returns a copy of this file meta moved to `new_level`, the file itself is not rewritten.
+    std::shared_ptr<DataFileMeta> Upgrade(int32_t new_level) const;
+
     Result<int64_t> NonNullFirstRowId() const {
         if (first_row_id) {
             return first_row_id.value();
@@ -21,6 +21,8 @@
 #include "arrow/c/abi.h"
 #include "paimon/common/utils/long_counter.h"
 #include "paimon/common/utils/path_util.h"
+#include "paimon/core/io/data_file_index_writer.h"
+#include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/core/stats/simple_stats_converter.h"
 #include "paimon/format/format_stats_extractor.h"
@@ -33,7 +35,7 @@ DataFileWriter::DataFileWriter(
     int64_t schema_id, const std::shared_ptr<LongCounter>& seq_num_counter, FileSource file_source,
     const std::shared_ptr<FormatStatsExtractor>& stats_extractor, bool is_external_path,
     const std::optional<std::vector<std::string>>& write_cols,
-    const std::shared_ptr<MemoryPool>& pool)
+    std::unique_ptr<DataFileIndexWriter>&& index_writer, const std::shared_ptr<MemoryPool>& pool)
     : SingleFileWriter(compression, converter),
       pool_(pool),
       schema_id_(schema_id),
@@ -41,10 +43,16 @@ DataFileWriter::DataFileWriter(
       seq_num_counter_(seq_num_counter),
       file_source_(file_source),
       stats_extractor_(stats_extractor),
-      write_cols_(write_cols) {}
+      write_cols_(write_cols),
+      index_writer_(std::move(index_writer)) {}
+
+DataFileWriter::~DataFileWriter() = default;
 
 Status DataFileWriter::Write(ArrowArray* batch) {
     int64_t record_count = batch->length;
+    if (index_writer_) {
+        PAIMON_RETURN_NOT_OK(index_writer_->Write(batch));
+    }
     PAIMON_RETURN_NOT_OK(SingleFileWriter::Write(batch));
     seq_num_counter_->Add(record_count);
     return Status::OK();
@@ -60,13 +68,36 @@ Result<std::shared_ptr<DataFileMeta>> DataFileWriter::GetResult() {
         PAIMON_ASSIGN_OR_RAISE(Path external_path, PathUtil::ToPath(path_));
         final_path = external_path.ToString();
     }
+    std::vector<std::optional<std::string>> extra_files;
+    std::shared_ptr<Bytes> embedded_index;
+    if (index_writer_) {
+        PAIMON_ASSIGN_OR_RAISE(DataFileIndexWriter::IndexResult index_result,
+                               index_writer_->Finish(fs_, GetIndexPath()));
+        if (index_result.index_file_name) {
+            index_file_written_ = true;
+            extra_files.push_back(index_result.index_file_name);
+        }
+        embedded_index = index_result.embedded_index;
+    }
     return DataFileMeta::ForAppend(
         PathUtil::GetName(path_), output_bytes_, RecordCount(), stats,
         seq_num_counter_->GetValue() - RecordCount(), seq_num_counter_->GetValue() - 1, schema_id_,
-        {}, /*embedded_index=*/nullptr, file_source_, /*value_stats_cols=*/std::nullopt, final_path,
+        extra_files, embedded_index, file_source_, /*value_stats_cols=*/std::nullopt, final_path,
         /*first_row_id=*/std::nullopt, write_cols_);
 }
 
+std::vector<std::string> DataFileWriter::ExtraFilePaths() const {
+    if (index_file_written_) {
+        return {GetIndexPath()};
+    }
+    return {};
+}
+
+std::string DataFileWriter::GetIndexPath() const {
+    // same as DataFilePathFactory::ToFileIndexPath(), index file is next to the data file
+    return path_ + DataFilePathFactory::INDEX_PATH_SUFFIX;
+}
+
 Result<std::vector<std::shared_ptr<ColumnStats>>> DataFileWriter::GetFieldStats() {
     if (!closed_) {
         return Status::Invalid("Cannot access metric unless the writer is closed.");
@@ -34,6 +34,7 @@
 namespace paimon {
 
 class ColumnStats;
+class DataFileIndexWriter;
 class FormatStatsExtractor;
 class LongCounter;
 class MemoryPool;
@@ -45,14 +46,20 @@ class DataFileWriter : public SingleFileWriter<::ArrowArray*, std::shared_ptr<Da
                    const std::shared_ptr<LongCounter>& seq_num_counter, FileSource file_source,
                    const std::shared_ptr<FormatStatsExtractor>& stats_extractor,
                    bool is_external_path, const std::optional<std::vector<std::string>>& write_cols,
+                   std::unique_ptr<DataFileIndexWriter>&& index_writer,
                    const std::shared_ptr<MemoryPool>& pool);
+    ~DataFileWriter() override;
 
     Status Write(::ArrowArray* batch) override;
 
     Result<std::shared_ptr<DataFileMeta>> GetResult() override;
 
+ protected:
+    std::vector<std::string> ExtraFilePaths() const override;
+
  private:
     Result<std::vector<std::shared_ptr<ColumnStats>>> GetFieldStats();
+    std::string GetIndexPath() const;
 
  private:
     std::shared_ptr<MemoryPool> pool_;
@@ -63,6 +70,9 @@ class DataFileWriter : public SingleFileWriter<::ArrowArray*, std::shared_ptr<Da
     FileSource file_source_;
     std::shared_ptr<FormatStatsExtractor> stats_extractor_;
     std::optional<std::vector<std::string>> write_cols_;
+    // nullptr if no file index is configured
+    std::unique_ptr<DataFileIndexWriter> index_writer_;
+    bool index_file_written_ = false;
 };
 
 }  // namespace paimon
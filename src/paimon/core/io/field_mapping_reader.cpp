@@ -29,11 +29,14 @@
 #include "arrow/util/checked_cast.h"
 #include "fmt/format.h"
 #include "paimon/common/data/binary_string.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/timer.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/core/casting/cast_executor.h"
 #include "paimon/core/casting/casting_utils.h"
+#include "paimon/core/operation/metrics/read_metrics.h"
 #include "paimon/core/utils/field_mapping.h"
 #include "paimon/memory/bytes.h"
 #include "paimon/reader/batch_reader.h"
@@ -51,7 +54,8 @@ FieldMappingReader::FieldMappingReader(int32_t field_count, std::unique_ptr<Batc
       partition_(partition),
       partition_info_(mapping->partition_info),
       non_partition_info_(mapping->non_partition_info),
-      non_exist_field_info_(mapping->non_exist_field_info) {
+      non_exist_field_info_(mapping->non_exist_field_info),
+      metrics_(std::make_shared<MetricsImpl>()) {
     if (non_exist_field_info_ != std::nullopt || partition_info_ != std::nullopt) {
         need_mapping_ = true;
     }
@@ -110,9 +114,22 @@ Result<std::shared_ptr<arrow::Array>> FieldMappingReader::CastNonPartitionArrayI
     return arrow_array;
 }
 
+void FieldMappingReader::RecordFileOpenLatency(uint64_t latency_us) {
+    metrics_->ObserveHistogram(ReadMetrics::FILE_OPEN_LATENCY, latency_us);
+}
+
+std::shared_ptr<Metrics> FieldMappingReader::GetReaderMetrics() const {
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->Merge(reader_->GetReaderMetrics());
+    metrics->Merge(metrics_);
+    return metrics;
+}
+
 Result<BatchReader::ReadBatchWithBitmap> FieldMappingReader::NextBatchWithBitmap() {
+    Timer read_timer;
     PAIMON_ASSIGN_OR_RAISE(ReadBatchWithBitmap non_partition_result_with_bitmap,
                            reader_->NextBatchWithBitmap());
+    metrics_->ObserveHistogram(ReadMetrics::READ_BATCH_LATENCY, read_timer.ElapsedUs());
     if (!need_mapping_ && !need_casting_) {
         return non_partition_result_with_bitmap;
     }
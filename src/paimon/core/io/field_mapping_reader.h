@@ -42,6 +42,7 @@ namespace paimon {
 class DataField;
 class MemoryPool;
 class Metrics;
+class MetricsImpl;
 struct FieldMapping;
 
 class FieldMappingReader : public BatchReader {
@@ -57,9 +58,12 @@ class FieldMappingReader : public BatchReader {
 
     Result<ReadBatchWithBitmap> NextBatchWithBitmap() override;
 
-    std::shared_ptr<Metrics> GetReaderMetrics() const override {
-        return reader_->GetReaderMetrics();
-    }
+    /// Returns metrics of the underlying file reader together with the read latency
+    /// histograms collected by this reader.
+    std::shared_ptr<Metrics> GetReaderMetrics() const override;
+
+    /// Records the time spent to open the underlying file reader.
+    void RecordFileOpenLatency(uint64_t latency_us);
 
     void Close() override {
         reader_->Close();
@@ -95,5 +99,6 @@ class FieldMappingReader : public BatchReader {
 
     std::shared_ptr<arrow::Array> partition_array_;
     std::shared_ptr<arrow::Array> non_exist_array_;
+    std::shared_ptr<MetricsImpl> metrics_;
 };
 }  // namespace paimon
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/key_value_file_reader_factory.h"
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/type.h"
+#include "paimon/common/metrics/timer.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/object_utils.h"
+#include "paimon/core/deletionvectors/apply_deletion_vector_batch_reader.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/io/field_mapping_reader.h"
+#include "paimon/core/io/key_value_data_file_record_reader.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/utils/field_mapping.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/file_format_factory.h"
+#include "paimon/format/reader_builder.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/reader/file_batch_reader.h"
+
+namespace paimon {
+class MemoryPool;
+
+KeyValueFileReaderFactory::KeyValueFileReaderFactory(
+    const std::shared_ptr<TableSchema>& table_schema,
+    std::unique_ptr<SchemaManager>&& schema_manager, int32_t key_arity,
+    const std::shared_ptr<arrow::Schema>& value_schema,
+    std::unique_ptr<FieldMappingBuilder>&& field_mapping_builder, const BinaryRow& partition,
+    const std::shared_ptr<DataFilePathFactory>& path_factory, const CoreOptions& options,
+    const std::shared_ptr<MemoryPool>& pool)
+    : pool_(pool),
+      table_schema_(table_schema),
+      schema_manager_(std::move(schema_manager)),
+      key_arity_(key_arity),
+      value_schema_(value_schema),
+      field_mapping_builder_(std::move(field_mapping_builder)),
+      partition_(partition),
+      path_factory_(path_factory),
+      options_(options) {}
+
+KeyValueFileReaderFactory::~KeyValueFileReaderFactory() = default;
+
+Result<std::unique_ptr<KeyValueFileReaderFactory>> KeyValueFileReaderFactory::Create(
+    const std::shared_ptr<TableSchema>& table_schema, const std::string& root_path,
+    const std::shared_ptr<arrow::Schema>& value_schema, const BinaryRow& partition,
+    const std::shared_ptr<DataFilePathFactory>& path_factory, const CoreOptions& options,
+    const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
+                           table_schema->TrimmedPrimaryKeys());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> key_fields,
+                           table_schema->GetFields(trimmed_primary_keys));
+    // read fields: special fields + trimmed key fields + non-key fields, which is the layout
+    // expected by KeyValueDataFileRecordReader
+    std::vector<DataField> read_fields = {SpecialFields::SequenceNumber(),
+                                          SpecialFields::ValueKind()};
+    read_fields.insert(read_fields.end(), key_fields.begin(), key_fields.end());
+    for (const auto& field : table_schema->Fields()) {
+        if (!ObjectUtils::Contains(trimmed_primary_keys, field.Name())) {
+            read_fields.push_back(field);
+        }
+    }
+    auto read_schema = DataField::ConvertDataFieldsToArrowSchema(read_fields);
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FieldMappingBuilder> field_mapping_builder,
+                           FieldMappingBuilder::Create(read_schema, table_schema->PartitionKeys(),
+                                                       /*predicate=*/nullptr));
+    auto schema_manager =
+        std::make_unique<SchemaManager>(options.GetFileSystem(), root_path, options.GetBranch());
+    return std::unique_ptr<KeyValueFileReaderFactory>(new KeyValueFileReaderFactory(
+        table_schema, std::move(schema_manager), static_cast<int32_t>(trimmed_primary_keys.size()),
+        value_schema, std::move(field_mapping_builder), partition, path_factory, options, pool));
+}
+
+Result<std::unique_ptr<KeyValueRecordReader>> KeyValueFileReaderFactory::CreateRecordReader(
+    const std::shared_ptr<DataFileMeta>& file) const {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> batch_reader,
+                           CreateBatchReader(file, /*deletion_vector=*/nullptr));
+    return std::make_unique<KeyValueDataFileRecordReader>(std::move(batch_reader), key_arity_,
+                                                          value_schema_, file->level, pool_);
+}
+
+Result<std::unique_ptr<BatchReader>> KeyValueFileReaderFactory::CreateBatchReader(
+    const std::shared_ptr<DataFileMeta>& file,
+    PAIMON_UNIQUE_PTR<DeletionVector>&& deletion_vector) const {
+    std::shared_ptr<TableSchema> data_schema = table_schema_;
+    if (file->schema_id != table_schema_->Id()) {
+        // load schema to get data schema
+        PAIMON_ASSIGN_OR_RAISE(data_schema, schema_manager_->ReadSchema(file->schema_id));
+    }
+    // add special fields to file schema when field mapping
+    std::vector<DataField> file_fields = {SpecialFields::SequenceNumber(),
+                                          SpecialFields::ValueKind()};
+    file_fields.insert(file_fields.end(), data_schema->Fields().begin(),
+                       data_schema->Fields().end());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FieldMapping> field_mapping,
+                           field_mapping_builder_->CreateFieldMapping(file_fields));
+    auto file_read_schema = DataField::ConvertDataFieldsToArrowSchema(
+        field_mapping->non_partition_info.non_partition_data_schema);
+
+    PAIMON_ASSIGN_OR_RAISE(std::string format_identifier, file->FileFormat());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileFormat> file_format,
+                           FileFormatFactory::Get(format_identifier, options_.ToMap()));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReaderBuilder> reader_builder,
+                           file_format->CreateReaderBuilder(options_.GetReadBatchSize()));
+    reader_builder->WithMemoryPool(pool_);
+    std::string file_path = path_factory_->ToPath(file);
+    std::unique_ptr<FileBatchReader> file_reader;
+    Timer file_open_timer;
+    if (format_identifier == "lance") {
+        // lance do not support stream build with input stream
+        PAIMON_ASSIGN_OR_RAISE(file_reader, reader_builder->Build(file_path));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> input_stream,
+                               options_.GetFileSystem()->Open(file_path));
+        PAIMON_ASSIGN_OR_RAISE(file_reader, reader_builder->Build(input_stream));
+    }
+    uint64_t file_open_latency_us = file_open_timer.ElapsedUs();
+    ::ArrowSchema c_read_schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*file_read_schema, &c_read_schema));
+    PAIMON_RETURN_NOT_OK(file_reader->SetReadSchema(&c_read_schema, /*predicate=*/nullptr,
+                                                    /*selection_bitmap=*/std::nullopt));
+    std::unique_ptr<BatchReader> reader;
+    if (deletion_vector && !deletion_vector->IsEmpty()) {
+        reader = std::make_unique<ApplyDeletionVectorBatchReader>(std::move(file_reader),
+                                                                  std::move(deletion_vector));
+    } else {
+        reader = std::move(file_reader);
+    }
+    auto field_mapping_reader = std::make_unique<FieldMappingReader>(
+        field_mapping_builder_->GetReadFieldCount(), std::move(reader), partition_,
+        std::move(field_mapping), pool_);
+    field_mapping_reader->RecordFileOpenLatency(file_open_latency_us);
+    return std::move(field_mapping_reader);
+}
+
+}  // namespace paimon
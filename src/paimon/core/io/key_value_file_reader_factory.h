@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/deletionvectors/deletion_vector.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/key_value_record_reader.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class DataFilePathFactory;
+class FieldMappingBuilder;
+class MemoryPool;
+class SchemaManager;
+class TableSchema;
+
+/// Factory to create `KeyValueRecordReader` for data files of one bucket, key values are
+/// returned with all table fields as value (e.g., for compaction rewriting). Files written with an
+/// old schema are evolved to the latest schema.
+class KeyValueFileReaderFactory {
+ public:
+    /// @param value_schema schema of member value in KeyValue object, fields should be in the order
+    /// of table schema
+    static Result<std::unique_ptr<KeyValueFileReaderFactory>> Create(
+        const std::shared_ptr<TableSchema>& table_schema, const std::string& root_path,
+        const std::shared_ptr<arrow::Schema>& value_schema, const BinaryRow& partition,
+        const std::shared_ptr<DataFilePathFactory>& path_factory, const CoreOptions& options,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    ~KeyValueFileReaderFactory();
+
+    Result<std::unique_ptr<KeyValueRecordReader>> CreateRecordReader(
+        const std::shared_ptr<DataFileMeta>& file) const;
+
+    /// Create a reader of the raw batches of `file`, each batch is a struct array of special
+    /// fields, trimmed key fields and non-key fields (in this order), which is the layout expected
+    /// by `KeyValueDataFileRecordReader`.
+    ///
+    /// @param deletion_vector rows deleted in this deletion vector are filtered out, can be null
+    Result<std::unique_ptr<BatchReader>> CreateBatchReader(
+        const std::shared_ptr<DataFileMeta>& file,
+        PAIMON_UNIQUE_PTR<DeletionVector>&& deletion_vector) const;
+
+ private:
+    KeyValueFileReaderFactory(const std::shared_ptr<TableSchema>& table_schema,
+                              std::unique_ptr<SchemaManager>&& schema_manager, int32_t key_arity,
+                              const std::shared_ptr<arrow::Schema>& value_schema,
+                              std::unique_ptr<FieldMappingBuilder>&& field_mapping_builder,
+                              const BinaryRow& partition,
+                              const std::shared_ptr<DataFilePathFactory>& path_factory,
+                              const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<TableSchema> table_schema_;
+    // schema manager is not thread-safe, so each factory owns one
+    std::unique_ptr<SchemaManager> schema_manager_;
+    int32_t key_arity_;
+    std::shared_ptr<arrow::Schema> value_schema_;
+    std::unique_ptr<FieldMappingBuilder> field_mapping_builder_;
+    BinaryRow partition_;
+    std::shared_ptr<DataFilePathFactory> path_factory_;
+    CoreOptions options_;
+};
+}  // namespace paimon
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/key_value_file_writer_factory.h"
+
+#include <utility>
+
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "arrow/type.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/scope_guard.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/io/key_value_data_file_writer.h"
+#include "paimon/core/io/single_file_writer.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/format_stats_extractor.h"
+#include "paimon/format/writer_builder.h"
+#include "paimon/fs/file_system.h"
+
+namespace paimon {
+class MemoryPool;
+
+KeyValueFileWriterFactory::KeyValueFileWriterFactory(
+    int64_t schema_id, const std::vector<std::string>& trimmed_primary_keys,
+    const std::shared_ptr<arrow::Schema>& write_schema,
+    const std::shared_ptr<DataFilePathFactory>& path_factory, const CoreOptions& options,
+    const std::shared_ptr<MemoryPool>& pool)
+    : schema_id_(schema_id),
+      trimmed_primary_keys_(trimmed_primary_keys),
+      write_schema_(write_schema),
+      path_factory_(path_factory),
+      options_(options),
+      pool_(pool) {}
+
+std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
+KeyValueFileWriterFactory::CreateRollingWriter(int32_t level, const FileSource& file_source) const {
+    auto create_file_writer = [this, level, file_source]()
+        -> Result<std::unique_ptr<SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>> {
+        ::ArrowSchema arrow_schema;
+        ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*write_schema_, &arrow_schema));
+        auto format = options_.GetWriteFileFormat();
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<WriterBuilder> writer_builder,
+            format->CreateWriterBuilder(&arrow_schema, options_.GetWriteBatchSize()));
+        writer_builder->WithMemoryPool(pool_);
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*write_schema_, &arrow_schema));
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
+                               format->CreateStatsExtractor(&arrow_schema));
+        auto converter = [](KeyValueBatch key_value_batch, ArrowArray* array) -> Status {
+            ArrowArrayMove(key_value_batch.batch.get(), array);
+            return Status::OK();
+        };
+        auto writer = std::make_unique<KeyValueDataFileWriter>(
+            options_.GetFileCompression(), converter, schema_id_, level, file_source,
+            trimmed_primary_keys_, stats_extractor, write_schema_, path_factory_->IsExternalPath(),
+            pool_);
+        PAIMON_RETURN_NOT_OK(
+            writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
+        return writer;
+    };
+    return std::make_unique<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>(
+        options_.GetTargetFileSize(), create_file_writer);
+}
+
+Status KeyValueFileWriterFactory::DeleteFile(const std::shared_ptr<DataFileMeta>& file) const {
+    return options_.GetFileSystem()->Delete(path_factory_->ToPath(file), /*recursive=*/false);
+}
+
+}  // namespace paimon
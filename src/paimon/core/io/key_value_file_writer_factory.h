@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/core/core_options.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/rolling_file_writer.h"
+#include "paimon/core/key_value.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class DataFilePathFactory;
+class MemoryPool;
+
+/// Factory to create rolling writers of key value data files in one bucket.
+class KeyValueFileWriterFactory {
+ public:
+    /// @param write_schema special fields (e.g., sequence number) + value fields
+    KeyValueFileWriterFactory(int64_t schema_id,
+                              const std::vector<std::string>& trimmed_primary_keys,
+                              const std::shared_ptr<arrow::Schema>& write_schema,
+                              const std::shared_ptr<DataFilePathFactory>& path_factory,
+                              const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool);
+
+    /// The factory must outlive the returned writer.
+    std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
+    CreateRollingWriter(int32_t level, const FileSource& file_source) const;
+
+    const std::shared_ptr<arrow::Schema>& WriteSchema() const {
+        return write_schema_;
+    }
+
+    /// Delete a data file written by writers of this factory.
+    Status DeleteFile(const std::shared_ptr<DataFileMeta>& file) const;
+
+ private:
+    int64_t schema_id_;
+    std::vector<std::string> trimmed_primary_keys_;
+    std::shared_ptr<arrow::Schema> write_schema_;
+    std::shared_ptr<DataFilePathFactory> path_factory_;
+    CoreOptions options_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+}  // namespace paimon
@@ -0,0 +1,279 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/key_value_in_memory_batch_merger.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/ordering.h"
+#include "arrow/util/checked_cast.h"
+#include "fmt/format.h"
+#include "paimon/common/data/columnar/columnar_row.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/status.h"
+
+namespace paimon {
+bool KeyValueInMemoryBatchMerger::IsSupported(const CoreOptions& options) {
+    MergeEngine merge_engine = options.GetMergeEngine();
+    return merge_engine == MergeEngine::DEDUPLICATE || merge_engine == MergeEngine::FIRST_ROW;
+}
+
+KeyValueInMemoryBatchMerger::KeyValueInMemoryBatchMerger(
+    int64_t first_sequence_number, const std::vector<std::string>& trimmed_primary_keys,
+    const std::shared_ptr<FieldsComparator>& key_comparator,
+    const std::shared_ptr<arrow::Schema>& write_schema, int32_t batch_size,
+    MergeEngine merge_engine, bool ignore_delete, const std::shared_ptr<MemoryPool>& pool)
+    : first_sequence_number_(first_sequence_number),
+      trimmed_primary_keys_(trimmed_primary_keys),
+      key_comparator_(key_comparator),
+      write_schema_(write_schema),
+      batch_size_(batch_size),
+      merge_engine_(merge_engine),
+      ignore_delete_(ignore_delete),
+      pool_(pool),
+      arrow_pool_(GetArrowPool(pool)) {}
+
+Result<std::unique_ptr<KeyValueInMemoryBatchMerger>> KeyValueInMemoryBatchMerger::Create(
+    int64_t first_sequence_number, std::vector<std::shared_ptr<arrow::StructArray>>&& batches,
+    std::vector<std::vector<RecordBatch::RowKind>>&& row_kinds,
+    const std::vector<std::string>& trimmed_primary_keys,
+    const std::shared_ptr<FieldsComparator>& key_comparator,
+    const std::shared_ptr<arrow::Schema>& write_schema, int32_t batch_size,
+    const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool) {
+    if (!IsSupported(options)) {
+        return Status::Invalid(
+            "only deduplicate and first-row merge engines can be merged column by column");
+    }
+    if (batches.empty() || batches.size() != row_kinds.size()) {
+        return Status::Invalid(fmt::format(
+            "invalid in-memory batches to merge, batch count {}, row kinds count {}",
+            batches.size(), row_kinds.size()));
+    }
+    auto merger = std::unique_ptr<KeyValueInMemoryBatchMerger>(new KeyValueInMemoryBatchMerger(
+        first_sequence_number, trimmed_primary_keys, key_comparator, write_schema, batch_size,
+        options.GetMergeEngine(), options.IgnoreDelete(), pool));
+
+    int64_t total_length = 0;
+    for (const auto& batch : batches) {
+        total_length += batch->length();
+    }
+    merger->row_kinds_.reserve(total_length);
+    for (size_t i = 0; i < batches.size(); i++) {
+        if (row_kinds[i].empty()) {
+            merger->row_kinds_.insert(merger->row_kinds_.end(), batches[i]->length(),
+                                      RowKind::Insert());
+            continue;
+        }
+        if (static_cast<int64_t>(row_kinds[i].size()) != batches[i]->length()) {
+            return Status::Invalid(fmt::format("row kinds count {} mismatches batch length {}",
+                                               row_kinds[i].size(), batches[i]->length()));
+        }
+        for (const auto& kind : row_kinds[i]) {
+            PAIMON_ASSIGN_OR_RAISE(const RowKind* row_kind,
+                                   RowKind::FromByteValue(static_cast<int8_t>(kind)));
+            merger->row_kinds_.push_back(row_kind);
+        }
+    }
+    row_kinds.clear();
+
+    if (batches.size() == 1) {
+        merger->value_struct_array_ = std::move(batches[0]);
+    } else {
+        arrow::ArrayVector arrays(batches.begin(), batches.end());
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> concatenated,
+                                          arrow::Concatenate(arrays, merger->arrow_pool_.get()));
+        merger->value_struct_array_ =
+            arrow::internal::checked_pointer_cast<arrow::StructArray>(concatenated);
+    }
+    batches.clear();
+    PAIMON_RETURN_NOT_OK(
+        merger->Merge(options.GetSequenceField(), options.SequenceFieldSortOrderIsAscending()));
+    return merger;
+}
+
+Status KeyValueInMemoryBatchMerger::Merge(const std::vector<std::string>& sequence_fields,
+                                          bool sequence_ascending) {
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::UInt64Array> sorted_indices,
+                           SortIndices(sequence_fields, sequence_ascending));
+    arrow::ArrayVector key_fields;
+    key_fields.reserve(trimmed_primary_keys_.size());
+    for (const auto& key : trimmed_primary_keys_) {
+        auto key_array = value_struct_array_->GetFieldByName(key);
+        if (!key_array) {
+            return Status::Invalid(fmt::format("cannot find field {} in data batch", key));
+        }
+        key_fields.push_back(key_array);
+    }
+    // the two rows are only used to compare adjacent keys, they are reused for all rows
+    ColumnarRow previous_key(key_fields, pool_, /*row_id=*/0);
+    ColumnarRow current_key(key_fields, pool_, /*row_id=*/0);
+    const uint64_t* sorted = sorted_indices->raw_values();
+    const int64_t length = sorted_indices->length();
+    arrow::UInt64Builder selected_builder(arrow_pool_.get());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(selected_builder.Reserve(length));
+    int64_t run_start = 0;
+    for (int64_t i = 1; i <= length; i++) {
+        if (i < length) {
+            previous_key.SetRowId(sorted[i - 1]);
+            current_key.SetRowId(sorted[i]);
+            if (key_comparator_->CompareTo(previous_key, current_key) == 0) {
+                continue;
+            }
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::optional<uint64_t> selected, SelectRow(sorted, run_start, i));
+        if (selected) {
+            selected_builder.UnsafeAppend(selected.value());
+        }
+        run_start = i;
+    }
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(selected_builder.Finish(&selected_indices_));
+    return Status::OK();
+}
+
+Result<std::shared_ptr<arrow::UInt64Array>> KeyValueInMemoryBatchMerger::SortIndices(
+    const std::vector<std::string>& sequence_fields, bool sequence_ascending) const {
+    // sort is stable, so rows with the same key and sequence fields are in the order of sequence
+    // number
+    std::vector<arrow::compute::SortKey> sort_keys;
+    sort_keys.reserve(trimmed_primary_keys_.size() + sequence_fields.size());
+    for (const auto& name : trimmed_primary_keys_) {
+        sort_keys.emplace_back(name, arrow::compute::SortOrder::Ascending);
+    }
+    for (const auto& name : sequence_fields) {
+        sort_keys.emplace_back(name, sequence_ascending ? arrow::compute::SortOrder::Ascending
+                                                        : arrow::compute::SortOrder::Descending);
+    }
+    auto sort_options =
+        arrow::compute::SortOptions(sort_keys, arrow::compute::NullPlacement::AtStart);
+    arrow::compute::ExecContext exec_context(arrow_pool_.get());
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        std::shared_ptr<arrow::Array> sorted_indices,
+        arrow::compute::SortIndices(arrow::Datum(value_struct_array_), sort_options,
+                                    &exec_context));
+    auto typed_indices =
+        arrow::internal::checked_pointer_cast<arrow::UInt64Array>(sorted_indices);
+    if (!typed_indices) {
+        return Status::Invalid("cannot cast sorted indices to UInt64Array");
+    }
+    return typed_indices;
+}
+
+Result<std::optional<uint64_t>> KeyValueInMemoryBatchMerger::SelectRow(
+    const uint64_t* sorted_indices, int64_t start, int64_t end) const {
+    assert(start < end);
+    if (end - start == 1) {
+        // a single row is not merged, the same as ReducerMergeFunctionWrapper
+        return std::optional<uint64_t>(sorted_indices[start]);
+    }
+    if (merge_engine_ == MergeEngine::DEDUPLICATE) {
+        // the same as DeduplicateMergeFunction, keep the latest row
+        for (int64_t i = end - 1; i >= start; i--) {
+            uint64_t index = sorted_indices[i];
+            if (!ignore_delete_ || !row_kinds_[index]->IsRetract()) {
+                return std::optional<uint64_t>(index);
+            }
+        }
+        return std::optional<uint64_t>();
+    }
+    // the same as FirstRowMergeFunction, keep the first row
+    std::optional<uint64_t> first_row;
+    for (int64_t i = start; i < end; i++) {
+        uint64_t index = sorted_indices[i];
+        if (row_kinds_[index]->IsRetract()) {
+            if (ignore_delete_) {
+                continue;
+            }
+            return Status::Invalid(
+                "By default, First row merge engine can not accept DELETE/UPDATE_BEFORE "
+                "records. You can config 'first-row.ignore-delete' to ignore the "
+                "DELETE/UPDATE_BEFORE records.");
+        }
+        if (first_row == std::nullopt) {
+            first_row = index;
+        }
+    }
+    return first_row;
+}
+
+Result<KeyValueBatch> KeyValueInMemoryBatchMerger::NextBatch() {
+    KeyValueBatch key_value_batch;
+    if (cursor_ >= selected_indices_->length()) {
+        return std::move(key_value_batch);
+    }
+    int64_t length = std::min<int64_t>(batch_size_, selected_indices_->length() - cursor_);
+    std::shared_ptr<arrow::Array> indices = selected_indices_->Slice(cursor_, length);
+    const uint64_t* raw_indices = selected_indices_->raw_values() + cursor_;
+    cursor_ += length;
+
+    arrow::compute::ExecContext exec_context(arrow_pool_.get());
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        arrow::Datum taken,
+        arrow::compute::Take(value_struct_array_, indices,
+                             arrow::compute::TakeOptions::NoBoundsCheck(), &exec_context));
+    auto taken_struct_array =
+        arrow::internal::checked_pointer_cast<arrow::StructArray>(taken.make_array());
+
+    // special fields
+    arrow::Int64Builder sequence_builder(arrow_pool_.get());
+    arrow::Int8Builder value_kind_builder(arrow_pool_.get());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(sequence_builder.Reserve(length));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(value_kind_builder.Reserve(length));
+    for (int64_t i = 0; i < length; i++) {
+        int64_t sequence_number = first_sequence_number_ + static_cast<int64_t>(raw_indices[i]);
+        const RowKind* row_kind = row_kinds_[raw_indices[i]];
+        if (row_kind->IsRetract()) {
+            key_value_batch.delete_row_count++;
+        }
+        key_value_batch.min_sequence_number =
+            std::min(key_value_batch.min_sequence_number, sequence_number);
+        key_value_batch.max_sequence_number =
+            std::max(key_value_batch.max_sequence_number, sequence_number);
+        sequence_builder.UnsafeAppend(sequence_number);
+        value_kind_builder.UnsafeAppend(row_kind->ToByteValue());
+    }
+    arrow::ArrayVector fields(2);
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(sequence_builder.Finish(&fields[0]));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(value_kind_builder.Finish(&fields[1]));
+    fields.insert(fields.end(), taken_struct_array->fields().begin(),
+                  taken_struct_array->fields().end());
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::StructArray> output_array,
+                                      arrow::StructArray::Make(fields, write_schema_->fields()));
+
+    // key must hold output array as min/max key may be used after the batch is exported
+    arrow::ArrayVector key_fields;
+    key_fields.reserve(trimmed_primary_keys_.size());
+    for (const auto& key : trimmed_primary_keys_) {
+        key_fields.push_back(taken_struct_array->GetFieldByName(key));
+    }
+    key_value_batch.min_key =
+        std::make_shared<ColumnarRow>(output_array, key_fields, pool_, /*row_id=*/0);
+    key_value_batch.max_key =
+        std::make_shared<ColumnarRow>(output_array, key_fields, pool_, /*row_id=*/length - 1);
+    key_value_batch.batch = std::make_unique<ArrowArray>();
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*output_array, key_value_batch.batch.get()));
+    return std::move(key_value_batch);
+}
+}  // namespace paimon
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "paimon/common/types/row_kind.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/key_value.h"
+#include "paimon/core/options/merge_engine.h"
+#include "paimon/record_batch.h"
+#include "paimon/result.h"
+
+namespace arrow {
+class MemoryPool;
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class FieldsComparator;
+class MemoryPool;
+
+/// Merge in-memory batches of a primary key table column by column, for merge engines which only
+/// select one of the rows of a key (deduplicate and first-row). Rows of all batches are sorted by
+/// indices, runs of the same key are detected on the sorted indices, and the selected rows are
+/// gathered with `arrow::compute::Take`, so that no `KeyValue` is created per row.
+///
+/// The output is the same as merging `KeyValueInMemoryRecordReader`s of the batches with
+/// `SortMergeReader` and projecting them with `KeyValueMetaProjectionConsumer`.
+class KeyValueInMemoryBatchMerger {
+ public:
+    /// @return Whether the merge engine of `options` can be merged column by column.
+    static bool IsSupported(const CoreOptions& options);
+
+    /// Sort and merge `batches`. The sequence number of a row is `first_sequence_number` plus its
+    /// position in all batches.
+    ///
+    /// @param row_kinds Row kinds of each batch, empty row kinds mean all rows are inserted.
+    /// @param write_schema Schema of output batches, which are special fields and value fields.
+    static Result<std::unique_ptr<KeyValueInMemoryBatchMerger>> Create(
+        int64_t first_sequence_number,
+        std::vector<std::shared_ptr<arrow::StructArray>>&& batches,
+        std::vector<std::vector<RecordBatch::RowKind>>&& row_kinds,
+        const std::vector<std::string>& trimmed_primary_keys,
+        const std::shared_ptr<FieldsComparator>& key_comparator,
+        const std::shared_ptr<arrow::Schema>& write_schema, int32_t batch_size,
+        const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool);
+
+    /// @return Next merged batch of at most `batch_size` rows, `KeyValueBatch::batch` is nullptr
+    /// if all rows are returned.
+    Result<KeyValueBatch> NextBatch();
+
+ private:
+    KeyValueInMemoryBatchMerger(int64_t first_sequence_number,
+                                const std::vector<std::string>& trimmed_primary_keys,
+                                const std::shared_ptr<FieldsComparator>& key_comparator,
+                                const std::shared_ptr<arrow::Schema>& write_schema,
+                                int32_t batch_size, MergeEngine merge_engine, bool ignore_delete,
+                                const std::shared_ptr<MemoryPool>& pool);
+
+    Status Merge(const std::vector<std::string>& sequence_fields, bool sequence_ascending);
+    Result<std::shared_ptr<arrow::UInt64Array>> SortIndices(
+        const std::vector<std::string>& sequence_fields, bool sequence_ascending) const;
+    // select the row to keep in sorted rows [start, end) of the same key
+    Result<std::optional<uint64_t>> SelectRow(const uint64_t* sorted_indices, int64_t start,
+                                              int64_t end) const;
+
+ private:
+    int64_t first_sequence_number_;
+    std::vector<std::string> trimmed_primary_keys_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    std::shared_ptr<arrow::Schema> write_schema_;
+    int32_t batch_size_;
+    MergeEngine merge_engine_;
+    bool ignore_delete_;
+    std::shared_ptr<MemoryPool> pool_;
+    std::unique_ptr<arrow::MemoryPool> arrow_pool_;
+
+    std::shared_ptr<arrow::StructArray> value_struct_array_;
+    std::vector<const RowKind*> row_kinds_;
+    std::shared_ptr<arrow::UInt64Array> selected_indices_;
+    int64_t cursor_ = 0;
+};
+}  // namespace paimon
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/key_value_in_memory_batch_merger.h"
+
+#include <map>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/defs.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class KeyValueInMemoryBatchMergerTest : public testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        fields_ = {DataField(0, arrow::field("k0", arrow::int32())),
+                   DataField(1, arrow::field("v0", arrow::int32()))};
+        value_type_ = DataField::ConvertDataFieldsToArrowStructType(fields_);
+        arrow::FieldVector write_fields = {
+            DataField::ConvertDataFieldToArrowField(SpecialFields::SequenceNumber()),
+            DataField::ConvertDataFieldToArrowField(SpecialFields::ValueKind())};
+        for (const auto& field : fields_) {
+            write_fields.push_back(DataField::ConvertDataFieldToArrowField(field));
+        }
+        write_schema_ = arrow::schema(write_fields);
+        ASSERT_OK_AND_ASSIGN(key_comparator_,
+                             FieldsComparator::Create({fields_[0]}, /*is_ascending_order=*/true,
+                                                      /*use_view=*/true));
+    }
+
+    std::shared_ptr<arrow::StructArray> MakeBatch(const std::string& json) const {
+        return std::dynamic_pointer_cast<arrow::StructArray>(
+            arrow::ipc::internal::json::ArrayFromJSON(value_type_, json).ValueOrDie());
+    }
+
+    Result<std::unique_ptr<KeyValueInMemoryBatchMerger>> CreateMerger(
+        std::vector<std::shared_ptr<arrow::StructArray>>&& batches,
+        std::vector<std::vector<RecordBatch::RowKind>>&& row_kinds,
+        const std::map<std::string, std::string>& options_map, int32_t batch_size) const {
+        PAIMON_ASSIGN_OR_RAISE(CoreOptions options, CoreOptions::FromMap(options_map));
+        return KeyValueInMemoryBatchMerger::Create(
+            /*first_sequence_number=*/100, std::move(batches), std::move(row_kinds), {"k0"},
+            key_comparator_, write_schema_, batch_size, options, pool_);
+    }
+
+    // collect all output batches, each element is the json of a batch
+    void CheckResult(KeyValueInMemoryBatchMerger* merger,
+                     const std::vector<std::string>& expected_batches) const {
+        auto write_type = arrow::struct_(write_schema_->fields());
+        for (const auto& expected_json : expected_batches) {
+            ASSERT_OK_AND_ASSIGN(KeyValueBatch key_value_batch, merger->NextBatch());
+            ASSERT_TRUE(key_value_batch.batch);
+            auto result = arrow::ImportArray(key_value_batch.batch.get(), write_type);
+            ASSERT_TRUE(result.ok()) << result.status().ToString();
+            auto expected =
+                arrow::ipc::internal::json::ArrayFromJSON(write_type, expected_json).ValueOrDie();
+            ASSERT_TRUE(expected->Equals(result.ValueUnsafe()))
+                << result.ValueUnsafe()->ToString();
+        }
+        ASSERT_OK_AND_ASSIGN(KeyValueBatch key_value_batch, merger->NextBatch());
+        ASSERT_FALSE(key_value_batch.batch);
+    }
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::vector<DataField> fields_;
+    std::shared_ptr<arrow::DataType> value_type_;
+    std::shared_ptr<arrow::Schema> write_schema_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+};
+
+TEST_F(KeyValueInMemoryBatchMergerTest, TestIsSupported) {
+    ASSERT_OK_AND_ASSIGN(CoreOptions dedup, CoreOptions::FromMap({}));
+    ASSERT_TRUE(KeyValueInMemoryBatchMerger::IsSupported(dedup));
+    ASSERT_OK_AND_ASSIGN(CoreOptions first_row,
+                         CoreOptions::FromMap({{Options::MERGE_ENGINE, "first-row"}}));
+    ASSERT_TRUE(KeyValueInMemoryBatchMerger::IsSupported(first_row));
+    ASSERT_OK_AND_ASSIGN(CoreOptions partial_update,
+                         CoreOptions::FromMap({{Options::MERGE_ENGINE, "partial-update"}}));
+    ASSERT_FALSE(KeyValueInMemoryBatchMerger::IsSupported(partial_update));
+}
+
+TEST_F(KeyValueInMemoryBatchMergerTest, TestDeduplicate) {
+    auto batch1 = MakeBatch(R"([[3, 30], [1, 10], [2, 20]])");
+    auto batch2 = MakeBatch(R"([[1, 11], [3, 31]])");
+    std::vector<RecordBatch::RowKind> row_kinds2 = {RecordBatch::RowKind::UPDATE_AFTER,
+                                                    RecordBatch::RowKind::DELETE};
+    ASSERT_OK_AND_ASSIGN(auto merger, CreateMerger({batch1, batch2}, {{}, row_kinds2},
+                                                   /*options_map=*/{}, /*batch_size=*/10));
+    CheckResult(merger.get(), {R"([[103, 2, 1, 11], [102, 0, 2, 20], [104, 3, 3, 31]])"});
+}
+
+TEST_F(KeyValueInMemoryBatchMergerTest, TestDeduplicateIgnoreDelete) {
+    auto batch1 = MakeBatch(R"([[3, 30], [1, 10], [2, 20]])");
+    auto batch2 = MakeBatch(R"([[1, 11], [3, 31], [2, 21]])");
+    std::vector<RecordBatch::RowKind> row_kinds2 = {RecordBatch::RowKind::UPDATE_AFTER,
+                                                    RecordBatch::RowKind::DELETE,
+                                                    RecordBatch::RowKind::DELETE};
+    ASSERT_OK_AND_ASSIGN(
+        auto merger, CreateMerger({batch1, batch2}, {{}, row_kinds2},
+                                  {{Options::IGNORE_DELETE, "true"}}, /*batch_size=*/2));
+    CheckResult(merger.get(), {R"([[103, 2, 1, 11], [102, 0, 2, 20]])", R"([[100, 0, 3, 30]])"});
+}
+
+TEST_F(KeyValueInMemoryBatchMergerTest, TestFirstRow) {
+    auto batch1 = MakeBatch(R"([[3, 30], [1, 10]])");
+    auto batch2 = MakeBatch(R"([[1, 11], [3, 31], [2, 21]])");
+    ASSERT_OK_AND_ASSIGN(auto merger,
+                         CreateMerger({batch1, batch2}, {{}, {}},
+                                      {{Options::MERGE_ENGINE, "first-row"}}, /*batch_size=*/1));
+    CheckResult(merger.get(),
+                {R"([[101, 0, 1, 10]])", R"([[104, 0, 2, 21]])", R"([[100, 0, 3, 30]])"});
+}
+
+TEST_F(KeyValueInMemoryBatchMergerTest, TestFirstRowWithRetract) {
+    auto batch1 = MakeBatch(R"([[1, 10], [1, 11]])");
+    std::vector<RecordBatch::RowKind> row_kinds1 = {RecordBatch::RowKind::INSERT,
+                                                    RecordBatch::RowKind::DELETE};
+    ASSERT_NOK_WITH_MSG(CreateMerger({batch1}, {row_kinds1},
+                                     {{Options::MERGE_ENGINE, "first-row"}}, /*batch_size=*/10),
+                        "First row merge engine can not accept DELETE/UPDATE_BEFORE records");
+}
+
+TEST_F(KeyValueInMemoryBatchMergerTest, TestUserDefinedSequenceField) {
+    auto batch1 = MakeBatch(R"([[1, 12], [1, 10], [1, 11], [2, 20]])");
+    ASSERT_OK_AND_ASSIGN(auto merger, CreateMerger({batch1}, {{}},
+                                                   {{Options::SEQUENCE_FIELD, "v0"}},
+                                                   /*batch_size=*/10));
+    CheckResult(merger.get(), {R"([[100, 0, 1, 12], [103, 0, 2, 20]])"});
+}
+
+}  // namespace paimon::test
@@ -508,6 +508,55 @@ TEST_P(KeyValueProjectionReaderTest, TestInvalidProducer) {
                         "cannot cast VALUE_KIND column to int8 arrow array");
 }
 
+TEST_P(KeyValueProjectionReaderTest, TestKeepProducerOrder) {
+    // batches converted by several threads are returned in the order of merged keys, without
+    // sorting the result
+    arrow::FieldVector fields = {arrow::field("_SEQUENCE_NUMBER", arrow::int64()),
+                                 arrow::field("_VALUE_KIND", arrow::int8()),
+                                 arrow::field("k0", arrow::int32()),
+                                 arrow::field("v0", arrow::int64())};
+    std::shared_ptr<arrow::Schema> value_schema =
+        arrow::schema(arrow::FieldVector({fields[2], fields[3]}));
+    std::shared_ptr<arrow::DataType> src_type = arrow::struct_({fields});
+
+    auto arrow_pool = GetArrowPool(pool_);
+    std::unique_ptr<arrow::ArrayBuilder> array_builder;
+    ASSERT_TRUE(arrow::MakeBuilder(arrow_pool.get(), src_type, &array_builder).ok());
+    auto struct_builder =
+        arrow::internal::checked_pointer_cast<arrow::StructBuilder>(std::move(array_builder));
+    auto seq_builder = static_cast<arrow::Int64Builder*>(struct_builder->field_builder(0));
+    auto kind_builder = static_cast<arrow::Int8Builder*>(struct_builder->field_builder(1));
+    auto key_builder = static_cast<arrow::Int32Builder*>(struct_builder->field_builder(2));
+    auto value_builder = static_cast<arrow::Int64Builder*>(struct_builder->field_builder(3));
+    for (int32_t i = 0; i < 5000; ++i) {
+        ASSERT_TRUE(struct_builder->Append().ok());
+        ASSERT_TRUE(seq_builder->Append(0).ok());
+        ASSERT_TRUE(kind_builder->Append(0).ok());
+        ASSERT_TRUE(key_builder->Append(i).ok());
+        ASSERT_TRUE(value_builder->Append(static_cast<int64_t>(i) * 3).ok());
+    }
+    std::shared_ptr<arrow::Array> src_array;
+    ASSERT_TRUE(struct_builder->Finish(&src_array).ok());
+    auto typed_array = arrow::internal::checked_pointer_cast<arrow::StructArray>(src_array);
+    auto expected_array =
+        arrow::StructArray::Make({typed_array->field(2), typed_array->field(3)},
+                                 value_schema->fields())
+            .ValueOrDie();
+    auto expected = arrow::ChunkedArray::Make({expected_array}).ValueOrDie();
+
+    bool multi_thread_row_to_batch = GetParam();
+    for (const auto& batch_size : {1, 3, 7, 64}) {
+        auto projection_reader = GenerateProjectionReader(
+            src_array, value_schema, /*target_to_src_mapping=*/{0, 1}, /*key_arity=*/1,
+            value_schema, batch_size, multi_thread_row_to_batch);
+        ASSERT_OK_AND_ASSIGN(auto result, paimon::test::ReadResultCollector::CollectResult(
+                                              projection_reader.get()));
+        ASSERT_TRUE(result);
+        ASSERT_TRUE(expected->Equals(result)) << "batch size " << batch_size;
+        projection_reader->Close();
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(EnableMultiThreadRowToBatch, KeyValueProjectionReaderTest,
                          ::testing::Values(false, true));
 
@@ -116,9 +116,11 @@ Result<std::vector<std::shared_ptr<DataFileMeta>>> RollingBlobFileWriter::GetRes
 
 Result<std::shared_ptr<DataFileMeta>> RollingBlobFileWriter::CloseMainWriter() {
     PAIMON_RETURN_NOT_OK(current_writer_->Close());
+    // extra files (e.g. file index) are written in GetResult(), so get abort executor after it
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataFileMeta> result, current_writer_->GetResult());
     PAIMON_ASSIGN_OR_RAISE(auto abort_executor, current_writer_->GetAbortExecutor());
     closed_writers_.push_back(abort_executor);
-    return current_writer_->GetResult();
+    return result;
 }
 
 Result<std::vector<std::shared_ptr<DataFileMeta>>> RollingBlobFileWriter::CloseBlobWriter() {
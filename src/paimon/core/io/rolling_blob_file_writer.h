@@ -70,6 +70,14 @@ class RollingBlobFileWriter
     Status Close() override;
     Result<std::vector<std::shared_ptr<DataFileMeta>>> GetResult() override;
 
+    int64_t GetBufferedSize() const override {
+        int64_t buffered_size = RollingFileWriter::GetBufferedSize();
+        if (blob_writer_) {
+            buffered_size += blob_writer_->GetBufferedSize();
+        }
+        return buffered_size;
+    }
+
  private:
     static Status ValidateFileConsistency(
         const std::shared_ptr<DataFileMeta>& main_data_file_meta,
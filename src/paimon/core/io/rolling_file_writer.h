@@ -61,6 +61,11 @@ class RollingFileWriter : public FileWriter<T, std::vector<R>> {
         return target_file_size_;
     }
 
+    /// Memory occupied by data buffered in the writers of the open files.
+    virtual int64_t GetBufferedSize() const {
+        return current_writer_ ? current_writer_->GetBufferedSize() : 0;
+    }
+
  protected:
     static constexpr int32_t CHECK_ROLLING_RECORD_CNT = 1000;
 
@@ -156,9 +161,11 @@ Status RollingFileWriter<T, R>::CloseCurrentWriter() {
     }
     std::shared_ptr<Metrics> current_metrics = current_writer_->GetMetrics();
     PAIMON_RETURN_NOT_OK(current_writer_->Close());
+    // get result before abort executor, as extra files (e.g. file index) are written in
+    // GetResult(). If it fails, current writer aborts itself in Close()
+    PAIMON_ASSIGN_OR_RAISE(R result, current_writer_->GetResult());
     PAIMON_ASSIGN_OR_RAISE(auto abort_executor, current_writer_->GetAbortExecutor());
     closed_writers_.push_back(abort_executor);
-    PAIMON_ASSIGN_OR_RAISE(R result, current_writer_->GetResult());
     results_.push_back(result);
     current_writer_.reset();
     if (metrics_) {
@@ -22,6 +22,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/c/abi.h"
 #include "arrow/c/helpers.h"
@@ -51,25 +52,37 @@ class Metrics;
 template <typename T, typename R>
 class SingleFileWriter : public FileWriter<T, R> {
  public:
-    /// Abort executor to just have reference of path instead of whole writer.
+    /// Abort executor to just have reference of paths instead of whole writer.
     class AbortExecutor {
      public:
-        AbortExecutor(const std::shared_ptr<FileSystem>& fs, const std::string& path)
-            : fs_(fs), path_(path), logger_(Logger::GetLogger("AbortExecutor")) {}
+        AbortExecutor(const std::shared_ptr<FileSystem>& fs, const std::string& path,
+                      const std::vector<std::string>& extra_paths = {})
+            : fs_(fs),
+              path_(path),
+              extra_paths_(extra_paths),
+              logger_(Logger::GetLogger("AbortExecutor")) {}
 
         void Abort() {
             if (fs_) {
-                auto status = fs_->Delete(path_);
-                if (!status.ok()) {
-                    PAIMON_LOG_WARN(logger_, "Exception occurs when deleting %s: %s", path_.c_str(),
-                                    status.ToString().c_str());
+                DeleteQuietly(path_);
+                for (const auto& extra_path : extra_paths_) {
+                    DeleteQuietly(extra_path);
                 }
             }
         }
 
      private:
+        void DeleteQuietly(const std::string& path) {
+            auto status = fs_->Delete(path);
+            if (!status.ok()) {
+                PAIMON_LOG_WARN(logger_, "Exception occurs when deleting %s: %s", path.c_str(),
+                                status.ToString().c_str());
+            }
+        }
+
         std::shared_ptr<FileSystem> fs_;
         std::string path_;
+        std::vector<std::string> extra_paths_;
         std::shared_ptr<Logger> logger_;
     };
 
@@ -99,11 +112,19 @@ class SingleFileWriter : public FileWriter<T, R> {
 
     Result<bool> ReachTargetSize(bool suggested_check, int64_t target_size);
 
+    /// Memory occupied by data buffered in the format writer of the open file.
+    int64_t GetBufferedSize() const {
+        if (writer_ && !closed_) {
+            return writer_->GetBufferedSize();
+        }
+        return 0;
+    }
+
     Result<AbortExecutor> GetAbortExecutor() const {
         if (closed_ == false) {
             return Status::Invalid("Writer should be closed!");
         }
-        return AbortExecutor(fs_, path_);
+        return AbortExecutor(fs_, path_, ExtraFilePaths());
     }
 
     std::string GetPath() const {
@@ -111,6 +132,11 @@ class SingleFileWriter : public FileWriter<T, R> {
     }
 
  protected:
+    /// Paths of files written besides the main file (e.g. file index), deleted on abort.
+    virtual std::vector<std::string> ExtraFilePaths() const {
+        return {};
+    }
+
     int64_t output_bytes_ = -1;
     std::string compression_;
     std::function<Status(T, ArrowArray*)> converter_;
@@ -233,6 +259,13 @@ void SingleFileWriter<T, R>::Abort() {
             PAIMON_LOG_WARN(logger_, "Exception occurs when closing %s: %s", path_.c_str(),
                             status.ToString().c_str());
         }
+        for (const auto& extra_path : ExtraFilePaths()) {
+            status = fs_->Delete(extra_path);
+            if (!status.ok()) {
+                PAIMON_LOG_WARN(logger_, "Exception occurs when closing %s: %s",
+                                extra_path.c_str(), status.ToString().c_str());
+            }
+        }
     }
 }
 
@@ -27,6 +27,7 @@
 #include "paimon/core/manifest/index_manifest_file_handler.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/object_serializer.h"
+#include "paimon/core/utils/objects_cache.h"
 #include "paimon/core/utils/path_factory.h"
 #include "paimon/core/utils/versioned_object_serializer.h"
 #include "paimon/format/file_format.h"
@@ -61,7 +62,8 @@ Result<std::unique_ptr<IndexManifestFile>> IndexManifestFile::Create(
         path_factory->CreateIndexManifestFileFactory();
     return std::unique_ptr<IndexManifestFile>(
         new IndexManifestFile(file_system, reader_builder, writer_builder, compression,
-                              index_manifest_file_factory, pool));
+                              index_manifest_file_factory, pool,
+                              ObjectsCache::GetShared(options.GetManifestCacheMaxMemorySize())));
 }
 
 IndexManifestFile::IndexManifestFile(const std::shared_ptr<FileSystem>& file_system,
@@ -69,10 +71,11 @@ IndexManifestFile::IndexManifestFile(const std::shared_ptr<FileSystem>& file_sys
                                      const std::shared_ptr<WriterBuilder>& writer_builder,
                                      const std::string& compression,
                                      const std::shared_ptr<PathFactory>& path_factory,
-                                     const std::shared_ptr<MemoryPool>& pool)
+                                     const std::shared_ptr<MemoryPool>& pool,
+                                     const std::shared_ptr<ObjectsCache>& cache)
     : ObjectsFile<IndexManifestEntry>(file_system, reader_builder, writer_builder,
                                       std::make_unique<IndexManifestEntrySerializer>(pool),
-                                      compression, path_factory, pool) {}
+                                      compression, path_factory, pool, cache) {}
 
 Result<std::optional<std::string>> IndexManifestFile::WriteIndexFiles(
     const std::optional<std::string>& previous_index_manifest,
@@ -35,6 +35,7 @@ class FileFormat;
 class FileStorePathFactory;
 class FileSystem;
 class MemoryPool;
+class ObjectsCache;
 class PathFactory;
 class ReaderBuilder;
 class WriterBuilder;
@@ -60,6 +61,7 @@ class IndexManifestFile : public ObjectsFile<IndexManifestEntry> {
                       const std::shared_ptr<WriterBuilder>& writer_builder,
                       const std::string& compression,
                       const std::shared_ptr<PathFactory>& path_factory,
-                      const std::shared_ptr<MemoryPool>& pool);
+                      const std::shared_ptr<MemoryPool>& pool,
+                      const std::shared_ptr<ObjectsCache>& cache);
 };
 }  // namespace paimon
@@ -29,6 +29,7 @@
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/object_serializer.h"
+#include "paimon/core/utils/objects_cache.h"
 #include "paimon/core/utils/path_factory.h"
 #include "paimon/core/utils/versioned_object_serializer.h"
 #include "paimon/format/file_format.h"
@@ -54,7 +55,8 @@ ManifestFile::ManifestFile(const std::shared_ptr<FileSystem>& file_system,
                            const std::shared_ptr<arrow::Schema>& partition_type)
     : ObjectsFile<ManifestEntry>(file_system, reader_builder, writer_builder,
                                  std::make_unique<ManifestEntrySerializer>(pool), compression,
-                                 path_factory, pool),
+                                 path_factory, pool,
+                                 ObjectsCache::GetShared(options.GetManifestCacheMaxMemorySize())),
       target_file_size_(target_file_size),
       options_(options),
       partition_type_(partition_type) {}
@@ -38,6 +38,7 @@ class FileSystem;
 class FileStorePathFactory;
 class ManifestFileMeta;
 class MemoryPool;
+class ObjectsCache;
 class PathFactory;
 class ReaderBuilder;
 class WriterBuilder;
@@ -50,7 +51,8 @@ class ManifestList : public ObjectsFile<ManifestFileMeta> {
         const std::shared_ptr<FileSystem>& file_system,
         const std::shared_ptr<FileFormat>& file_format, const std::string& compression,
         const std::shared_ptr<FileStorePathFactory>& path_factory,
-        const std::shared_ptr<MemoryPool>& pool);
+        const std::shared_ptr<MemoryPool>& pool,
+        const std::shared_ptr<ObjectsCache>& cache = nullptr);
 
     /// Write several `ManifestFileMeta`s into a manifest list.
     ///
@@ -122,7 +124,8 @@ class ManifestList : public ObjectsFile<ManifestFileMeta> {
                  const std::shared_ptr<ReaderBuilder>& reader_builder,
                  const std::shared_ptr<WriterBuilder>& writer_builder,
                  const std::string& compression, const std::shared_ptr<PathFactory>& path_factory,
-                 const std::shared_ptr<MemoryPool>& pool);
+                 const std::shared_ptr<MemoryPool>& pool,
+                 const std::shared_ptr<ObjectsCache>& cache);
 };
 
 }  // namespace paimon
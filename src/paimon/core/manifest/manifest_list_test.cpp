@@ -24,6 +24,7 @@
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/objects_cache.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/file_format_factory.h"
 #include "paimon/fs/local/local_file_system.h"
@@ -36,7 +37,8 @@ class ManifestListTest : public testing::Test {
  public:
     std::unique_ptr<ManifestList> CreateManifestList(
         const std::string& file_format_str, const std::string& root_path,
-        const std::shared_ptr<MemoryPool>& pool) const {
+        const std::shared_ptr<MemoryPool>& pool,
+        const std::shared_ptr<ObjectsCache>& cache = nullptr) const {
         std::shared_ptr<FileSystem> file_system = std::make_shared<LocalFileSystem>();
         EXPECT_OK_AND_ASSIGN(std::shared_ptr<FileFormat> file_format,
                              FileFormatFactory::Get(file_format_str, {}));
@@ -49,8 +51,9 @@ class ManifestListTest : public testing::Test {
                                  /*legacy_partition_name_enabled=*/true, /*external_paths=*/{},
                                  /*global_index_external_path=*/std::nullopt,
                                  /*index_file_in_data_file_dir=*/false, pool));
-        EXPECT_OK_AND_ASSIGN(auto manifest_list, ManifestList::Create(file_system, file_format,
-                                                                      "zstd", path_factory, pool));
+        EXPECT_OK_AND_ASSIGN(auto manifest_list,
+                             ManifestList::Create(file_system, file_format, "zstd", path_factory,
+                                                  pool, cache));
         return manifest_list;
     }
 
@@ -107,6 +110,30 @@ TEST_F(ManifestListTest, TestSimple) {
     ASSERT_EQ(manifest_file_metas, expected_manifest_file_metas);
 }
 
+TEST_F(ManifestListTest, TestReadWithCache) {
+    auto pool = GetDefaultPool();
+    std::string root_path = paimon::test::GetDataDir() + "/orc/append_09.db/append_09";
+    std::string file_name = "manifest-list-f2d59cb8-3ec6-4860-b34b-050b1a533416-2";
+    auto expected_manifest_file_metas = ReadManifestFileMeta("orc", root_path, file_name, pool);
+
+    auto cache = std::make_shared<ObjectsCache>(/*max_memory_size=*/1024 * 1024, pool);
+    auto manifest_list = CreateManifestList("orc", root_path, pool, cache);
+    for (int32_t i = 0; i < 2; i++) {
+        std::vector<ManifestFileMeta> manifest_file_metas;
+        ASSERT_OK(manifest_list->Read(file_name, /*filter=*/nullptr, &manifest_file_metas));
+        ASSERT_EQ(expected_manifest_file_metas, manifest_file_metas);
+        ASSERT_EQ(1, cache->Size());
+    }
+
+    // filter is applied on cached objects
+    std::vector<ManifestFileMeta> manifest_file_metas;
+    ASSERT_OK(manifest_list->Read(
+        file_name,
+        [](const ManifestFileMeta& meta) -> Result<bool> { return meta.NumAddedFiles() > 1; },
+        &manifest_file_metas));
+    ASSERT_EQ(2, manifest_file_metas.size());
+}
+
 TEST_F(ManifestListTest, TestReadWithBucketsAndLevel) {
     auto pool = GetDefaultPool();
     auto manifest_file_metas =
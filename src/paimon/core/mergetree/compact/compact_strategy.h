@@ -0,0 +1,55 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "paimon/core/mergetree/compact/compact_unit.h"
+#include "paimon/core/mergetree/level_sorted_run.h"
+
+namespace paimon {
+/// Compact strategy to decide which files to select for compaction.
+class CompactStrategy {
+ public:
+    virtual ~CompactStrategy() = default;
+
+    /// Pick compaction unit from runs.
+    ///
+    /// - compaction is runs-based, not file-based.
+    /// - level 0 is special, one run per file; all other levels are one run per level.
+    /// - compaction is sequential from small level to large level.
+    virtual std::optional<CompactUnit> Pick(int32_t num_levels,
+                                            const std::vector<LevelSortedRun>& runs) = 0;
+
+    /// Pick a compaction unit consisting of all existing files.
+    static std::optional<CompactUnit> PickFullCompaction(int32_t num_levels,
+                                                         const std::vector<LevelSortedRun>& runs) {
+        int32_t max_level = num_levels - 1;
+        if (runs.empty()) {
+            // no sorted run, no need to compact
+            return std::nullopt;
+        }
+        if (runs.size() == 1 && runs[0].Level() == max_level) {
+            // only 1 sorted run on the max level, nothing to compact
+            return std::nullopt;
+        }
+        return CompactUnit::FromLevelRuns(max_level, runs);
+    }
+};
+}  // namespace paimon
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/mergetree/level_sorted_run.h"
+
+namespace paimon {
+/// A files unit for compaction.
+class CompactUnit {
+ public:
+    CompactUnit(int32_t output_level, const std::vector<std::shared_ptr<DataFileMeta>>& files)
+        : output_level_(output_level), files_(files) {}
+
+    static CompactUnit FromLevelRuns(int32_t output_level,
+                                     const std::vector<LevelSortedRun>& runs) {
+        std::vector<std::shared_ptr<DataFileMeta>> files;
+        for (const auto& run : runs) {
+            const auto& run_files = run.Run().Files();
+            files.insert(files.end(), run_files.begin(), run_files.end());
+        }
+        return CompactUnit(output_level, files);
+    }
+
+    int32_t OutputLevel() const {
+        return output_level_;
+    }
+
+    const std::vector<std::shared_ptr<DataFileMeta>>& Files() const {
+        return files_;
+    }
+
+ private:
+    int32_t output_level_;
+    std::vector<std::shared_ptr<DataFileMeta>> files_;
+};
+}  // namespace paimon
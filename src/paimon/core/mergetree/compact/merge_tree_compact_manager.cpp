@@ -0,0 +1,108 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/merge_tree_compact_manager.h"
+
+#include <utility>
+
+#include "paimon/common/executor/future.h"
+#include "paimon/core/mergetree/compact/merge_tree_compact_rewriter.h"
+#include "paimon/core/mergetree/compact/merge_tree_compact_task.h"
+#include "paimon/executor.h"
+
+namespace paimon {
+
+MergeTreeCompactManager::MergeTreeCompactManager(
+    const std::shared_ptr<Executor>& executor, std::unique_ptr<Levels>&& levels,
+    std::unique_ptr<CompactStrategy>&& strategy,
+    const std::shared_ptr<FieldsComparator>& key_comparator, int64_t compaction_file_size,
+    int32_t num_sorted_run_stop_trigger, const std::shared_ptr<MergeTreeCompactRewriter>& rewriter)
+    : executor_(executor),
+      levels_(std::move(levels)),
+      strategy_(std::move(strategy)),
+      key_comparator_(key_comparator),
+      compaction_file_size_(compaction_file_size),
+      num_sorted_run_stop_trigger_(num_sorted_run_stop_trigger),
+      rewriter_(rewriter),
+      logger_(Logger::GetLogger("MergeTreeCompactManager")) {}
+
+MergeTreeCompactManager::~MergeTreeCompactManager() {
+    // the running task refers to rewriter and files, make sure it is finished before destruction
+    CancelAndWaitCompaction();
+}
+
+Status MergeTreeCompactManager::TriggerCompaction(bool full_compaction) {
+    std::optional<CompactUnit> optional_unit;
+    std::vector<LevelSortedRun> runs = levels_->LevelSortedRuns();
+    if (full_compaction) {
+        if (task_future_.valid()) {
+            return Status::Invalid(
+                "A compaction task is still running while the user forces a new compaction. This "
+                "is unexpected.");
+        }
+        PAIMON_LOG_DEBUG(logger_,
+                         "Trigger forced full compaction. Picking from the following %zu runs",
+                         runs.size());
+        optional_unit = CompactStrategy::PickFullCompaction(levels_->NumberOfLevels(), runs);
+    } else {
+        if (task_future_.valid()) {
+            return Status::OK();
+        }
+        optional_unit = strategy_->Pick(levels_->NumberOfLevels(), runs);
+        if (optional_unit) {
+            const auto& files = optional_unit->Files();
+            if (files.empty() ||
+                (files.size() == 1 && files[0]->level == optional_unit->OutputLevel())) {
+                // only 1 file in the unit which is already at the output level, nothing to do
+                optional_unit = std::nullopt;
+            }
+        }
+    }
+    if (optional_unit) {
+        // As long as there is no older data, we can drop the deletion.
+        // If the output level is 0, there may be older data not involved in compaction.
+        // If the output level is bigger than 0, as long as there is no older data in the current
+        // levels, the output is the oldest, so we can drop the deletion.
+        // See CompactStrategy::Pick.
+        int32_t output_level = optional_unit->OutputLevel();
+        bool drop_delete = output_level != 0 && output_level >= levels_->NonEmptyHighestLevel();
+        SubmitCompaction(optional_unit.value(), drop_delete);
+    }
+    return Status::OK();
+}
+
+void MergeTreeCompactManager::SubmitCompaction(const CompactUnit& unit, bool drop_delete) {
+    PAIMON_LOG_DEBUG(logger_, "Submit compaction with %zu files, output level %d, drop delete %d",
+                     unit.Files().size(), unit.OutputLevel(), static_cast<int32_t>(drop_delete));
+    auto task = std::make_shared<MergeTreeCompactTask>(
+        key_comparator_, compaction_file_size_, rewriter_, unit.OutputLevel(),
+        levels_->MaxLevel(), drop_delete, unit.Files(), NewCancelFlag());
+    task_future_ = Via(executor_.get(), [task]() -> Result<CompactResult> {
+        return task->DoCompact();
+    });
+}
+
+Result<std::optional<CompactResult>> MergeTreeCompactManager::GetCompactionResult(bool blocking) {
+    PAIMON_ASSIGN_OR_RAISE(std::optional<CompactResult> result, ObtainCompactResult(blocking));
+    if (result) {
+        PAIMON_LOG_DEBUG(logger_, "Update levels in compact manager with %zu before files",
+                         result->Before().size());
+        PAIMON_RETURN_NOT_OK(levels_->Update(result->Before(), result->After()));
+    }
+    return result;
+}
+
+}  // namespace paimon
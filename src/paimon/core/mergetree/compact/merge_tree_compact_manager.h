@@ -0,0 +1,96 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "paimon/core/compact/compact_future_manager.h"
+#include "paimon/core/compact/compact_result.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/mergetree/compact/compact_strategy.h"
+#include "paimon/core/mergetree/compact/compact_unit.h"
+#include "paimon/core/mergetree/levels.h"
+#include "paimon/logging.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class Executor;
+class FieldsComparator;
+class MergeTreeCompactRewriter;
+
+/// Compact manager for `KeyValueFileStore`, compaction tasks run in `executor` one at a time.
+class MergeTreeCompactManager : public CompactFutureManager {
+ public:
+    /// @param key_comparator comparator of `DataFileMeta::min_key` and `DataFileMeta::max_key`
+    MergeTreeCompactManager(const std::shared_ptr<Executor>& executor,
+                            std::unique_ptr<Levels>&& levels,
+                            std::unique_ptr<CompactStrategy>&& strategy,
+                            const std::shared_ptr<FieldsComparator>& key_comparator,
+                            int64_t compaction_file_size, int32_t num_sorted_run_stop_trigger,
+                            const std::shared_ptr<MergeTreeCompactRewriter>& rewriter);
+
+    ~MergeTreeCompactManager() override;
+
+    bool ShouldWaitForLatestCompaction() const override {
+        return levels_->NumberOfSortedRuns() > num_sorted_run_stop_trigger_;
+    }
+
+    bool ShouldWaitForPreparingCheckpoint() const override {
+        return levels_->NumberOfSortedRuns() >
+               static_cast<int64_t>(num_sorted_run_stop_trigger_) + 1;
+    }
+
+    void AddNewFile(const std::shared_ptr<DataFileMeta>& file) override {
+        levels_->AddLevel0File(file);
+    }
+
+    std::vector<std::shared_ptr<DataFileMeta>> AllFiles() const override {
+        return levels_->AllFiles();
+    }
+
+    Status TriggerCompaction(bool full_compaction) override;
+
+    /// Finish current task, and update result files to `Levels`.
+    Result<std::optional<CompactResult>> GetCompactionResult(bool blocking) override;
+
+    Status Close() override {
+        CancelAndWaitCompaction();
+        return Status::OK();
+    }
+
+    const Levels& GetLevels() const {
+        return *levels_;
+    }
+
+ private:
+    void SubmitCompaction(const CompactUnit& unit, bool drop_delete);
+
+ private:
+    std::shared_ptr<Executor> executor_;
+    std::unique_ptr<Levels> levels_;
+    std::unique_ptr<CompactStrategy> strategy_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    int64_t compaction_file_size_;
+    int32_t num_sorted_run_stop_trigger_;
+    std::shared_ptr<MergeTreeCompactRewriter> rewriter_;
+    std::unique_ptr<Logger> logger_;
+};
+}  // namespace paimon
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/merge_tree_compact_rewriter.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "paimon/common/utils/scope_guard.h"
+#include "paimon/core/io/async_key_value_producer_and_consumer.h"
+#include "paimon/core/io/concat_key_value_record_reader.h"
+#include "paimon/core/io/key_value_meta_projection_consumer.h"
+#include "paimon/core/io/key_value_record_reader.h"
+#include "paimon/core/io/row_to_arrow_array_converter.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
+#include "paimon/core/mergetree/drop_delete_reader.h"
+
+namespace paimon {
+class FieldsComparator;
+class MemoryPool;
+
+MergeTreeCompactRewriter::MergeTreeCompactRewriter(
+    std::unique_ptr<KeyValueFileReaderFactory>&& reader_factory,
+    const std::shared_ptr<KeyValueFileWriterFactory>& writer_factory,
+    const std::shared_ptr<FieldsComparator>& key_comparator,
+    const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+    const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
+    int32_t write_batch_size, const std::shared_ptr<MemoryPool>& pool)
+    : reader_factory_(std::move(reader_factory)),
+      writer_factory_(writer_factory),
+      key_comparator_(key_comparator),
+      user_defined_seq_comparator_(user_defined_seq_comparator),
+      merge_function_wrapper_(merge_function_wrapper),
+      write_batch_size_(std::min(write_batch_size, MAX_PROJECTION_BATCH_SIZE)),
+      pool_(pool) {}
+
+Result<CompactResult> MergeTreeCompactRewriter::Rewrite(
+    int32_t output_level, bool drop_delete, const std::vector<std::vector<SortedRun>>& sections,
+    const std::atomic<bool>& cancelled) {
+    auto rolling_writer = writer_factory_->CreateRollingWriter(output_level, FileSource::Compact());
+    ScopeGuard guard([&rolling_writer]() { rolling_writer->Abort(); });
+    std::vector<std::shared_ptr<DataFileMeta>> before;
+    for (const auto& section : sections) {
+        // no overlap through multiple sections, merge sort runs in one section
+        std::vector<std::unique_ptr<KeyValueRecordReader>> run_readers;
+        run_readers.reserve(section.size());
+        for (const auto& run : section) {
+            // no overlap in a run
+            std::vector<std::unique_ptr<KeyValueRecordReader>> file_readers;
+            file_readers.reserve(run.Files().size());
+            for (const auto& file : run.Files()) {
+                PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueRecordReader> file_reader,
+                                       reader_factory_->CreateRecordReader(file));
+                file_readers.push_back(std::move(file_reader));
+                before.push_back(file);
+            }
+            run_readers.push_back(
+                std::make_unique<ConcatKeyValueRecordReader>(std::move(file_readers)));
+        }
+        std::unique_ptr<SortMergeReader> sort_merge_reader =
+            std::make_unique<SortMergeReaderWithLoserTree>(std::move(run_readers), key_comparator_,
+                                                           user_defined_seq_comparator_,
+                                                           merge_function_wrapper_);
+        if (drop_delete) {
+            sort_merge_reader = std::make_unique<DropDeleteReader>(std::move(sort_merge_reader));
+        }
+        auto create_consumer = [target_schema = writer_factory_->WriteSchema(), pool = pool_]()
+            -> Result<std::unique_ptr<RowToArrowArrayConverter<KeyValue, KeyValueBatch>>> {
+            return KeyValueMetaProjectionConsumer::Create(target_schema, pool);
+        };
+        auto async_key_value_producer_consumer =
+            std::make_unique<AsyncKeyValueProducerAndConsumer<KeyValue, KeyValueBatch>>(
+                std::move(sort_merge_reader), create_consumer, write_batch_size_,
+                /*projection_thread_num=*/1, pool_);
+        while (true) {
+            if (cancelled.load()) {
+                async_key_value_producer_consumer->Close();
+                return Status::Invalid("compaction is cancelled");
+            }
+            PAIMON_ASSIGN_OR_RAISE(KeyValueBatch key_value_batch,
+                                   async_key_value_producer_consumer->NextBatch());
+            if (key_value_batch.batch == nullptr) {
+                break;
+            }
+            PAIMON_RETURN_NOT_OK(rolling_writer->Write(std::move(key_value_batch)));
+        }
+        async_key_value_producer_consumer->Close();
+    }
+    PAIMON_RETURN_NOT_OK(rolling_writer->Close());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> after,
+                           rolling_writer->GetResult());
+    guard.Release();
+    return CompactResult(before, after);
+}
+
+Result<CompactResult> MergeTreeCompactRewriter::Upgrade(
+    int32_t output_level, const std::shared_ptr<DataFileMeta>& file) const {
+    return CompactResult({file}, {file->Upgrade(output_level)});
+}
+
+}  // namespace paimon
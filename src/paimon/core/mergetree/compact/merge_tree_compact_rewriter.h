@@ -0,0 +1,78 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "paimon/core/compact/compact_result.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/key_value_file_reader_factory.h"
+#include "paimon/core/io/key_value_file_writer_factory.h"
+#include "paimon/core/key_value.h"
+#include "paimon/core/mergetree/compact/merge_function_wrapper.h"
+#include "paimon/core/mergetree/sorted_run.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class FieldsComparator;
+class MemoryPool;
+template <typename T>
+class MergeFunctionWrapper;
+
+/// Rewrite sections of sorted runs into new files of the output level, records with the same key
+/// are merged by the merge function.
+class MergeTreeCompactRewriter {
+ public:
+    MergeTreeCompactRewriter(
+        std::unique_ptr<KeyValueFileReaderFactory>&& reader_factory,
+        const std::shared_ptr<KeyValueFileWriterFactory>& writer_factory,
+        const std::shared_ptr<FieldsComparator>& key_comparator,
+        const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+        const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
+        int32_t write_batch_size, const std::shared_ptr<MemoryPool>& pool);
+
+    /// Rewrite `sections` to `output_level`, sections must not overlap with each other.
+    ///
+    /// @param drop_delete whether to drop records which are not `RowKind::IsAdd()`, only safe when
+    /// there are no older records of the same keys in higher levels
+    /// @param cancelled checked between batches, rewriting stops and written files are cleaned up
+    /// once it is set
+    Result<CompactResult> Rewrite(int32_t output_level, bool drop_delete,
+                                  const std::vector<std::vector<SortedRun>>& sections,
+                                  const std::atomic<bool>& cancelled);
+
+    /// Move `file` to `output_level` without rewriting it.
+    Result<CompactResult> Upgrade(int32_t output_level,
+                                  const std::shared_ptr<DataFileMeta>& file) const;
+
+ private:
+    // in case write batch size is too large and overflow arrow array
+    static constexpr int32_t MAX_PROJECTION_BATCH_SIZE = 100000;
+
+    std::unique_ptr<KeyValueFileReaderFactory> reader_factory_;
+    std::shared_ptr<KeyValueFileWriterFactory> writer_factory_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
+    std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper_;
+    int32_t write_batch_size_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+}  // namespace paimon
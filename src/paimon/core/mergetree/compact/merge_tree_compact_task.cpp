@@ -0,0 +1,116 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/merge_tree_compact_task.h"
+
+#include <utility>
+
+#include "paimon/core/mergetree/compact/interval_partition.h"
+#include "paimon/core/mergetree/compact/merge_tree_compact_rewriter.h"
+
+namespace paimon {
+
+MergeTreeCompactTask::MergeTreeCompactTask(
+    const std::shared_ptr<FieldsComparator>& key_comparator, int64_t min_file_size,
+    const std::shared_ptr<MergeTreeCompactRewriter>& rewriter, int32_t output_level,
+    int32_t max_level, bool drop_delete, const std::vector<std::shared_ptr<DataFileMeta>>& files,
+    const std::shared_ptr<std::atomic<bool>>& cancelled)
+    : key_comparator_(key_comparator),
+      min_file_size_(min_file_size),
+      rewriter_(rewriter),
+      output_level_(output_level),
+      max_level_(max_level),
+      drop_delete_(drop_delete),
+      files_(files),
+      cancelled_(cancelled) {}
+
+Result<CompactResult> MergeTreeCompactTask::DoCompact() {
+    std::vector<std::vector<SortedRun>> partitioned =
+        IntervalPartition(files_, key_comparator_).Partition();
+    std::vector<std::vector<SortedRun>> candidate;
+    CompactResult result;
+    // Checking the order and compacting adjacent and contiguous files
+    // Note: can't skip an intermediate file to compact, this will destroy the overall orderliness
+    for (auto& section : partitioned) {
+        if (section.size() > 1) {
+            candidate.push_back(std::move(section));
+            continue;
+        }
+        // No overlapping:
+        // We can just upgrade the large file and just change the level instead of rewriting it
+        // But for small files, we will try to compact it
+        for (const auto& file : section[0].Files()) {
+            if (file->file_size < min_file_size_) {
+                // Smaller files are rewritten along with the previous files
+                candidate.push_back({SortedRun::FromSingle(file)});
+            } else {
+                // Large file appear, rewrite previous and upgrade it
+                PAIMON_RETURN_NOT_OK(Rewrite(&candidate, &result));
+                PAIMON_RETURN_NOT_OK(Upgrade(file, &result));
+            }
+        }
+    }
+    PAIMON_RETURN_NOT_OK(Rewrite(&candidate, &result));
+    return result;
+}
+
+Status MergeTreeCompactTask::Upgrade(const std::shared_ptr<DataFileMeta>& file,
+                                     CompactResult* to_update) {
+    if (file->level == output_level_) {
+        return Status::OK();
+    }
+    if (output_level_ != max_level_ ||
+        (file->delete_row_count && file->delete_row_count.value() == 0)) {
+        PAIMON_ASSIGN_OR_RAISE(CompactResult upgraded, rewriter_->Upgrade(output_level_, file));
+        to_update->Merge(upgraded);
+        return Status::OK();
+    }
+    // files with delete records should not be upgraded directly to max level
+    std::vector<std::vector<SortedRun>> candidate = {{SortedRun::FromSingle(file)}};
+    return RewriteImpl(&candidate, to_update);
+}
+
+Status MergeTreeCompactTask::Rewrite(std::vector<std::vector<SortedRun>>* candidate,
+                                     CompactResult* to_update) {
+    if (candidate->empty()) {
+        return Status::OK();
+    }
+    if (candidate->size() == 1) {
+        const std::vector<SortedRun>& section = (*candidate)[0];
+        if (section.empty()) {
+            return Status::OK();
+        } else if (section.size() == 1) {
+            for (const auto& file : section[0].Files()) {
+                PAIMON_RETURN_NOT_OK(Upgrade(file, to_update));
+            }
+            candidate->clear();
+            return Status::OK();
+        }
+    }
+    return RewriteImpl(candidate, to_update);
+}
+
+Status MergeTreeCompactTask::RewriteImpl(std::vector<std::vector<SortedRun>>* candidate,
+                                         CompactResult* to_update) {
+    PAIMON_ASSIGN_OR_RAISE(
+        CompactResult rewritten,
+        rewriter_->Rewrite(output_level_, drop_delete_, *candidate, *cancelled_));
+    to_update->Merge(rewritten);
+    candidate->clear();
+    return Status::OK();
+}
+
+}  // namespace paimon
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "paimon/core/compact/compact_result.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/mergetree/sorted_run.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class FieldsComparator;
+class MergeTreeCompactRewriter;
+
+/// Compact task for merge tree compaction. Files which do not overlap with others are upgraded to
+/// the output level directly if they are large enough, the others are rewritten.
+class MergeTreeCompactTask {
+ public:
+    /// @param key_comparator comparator of `DataFileMeta::min_key` and `DataFileMeta::max_key`
+    /// @param min_file_size files smaller than it are always rewritten
+    MergeTreeCompactTask(const std::shared_ptr<FieldsComparator>& key_comparator,
+                         int64_t min_file_size,
+                         const std::shared_ptr<MergeTreeCompactRewriter>& rewriter,
+                         int32_t output_level, int32_t max_level, bool drop_delete,
+                         const std::vector<std::shared_ptr<DataFileMeta>>& files,
+                         const std::shared_ptr<std::atomic<bool>>& cancelled);
+
+    Result<CompactResult> DoCompact();
+
+ private:
+    Status Upgrade(const std::shared_ptr<DataFileMeta>& file, CompactResult* to_update);
+    Status Rewrite(std::vector<std::vector<SortedRun>>* candidate, CompactResult* to_update);
+    Status RewriteImpl(std::vector<std::vector<SortedRun>>* candidate, CompactResult* to_update);
+
+ private:
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    int64_t min_file_size_;
+    std::shared_ptr<MergeTreeCompactRewriter> rewriter_;
+    int32_t output_level_;
+    int32_t max_level_;
+    bool drop_delete_;
+    std::vector<std::shared_ptr<DataFileMeta>> files_;
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+}  // namespace paimon
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/universal_compaction.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace paimon {
+
+UniversalCompaction::UniversalCompaction(int32_t max_size_amp, int32_t size_ratio,
+                                         int32_t num_run_compaction_trigger)
+    : max_size_amp_(max_size_amp),
+      size_ratio_(size_ratio),
+      num_run_compaction_trigger_(num_run_compaction_trigger),
+      logger_(Logger::GetLogger("UniversalCompaction")) {}
+
+std::optional<CompactUnit> UniversalCompaction::Pick(int32_t num_levels,
+                                                     const std::vector<LevelSortedRun>& runs) {
+    int32_t max_level = num_levels - 1;
+
+    // 1 checking for reducing size amplification
+    std::optional<CompactUnit> unit = PickForSizeAmp(max_level, runs);
+    if (unit) {
+        PAIMON_LOG_DEBUG(logger_,
+                         "Universal compaction due to size amplification, sorted runs: %zu",
+                         runs.size());
+        return unit;
+    }
+
+    // 2 checking for size ratio
+    unit = PickForSizeRatio(max_level, runs);
+    if (unit) {
+        PAIMON_LOG_DEBUG(logger_, "Universal compaction due to size ratio, sorted runs: %zu",
+                         runs.size());
+        return unit;
+    }
+
+    // 3 checking for file num
+    if (static_cast<int32_t>(runs.size()) > num_run_compaction_trigger_) {
+        // compacting for file num
+        int32_t candidate_count =
+            static_cast<int32_t>(runs.size()) - num_run_compaction_trigger_ + 1;
+        PAIMON_LOG_DEBUG(logger_, "Universal compaction due to file num, sorted runs: %zu",
+                         runs.size());
+        return PickForSizeRatio(max_level, runs, candidate_count);
+    }
+    return std::nullopt;
+}
+
+std::optional<CompactUnit> UniversalCompaction::PickForSizeAmp(
+    int32_t max_level, const std::vector<LevelSortedRun>& runs) const {
+    if (static_cast<int32_t>(runs.size()) < num_run_compaction_trigger_) {
+        return std::nullopt;
+    }
+    int64_t candidate_size = 0;
+    for (size_t i = 0; i + 1 < runs.size(); i++) {
+        candidate_size += runs[i].Run().TotalSize();
+    }
+    int64_t earliest_run_size = runs.back().Run().TotalSize();
+    // size amplification = percentage of additional size
+    if (candidate_size * 100 > max_size_amp_ * earliest_run_size) {
+        return CompactUnit::FromLevelRuns(max_level, runs);
+    }
+    return std::nullopt;
+}
+
+std::optional<CompactUnit> UniversalCompaction::PickForSizeRatio(
+    int32_t max_level, const std::vector<LevelSortedRun>& runs) const {
+    if (static_cast<int32_t>(runs.size()) < num_run_compaction_trigger_) {
+        return std::nullopt;
+    }
+    return PickForSizeRatio(max_level, runs, /*candidate_count=*/1);
+}
+
+std::optional<CompactUnit> UniversalCompaction::PickForSizeRatio(
+    int32_t max_level, const std::vector<LevelSortedRun>& runs, int32_t candidate_count) const {
+    int64_t candidate_size = 0;
+    for (int32_t i = 0; i < candidate_count; i++) {
+        candidate_size += runs[i].Run().TotalSize();
+    }
+    for (size_t i = candidate_count; i < runs.size(); i++) {
+        const LevelSortedRun& next = runs[i];
+        if (static_cast<double>(candidate_size) * (100.0 + size_ratio_) / 100.0 <
+            static_cast<double>(next.Run().TotalSize())) {
+            break;
+        }
+        candidate_size += next.Run().TotalSize();
+        candidate_count++;
+    }
+    if (candidate_count > 1) {
+        return CreateUnit(runs, max_level, candidate_count);
+    }
+    return std::nullopt;
+}
+
+CompactUnit UniversalCompaction::CreateUnit(const std::vector<LevelSortedRun>& runs,
+                                            int32_t max_level, int32_t run_count) const {
+    int32_t output_level;
+    if (run_count == static_cast<int32_t>(runs.size())) {
+        output_level = max_level;
+    } else {
+        // level of next run - 1
+        output_level = std::max(0, runs[run_count].Level() - 1);
+    }
+
+    if (output_level == 0) {
+        // do not output level 0
+        for (size_t i = run_count; i < runs.size(); i++) {
+            const LevelSortedRun& next = runs[i];
+            run_count++;
+            if (next.Level() != 0) {
+                output_level = next.Level();
+                break;
+            }
+        }
+    }
+
+    if (run_count == static_cast<int32_t>(runs.size())) {
+        output_level = max_level;
+    }
+    std::vector<LevelSortedRun> picked(runs.begin(), runs.begin() + run_count);
+    return CompactUnit::FromLevelRuns(output_level, picked);
+}
+
+}  // namespace paimon
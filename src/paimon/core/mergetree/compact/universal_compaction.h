@@ -0,0 +1,62 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "paimon/core/mergetree/compact/compact_strategy.h"
+#include "paimon/core/mergetree/compact/compact_unit.h"
+#include "paimon/core/mergetree/level_sorted_run.h"
+#include "paimon/logging.h"
+
+namespace paimon {
+/// Universal Compaction Style is a compaction style, targeting the use cases requiring lower write
+/// amplification, trading off read amplification and space amplification.
+///
+/// See RocksDb Universal-Compaction:
+/// https://github.com/facebook/rocksdb/wiki/Universal-Compaction.
+class UniversalCompaction : public CompactStrategy {
+ public:
+    UniversalCompaction(int32_t max_size_amp, int32_t size_ratio,
+                        int32_t num_run_compaction_trigger);
+
+    std::optional<CompactUnit> Pick(int32_t num_levels,
+                                    const std::vector<LevelSortedRun>& runs) override;
+
+    std::optional<CompactUnit> PickForSizeAmp(int32_t max_level,
+                                              const std::vector<LevelSortedRun>& runs) const;
+
+    std::optional<CompactUnit> PickForSizeRatio(int32_t max_level,
+                                                const std::vector<LevelSortedRun>& runs) const;
+
+    std::optional<CompactUnit> PickForSizeRatio(int32_t max_level,
+                                                const std::vector<LevelSortedRun>& runs,
+                                                int32_t candidate_count) const;
+
+    CompactUnit CreateUnit(const std::vector<LevelSortedRun>& runs, int32_t max_level,
+                           int32_t run_count) const;
+
+ private:
+    int32_t max_size_amp_;
+    int32_t size_ratio_;
+    int32_t num_run_compaction_trigger_;
+    std::unique_ptr<Logger> logger_;
+};
+}  // namespace paimon
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/universal_compaction.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/core/mergetree/compact/compact_strategy.h"
+#include "paimon/core/mergetree/compact/compact_unit.h"
+#include "paimon/core/mergetree/level_sorted_run.h"
+#include "paimon/core/mergetree/sorted_run.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/data/timestamp.h"
+
+namespace paimon::test {
+
+class UniversalCompactionTest : public testing::Test {
+ public:
+    static std::shared_ptr<DataFileMeta> NewFile(int32_t level, int64_t file_size) {
+        return std::make_shared<DataFileMeta>(
+            "file-" + std::to_string(file_id_++), file_size, /*row_count=*/1,
+            DataFileMeta::EmptyMinKey(), DataFileMeta::EmptyMaxKey(), SimpleStats::EmptyStats(),
+            SimpleStats::EmptyStats(), /*min_sequence_number=*/0, /*max_sequence_number=*/0,
+            /*schema_id=*/0, level, /*extra_files=*/std::vector<std::optional<std::string>>(),
+            Timestamp(0, 0), /*delete_row_count=*/0, /*embedded_index=*/nullptr,
+            FileSource::Append(), /*value_stats_cols=*/std::nullopt,
+            /*external_path=*/std::nullopt, /*first_row_id=*/std::nullopt,
+            /*write_cols=*/std::nullopt);
+    }
+
+    static std::vector<LevelSortedRun> Level0(const std::vector<int64_t>& sizes) {
+        std::vector<LevelSortedRun> runs;
+        for (int64_t size : sizes) {
+            runs.emplace_back(/*level=*/0, SortedRun::FromSingle(NewFile(/*level=*/0, size)));
+        }
+        return runs;
+    }
+
+    static std::vector<LevelSortedRun> CreateRuns(const std::vector<int32_t>& levels,
+                                                  const std::vector<int64_t>& sizes) {
+        std::vector<LevelSortedRun> runs;
+        for (size_t i = 0; i < levels.size(); i++) {
+            runs.emplace_back(levels[i], SortedRun::FromSingle(NewFile(levels[i], sizes[i])));
+        }
+        return runs;
+    }
+
+    static std::vector<int64_t> FileSizes(const CompactUnit& unit) {
+        std::vector<int64_t> sizes;
+        for (const auto& file : unit.Files()) {
+            sizes.push_back(file->file_size);
+        }
+        return sizes;
+    }
+
+ private:
+    static inline int32_t file_id_ = 0;
+};
+
+TEST_F(UniversalCompactionTest, TestOutputLevel) {
+    UniversalCompaction compaction(/*max_size_amp=*/25, /*size_ratio=*/1,
+                                   /*num_run_compaction_trigger=*/3);
+    auto runs = CreateRuns({0, 0, 1, 3, 4}, {1, 1, 1, 1, 1});
+    ASSERT_EQ(1, compaction.CreateUnit(runs, /*max_level=*/5, /*run_count=*/1).OutputLevel());
+    ASSERT_EQ(1, compaction.CreateUnit(runs, /*max_level=*/5, /*run_count=*/2).OutputLevel());
+    ASSERT_EQ(2, compaction.CreateUnit(runs, /*max_level=*/5, /*run_count=*/3).OutputLevel());
+    ASSERT_EQ(3, compaction.CreateUnit(runs, /*max_level=*/5, /*run_count=*/4).OutputLevel());
+    ASSERT_EQ(5, compaction.CreateUnit(runs, /*max_level=*/5, /*run_count=*/5).OutputLevel());
+    // level 0 is never the output level, following runs are picked until a non-zero level
+    ASSERT_EQ(3, compaction.CreateUnit(runs, /*max_level=*/5, /*run_count=*/1).Files().size());
+    ASSERT_EQ(3, compaction.CreateUnit(runs, /*max_level=*/5, /*run_count=*/2).Files().size());
+}
+
+TEST_F(UniversalCompactionTest, TestPick) {
+    UniversalCompaction compaction(/*max_size_amp=*/25, /*size_ratio=*/1,
+                                   /*num_run_compaction_trigger=*/3);
+    // by size amplification
+    std::optional<CompactUnit> unit = compaction.Pick(/*num_levels=*/3, Level0({1, 2, 3, 3}));
+    ASSERT_TRUE(unit);
+    ASSERT_EQ(std::vector<int64_t>({1, 2, 3, 3}), FileSizes(unit.value()));
+    ASSERT_EQ(2, unit->OutputLevel());
+
+    // by size ratio
+    unit = compaction.Pick(/*num_levels=*/3, Level0({1, 1, 1, 50}));
+    ASSERT_TRUE(unit);
+    ASSERT_EQ(std::vector<int64_t>({1, 1, 1, 50}), FileSizes(unit.value()));
+    ASSERT_EQ(2, unit->OutputLevel());
+
+    // by file num
+    unit = compaction.Pick(/*num_levels=*/4, CreateRuns({0, 0, 0, 1, 3}, {1, 5, 10, 50, 1000}));
+    ASSERT_TRUE(unit);
+    ASSERT_EQ(std::vector<int64_t>({1, 5, 10, 50}), FileSizes(unit.value()));
+    ASSERT_EQ(1, unit->OutputLevel());
+}
+
+TEST_F(UniversalCompactionTest, TestNoPick) {
+    UniversalCompaction compaction(/*max_size_amp=*/25, /*size_ratio=*/1,
+                                   /*num_run_compaction_trigger=*/3);
+    // less runs than trigger
+    ASSERT_FALSE(compaction.Pick(/*num_levels=*/3, Level0({1, 1})));
+    // neither size amplification nor size ratio reaches the threshold
+    ASSERT_FALSE(compaction.Pick(/*num_levels=*/3, CreateRuns({0, 1, 2}, {1, 10, 100})));
+}
+
+TEST_F(UniversalCompactionTest, TestSizeAmplification) {
+    UniversalCompaction compaction(/*max_size_amp=*/25, /*size_ratio=*/0,
+                                   /*num_run_compaction_trigger=*/1);
+    ASSERT_FALSE(compaction.PickForSizeAmp(/*max_level=*/2, CreateRuns({0, 2}, {1, 10})));
+    ASSERT_FALSE(compaction.PickForSizeAmp(/*max_level=*/2, CreateRuns({0, 1, 2}, {1, 1, 10})));
+    std::optional<CompactUnit> unit =
+        compaction.PickForSizeAmp(/*max_level=*/2, CreateRuns({0, 1, 2}, {1, 2, 10}));
+    ASSERT_TRUE(unit);
+    ASSERT_EQ(std::vector<int64_t>({1, 2, 10}), FileSizes(unit.value()));
+    ASSERT_EQ(2, unit->OutputLevel());
+}
+
+TEST_F(UniversalCompactionTest, TestSizeRatio) {
+    UniversalCompaction compaction(/*max_size_amp=*/25, /*size_ratio=*/10,
+                                   /*num_run_compaction_trigger=*/2);
+    ASSERT_FALSE(compaction.PickForSizeRatio(/*max_level=*/3, CreateRuns({0, 1}, {10, 12})));
+    std::optional<CompactUnit> unit =
+        compaction.PickForSizeRatio(/*max_level=*/3, CreateRuns({0, 0, 1, 3}, {10, 11, 23, 100}));
+    ASSERT_TRUE(unit);
+    ASSERT_EQ(std::vector<int64_t>({10, 11, 23}), FileSizes(unit.value()));
+    ASSERT_EQ(2, unit->OutputLevel());
+}
+
+TEST_F(UniversalCompactionTest, TestPickFullCompaction) {
+    ASSERT_FALSE(CompactStrategy::PickFullCompaction(/*num_levels=*/3, {}));
+    ASSERT_FALSE(CompactStrategy::PickFullCompaction(/*num_levels=*/3, CreateRuns({2}, {10})));
+    std::optional<CompactUnit> unit =
+        CompactStrategy::PickFullCompaction(/*num_levels=*/3, CreateRuns({1}, {10}));
+    ASSERT_TRUE(unit);
+    ASSERT_EQ(2, unit->OutputLevel());
+    unit = CompactStrategy::PickFullCompaction(/*num_levels=*/3, CreateRuns({0, 2}, {1, 10}));
+    ASSERT_TRUE(unit);
+    ASSERT_EQ(std::vector<int64_t>({1, 10}), FileSizes(unit.value()));
+    ASSERT_EQ(2, unit->OutputLevel());
+}
+
+}  // namespace paimon::test
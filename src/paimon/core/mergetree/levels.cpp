@@ -0,0 +1,173 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/levels.h"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <utility>
+
+#include "fmt/format.h"
+
+namespace paimon {
+
+Levels::Levels(const std::shared_ptr<FieldsComparator>& key_comparator, int32_t num_levels)
+    : key_comparator_(key_comparator), levels_(num_levels - 1, SortedRun::Empty()) {}
+
+Result<std::unique_ptr<Levels>> Levels::Create(
+    const std::shared_ptr<FieldsComparator>& key_comparator,
+    const std::vector<std::shared_ptr<DataFileMeta>>& input_files, int32_t num_levels) {
+    // in case the num of levels is not specified explicitly
+    int32_t restored_num_levels = num_levels;
+    for (const auto& file : input_files) {
+        restored_num_levels = std::max(restored_num_levels, file->level + 1);
+    }
+    if (restored_num_levels <= 1) {
+        return Status::Invalid(
+            fmt::format("Number of levels must be at least 2, but is {}.", restored_num_levels));
+    }
+    std::unique_ptr<Levels> levels(new Levels(key_comparator, restored_num_levels));
+    std::map<int32_t, std::vector<std::shared_ptr<DataFileMeta>>> level_map;
+    for (const auto& file : input_files) {
+        level_map[file->level].push_back(file);
+    }
+    for (const auto& [level, files] : level_map) {
+        PAIMON_RETURN_NOT_OK(levels->UpdateLevel(level, /*before=*/{}, files));
+    }
+    size_t stored_file_count = levels->level0_.size();
+    for (const auto& run : levels->levels_) {
+        stored_file_count += run.Files().size();
+    }
+    if (stored_file_count != input_files.size()) {
+        return Status::Invalid(fmt::format(
+            "Number of files stored in Levels ({}) does not equal to the size of input files "
+            "({}). This is unexpected.",
+            stored_file_count, input_files.size()));
+    }
+    return levels;
+}
+
+void Levels::AddLevel0File(const std::shared_ptr<DataFileMeta>& file) {
+    assert(file->level == 0);
+    level0_.insert(file);
+}
+
+int32_t Levels::NumberOfSortedRuns() const {
+    int32_t number_of_sorted_runs = level0_.size();
+    for (const auto& run : levels_) {
+        if (run.NonEmpty()) {
+            number_of_sorted_runs++;
+        }
+    }
+    return number_of_sorted_runs;
+}
+
+int32_t Levels::NonEmptyHighestLevel() const {
+    for (int32_t i = static_cast<int32_t>(levels_.size()) - 1; i >= 0; i--) {
+        if (levels_[i].NonEmpty()) {
+            return i + 1;
+        }
+    }
+    return level0_.empty() ? -1 : 0;
+}
+
+int64_t Levels::TotalFileSize() const {
+    int64_t total_size = 0;
+    for (const auto& file : level0_) {
+        total_size += file->file_size;
+    }
+    for (const auto& run : levels_) {
+        total_size += run.TotalSize();
+    }
+    return total_size;
+}
+
+std::vector<std::shared_ptr<DataFileMeta>> Levels::AllFiles() const {
+    std::vector<std::shared_ptr<DataFileMeta>> files;
+    for (const auto& run : LevelSortedRuns()) {
+        const auto& run_files = run.Run().Files();
+        files.insert(files.end(), run_files.begin(), run_files.end());
+    }
+    return files;
+}
+
+std::vector<LevelSortedRun> Levels::LevelSortedRuns() const {
+    std::vector<LevelSortedRun> runs;
+    runs.reserve(NumberOfSortedRuns());
+    for (const auto& file : level0_) {
+        runs.emplace_back(/*level=*/0, SortedRun::FromSingle(file));
+    }
+    for (size_t i = 0; i < levels_.size(); i++) {
+        if (levels_[i].NonEmpty()) {
+            runs.emplace_back(static_cast<int32_t>(i) + 1, levels_[i]);
+        }
+    }
+    return runs;
+}
+
+Status Levels::Update(const std::vector<std::shared_ptr<DataFileMeta>>& before,
+                      const std::vector<std::shared_ptr<DataFileMeta>>& after) {
+    std::map<int32_t, std::vector<std::shared_ptr<DataFileMeta>>> grouped_before;
+    for (const auto& file : before) {
+        grouped_before[file->level].push_back(file);
+    }
+    std::map<int32_t, std::vector<std::shared_ptr<DataFileMeta>>> grouped_after;
+    for (const auto& file : after) {
+        grouped_after[file->level].push_back(file);
+    }
+    for (int32_t i = 0; i < NumberOfLevels(); i++) {
+        PAIMON_RETURN_NOT_OK(UpdateLevel(i, grouped_before[i], grouped_after[i]));
+    }
+    return Status::OK();
+}
+
+Status Levels::UpdateLevel(int32_t level, const std::vector<std::shared_ptr<DataFileMeta>>& before,
+                           const std::vector<std::shared_ptr<DataFileMeta>>& after) {
+    if (before.empty() && after.empty()) {
+        return Status::OK();
+    }
+    if (level == 0) {
+        for (const auto& file : before) {
+            level0_.erase(file);
+        }
+        level0_.insert(after.begin(), after.end());
+        return Status::OK();
+    }
+    if (level >= NumberOfLevels()) {
+        return Status::Invalid(
+            fmt::format("level {} exceeds max level {} of levels", level, MaxLevel()));
+    }
+    std::vector<std::shared_ptr<DataFileMeta>> files;
+    for (const auto& file : RunOfLevel(level).Files()) {
+        auto iter = std::find_if(
+            before.begin(), before.end(),
+            [&file](const std::shared_ptr<DataFileMeta>& removed) { return *removed == *file; });
+        if (iter == before.end()) {
+            files.push_back(file);
+        }
+    }
+    files.insert(files.end(), after.begin(), after.end());
+    SortedRun run = SortedRun::FromUnsorted(files, key_comparator_);
+    if (!run.IsValid(key_comparator_)) {
+        return Status::Invalid(
+            fmt::format("files of level {} are overlapping, this is unexpected", level));
+    }
+    levels_[level - 1] = std::move(run);
+    return Status::OK();
+}
+
+}  // namespace paimon
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/mergetree/level_sorted_run.h"
+#include "paimon/core/mergetree/sorted_run.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class FieldsComparator;
+
+/// A class which stores all level files of merge tree. Level 0 files are kept one file one sorted
+/// run, ordered by max sequence number descending. Each level above 0 is a single sorted run.
+class Levels {
+ public:
+    /// @param key_comparator comparator of `DataFileMeta::min_key` and `DataFileMeta::max_key`
+    /// @param input_files restored files, their levels decide where they are placed
+    /// @param num_levels expected number of levels, enlarged if `input_files` contain higher level
+    static Result<std::unique_ptr<Levels>> Create(
+        const std::shared_ptr<FieldsComparator>& key_comparator,
+        const std::vector<std::shared_ptr<DataFileMeta>>& input_files, int32_t num_levels);
+
+    void AddLevel0File(const std::shared_ptr<DataFileMeta>& file);
+
+    std::vector<std::shared_ptr<DataFileMeta>> Level0() const {
+        return std::vector<std::shared_ptr<DataFileMeta>>(level0_.begin(), level0_.end());
+    }
+
+    /// Returns the sorted run of `level`, `level` must be in [1, MaxLevel()].
+    const SortedRun& RunOfLevel(int32_t level) const {
+        return levels_[level - 1];
+    }
+
+    int32_t NumberOfLevels() const {
+        return static_cast<int32_t>(levels_.size()) + 1;
+    }
+
+    int32_t MaxLevel() const {
+        return static_cast<int32_t>(levels_.size());
+    }
+
+    int32_t NumberOfSortedRuns() const;
+
+    /// @return the highest non-empty level or -1 if all levels are empty.
+    int32_t NonEmptyHighestLevel() const;
+
+    int64_t TotalFileSize() const;
+
+    std::vector<std::shared_ptr<DataFileMeta>> AllFiles() const;
+
+    std::vector<LevelSortedRun> LevelSortedRuns() const;
+
+    Status Update(const std::vector<std::shared_ptr<DataFileMeta>>& before,
+                  const std::vector<std::shared_ptr<DataFileMeta>>& after);
+
+ private:
+    struct Level0Comparator {
+        bool operator()(const std::shared_ptr<DataFileMeta>& lhs,
+                        const std::shared_ptr<DataFileMeta>& rhs) const {
+            if (lhs->max_sequence_number != rhs->max_sequence_number) {
+                // file with larger sequence number should be in front
+                return lhs->max_sequence_number > rhs->max_sequence_number;
+            }
+            // When two or more jobs are writing the same merge tree, it is possible that multiple
+            // files have the same max sequence number. In this case we have to compare their
+            // min sequence numbers and file names so that these files won't be "de-duplicated" by
+            // the set.
+            if (lhs->min_sequence_number != rhs->min_sequence_number) {
+                return lhs->min_sequence_number < rhs->min_sequence_number;
+            }
+            return lhs->file_name < rhs->file_name;
+        }
+    };
+
+    Levels(const std::shared_ptr<FieldsComparator>& key_comparator, int32_t num_levels);
+
+    Status UpdateLevel(int32_t level, const std::vector<std::shared_ptr<DataFileMeta>>& before,
+                       const std::vector<std::shared_ptr<DataFileMeta>>& after);
+
+ private:
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    std::set<std::shared_ptr<DataFileMeta>, Level0Comparator> level0_;
+    std::vector<SortedRun> levels_;
+};
+}  // namespace paimon
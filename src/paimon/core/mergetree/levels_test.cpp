@@ -0,0 +1,165 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/levels.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/type_fwd.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/binary_row_writer.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class LevelsTest : public testing::Test {
+ public:
+    void SetUp() override {
+        ASSERT_OK_AND_ASSIGN(comparator_, FieldsComparator::Create(
+                                              {DataField(0, arrow::field("test", arrow::int32()))},
+                                              /*is_ascending_order=*/true, /*use_view=*/false));
+        pool_ = GetDefaultPool();
+    }
+
+    std::shared_ptr<DataFileMeta> NewFile(const std::string& name, int32_t level, int32_t min_key,
+                                          int32_t max_key, int64_t max_sequence_number) const {
+        BinaryRow min_row(1);
+        BinaryRowWriter min_writer(&min_row, /*initial_size=*/20, pool_.get());
+        min_writer.WriteInt(0, min_key);
+        min_writer.Complete();
+
+        BinaryRow max_row(1);
+        BinaryRowWriter max_writer(&max_row, /*initial_size=*/20, pool_.get());
+        max_writer.WriteInt(0, max_key);
+        max_writer.Complete();
+
+        return std::make_shared<DataFileMeta>(
+            name, /*file_size=*/max_key - min_key + 1, /*row_count=*/max_key - min_key + 1,
+            min_row, max_row, SimpleStats::EmptyStats(), SimpleStats::EmptyStats(),
+            /*min_sequence_number=*/0, max_sequence_number, /*schema_id=*/0, level,
+            /*extra_files=*/std::vector<std::optional<std::string>>(), Timestamp(0, 0),
+            /*delete_row_count=*/0, /*embedded_index=*/nullptr, FileSource::Append(),
+            /*value_stats_cols=*/std::nullopt,
+            /*external_path=*/std::nullopt, /*first_row_id=*/std::nullopt,
+            /*write_cols=*/std::nullopt);
+    }
+
+    static std::vector<std::string> FileNames(
+        const std::vector<std::shared_ptr<DataFileMeta>>& files) {
+        std::vector<std::string> names;
+        for (const auto& file : files) {
+            names.push_back(file->file_name);
+        }
+        return names;
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<FieldsComparator> comparator_;
+};
+
+TEST_F(LevelsTest, TestRestore) {
+    auto a = NewFile("a", /*level=*/0, 0, 9, /*max_sequence_number=*/9);
+    auto b = NewFile("b", /*level=*/0, 5, 14, /*max_sequence_number=*/19);
+    auto c = NewFile("c", /*level=*/1, 11, 20, /*max_sequence_number=*/5);
+    auto d = NewFile("d", /*level=*/1, 0, 10, /*max_sequence_number=*/5);
+    auto e = NewFile("e", /*level=*/2, 0, 99, /*max_sequence_number=*/1);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<Levels> levels,
+                         Levels::Create(comparator_, {a, b, c, d, e}, /*num_levels=*/3));
+    ASSERT_EQ(3, levels->NumberOfLevels());
+    ASSERT_EQ(2, levels->MaxLevel());
+    ASSERT_EQ(4, levels->NumberOfSortedRuns());
+    ASSERT_EQ(2, levels->NonEmptyHighestLevel());
+    ASSERT_EQ(10 + 10 + 10 + 11 + 100, levels->TotalFileSize());
+    // level 0 is ordered by max sequence number descending, other levels by min key
+    ASSERT_EQ(std::vector<std::string>({"b", "a"}), FileNames(levels->Level0()));
+    ASSERT_EQ(std::vector<std::string>({"d", "c"}), FileNames(levels->RunOfLevel(1).Files()));
+    ASSERT_EQ(std::vector<std::string>({"b", "a", "d", "c", "e"}), FileNames(levels->AllFiles()));
+
+    std::vector<LevelSortedRun> runs = levels->LevelSortedRuns();
+    ASSERT_EQ(4, runs.size());
+    ASSERT_EQ(0, runs[0].Level());
+    ASSERT_EQ(0, runs[1].Level());
+    ASSERT_EQ(1, runs[2].Level());
+    ASSERT_EQ(2, runs[3].Level());
+}
+
+TEST_F(LevelsTest, TestEmptyAndEnlargedLevels) {
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<Levels> levels,
+                         Levels::Create(comparator_, {}, /*num_levels=*/3));
+    ASSERT_EQ(-1, levels->NonEmptyHighestLevel());
+    ASSERT_EQ(0, levels->NumberOfSortedRuns());
+    ASSERT_TRUE(levels->LevelSortedRuns().empty());
+
+    levels->AddLevel0File(NewFile("a", /*level=*/0, 0, 9, /*max_sequence_number=*/9));
+    ASSERT_EQ(0, levels->NonEmptyHighestLevel());
+    ASSERT_EQ(1, levels->NumberOfSortedRuns());
+
+    // restored files with higher level than expected enlarge the levels
+    ASSERT_OK_AND_ASSIGN(
+        levels, Levels::Create(comparator_,
+                               {NewFile("b", /*level=*/4, 0, 9, /*max_sequence_number=*/9)},
+                               /*num_levels=*/3));
+    ASSERT_EQ(5, levels->NumberOfLevels());
+    ASSERT_EQ(4, levels->NonEmptyHighestLevel());
+}
+
+TEST_F(LevelsTest, TestOverlappedFilesInLevel) {
+    auto a = NewFile("a", /*level=*/1, 0, 10, /*max_sequence_number=*/9);
+    auto b = NewFile("b", /*level=*/1, 10, 20, /*max_sequence_number=*/19);
+    ASSERT_NOK(Levels::Create(comparator_, {a, b}, /*num_levels=*/3));
+}
+
+TEST_F(LevelsTest, TestUpdate) {
+    auto a = NewFile("a", /*level=*/0, 0, 9, /*max_sequence_number=*/9);
+    auto b = NewFile("b", /*level=*/0, 5, 14, /*max_sequence_number=*/19);
+    auto c = NewFile("c", /*level=*/1, 0, 10, /*max_sequence_number=*/5);
+    auto e = NewFile("e", /*level=*/2, 0, 99, /*max_sequence_number=*/1);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<Levels> levels,
+                         Levels::Create(comparator_, {a, b, c, e}, /*num_levels=*/3));
+
+    // rewrite level 0 and level 1 files to level 1
+    auto f = NewFile("f", /*level=*/1, 0, 14, /*max_sequence_number=*/19);
+    ASSERT_OK(levels->Update({a, b, c}, {f}));
+    ASSERT_TRUE(levels->Level0().empty());
+    ASSERT_EQ(std::vector<std::string>({"f"}), FileNames(levels->RunOfLevel(1).Files()));
+    ASSERT_EQ(2, levels->NumberOfSortedRuns());
+
+    // upgrade a new level 0 file to level 1 without overlapping
+    auto g = NewFile("g", /*level=*/0, 20, 29, /*max_sequence_number=*/29);
+    levels->AddLevel0File(g);
+    ASSERT_OK(levels->Update({g}, {g->Upgrade(1)}));
+    ASSERT_TRUE(levels->Level0().empty());
+    ASSERT_EQ(std::vector<std::string>({"f", "g"}), FileNames(levels->RunOfLevel(1).Files()));
+
+    // files of level 1 must not overlap
+    auto h = NewFile("h", /*level=*/1, 25, 39, /*max_sequence_number=*/39);
+    ASSERT_NOK(levels->Update({}, {h}));
+}
+
+}  // namespace paimon::test
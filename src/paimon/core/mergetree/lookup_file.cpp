@@ -0,0 +1,251 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/lookup_file.h"
+
+#include <utility>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/type.h"
+#include "fmt/format.h"
+#include "paimon/common/data/columnar/columnar_row.h"
+#include "paimon/common/file_index/bloomfilter/fast_hash.h"
+#include "paimon/common/reader/reader_utils.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/types/row_kind.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/split_block_bloom_filter.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/utils/roaring_bitmap32.h"
+
+namespace paimon {
+Result<std::unique_ptr<LookupKeyHasher>> LookupKeyHasher::Create(
+    const std::vector<DataField>& key_fields, const std::shared_ptr<MemoryPool>& pool) {
+    std::vector<InternalRow::FieldGetterFunc> getters;
+    std::vector<BinaryRowWriter::FieldSetterFunc> setters;
+    for (size_t i = 0; i < key_fields.size(); ++i) {
+        const auto& type = key_fields[i].Type();
+        PAIMON_ASSIGN_OR_RAISE(InternalRow::FieldGetterFunc getter,
+                               InternalRow::CreateFieldGetter(i, type, /*use_view=*/true));
+        PAIMON_ASSIGN_OR_RAISE(BinaryRowWriter::FieldSetterFunc setter,
+                               BinaryRowWriter::CreateFieldSetter(i, type));
+        getters.push_back(std::move(getter));
+        setters.push_back(std::move(setter));
+    }
+    return std::unique_ptr<LookupKeyHasher>(new LookupKeyHasher(
+        static_cast<int32_t>(key_fields.size()), std::move(getters), std::move(setters), pool));
+}
+
+LookupKeyHasher::LookupKeyHasher(int32_t key_arity,
+                                 std::vector<InternalRow::FieldGetterFunc>&& getters,
+                                 std::vector<BinaryRowWriter::FieldSetterFunc>&& setters,
+                                 const std::shared_ptr<MemoryPool>& pool)
+    : getters_(std::move(getters)),
+      setters_(std::move(setters)),
+      row_(key_arity),
+      writer_(&row_, /*initial_size=*/1024, pool.get()) {}
+
+int64_t LookupKeyHasher::Hash(const InternalRow& key) {
+    writer_.Reset();
+    for (size_t i = 0; i < getters_.size(); ++i) {
+        if (key.IsNullAt(i)) {
+            writer_.SetNullAt(i);
+        } else {
+            setters_[i](getters_[i](key), &writer_);
+        }
+    }
+    writer_.Complete();
+    return FastHash::GetLongHash(row_.HashCode());
+}
+
+LookupFile::LookupFile(int32_t level, const std::shared_ptr<FieldsComparator>& key_comparator,
+                       const std::shared_ptr<MemoryPool>& pool)
+    : level_(level), key_comparator_(key_comparator), pool_(pool) {}
+
+LookupFile::~LookupFile() = default;
+
+Result<std::unique_ptr<LookupFile>> LookupFile::Create(
+    std::unique_ptr<BatchReader>&& reader, int32_t key_arity,
+    const std::shared_ptr<arrow::Schema>& value_schema, int32_t level,
+    const std::shared_ptr<FieldsComparator>& key_comparator, LookupKeyHasher* key_hasher,
+    const std::shared_ptr<MemoryPool>& pool) {
+    std::unique_ptr<LookupFile> lookup_file(new LookupFile(level, key_comparator, pool));
+    PAIMON_RETURN_NOT_OK(lookup_file->Load(std::move(reader), key_arity, value_schema, key_hasher));
+    return lookup_file;
+}
+
+Status LookupFile::Load(std::unique_ptr<BatchReader>&& reader, int32_t key_arity,
+                        const std::shared_ptr<arrow::Schema>& value_schema,
+                        LookupKeyHasher* key_hasher) {
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatchWithBitmap batch_with_bitmap,
+                               reader->NextBatchWithBitmap());
+        if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+            break;
+        }
+        auto& [batch, bitmap] = batch_with_bitmap;
+        auto& [c_array, c_schema] = batch;
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                          arrow::ImportArray(c_array.get(), c_schema.get()));
+        if (bitmap.IsEmpty()) {
+            continue;
+        }
+        // sliced arrays share buffers of the read batch, only count them once
+        memory_size_ += MemorySizeOf(*array->data());
+        if (bitmap.Cardinality() == array->length()) {
+            PAIMON_RETURN_NOT_OK(AddBatch(array, key_arity, value_schema));
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(arrow::ArrayVector valid_arrays,
+                               ReaderUtils::GenerateFilteredArrayVector(array, bitmap));
+        for (const auto& valid_array : valid_arrays) {
+            PAIMON_RETURN_NOT_OK(AddBatch(valid_array, key_arity, value_schema));
+        }
+    }
+    reader->Close();
+    if (row_count_ == 0) {
+        return Status::OK();
+    }
+    bloom_filter_ = std::make_unique<SplitBlockBloomFilter>(row_count_, BLOOM_FILTER_FPP, pool_);
+    std::vector<int64_t> hashes;
+    for (const auto& batch : batches_) {
+        ColumnarRow key(batch.key_fields, pool_, /*row_id=*/0);
+        int64_t length = batch.row_kind_array->length();
+        hashes.resize(length);
+        for (int64_t row_id = 0; row_id < length; ++row_id) {
+            key.SetRowId(row_id);
+            hashes[row_id] = key_hasher->Hash(key);
+        }
+        bloom_filter_->AddHashes(hashes.data(), length);
+    }
+    memory_size_ += bloom_filter_->GetBytes()->size();
+    return Status::OK();
+}
+
+Status LookupFile::AddBatch(const std::shared_ptr<arrow::Array>& array, int32_t key_arity,
+                            const std::shared_ptr<arrow::Schema>& value_schema) {
+    auto data_batch = std::dynamic_pointer_cast<arrow::StructArray>(array);
+    if (!data_batch) {
+        return Status::Invalid("cannot cast data batch of lookup file to struct arrow array");
+    }
+    Batch batch;
+    batch.sequence_number_array =
+        std::dynamic_pointer_cast<arrow::NumericArray<arrow::Int64Type>>(data_batch->field(0));
+    if (!batch.sequence_number_array) {
+        return Status::Invalid("cannot cast SEQUENCE_NUMBER column to int64 arrow array");
+    }
+    batch.row_kind_array =
+        std::dynamic_pointer_cast<arrow::NumericArray<arrow::Int8Type>>(data_batch->field(1));
+    if (!batch.row_kind_array) {
+        return Status::Invalid("cannot cast VALUE_KIND column to int8 arrow array");
+    }
+    batch.key_fields.reserve(key_arity);
+    for (int32_t i = 0; i < key_arity; i++) {
+        batch.key_fields.push_back(
+            data_batch->field(i + SpecialFields::KEY_VALUE_SPECIAL_FIELD_COUNT));
+    }
+    arrow::ArrayVector value_fields;
+    value_fields.reserve(value_schema->num_fields());
+    for (const auto& value_field : value_schema->fields()) {
+        auto field_array = data_batch->GetFieldByName(value_field->name());
+        if (!field_array) {
+            return Status::Invalid(
+                fmt::format("cannot find field {} in data batch", value_field->name()));
+        }
+        value_fields.push_back(field_array);
+    }
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        batch.value_struct_array,
+        arrow::StructArray::Make(value_fields, value_schema->field_names()));
+    batch.value_fields = batch.value_struct_array->fields();
+    row_count_ += data_batch->length();
+    batches_.push_back(std::move(batch));
+    return Status::OK();
+}
+
+Status LookupFile::Lookup(const InternalRow& key, int64_t key_hash,
+                          std::vector<KeyValue>* key_values) const {
+    if (row_count_ == 0 || !bloom_filter_->TestHash(key_hash)) {
+        return Status::OK();
+    }
+    // find the first batch whose last key is not less than key
+    size_t low = 0;
+    size_t high = batches_.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        const Batch& batch = batches_[mid];
+        ColumnarRow last_key(batch.key_fields, pool_, batch.row_kind_array->length() - 1);
+        if (key_comparator_->CompareTo(last_key, key) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == batches_.size()) {
+        return Status::OK();
+    }
+    // find the first row whose key is not less than key in the batch
+    const Batch& batch = batches_[low];
+    ColumnarRow file_key(batch.key_fields, pool_, /*row_id=*/0);
+    int64_t row_low = 0;
+    int64_t row_high = batch.row_kind_array->length();
+    while (row_low < row_high) {
+        int64_t mid = row_low + (row_high - row_low) / 2;
+        file_key.SetRowId(mid);
+        if (key_comparator_->CompareTo(file_key, key) < 0) {
+            row_low = mid + 1;
+        } else {
+            row_high = mid;
+        }
+    }
+    file_key.SetRowId(row_low);
+    if (key_comparator_->CompareTo(file_key, key) != 0) {
+        return Status::OK();
+    }
+    PAIMON_ASSIGN_OR_RAISE(const RowKind* row_kind,
+                           RowKind::FromByteValue(batch.row_kind_array->Value(row_low)));
+    key_values->emplace_back(
+        row_kind, batch.sequence_number_array->Value(row_low), level_,
+        std::make_shared<ColumnarRow>(batch.key_fields, pool_, row_low),
+        std::make_unique<ColumnarRow>(batch.value_struct_array, batch.value_fields, pool_,
+                                      row_low));
+    return Status::OK();
+}
+
+int64_t LookupFile::MemorySizeOf(const arrow::ArrayData& array_data) {
+    int64_t memory_size = 0;
+    for (const auto& buffer : array_data.buffers) {
+        if (buffer) {
+            memory_size += buffer->size();
+        }
+    }
+    for (const auto& child : array_data.child_data) {
+        memory_size += MemorySizeOf(*child);
+    }
+    if (array_data.dictionary) {
+        memory_size += MemorySizeOf(*array_data.dictionary);
+    }
+    return memory_size;
+}
+
+}  // namespace paimon
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/type_fwd.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/binary_row_writer.h"
+#include "paimon/common/data/internal_row.h"
+#include "paimon/core/key_value.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Array;
+class Int64Type;
+class Int8Type;
+class Schema;
+class StructArray;
+template <typename TypeClass>
+class NumericArray;
+}  // namespace arrow
+
+namespace paimon {
+class DataField;
+class FieldsComparator;
+class MemoryPool;
+class SplitBlockBloomFilter;
+
+/// Hashes keys through their `BinaryRow` form, so that equal keys get the same hash no matter
+/// which arrays they come from. Not thread-safe, as the serialized row is reused.
+class LookupKeyHasher {
+ public:
+    static Result<std::unique_ptr<LookupKeyHasher>> Create(const std::vector<DataField>& key_fields,
+                                                           const std::shared_ptr<MemoryPool>& pool);
+
+    int64_t Hash(const InternalRow& key);
+
+ private:
+    LookupKeyHasher(int32_t key_arity, std::vector<InternalRow::FieldGetterFunc>&& getters,
+                    std::vector<BinaryRowWriter::FieldSetterFunc>&& setters,
+                    const std::shared_ptr<MemoryPool>& pool);
+
+    std::vector<InternalRow::FieldGetterFunc> getters_;
+    std::vector<BinaryRowWriter::FieldSetterFunc> setters_;
+    BinaryRow row_;
+    BinaryRowWriter writer_;
+};
+
+/// In-memory lookup structure of a data file of primary-key table. Rows of a data file are sorted
+/// by key and keys are unique, so the batches read from the file are kept as is (deleted rows are
+/// dropped) and keys are searched by binary search, first over the last keys of batches and then
+/// within a batch. A bloom filter of key hashes is checked first to skip most of the absent keys.
+class LookupFile {
+ public:
+    /// @param reader reader of the file, see `KeyValueFileReaderFactory::CreateBatchReader()`
+    /// @param key_arity number of trimmed primary keys
+    /// @param value_schema schema of member value in returned KeyValue objects
+    /// @param level level of the file
+    /// @param key_comparator comparator of keys, used to search keys in the file
+    /// @param key_hasher hasher of keys, used to build the bloom filter
+    /// @param pool memory pool of the file reader
+    static Result<std::unique_ptr<LookupFile>> Create(
+        std::unique_ptr<BatchReader>&& reader, int32_t key_arity,
+        const std::shared_ptr<arrow::Schema>& value_schema, int32_t level,
+        const std::shared_ptr<FieldsComparator>& key_comparator, LookupKeyHasher* key_hasher,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    ~LookupFile();
+
+    /// Append the key value of `key` in this file to `key_values` if present, the key and value of
+    /// the appended KeyValue object refer to the batches of this file.
+    ///
+    /// @param key the key to look up
+    /// @param key_hash hash of `key` from `LookupKeyHasher::Hash()`
+    /// @param key_values output key values
+    Status Lookup(const InternalRow& key, int64_t key_hash,
+                  std::vector<KeyValue>* key_values) const;
+
+    int64_t RowCount() const {
+        return row_count_;
+    }
+
+    /// @return Memory size of the loaded batches and the bloom filter.
+    int64_t MemorySize() const {
+        return memory_size_;
+    }
+
+ private:
+    LookupFile(int32_t level, const std::shared_ptr<FieldsComparator>& key_comparator,
+               const std::shared_ptr<MemoryPool>& pool);
+
+    Status Load(std::unique_ptr<BatchReader>&& reader, int32_t key_arity,
+                const std::shared_ptr<arrow::Schema>& value_schema, LookupKeyHasher* key_hasher);
+
+    Status AddBatch(const std::shared_ptr<arrow::Array>& array, int32_t key_arity,
+                    const std::shared_ptr<arrow::Schema>& value_schema);
+
+    static int64_t MemorySizeOf(const arrow::ArrayData& array_data);
+
+    static constexpr double BLOOM_FILTER_FPP = 0.05;
+
+    struct Batch {
+        arrow::ArrayVector key_fields;
+        std::shared_ptr<arrow::StructArray> value_struct_array;
+        arrow::ArrayVector value_fields;
+        std::shared_ptr<arrow::NumericArray<arrow::Int64Type>> sequence_number_array;
+        std::shared_ptr<arrow::NumericArray<arrow::Int8Type>> row_kind_array;
+    };
+
+ private:
+    int32_t level_;
+    int64_t row_count_ = 0;
+    int64_t memory_size_ = 0;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    std::shared_ptr<MemoryPool> pool_;
+    std::vector<Batch> batches_;
+    std::unique_ptr<SplitBlockBloomFilter> bloom_filter_;
+};
+}  // namespace paimon
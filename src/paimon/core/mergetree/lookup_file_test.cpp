@@ -0,0 +1,152 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/lookup_file.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/columnar/columnar_row.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/types/row_kind.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/mock/mock_file_batch_reader.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class LookupFileTest : public testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        key_fields_ = {DataField(0, arrow::field("k", arrow::int32()))};
+        value_schema_ = arrow::schema(
+            {arrow::field("k", arrow::int32()), arrow::field("v", arrow::utf8())});
+        file_type_ = arrow::struct_({SpecialFields::SequenceNumber().ArrowField(),
+                                     SpecialFields::ValueKind().ArrowField(),
+                                     arrow::field("_KEY_k", arrow::int32()),
+                                     arrow::field("k", arrow::int32()),
+                                     arrow::field("v", arrow::utf8())});
+        ASSERT_OK_AND_ASSIGN(comparator_,
+                             FieldsComparator::Create(key_fields_, /*is_ascending_order=*/true,
+                                                      /*use_view=*/false));
+        ASSERT_OK_AND_ASSIGN(hasher_, LookupKeyHasher::Create(key_fields_, pool_));
+    }
+
+    std::unique_ptr<LookupFile> CreateLookupFile(const std::string& data_json,
+                                                 const RoaringBitmap32& bitmap,
+                                                 int32_t batch_size) const {
+        auto data =
+            arrow::ipc::internal::json::ArrayFromJSON(file_type_, data_json).ValueOrDie();
+        auto reader = std::make_unique<MockFileBatchReader>(data, file_type_, bitmap, batch_size);
+        reader->EnableRandomizeBatchSize(false);
+        auto result = LookupFile::Create(std::move(reader), /*key_arity=*/1, value_schema_,
+                                         /*level=*/2, comparator_, hasher_.get(), pool_);
+        EXPECT_OK(result.status());
+        return std::move(result).value();
+    }
+
+    // Returns the value of key `k`, or "absent" if `k` is not found.
+    std::string LookupValue(const LookupFile& lookup_file, int32_t k) const {
+        auto key_array = arrow::ipc::internal::json::ArrayFromJSON(
+                             arrow::int32(), "[" + std::to_string(k) + "]")
+                             .ValueOrDie();
+        ColumnarRow key({key_array}, pool_, /*row_id=*/0);
+        std::vector<KeyValue> key_values;
+        EXPECT_OK(lookup_file.Lookup(key, hasher_->Hash(key), &key_values));
+        if (key_values.empty()) {
+            return "absent";
+        }
+        EXPECT_EQ(key_values.size(), 1);
+        const KeyValue& kv = key_values[0];
+        EXPECT_EQ(kv.level, 2);
+        EXPECT_EQ(kv.key->GetInt(0), k);
+        EXPECT_EQ(kv.value->GetInt(0), k);
+        return kv.value_kind->ShortString() + std::to_string(kv.sequence_number) + ":" +
+               kv.value->GetString(1).ToString();
+    }
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::vector<DataField> key_fields_;
+    std::shared_ptr<arrow::Schema> value_schema_;
+    std::shared_ptr<arrow::DataType> file_type_;
+    std::shared_ptr<FieldsComparator> comparator_;
+    std::unique_ptr<LookupKeyHasher> hasher_;
+};
+
+TEST_F(LookupFileTest, TestLookup) {
+    std::string data_json = R"([
+        [10, 0, 1, 1, "a"],
+        [11, 0, 3, 3, "b"],
+        [12, 3, 5, 5, "c"],
+        [13, 0, 7, 7, "d"],
+        [14, 2, 9, 9, "e"]
+    ])";
+    RoaringBitmap32 bitmap;
+    bitmap.AddRange(0, 5);
+    for (int32_t batch_size : {1, 2, 10}) {
+        auto lookup_file = CreateLookupFile(data_json, bitmap, batch_size);
+        ASSERT_EQ(lookup_file->RowCount(), 5);
+        ASSERT_GT(lookup_file->MemorySize(), 0);
+        ASSERT_EQ(LookupValue(*lookup_file, 1), "+I10:a");
+        ASSERT_EQ(LookupValue(*lookup_file, 3), "+I11:b");
+        ASSERT_EQ(LookupValue(*lookup_file, 5), "-D12:c");
+        ASSERT_EQ(LookupValue(*lookup_file, 7), "+I13:d");
+        ASSERT_EQ(LookupValue(*lookup_file, 9), "+U14:e");
+        for (int32_t absent : {0, 2, 4, 6, 8, 10}) {
+            ASSERT_EQ(LookupValue(*lookup_file, absent), "absent");
+        }
+    }
+}
+
+TEST_F(LookupFileTest, TestLookupWithDeletedRows) {
+    std::string data_json = R"([
+        [10, 0, 1, 1, "a"],
+        [11, 0, 3, 3, "b"],
+        [12, 0, 5, 5, "c"],
+        [13, 0, 7, 7, "d"]
+    ])";
+    // rows of key 3 and 7 are deleted by deletion vector
+    RoaringBitmap32 bitmap;
+    bitmap.Add(0);
+    bitmap.Add(2);
+    for (int32_t batch_size : {1, 2, 3, 10}) {
+        auto lookup_file = CreateLookupFile(data_json, bitmap, batch_size);
+        ASSERT_EQ(lookup_file->RowCount(), 2);
+        ASSERT_EQ(LookupValue(*lookup_file, 1), "+I10:a");
+        ASSERT_EQ(LookupValue(*lookup_file, 3), "absent");
+        ASSERT_EQ(LookupValue(*lookup_file, 5), "+I12:c");
+        ASSERT_EQ(LookupValue(*lookup_file, 7), "absent");
+    }
+}
+
+TEST_F(LookupFileTest, TestEmptyFile) {
+    auto lookup_file = CreateLookupFile("[[10, 0, 1, 1, \"a\"]]", RoaringBitmap32(),
+                                        /*batch_size=*/10);
+    ASSERT_EQ(lookup_file->RowCount(), 0);
+    ASSERT_EQ(LookupValue(*lookup_file, 1), "absent");
+}
+
+}  // namespace paimon::test
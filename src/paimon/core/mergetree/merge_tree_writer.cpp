@@ -19,6 +19,11 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <set>
+#include <system_error>
 #include <utility>
 
 #include "arrow/api.h"
@@ -31,26 +36,25 @@
 #include "arrow/util/checked_cast.h"
 #include "fmt/format.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/timer.h"
 #include "paimon/common/table/special_fields.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/arrow/status_utils.h"
-#include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/io/async_key_value_producer_and_consumer.h"
 #include "paimon/core/io/compact_increment.h"
 #include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/io/data_increment.h"
-#include "paimon/core/io/key_value_data_file_writer.h"
+#include "paimon/core/io/key_value_data_file_record_reader.h"
+#include "paimon/core/io/key_value_in_memory_batch_merger.h"
 #include "paimon/core/io/key_value_in_memory_record_reader.h"
 #include "paimon/core/io/key_value_meta_projection_consumer.h"
 #include "paimon/core/io/key_value_record_reader.h"
 #include "paimon/core/io/row_to_arrow_array_converter.h"
-#include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/manifest/file_source.h"
 #include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
+#include "paimon/core/operation/metrics/write_metrics.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/data/decimal.h"
-#include "paimon/format/file_format.h"
-#include "paimon/format/writer_builder.h"
 #include "paimon/metrics.h"
 
 namespace paimon {
@@ -58,7 +62,6 @@ class FieldsComparator;
 class MemoryPool;
 template <typename T>
 class MergeFunctionWrapper;
-class FormatStatsExtractor;
 
 MergeTreeWriter::MergeTreeWriter(
     int64_t last_sequence_number, const std::vector<std::string>& trimmed_primary_keys,
@@ -67,18 +70,19 @@ MergeTreeWriter::MergeTreeWriter(
     const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
     const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
     int64_t schema_id, const std::shared_ptr<arrow::Schema>& value_schema,
-    const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool)
+    const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool,
+    const std::shared_ptr<CompactManager>& compact_manager)
     : last_sequence_number_(last_sequence_number + 1),
       current_memory_in_bytes_(0),
       pool_(pool),
       trimmed_primary_keys_(trimmed_primary_keys),
       options_(options),
-      path_factory_(path_factory),
       key_comparator_(key_comparator),
       user_defined_seq_comparator_(user_defined_seq_comparator),
       merge_function_wrapper_(merge_function_wrapper),
-      schema_id_(schema_id),
+      value_schema_(value_schema),
       value_type_(arrow::struct_(value_schema->fields())),
+      compact_manager_(compact_manager),
       metrics_(std::make_shared<MetricsImpl>()) {
     arrow::FieldVector target_fields;
     target_fields.push_back(
@@ -87,6 +91,8 @@ MergeTreeWriter::MergeTreeWriter(
     target_fields.insert(target_fields.end(), value_schema->fields().begin(),
                          value_schema->fields().end());
     write_schema_ = arrow::schema(target_fields);
+    writer_factory_ = std::make_unique<KeyValueFileWriterFactory>(
+        schema_id, trimmed_primary_keys_, write_schema_, path_factory, options_, pool_);
 }
 
 Status MergeTreeWriter::Write(std::unique_ptr<RecordBatch>&& moved_batch) {
@@ -107,22 +113,164 @@ Status MergeTreeWriter::Write(std::unique_ptr<RecordBatch>&& moved_batch) {
     batch_vec_.push_back(std::move(value_struct_array));
     row_kinds_vec_.push_back(batch->GetRowKind());
     if (current_memory_in_bytes_ >= options_.GetWriteBufferSize()) {
-        return Flush();
+        return FlushMemory();
     }
     return Status::OK();
 }
 
+Status MergeTreeWriter::FlushMemory() {
+    if (batch_vec_.empty()) {
+        return Status::OK();
+    }
+    if (options_.WriteBufferSpillable() &&
+        spilled_size_in_bytes_ < options_.GetWriteBufferSpillMaxDiskSize()) {
+        return SpillWriteBuffer();
+    }
+    return Flush(/*wait_for_latest_compaction=*/false);
+}
+
 Result<CommitIncrement> MergeTreeWriter::PrepareCommit(bool wait_compaction) {
-    // TODO(xinyu.lxy): support wait_compaction
-    PAIMON_RETURN_NOT_OK(Flush());
+    PAIMON_RETURN_NOT_OK(Flush(wait_compaction));
+    if (compact_manager_->ShouldWaitForPreparingCheckpoint()) {
+        wait_compaction = true;
+    }
+    PAIMON_RETURN_NOT_OK(TrySyncLatestCompaction(wait_compaction));
     return DrainIncrement();
 }
 
-Status MergeTreeWriter::Flush() {
-    if (batch_vec_.empty()) {
+Status MergeTreeWriter::FlushForCommit() {
+    if (WriteBufferEmpty()) {
         return Status::OK();
     }
-    // 1. create key value iter for each record batch
+    if (compact_manager_->ShouldWaitForLatestCompaction()) {
+        wait_for_latest_compaction_ = true;
+    }
+    return FlushWriteBuffer();
+}
+
+Status MergeTreeWriter::Flush(bool wait_for_latest_compaction) {
+    if (wait_for_latest_compaction_) {
+        wait_for_latest_compaction = true;
+        wait_for_latest_compaction_ = false;
+    }
+    if (!WriteBufferEmpty()) {
+        if (compact_manager_->ShouldWaitForLatestCompaction()) {
+            wait_for_latest_compaction = true;
+        }
+        PAIMON_RETURN_NOT_OK(FlushWriteBuffer());
+    }
+    PAIMON_RETURN_NOT_OK(TrySyncLatestCompaction(wait_for_latest_compaction));
+    return compact_manager_->TriggerCompaction(/*full_compaction=*/false);
+}
+
+Status MergeTreeWriter::FlushWriteBuffer() {
+    ScopedTimer flush_timer(metrics_.get(), WriteMetrics::FLUSH_DURATION);
+    // consumer batch size is WriteBatchSize
+    int32_t batch_size = std::min(options_.GetWriteBatchSize(), MAX_PROJECTION_BATCH_SIZE);
+    // merged batches must outlive the rolling writer, as it may hold min/max keys of them
+    std::function<Result<KeyValueBatch>()> next_batch;
+    if (spilled_runs_.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(next_batch, MergeWriteBuffer(batch_size));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(next_batch, MergeWithSpilledRuns(batch_size));
+    }
+    auto rolling_writer = writer_factory_->CreateRollingWriter(/*level=*/0, FileSource::Append());
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(KeyValueBatch key_value_batch, next_batch());
+        if (key_value_batch.batch == nullptr) {
+            break;
+        }
+        PAIMON_RETURN_NOT_OK(rolling_writer->Write(std::move(key_value_batch)));
+    }
+    PAIMON_RETURN_NOT_OK(rolling_writer->Close());
+    spilled_runs_.clear();
+    spilled_size_in_bytes_ = 0;
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> flushed_files,
+                           rolling_writer->GetResult());
+    for (const auto& file : flushed_files) {
+        new_files_.push_back(file);
+        compact_manager_->AddNewFile(file);
+    }
+    metrics_->Merge(rolling_writer->GetMetrics());
+    return Status::OK();
+}
+
+Status MergeTreeWriter::SpillWriteBuffer() {
+    ScopedTimer spill_timer(metrics_.get(), WriteMetrics::SPILL_DURATION);
+    int32_t batch_size = std::min(options_.GetWriteBatchSize(), MAX_PROJECTION_BATCH_SIZE);
+    PAIMON_ASSIGN_OR_RAISE(std::function<Result<KeyValueBatch>()> next_batch,
+                           MergeWriteBuffer(batch_size));
+    std::optional<std::string> spill_dir = options_.GetWriteBufferSpillDir();
+    if (spill_dir == std::nullopt) {
+        std::error_code ec;
+        std::filesystem::path temp_dir = std::filesystem::temp_directory_path(ec);
+        if (ec) {
+            return Status::IOError(
+                fmt::format("cannot get temp directory for spilling: {}", ec.message()));
+        }
+        spill_dir = temp_dir.string();
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SpilledRun> run,
+                           SpilledRun::Write(spill_dir.value(), write_schema_, next_batch, pool_));
+    spilled_size_in_bytes_ += run->FileSize();
+    spilled_runs_.push_back(std::move(run));
+    return Status::OK();
+}
+
+Result<std::function<Result<KeyValueBatch>()>> MergeTreeWriter::MergeWriteBuffer(
+    int32_t batch_size) {
+    if (KeyValueInMemoryBatchMerger::IsSupported(options_)) {
+        return MergeByColumn(batch_size);
+    }
+    return MergeByRow(batch_size);
+}
+
+Result<std::function<Result<KeyValueBatch>()>> MergeTreeWriter::MergeByColumn(
+    int32_t batch_size) {
+    // merge engines which only select rows do not need to create key value for each row, select
+    // rows on sorted indices and gather them instead
+    int64_t first_sequence_number = last_sequence_number_;
+    for (const auto& batch : batch_vec_) {
+        last_sequence_number_ += batch->length();
+    }
+    current_memory_in_bytes_ = 0;
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<KeyValueInMemoryBatchMerger> merger,
+        KeyValueInMemoryBatchMerger::Create(first_sequence_number, std::move(batch_vec_),
+                                            std::move(row_kinds_vec_), trimmed_primary_keys_,
+                                            key_comparator_, write_schema_, batch_size, options_,
+                                            pool_));
+    batch_vec_.clear();
+    row_kinds_vec_.clear();
+    return [merger]() { return merger->NextBatch(); };
+}
+
+Result<std::function<Result<KeyValueBatch>()>> MergeTreeWriter::MergeByRow(int32_t batch_size) {
+    return MergeReaders(CreateInMemoryReaders(), batch_size);
+}
+
+Result<std::function<Result<KeyValueBatch>()>> MergeTreeWriter::MergeWithSpilledRuns(
+    int32_t batch_size) {
+    // spilled runs hold sequence numbers and row kinds of merged key values, read them back as
+    // data files and merge them with the remaining buffered batches
+    std::vector<std::unique_ptr<KeyValueRecordReader>> readers;
+    readers.reserve(spilled_runs_.size() + batch_vec_.size());
+    for (const auto& run : spilled_runs_) {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> batch_reader,
+                               run->CreateReader(trimmed_primary_keys_));
+        readers.push_back(std::make_unique<KeyValueDataFileRecordReader>(
+            std::move(batch_reader), static_cast<int32_t>(trimmed_primary_keys_.size()),
+            value_schema_, /*level=*/0, pool_));
+    }
+    std::vector<std::unique_ptr<KeyValueRecordReader>> in_memory_readers = CreateInMemoryReaders();
+    for (auto& reader : in_memory_readers) {
+        readers.push_back(std::move(reader));
+    }
+    return MergeReaders(std::move(readers), batch_size);
+}
+
+std::vector<std::unique_ptr<KeyValueRecordReader>> MergeTreeWriter::CreateInMemoryReaders() {
+    // create key value iter for each record batch
     std::vector<std::unique_ptr<KeyValueRecordReader>> readers;
     readers.reserve(batch_vec_.size());
     for (size_t i = 0; i < batch_vec_.size(); ++i) {
@@ -137,74 +285,106 @@ Status MergeTreeWriter::Flush() {
     batch_vec_.clear();
     row_kinds_vec_.clear();
     current_memory_in_bytes_ = 0;
-    // 2. prepare loser tree sort merge reader
+    return readers;
+}
+
+std::function<Result<KeyValueBatch>()> MergeTreeWriter::MergeReaders(
+    std::vector<std::unique_ptr<KeyValueRecordReader>>&& readers, int32_t batch_size) {
+    // 1. prepare loser tree sort merge reader
     auto sort_merge_reader = std::make_unique<SortMergeReaderWithLoserTree>(
         std::move(readers), key_comparator_, user_defined_seq_comparator_, merge_function_wrapper_);
-    // 3. project key value to arrow array
+    // 2. project key value to arrow array
     auto create_consumer = [target_schema = write_schema_, pool = pool_]()
         -> Result<std::unique_ptr<RowToArrowArrayConverter<KeyValue, KeyValueBatch>>> {
         return KeyValueMetaProjectionConsumer::Create(target_schema, pool);
     };
-    // consumer batch size is WriteBatchSize
     auto async_key_value_producer_consumer =
-        std::make_unique<AsyncKeyValueProducerAndConsumer<KeyValue, KeyValueBatch>>(
-            std::move(sort_merge_reader), create_consumer,
-            std::min(options_.GetWriteBatchSize(), MAX_PROJECTION_BATCH_SIZE),
+        std::make_shared<AsyncKeyValueProducerAndConsumer<KeyValue, KeyValueBatch>>(
+            std::move(sort_merge_reader), create_consumer, batch_size,
             /*projection_thread_num=*/1, pool_);
-    auto rolling_writer = CreateRollingRowWriter();
-    while (true) {
-        PAIMON_ASSIGN_OR_RAISE(KeyValueBatch key_value_batch,
-                               async_key_value_producer_consumer->NextBatch());
-        if (key_value_batch.batch == nullptr) {
-            break;
-        }
-        PAIMON_RETURN_NOT_OK(rolling_writer->Write(std::move(key_value_batch)));
-    }
-    PAIMON_RETURN_NOT_OK(rolling_writer->Close());
-    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> flushed_files,
-                           rolling_writer->GetResult());
-    new_files_.insert(new_files_.end(), flushed_files.begin(), flushed_files.end());
-    metrics_->Merge(rolling_writer->GetMetrics());
-    return Status::OK();
+    return [async_key_value_producer_consumer]() {
+        return async_key_value_producer_consumer->NextBatch();
+    };
 }
 
 Result<CommitIncrement> MergeTreeWriter::DrainIncrement() {
     DataIncrement data_increment(std::move(new_files_), std::move(deleted_files_), {});
-    CompactIncrement compact_increment({}, {}, {});
+    std::vector<std::shared_ptr<DataFileMeta>> compact_before;
+    compact_before.reserve(compact_before_.size());
+    for (const auto& [file_name, file] : compact_before_) {
+        compact_before.push_back(file);
+    }
+    CompactIncrement compact_increment(std::move(compact_before), std::move(compact_after_), {});
     new_files_.clear();
     deleted_files_.clear();
+    compact_before_.clear();
+    compact_after_.clear();
     return CommitIncrement(data_increment, compact_increment);
 }
 
-std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-MergeTreeWriter::CreateRollingRowWriter() const {
-    auto create_file_writer = [&]()
-        -> Result<std::unique_ptr<SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>> {
-        ::ArrowSchema arrow_schema;
-        ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
-        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*write_schema_, &arrow_schema));
-        auto format = options_.GetWriteFileFormat();
-        PAIMON_ASSIGN_OR_RAISE(
-            std::shared_ptr<WriterBuilder> writer_builder,
-            format->CreateWriterBuilder(&arrow_schema, options_.GetWriteBatchSize()));
-        writer_builder->WithMemoryPool(pool_);
-        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*write_schema_, &arrow_schema));
-        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
-                               format->CreateStatsExtractor(&arrow_schema));
-        auto converter = [](KeyValueBatch key_value_batch, ArrowArray* array) -> Status {
-            ArrowArrayMove(key_value_batch.batch.get(), array);
-            return Status::OK();
-        };
-        auto writer = std::make_unique<KeyValueDataFileWriter>(
-            options_.GetFileCompression(), converter, schema_id_, FileSource::Append(),
-            trimmed_primary_keys_, stats_extractor, write_schema_, path_factory_->IsExternalPath(),
-            pool_);
-        PAIMON_RETURN_NOT_OK(
-            writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
-        return writer;
-    };
-    return std::make_unique<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>(
-        options_.GetTargetFileSize(), create_file_writer);
+Status MergeTreeWriter::TrySyncLatestCompaction(bool blocking) {
+    PAIMON_ASSIGN_OR_RAISE(std::optional<CompactResult> result,
+                           compact_manager_->GetCompactionResult(blocking));
+    if (result) {
+        return UpdateCompactResult(result.value());
+    }
+    return Status::OK();
+}
+
+Status MergeTreeWriter::UpdateCompactResult(const CompactResult& result) {
+    std::set<std::string> after_files;
+    for (const auto& file : result.After()) {
+        after_files.insert(file->file_name);
+    }
+    // record the new files first, so that they are still cleaned up on close if deleting an
+    // intermediate file fails below
+    compact_after_.insert(compact_after_.end(), result.After().begin(), result.After().end());
+    for (const auto& file : result.Before()) {
+        auto iter = std::find_if(
+            compact_after_.begin(), compact_after_.end(),
+            [&file](const std::shared_ptr<DataFileMeta>& after) { return *after == *file; });
+        if (iter == compact_after_.end()) {
+            compact_before_.emplace(file->file_name, file);
+            continue;
+        }
+        compact_after_.erase(iter);
+        // This is an intermediate file (not a new data file), which is no longer needed after
+        // compaction and can be deleted directly, but upgrade file is required by previous
+        // snapshot and following snapshot, so we should ensure:
+        // 1. This file is not the output of upgraded.
+        // 2. This file is not the input of upgraded.
+        if (compact_before_.find(file->file_name) == compact_before_.end() &&
+            after_files.find(file->file_name) == after_files.end()) {
+            PAIMON_RETURN_NOT_OK(writer_factory_->DeleteFile(file));
+        }
+    }
+    return Status::OK();
+}
+
+Status MergeTreeWriter::DoClose() {
+    batch_vec_.clear();
+    row_kinds_vec_.clear();
+    spilled_runs_.clear();
+    spilled_size_in_bytes_ = 0;
+    // cancel compaction so that it does not block closing, a finished result still needs to be
+    // synced so that its files can be cleaned up below, a failure is reported after cleaning up
+    compact_manager_->CancelCompaction();
+    Status sync_status = TrySyncLatestCompaction(/*blocking=*/true);
+    PAIMON_RETURN_NOT_OK(compact_manager_->Close());
+    // delete temporary files which are not committed
+    std::vector<std::shared_ptr<DataFileMeta>> to_delete;
+    for (const auto& file : compact_after_) {
+        // upgrade file is required by previous snapshot, so we should ensure that this file is
+        // not the output of upgraded
+        if (compact_before_.find(file->file_name) == compact_before_.end()) {
+            to_delete.push_back(file);
+        }
+    }
+    compact_after_.clear();
+    for (const auto& file : to_delete) {
+        PAIMON_RETURN_NOT_OK(writer_factory_->DeleteFile(file));
+    }
+    return sync_status;
 }
 
 Result<int64_t> MergeTreeWriter::EstimateMemoryUse(const std::shared_ptr<arrow::Array>& array) {
@@ -16,17 +16,25 @@
 
 #pragma once
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "arrow/api.h"
+#include "paimon/core/compact/compact_manager.h"
+#include "paimon/core/compact/compact_result.h"
+#include "paimon/core/compact/noop_compact_manager.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/io/key_value_file_writer_factory.h"
+#include "paimon/core/io/key_value_record_reader.h"
 #include "paimon/core/io/rolling_file_writer.h"
 #include "paimon/core/key_value.h"
 #include "paimon/core/mergetree/compact/merge_function_wrapper.h"
+#include "paimon/core/mergetree/spilled_run.h"
 #include "paimon/core/utils/batch_writer.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/core/utils/fields_comparator.h"
@@ -52,6 +60,8 @@ class MergeFunctionWrapper;
 
 class MergeTreeWriter : public BatchWriter {
  public:
+    /// @param compact_manager manager of files in this bucket, new files are added to it after
+    /// flushing and compaction is triggered through it; no compaction by default
     MergeTreeWriter(int64_t last_sequence_number,
                     const std::vector<std::string>& trimmed_primary_keys,
                     const std::shared_ptr<DataFilePathFactory>& path_factory,
@@ -59,16 +69,24 @@ class MergeTreeWriter : public BatchWriter {
                     const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
                     const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
                     int64_t schema_id, const std::shared_ptr<arrow::Schema>& value_schema,
-                    const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool);
+                    const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool,
+                    const std::shared_ptr<CompactManager>& compact_manager =
+                        std::make_shared<NoopCompactManager>());
 
     ~MergeTreeWriter() override {
         [[maybe_unused]] auto status = DoClose();
     }
     Status Write(std::unique_ptr<RecordBatch>&& batch) override;
     Result<CommitIncrement> PrepareCommit(bool wait_compaction) override;
+    Status FlushForCommit() override;
+
+    int64_t MemoryOccupancy() const override {
+        return current_memory_in_bytes_;
+    }
+    Status FlushMemory() override;
 
     bool IsCompacting() const override {
-        return false;
+        return compact_manager_->CompactNotCompleted();
     }
 
     Status Close() override {
@@ -80,17 +98,34 @@ class MergeTreeWriter : public BatchWriter {
     }
 
  private:
-    Status DoClose() {
-        batch_vec_.clear();
-        row_kinds_vec_.clear();
-        return Status::OK();
+    Status DoClose();
+
+    bool WriteBufferEmpty() const {
+        return batch_vec_.empty() && spilled_runs_.empty();
     }
 
-    Status Flush();
+    Status Flush(bool wait_for_latest_compaction);
+    // sort and merge buffered batches and spilled runs into level 0 files, without touching
+    // compaction
+    Status FlushWriteBuffer();
+    // sort and merge buffered batches into a sorted run on local disk, used instead of flushing
+    // when write buffer is spillable
+    Status SpillWriteBuffer();
+    // merge buffered batches, merge engines which only select rows are merged column by column,
+    // others are merged row by row with merge function, both return a function to get next merged
+    // batch
+    Result<std::function<Result<KeyValueBatch>()>> MergeWriteBuffer(int32_t batch_size);
+    Result<std::function<Result<KeyValueBatch>()>> MergeByColumn(int32_t batch_size);
+    Result<std::function<Result<KeyValueBatch>()>> MergeByRow(int32_t batch_size);
+    // merge spilled runs with buffered batches row by row with loser tree
+    Result<std::function<Result<KeyValueBatch>()>> MergeWithSpilledRuns(int32_t batch_size);
+    std::vector<std::unique_ptr<KeyValueRecordReader>> CreateInMemoryReaders();
+    std::function<Result<KeyValueBatch>()> MergeReaders(
+        std::vector<std::unique_ptr<KeyValueRecordReader>>&& readers, int32_t batch_size);
     Result<CommitIncrement> DrainIncrement();
 
-    std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-    CreateRollingRowWriter() const;
+    Status TrySyncLatestCompaction(bool blocking);
+    Status UpdateCompactResult(const CompactResult& result);
     static Result<int64_t> EstimateMemoryUse(const std::shared_ptr<arrow::Array>& array);
 
     // in case write batch size is too large and overflow arrow array
@@ -102,20 +137,30 @@ class MergeTreeWriter : public BatchWriter {
     std::shared_ptr<MemoryPool> pool_;
     std::vector<std::string> trimmed_primary_keys_;
     CoreOptions options_;
-    std::shared_ptr<DataFilePathFactory> path_factory_;
     std::shared_ptr<FieldsComparator> key_comparator_;
     std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
     std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper_;
-    int64_t schema_id_;
     // write_schema = value_schema + special fields
+    std::shared_ptr<arrow::Schema> value_schema_;
     std::shared_ptr<arrow::DataType> value_type_;
     std::shared_ptr<arrow::Schema> write_schema_;
+    std::unique_ptr<KeyValueFileWriterFactory> writer_factory_;
+    std::shared_ptr<CompactManager> compact_manager_;
 
     std::vector<std::shared_ptr<arrow::StructArray>> batch_vec_;
     std::vector<std::vector<RecordBatch::RowKind>> row_kinds_vec_;
+    // sorted runs spilled from write buffer, merged into level 0 files at next flush
+    std::vector<std::unique_ptr<SpilledRun>> spilled_runs_;
+    int64_t spilled_size_in_bytes_ = 0;
+    // set when the write buffer is flushed for commit while too many level 0 files wait for
+    // compaction, the following flush in PrepareCommit waits for the latest compaction
+    bool wait_for_latest_compaction_ = false;
 
     std::shared_ptr<Metrics> metrics_;
     std::vector<std::shared_ptr<DataFileMeta>> new_files_;
     std::vector<std::shared_ptr<DataFileMeta>> deleted_files_;
+    // compact before files keyed by file name, ordered for deterministic commit messages
+    std::map<std::string, std::shared_ptr<DataFileMeta>> compact_before_;
+    std::vector<std::shared_ptr<DataFileMeta>> compact_after_;
 };
 }  // namespace paimon
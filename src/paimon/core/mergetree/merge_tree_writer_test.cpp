@@ -18,6 +18,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <filesystem>
 #include <map>
 #include <optional>
 #include <utility>
@@ -660,6 +661,169 @@ TEST_F(MergeTreeWriterTest, TestAutoFlush) {
     ASSERT_EQ(expected_data_increment, commit_increment.GetNewFilesIncrement());
 }
 
+TEST_F(MergeTreeWriterTest, TestSpillWriteBuffer) {
+    // each batch is spilled due to WRITE_BUFFER_SIZE, and all of them are merged into one file
+    ASSERT_OK_AND_ASSIGN(CoreOptions options,
+                         CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"},
+                                               {Options::WRITE_BUFFER_SIZE, "1"},
+                                               {Options::WRITE_BUFFER_SPILLABLE, "true"}}));
+
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+    std::string uuid = path_factory->uuid_;
+
+    auto merge_writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, options, pool_);
+    // batch1
+    std::shared_ptr<arrow::Array> array1 =
+        arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 14.1],
+      ["Paul", 20, 1, null],
+      ["Alice", 10, 0, 13.1],
+      ["Paul", 20, 1, 15.1]
+    ])")
+            .ValueOrDie();
+    WriteBatch(array1, /*row_kinds=*/{}, merge_writer.get());
+
+    // batch2
+    std::shared_ptr<arrow::Array> array2 =
+        arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 114.1],
+      ["Skye", 10, 0, 118.1],
+      ["Alice", 10, 0, 113.1]
+    ])")
+            .ValueOrDie();
+    WriteBatch(array2, /*row_kinds=*/{}, merge_writer.get());
+    ASSERT_TRUE(merge_writer->batch_vec_.empty());
+    ASSERT_EQ(2, merge_writer->spilled_runs_.size());
+    std::vector<std::string> spill_files;
+    for (const auto& run : merge_writer->spilled_runs_) {
+        ASSERT_TRUE(std::filesystem::exists(run->Path()));
+        spill_files.push_back(run->Path());
+    }
+    ASSERT_EQ(3, merge_writer->spilled_runs_[0]->RowCount());
+    ASSERT_EQ(3, merge_writer->spilled_runs_[1]->RowCount());
+
+    // prepare commit
+    ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
+                         merge_writer->PrepareCommit(/*wait_compaction=*/false));
+    ASSERT_TRUE(merge_writer->spilled_runs_.empty());
+    for (const auto& spill_file : spill_files) {
+        ASSERT_FALSE(std::filesystem::exists(spill_file));
+    }
+    ASSERT_OK(merge_writer->Close());
+
+    ASSERT_TRUE(commit_increment.GetCompactIncrement().IsEmpty());
+    const auto& new_files = commit_increment.GetNewFilesIncrement().NewFiles();
+    ASSERT_EQ(1, new_files.size());
+    ASSERT_EQ(4, new_files[0]->row_count);
+    ASSERT_EQ(10, new_files[0]->min_sequence_number);
+    ASSERT_EQ(16, new_files[0]->max_sequence_number);
+
+    std::shared_ptr<arrow::ChunkedArray> expected_array;
+    auto array_status = arrow::ipc::internal::json::ChunkedArrayFromJSON(write_type_, {R"([
+      [16, 0, "Alice", 10, 0, 113.1],
+      [14, 0, "Lucy", 20, 1, 114.1],
+      [13, 0, "Paul", 20, 1, 15.1],
+      [15, 0, "Skye", 10, 0, 118.1]
+    ])"},
+                                                                         &expected_array);
+    ASSERT_TRUE(array_status.ok());
+    CheckFileContent(dir->Str() + "/data-" + uuid + "-0.orc", expected_array);
+}
+
+TEST_F(MergeTreeWriterTest, TestSpillWriteBufferToSpillDir) {
+    auto spill_dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(spill_dir);
+    ASSERT_OK_AND_ASSIGN(
+        CoreOptions options,
+        CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"},
+                              {Options::WRITE_BUFFER_SIZE, "1"},
+                              {Options::WRITE_BUFFER_SPILLABLE, "true"},
+                              {Options::WRITE_BUFFER_SPILL_DIR, spill_dir->Str()}}));
+
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+
+    auto merge_writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, options, pool_);
+    std::shared_ptr<arrow::Array> array =
+        arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 14.1],
+      ["Alice", 10, 0, 13.1]
+    ])")
+            .ValueOrDie();
+    WriteBatch(array, /*row_kinds=*/{}, merge_writer.get());
+    ASSERT_EQ(1, merge_writer->spilled_runs_.size());
+    std::string spill_file = merge_writer->spilled_runs_[0]->Path();
+    ASSERT_EQ(std::filesystem::path(spill_dir->Str()),
+              std::filesystem::path(spill_file).parent_path());
+    ASSERT_TRUE(std::filesystem::exists(spill_file));
+
+    ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
+                         merge_writer->PrepareCommit(/*wait_compaction=*/false));
+    ASSERT_FALSE(std::filesystem::exists(spill_file));
+    ASSERT_OK(merge_writer->Close());
+    const auto& new_files = commit_increment.GetNewFilesIncrement().NewFiles();
+    ASSERT_EQ(1, new_files.size());
+    ASSERT_EQ(2, new_files[0]->row_count);
+}
+
+TEST_F(MergeTreeWriterTest, TestSpillWriteBufferExceedMaxDiskSize) {
+    // the first batch is spilled, the second one is flushed with the spilled run as max disk size
+    // is reached
+    ASSERT_OK_AND_ASSIGN(CoreOptions options,
+                         CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"},
+                                               {Options::WRITE_BUFFER_SIZE, "1"},
+                                               {Options::WRITE_BUFFER_SPILLABLE, "true"},
+                                               {Options::WRITE_BUFFER_SPILL_MAX_DISK_SIZE, "1"}}));
+
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+
+    auto merge_writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, options, pool_);
+    std::shared_ptr<arrow::Array> array1 =
+        arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 14.1],
+      ["Alice", 10, 0, 13.1]
+    ])")
+            .ValueOrDie();
+    WriteBatch(array1, /*row_kinds=*/{}, merge_writer.get());
+    ASSERT_EQ(1, merge_writer->spilled_runs_.size());
+    ASSERT_GT(merge_writer->spilled_size_in_bytes_, 0);
+
+    std::shared_ptr<arrow::Array> array2 =
+        arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 114.1]
+    ])")
+            .ValueOrDie();
+    WriteBatch(array2, /*row_kinds=*/{}, merge_writer.get());
+    ASSERT_TRUE(merge_writer->spilled_runs_.empty());
+    ASSERT_EQ(0, merge_writer->spilled_size_in_bytes_);
+
+    ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
+                         merge_writer->PrepareCommit(/*wait_compaction=*/false));
+    ASSERT_OK(merge_writer->Close());
+    const auto& new_files = commit_increment.GetNewFilesIncrement().NewFiles();
+    ASSERT_EQ(1, new_files.size());
+    ASSERT_EQ(2, new_files[0]->row_count);
+    ASSERT_EQ(11, new_files[0]->min_sequence_number);
+    ASSERT_EQ(12, new_files[0]->max_sequence_number);
+}
+
 TEST_F(MergeTreeWriterTest, TestIOException) {
     ASSERT_OK_AND_ASSIGN(CoreOptions options,
                          CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"}}));
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -37,6 +38,21 @@ class SortedRun {
     static SortedRun FromSorted(const std::vector<std::shared_ptr<DataFileMeta>>& meta) {
         return SortedRun(meta);
     }
+    static SortedRun Empty() {
+        return SortedRun({});
+    }
+    /// Sorts `metas` by their min keys, the caller should check `IsValid()` if the key ranges of
+    /// `metas` are not guaranteed to be disjoint.
+    static SortedRun FromUnsorted(const std::vector<std::shared_ptr<DataFileMeta>>& metas,
+                                  const std::shared_ptr<FieldsComparator>& comparator) {
+        std::vector<std::shared_ptr<DataFileMeta>> sorted = metas;
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [&comparator](const std::shared_ptr<DataFileMeta>& lhs,
+                                       const std::shared_ptr<DataFileMeta>& rhs) {
+                             return comparator->CompareTo(lhs->min_key, rhs->min_key) < 0;
+                         });
+        return SortedRun(sorted);
+    }
     const std::vector<std::shared_ptr<DataFileMeta>>& Files() const& {
         return files_;
     }
@@ -49,6 +65,10 @@ class SortedRun {
         return total_size_;
     }
 
+    bool NonEmpty() const {
+        return !files_.empty();
+    }
+
     bool IsValid(const std::shared_ptr<FieldsComparator>& comparator) const {
         for (size_t i = 1; i < files_.size(); ++i) {
             if (comparator->CompareTo(files_[i]->min_key, files_[i - 1]->max_key) <= 0) {
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/spilled_run.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/util/compression.h"
+#include "fmt/format.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/uuid.h"
+
+namespace paimon {
+namespace {
+// Reads record batches of a spill file one by one and reorders the columns into the layout of
+// data file read schema: special fields, trimmed primary keys, and then the other value fields.
+class SpilledRunBatchReader : public BatchReader {
+ public:
+    SpilledRunBatchReader(std::shared_ptr<arrow::ipc::RecordBatchFileReader>&& reader,
+                          std::vector<int32_t>&& field_indices,
+                          const std::shared_ptr<arrow::MemoryPool>& arrow_pool)
+        : arrow_pool_(arrow_pool),
+          reader_(std::move(reader)),
+          field_indices_(std::move(field_indices)),
+          metrics_(std::make_shared<MetricsImpl>()) {
+        const auto& schema = reader_->schema();
+        for (int32_t index : field_indices_) {
+            fields_.push_back(schema->field(index));
+        }
+    }
+
+    Result<ReadBatch> NextBatch() override {
+        while (reader_ && next_batch_index_ < reader_->num_record_batches()) {
+            PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::RecordBatch> record_batch,
+                                              reader_->ReadRecordBatch(next_batch_index_++));
+            if (record_batch->num_rows() == 0) {
+                continue;
+            }
+            arrow::ArrayVector columns;
+            columns.reserve(field_indices_.size());
+            for (int32_t index : field_indices_) {
+                columns.push_back(record_batch->column(index));
+            }
+            PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::StructArray> struct_array,
+                                              arrow::StructArray::Make(columns, fields_));
+            auto c_array = std::make_unique<ArrowArray>();
+            auto c_schema = std::make_unique<ArrowSchema>();
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(
+                arrow::ExportArray(*struct_array, c_array.get(), c_schema.get()));
+            return std::make_pair(std::move(c_array), std::move(c_schema));
+        }
+        return BatchReader::MakeEofBatch();
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return metrics_;
+    }
+
+    void Close() override {
+        reader_.reset();
+    }
+
+ private:
+    // must outlive the ipc reader and the arrays read by it
+    std::shared_ptr<arrow::MemoryPool> arrow_pool_;
+    std::shared_ptr<arrow::ipc::RecordBatchFileReader> reader_;
+    std::vector<int32_t> field_indices_;
+    arrow::FieldVector fields_;
+    int32_t next_batch_index_ = 0;
+    std::shared_ptr<Metrics> metrics_;
+};
+}  // namespace
+
+SpilledRun::SpilledRun(const std::string& path, const std::shared_ptr<arrow::Schema>& write_schema,
+                       const std::shared_ptr<MemoryPool>& pool)
+    : path_(path), write_schema_(write_schema), pool_(pool), arrow_pool_(GetArrowPool(pool)) {}
+
+SpilledRun::~SpilledRun() {
+    std::error_code ec;
+    std::filesystem::remove(path_, ec);
+}
+
+Result<std::unique_ptr<SpilledRun>> SpilledRun::Write(
+    const std::string& spill_dir, const std::shared_ptr<arrow::Schema>& write_schema,
+    const std::function<Result<KeyValueBatch>()>& next_batch,
+    const std::shared_ptr<MemoryPool>& pool) {
+    std::string uuid;
+    if (!UUID::Generate(&uuid)) {
+        return Status::Invalid("generate uuid failed");
+    }
+    std::string path = PathUtil::JoinPath(spill_dir, fmt::format("paimon-spill-{}.arrow", uuid));
+    // the run is created before writing, so that a partially written file is deleted on error
+    std::unique_ptr<SpilledRun> run(new SpilledRun(path, write_schema, pool));
+
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::io::FileOutputStream> out,
+                                      arrow::io::FileOutputStream::Open(path));
+    auto write_options = arrow::ipc::IpcWriteOptions::Defaults();
+    write_options.memory_pool = run->arrow_pool_.get();
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::unique_ptr<arrow::util::Codec> codec,
+                                      arrow::util::Codec::Create(arrow::Compression::ZSTD));
+    write_options.codec = std::move(codec);
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        std::shared_ptr<arrow::ipc::RecordBatchWriter> writer,
+        arrow::ipc::MakeFileWriter(out, write_schema, write_options));
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(KeyValueBatch key_value_batch, next_batch());
+        if (key_value_batch.batch == nullptr) {
+            break;
+        }
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+            std::shared_ptr<arrow::RecordBatch> record_batch,
+            arrow::ImportRecordBatch(key_value_batch.batch.get(), write_schema));
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(writer->WriteRecordBatch(*record_batch));
+        run->row_count_ += record_batch->num_rows();
+    }
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(writer->Close());
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(run->file_size_, out->Tell());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(out->Close());
+    return run;
+}
+
+Result<std::unique_ptr<BatchReader>> SpilledRun::CreateReader(
+    const std::vector<std::string>& trimmed_primary_keys) const {
+    // e.g., spill file schema: seq, kind, s1, key1, v1, key2
+    // returned batch schema:   seq, kind, key1, key2, s1, v1
+    std::vector<int32_t> field_indices;
+    field_indices.reserve(write_schema_->num_fields());
+    for (int32_t i = 0; i < SpecialFields::KEY_VALUE_SPECIAL_FIELD_COUNT; i++) {
+        field_indices.push_back(i);
+    }
+    for (const auto& key : trimmed_primary_keys) {
+        int32_t index = write_schema_->GetFieldIndex(key);
+        if (index < 0) {
+            return Status::Invalid(fmt::format("cannot find key field {} in spill file", key));
+        }
+        field_indices.push_back(index);
+    }
+    for (int32_t i = SpecialFields::KEY_VALUE_SPECIAL_FIELD_COUNT;
+         i < write_schema_->num_fields(); i++) {
+        if (std::find(trimmed_primary_keys.begin(), trimmed_primary_keys.end(),
+                      write_schema_->field(i)->name()) == trimmed_primary_keys.end()) {
+            field_indices.push_back(i);
+        }
+    }
+
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::io::ReadableFile> file,
+                                      arrow::io::ReadableFile::Open(path_, arrow_pool_.get()));
+    auto read_options = arrow::ipc::IpcReadOptions::Defaults();
+    read_options.memory_pool = arrow_pool_.get();
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::ipc::RecordBatchFileReader> reader,
+                                      arrow::ipc::RecordBatchFileReader::Open(file, read_options));
+    return std::make_unique<SpilledRunBatchReader>(std::move(reader), std::move(field_indices),
+                                                   arrow_pool_);
+}
+
+}  // namespace paimon
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/core/key_value.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class MemoryPool;
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class MemoryPool;
+
+/// A sorted run of key values spilled from the write buffer of `MergeTreeWriter` to a local
+/// compressed arrow ipc file. The file keeps the write schema of the writer (sequence number,
+/// value kind and value fields), so spilled key values keep their sequence numbers and row kinds
+/// when they are read back and merged. The file is deleted when the run is destroyed.
+class SpilledRun {
+ public:
+    /// Drain `next_batch` into a new spill file under `spill_dir`.
+    ///
+    /// @param spill_dir local directory of the spill file
+    /// @param write_schema schema of the key value batches
+    /// @param next_batch function returning sorted key value batches, a null batch means eof
+    /// @param pool memory pool of the writer
+    static Result<std::unique_ptr<SpilledRun>> Write(
+        const std::string& spill_dir, const std::shared_ptr<arrow::Schema>& write_schema,
+        const std::function<Result<KeyValueBatch>()>& next_batch,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    ~SpilledRun();
+
+    /// Create a reader of the spilled key values for `KeyValueDataFileRecordReader`, trimmed
+    /// primary keys are placed right after the special fields in returned batches.
+    Result<std::unique_ptr<BatchReader>> CreateReader(
+        const std::vector<std::string>& trimmed_primary_keys) const;
+
+    const std::string& Path() const {
+        return path_;
+    }
+
+    int64_t FileSize() const {
+        return file_size_;
+    }
+
+    int64_t RowCount() const {
+        return row_count_;
+    }
+
+ private:
+    SpilledRun(const std::string& path, const std::shared_ptr<arrow::Schema>& write_schema,
+               const std::shared_ptr<MemoryPool>& pool);
+
+    std::string path_;
+    int64_t file_size_ = 0;
+    int64_t row_count_ = 0;
+    std::shared_ptr<arrow::Schema> write_schema_;
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<arrow::MemoryPool> arrow_pool_;
+};
+}  // namespace paimon
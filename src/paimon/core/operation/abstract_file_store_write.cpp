@@ -17,15 +17,21 @@
 #include "paimon/core/operation/abstract_file_store_write.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <future>
 #include <map>
 #include <optional>
+#include <vector>
 
 #include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/executor/future.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/operation/file_store_scan.h"
+#include "paimon/core/operation/metrics/write_metrics.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/core/table/bucket_mode.h"
@@ -107,10 +113,61 @@ Status AbstractFileStoreWrite::Write(std::unique_ptr<RecordBatch>&& batch) {
     }
     PAIMON_ASSIGN_OR_RAISE(BinaryRow partition,
                            file_store_path_factory_->ToBinaryRow(batch->GetPartition()))
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<BatchWriter> writer,
+    PAIMON_ASSIGN_OR_RAISE(WriterContainer<BatchWriter>* writer_container,
                            GetWriter(partition, batch->GetBucket()));
-    assert(writer);
-    return writer->Write(std::move(batch));
+    assert(writer_container->writer);
+    PAIMON_RETURN_NOT_OK(writer_container->writer->Write(std::move(batch)));
+    UpdateMemoryOccupancy(writer_container);
+    if (total_memory_occupancy_ > options_.GetWriteTotalBufferSize()) {
+        PAIMON_RETURN_NOT_OK(PreemptMemory());
+    }
+    metrics_->SetCounter(WriteMetrics::BUFFER_MEMORY_USED,
+                         static_cast<uint64_t>(total_memory_occupancy_));
+    return Status::OK();
+}
+
+void AbstractFileStoreWrite::UpdateMemoryOccupancy(
+    WriterContainer<BatchWriter>* writer_container) {
+    int64_t memory_occupancy = writer_container->writer->MemoryOccupancy();
+    total_memory_occupancy_ += memory_occupancy - writer_container->memory_occupancy;
+    writer_container->memory_occupancy = memory_occupancy;
+}
+
+void AbstractFileStoreWrite::ResetMemoryOccupancy() {
+    total_memory_occupancy_ = 0;
+    for (auto& [_, bucket_writers] : writers_) {
+        for (auto& [_, writer_container] : bucket_writers) {
+            writer_container.memory_occupancy = writer_container.writer->MemoryOccupancy();
+            total_memory_occupancy_ += writer_container.memory_occupancy;
+        }
+    }
+}
+
+Status AbstractFileStoreWrite::PreemptMemory() {
+    while (total_memory_occupancy_ > options_.GetWriteTotalBufferSize()) {
+        WriterContainer<BatchWriter>* largest = nullptr;
+        for (auto& [_, bucket_writers] : writers_) {
+            for (auto& [_, writer_container] : bucket_writers) {
+                if (largest == nullptr ||
+                    writer_container.memory_occupancy > largest->memory_occupancy) {
+                    largest = &writer_container;
+                }
+            }
+        }
+        if (largest == nullptr || largest->memory_occupancy == 0) {
+            break;
+        }
+        int64_t memory_occupancy = largest->memory_occupancy;
+        PAIMON_RETURN_NOT_OK(largest->writer->FlushMemory());
+        memory_preempt_count_++;
+        UpdateMemoryOccupancy(largest);
+        if (largest->memory_occupancy >= memory_occupancy) {
+            // the writer cannot release its memory, do not preempt it again and again
+            break;
+        }
+    }
+    metrics_->SetCounter(WriteMetrics::BUFFER_PREEMPT_COUNT, memory_preempt_count_);
+    return Status::OK();
 }
 
 Result<std::vector<std::shared_ptr<CommitMessage>>> AbstractFileStoreWrite::PrepareCommit(
@@ -151,6 +208,10 @@ Result<std::vector<std::shared_ptr<CommitMessage>>> AbstractFileStoreWrite::Prep
         }
     }
 
+    // flushing is the expensive part of preparing commit, do it for all writers at first, so that
+    // independent writers are flushed concurrently
+    PAIMON_RETURN_NOT_OK(FlushWritersForCommit());
+
     std::vector<std::shared_ptr<CommitMessage>> result;
     auto metrics = std::make_shared<MetricsImpl>();
     for (auto partition_iter = writers_.begin(); partition_iter != writers_.end();) {
@@ -209,10 +270,66 @@ Result<std::vector<std::shared_ptr<CommitMessage>>> AbstractFileStoreWrite::Prep
             ++partition_iter;
         }
     }
+    ResetMemoryOccupancy();
+    metrics->SetCounter(WriteMetrics::BUFFER_MEMORY_USED,
+                        static_cast<uint64_t>(total_memory_occupancy_));
+    metrics->SetCounter(WriteMetrics::BUFFER_PREEMPT_COUNT, memory_preempt_count_);
     metrics_->Overwrite(metrics);
     return result;
 }
 
+Status AbstractFileStoreWrite::FlushWritersForCommit() {
+    std::vector<BatchWriter*> writers;
+    for (const auto& [_, bucket_writers] : writers_) {
+        for (const auto& [_, writer_container] : bucket_writers) {
+            writers.push_back(writer_container.writer.get());
+        }
+    }
+    size_t parallelism = std::min(
+        static_cast<size_t>(options_.GetWritePrepareCommitParallelism()), writers.size());
+    if (parallelism <= 1 || executor_ == nullptr) {
+        for (auto* writer : writers) {
+            PAIMON_RETURN_NOT_OK(writer->FlushForCommit());
+        }
+        return Status::OK();
+    }
+
+    // each worker repeatedly takes the next writer, the calling thread works as one of them
+    std::vector<Status> statuses(writers.size());
+    std::atomic<size_t> next_writer(0);
+    auto flush_writers = [&writers, &statuses, &next_writer]() {
+        for (size_t i = next_writer++; i < writers.size(); i = next_writer++) {
+            statuses[i] = writers[i]->FlushForCommit();
+        }
+    };
+    std::vector<std::future<void>> futures;
+    {
+        ScopeGuard guard([&futures]() { Wait(futures); });
+        for (size_t i = 1; i < parallelism; ++i) {
+            futures.push_back(Via(executor_.get(), flush_writers));
+        }
+        flush_writers();
+    }
+
+    Status first_error = Status::OK();
+    size_t failed_count = 0;
+    for (const auto& status : statuses) {
+        if (!status.ok()) {
+            if (failed_count == 0) {
+                first_error = status;
+            }
+            failed_count++;
+        }
+    }
+    if (failed_count > 1) {
+        return first_error.WithMessage(
+            first_error.message(),
+            fmt::format(" ({} of {} writers failed to flush for commit)", failed_count,
+                        writers.size()));
+    }
+    return first_error;
+}
+
 Status AbstractFileStoreWrite::Close() {
     for (auto& [_, bucket_writers] : writers_) {
         for (auto& [_, writer_container] : bucket_writers) {
@@ -220,6 +337,7 @@ Status AbstractFileStoreWrite::Close() {
         }
     }
     writers_.clear();
+    total_memory_occupancy_ = 0;
     return Status::OK();
 }
 
@@ -267,30 +385,35 @@ Result<int32_t> AbstractFileStoreWrite::ScanExistingFileMetas(
     return total_buckets;
 }
 
-Result<std::shared_ptr<BatchWriter>> AbstractFileStoreWrite::GetWriter(const BinaryRow& partition,
-                                                                       int32_t bucket) {
+Result<AbstractFileStoreWrite::WriterContainer<BatchWriter>*> AbstractFileStoreWrite::GetWriter(
+    const BinaryRow& partition, int32_t bucket) {
     auto iter = writers_.find(partition);
     if (PAIMON_UNLIKELY(iter == writers_.end())) {
         PAIMON_ASSIGN_OR_RAISE(auto result,
                                CreateWriter(partition, bucket, ignore_previous_files_));
         int32_t total_buckets = result.first;
         std::shared_ptr<BatchWriter> writer = result.second;
-        writers_.emplace(partition,
+        auto partition_iter =
+            writers_
+                .emplace(partition,
                          std::unordered_map<int32_t, WriterContainer<BatchWriter>>(
-                             {{bucket, WriterContainer<BatchWriter>(writer, total_buckets)}}));
-        return writer;
+                             {{bucket, WriterContainer<BatchWriter>(writer, total_buckets)}}))
+                .first;
+        return &partition_iter->second.at(bucket);
     } else {
         auto& buckets = iter->second;
         auto iter = buckets.find(bucket);
         if (PAIMON_LIKELY(iter != buckets.end())) {
-            return iter->second.writer;
+            return &iter->second;
         } else {
             PAIMON_ASSIGN_OR_RAISE(auto result,
                                    CreateWriter(partition, bucket, ignore_previous_files_));
             int32_t total_buckets = result.first;
             std::shared_ptr<BatchWriter> writer = result.second;
-            buckets.emplace(bucket, WriterContainer<BatchWriter>(writer, total_buckets));
-            return writer;
+            auto bucket_iter =
+                buckets.emplace(bucket, WriterContainer<BatchWriter>(writer, total_buckets))
+                    .first;
+            return &bucket_iter->second;
         }
     }
 }
@@ -94,6 +94,8 @@ class AbstractFileStoreWrite : public FileStoreWrite {
         std::shared_ptr<T> writer;
         int64_t last_modified_commit_identifier = std::numeric_limits<int64_t>::min();
         int32_t total_buckets = -1;
+        // memory occupancy of the writer when it was last accounted
+        int64_t memory_occupancy = 0;
     };
 
  protected:
@@ -124,7 +126,18 @@ class AbstractFileStoreWrite : public FileStoreWrite {
     CoreOptions options_;
 
  private:
-    Result<std::shared_ptr<BatchWriter>> GetWriter(const BinaryRow& partition, int32_t bucket);
+    Result<WriterContainer<BatchWriter>*> GetWriter(const BinaryRow& partition, int32_t bucket);
+    // flush all writers, up to "write.prepare-commit.parallelism" of them concurrently on the
+    // executor, so that preparing commit scales with cores instead of the number of buckets
+    Status FlushWritersForCommit();
+
+    // account the memory occupancy change of a writer in the total memory occupancy
+    void UpdateMemoryOccupancy(WriterContainer<BatchWriter>* writer_container);
+    // re-account memory occupancy of all writers, after they are flushed or closed
+    void ResetMemoryOccupancy();
+    // flush (or spill) the writers occupying the most memory until the total memory occupancy
+    // fits "write.total-buffer-size"
+    Status PreemptMemory();
 
  private:
     std::unordered_map<BinaryRow, std::unordered_map<int32_t, WriterContainer<BatchWriter>>>
@@ -134,6 +147,9 @@ class AbstractFileStoreWrite : public FileStoreWrite {
     bool ignore_num_bucket_check_ = false;
     bool batch_committed_ = false;
 
+    int64_t total_memory_occupancy_ = 0;
+    uint64_t memory_preempt_count_ = 0;
+
     std::shared_ptr<MetricsImpl> metrics_;
     std::unique_ptr<Logger> logger_;
 };
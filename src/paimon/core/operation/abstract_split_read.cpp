@@ -21,6 +21,7 @@
 #include <utility>
 
 #include "arrow/type.h"
+#include "paimon/common/metrics/timer.h"
 #include "paimon/common/reader/delegating_prefetch_reader.h"
 #include "paimon/common/reader/predicate_batch_reader.h"
 #include "paimon/common/reader/prefetch_file_batch_reader_impl.h"
@@ -199,8 +200,10 @@ Result<std::unique_ptr<BatchReader>> AbstractSplitRead::CreateFieldMappingReader
     auto read_schema = DataField::ConvertDataFieldsToArrowSchema(
         field_mapping->non_partition_info.non_partition_data_schema);
 
+    Timer file_open_timer;
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileBatchReader> file_reader,
                            CreateFileBatchReader(file_meta, data_file_path, reader_builder));
+    uint64_t file_open_latency_us = file_open_timer.ElapsedUs();
     if (NeedCompleteRowTrackingFields(options_.RowTrackingEnabled(), read_schema)) {
         file_reader = std::make_unique<CompleteRowTrackingFieldsBatchReader>(
             std::move(file_reader), file_meta->first_row_id, file_meta->max_sequence_number, pool_);
@@ -217,9 +220,11 @@ Result<std::unique_ptr<BatchReader>> AbstractSplitRead::CreateFieldMappingReader
         return std::unique_ptr<BatchReader>();
     }
 
-    return std::make_unique<FieldMappingReader>(field_mapping_builder->GetReadFieldCount(),
-                                                std::move(final_reader), partition,
-                                                std::move(field_mapping), pool_);
+    auto mapping_reader = std::make_unique<FieldMappingReader>(
+        field_mapping_builder->GetReadFieldCount(), std::move(final_reader), partition,
+        std::move(field_mapping), pool_);
+    mapping_reader->RecordFileOpenLatency(file_open_latency_us);
+    return std::unique_ptr<BatchReader>(std::move(mapping_reader));
 }
 
 Result<std::vector<DataField>> AbstractSplitRead::ProjectFieldsForRowTrackingAndDataEvolution(
@@ -16,10 +16,15 @@
 
 #include "paimon/core/operation/append_only_file_store_write.h"
 
+#include <atomic>
 #include <vector>
 
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/blob_utils.h"
+#include "paimon/core/append/append_compact_rewriter.h"
 #include "paimon/core/append/append_only_writer.h"
+#include "paimon/core/append/bucketed_append_compact_manager.h"
+#include "paimon/core/compact/noop_compact_manager.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/manifest_file.h"
@@ -29,6 +34,7 @@
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/objects_cache.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/logging.h"
 #include "paimon/result.h"
@@ -75,7 +81,8 @@ Result<std::unique_ptr<FileStoreScan>> AppendOnlyFileStoreWrite::CreateFileStore
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<ManifestList> manifest_list,
         ManifestList::Create(options_.GetFileSystem(), options_.GetManifestFormat(),
-                             options_.GetManifestCompression(), file_store_path_factory_, pool_));
+                             options_.GetManifestCompression(), file_store_path_factory_, pool_,
+                             ObjectsCache::GetShared(options_.GetManifestCacheMaxMemorySize())));
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<ManifestFile> manifest_file,
         ManifestFile::Create(options_.GetFileSystem(), options_.GetManifestFormat(),
@@ -106,10 +113,38 @@ Result<std::pair<int32_t, std::shared_ptr<BatchWriter>>> AppendOnlyFileStoreWrit
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataFilePathFactory> data_file_path_factory,
                            file_store_path_factory_->CreateDataFilePathFactory(partition, bucket));
 
-    auto writer = std::make_shared<AppendOnlyWriter>(options_, table_schema_->Id(), write_schema_,
-                                                     write_cols_, max_sequence_number,
-                                                     data_file_path_factory, pool_);
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<CompactManager> compact_manager,
+        CreateCompactManager(partition, data_file_path_factory, restore_files));
+    auto writer = std::make_shared<AppendOnlyWriter>(
+        options_, table_schema_->Id(), write_schema_, write_cols_, max_sequence_number,
+        data_file_path_factory, pool_, compact_manager);
     return std::pair<int32_t, std::shared_ptr<BatchWriter>>(total_buckets, writer);
 }
 
+Result<std::shared_ptr<CompactManager>> AppendOnlyFileStoreWrite::CreateCompactManager(
+    const BinaryRow& partition, const std::shared_ptr<DataFilePathFactory>& path_factory,
+    const std::vector<std::shared_ptr<DataFileMeta>>& restore_files) const {
+    // Compaction of bucket unaware tables is not done by writers. Partial column writes, blob
+    // files, row tracking and deletion vectors need extra metadata to be maintained while
+    // rewriting, which is not supported yet.
+    auto blob_schema = BlobUtils::SeparateBlobSchema(schema_).blob_schema;
+    if (options_.WriteOnly() || options_.GetBucket() == -1 || write_cols_ != std::nullopt ||
+        (blob_schema && blob_schema->num_fields() > 0) || options_.RowTrackingEnabled() ||
+        options_.DataEvolutionEnabled() || options_.DeletionVectorsEnabled()) {
+        return std::make_shared<NoopCompactManager>();
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<AppendCompactRewriter> rewriter,
+                           AppendCompactRewriter::Create(table_schema_, root_path_, schema_,
+                                                         partition, path_factory, options_, pool_));
+    auto compact_rewriter = [rewriter](const std::vector<std::shared_ptr<DataFileMeta>>& files,
+                                       const std::atomic<bool>& cancelled) {
+        return rewriter->Rewrite(files, cancelled);
+    };
+    return std::make_shared<BucketedAppendCompactManager>(
+        executor_, restore_files, options_.GetCompactionMinFileNum(),
+        options_.GetCompactionMaxFileNum(), options_.GetTargetFileSize(),
+        options_.GetCompactionFileSize(), compact_rewriter);
+}
+
 }  // namespace paimon
@@ -44,6 +44,9 @@ class Schema;
 namespace paimon {
 
 class BatchWriter;
+class CompactManager;
+class DataFileMeta;
+class DataFilePathFactory;
 class FileStorePathFactory;
 class FileStoreScan;
 class SnapshotManager;
@@ -80,6 +83,10 @@ class AppendOnlyFileStoreWrite : public AbstractFileStoreWrite {
     Result<std::unique_ptr<FileStoreScan>> CreateFileStoreScan(
         const std::shared_ptr<ScanFilter>& filter) const override;
 
+    Result<std::shared_ptr<CompactManager>> CreateCompactManager(
+        const BinaryRow& partition, const std::shared_ptr<DataFilePathFactory>& path_factory,
+        const std::vector<std::shared_ptr<DataFileMeta>>& restore_files) const;
+
  private:
     std::optional<std::vector<std::string>> write_cols_;
     std::unique_ptr<Logger> logger_;
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 #include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/array/array_base.h"
@@ -25,6 +27,7 @@
 #include "arrow/c/abi.h"
 #include "arrow/c/bridge.h"
 #include "arrow/c/helpers.h"
+#include "arrow/ipc/api.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "gtest/gtest.h"
@@ -34,10 +37,14 @@
 #include "paimon/common/data/binary_row_writer.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/operation/metrics/write_metrics.h"
 #include "paimon/core/snapshot.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
 #include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/defs.h"
 #include "paimon/file_store_write.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
 #include "paimon/record_batch.h"
 #include "paimon/status.h"
 #include "paimon/testing/utils/testharness.h"
@@ -176,4 +183,93 @@ TEST_F(AppendOnlyFileStoreWriteTest, TestGetMaxSequenceNumberFromMultiPartition)
     }
 }
 
+namespace {
+// write 100 rows into each of 4 partitions and return the new file count and row count of each
+// commit message, the buffer memory used after writing and the write metrics after preparing commit
+void WriteAndPrepareCommit(const std::map<std::string, std::string>& options,
+                           std::vector<std::pair<size_t, int64_t>>* partition_files,
+                           uint64_t* write_memory_used, std::shared_ptr<Metrics>* metrics) {
+    arrow::FieldVector fields = {arrow::field("p", arrow::int32()),
+                                 arrow::field("v", arrow::utf8())};
+    arrow::Schema typed_schema(fields);
+    ::ArrowSchema schema;
+    ASSERT_TRUE(arrow::ExportSchema(typed_schema, &schema).ok());
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    ASSERT_OK_AND_ASSIGN(auto catalog, Catalog::Create(dir->Str(), {}));
+    ASSERT_OK(catalog->CreateDatabase("foo", {}, /*ignore_if_exists=*/false));
+    ASSERT_OK(catalog->CreateTable(Identifier("foo", "bar"), &schema, /*partition_keys=*/{"p"},
+                                   /*primary_keys=*/{}, /*options=*/{},
+                                   /*ignore_if_exists=*/false));
+
+    WriteContextBuilder builder(PathUtil::JoinPath(dir->Str(), "foo.db/bar"), "test");
+    for (const auto& [key, value] : options) {
+        builder.AddOption(key, value);
+    }
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<WriteContext> write_context, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto file_store_write, FileStoreWrite::Create(std::move(write_context)));
+    for (int32_t partition = 0; partition < 4; ++partition) {
+        std::string json = "[";
+        for (int32_t i = 0; i < 100; ++i) {
+            json += (i == 0 ? "" : ",");
+            json += "[" + std::to_string(partition) + ", \"value-" + std::to_string(i) + "\"]";
+        }
+        json += "]";
+        std::shared_ptr<arrow::Array> array =
+            arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(fields), json).ValueOrDie();
+        ::ArrowArray arrow_array;
+        ASSERT_TRUE(arrow::ExportArray(*array, &arrow_array).ok());
+        RecordBatchBuilder batch_builder(&arrow_array);
+        ASSERT_OK_AND_ASSIGN(
+            std::unique_ptr<RecordBatch> batch,
+            batch_builder.SetPartition({{"p", std::to_string(partition)}}).Finish());
+        ASSERT_OK(file_store_write->Write(std::move(batch)));
+    }
+    ASSERT_OK_AND_ASSIGN(*write_memory_used,
+                         file_store_write->GetMetrics()->GetCounter(
+                             WriteMetrics::BUFFER_MEMORY_USED));
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> messages,
+                         file_store_write->PrepareCommit(/*wait_compaction=*/false,
+                                                         /*commit_identifier=*/0));
+    for (const auto& message : messages) {
+        auto message_impl = std::dynamic_pointer_cast<CommitMessageImpl>(message);
+        ASSERT_TRUE(message_impl);
+        const auto& new_files = message_impl->GetNewFilesIncrement().NewFiles();
+        int64_t row_count = 0;
+        for (const auto& file : new_files) {
+            row_count += file->row_count;
+        }
+        partition_files->emplace_back(new_files.size(), row_count);
+    }
+    *metrics = file_store_write->GetMetrics();
+    ASSERT_OK(file_store_write->Close());
+}
+}  // namespace
+
+TEST_F(AppendOnlyFileStoreWriteTest, TestPreemptMemoryOfOpenFileWriters) {
+    std::vector<std::pair<size_t, int64_t>> unlimited_result;
+    uint64_t memory_used = 0;
+    std::shared_ptr<Metrics> metrics;
+    WriteAndPrepareCommit({}, &unlimited_result, &memory_used, &metrics);
+    // the open file writer of each partition holds its buffered rows in memory
+    ASSERT_GT(memory_used, 0u);
+    ASSERT_OK_AND_ASSIGN(uint64_t preempt_count,
+                         metrics->GetCounter(WriteMetrics::BUFFER_PREEMPT_COUNT));
+    ASSERT_EQ(0u, preempt_count);
+    ASSERT_OK_AND_ASSIGN(memory_used, metrics->GetCounter(WriteMetrics::BUFFER_MEMORY_USED));
+    ASSERT_EQ(0u, memory_used);
+
+    // each write exceeds the total buffer size, so that the written file is closed at once
+    std::vector<std::pair<size_t, int64_t>> limited_result;
+    WriteAndPrepareCommit({{Options::WRITE_TOTAL_BUFFER_SIZE, "1"}}, &limited_result,
+                          &memory_used, &metrics);
+    ASSERT_EQ(0u, memory_used);
+    ASSERT_OK_AND_ASSIGN(preempt_count, metrics->GetCounter(WriteMetrics::BUFFER_PREEMPT_COUNT));
+    ASSERT_EQ(4u, preempt_count);
+    // preempted writers produce the same files as the ones flushed by commit
+    std::vector<std::pair<size_t, int64_t>> expected(4, {1, 100});
+    ASSERT_EQ(expected, unlimited_result);
+    ASSERT_EQ(expected, limited_result);
+}
+
 }  // namespace paimon::test
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/operation/conflict_detection.h"
+
+#include <algorithm>
+
+#include "fmt/format.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/manifest/file_kind.h"
+#include "paimon/core/operation/file_store_scan.h"
+#include "paimon/core/table/source/scan_mode.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/core/utils/snapshot_manager.h"
+
+namespace paimon {
+
+ConflictDetection::ConflictDetection(
+    const std::set<std::map<std::string, std::string>>& partitions,
+    std::unique_ptr<FileStoreScan>&& scan, const std::shared_ptr<SnapshotManager>& snapshot_manager,
+    const std::shared_ptr<FieldsComparator>& key_comparator)
+    : partitions_(partitions),
+      scan_(std::move(scan)),
+      snapshot_manager_(snapshot_manager),
+      key_comparator_(key_comparator) {}
+
+ConflictDetection::~ConflictDetection() = default;
+
+Status ConflictDetection::Refresh(const Snapshot& latest_snapshot) {
+    if (snapshot_ == latest_snapshot) {
+        return Status::OK();
+    }
+    if (snapshot_ && snapshot_.value().Id() < latest_snapshot.Id()) {
+        std::vector<ManifestEntry> delta_entries;
+        PAIMON_ASSIGN_OR_RAISE(bool complete, ReadDeltaSince(snapshot_.value(), latest_snapshot,
+                                                             &delta_entries));
+        if (complete) {
+            // the index is invalid until all delta entries are applied
+            snapshot_ = std::nullopt;
+            PAIMON_RETURN_NOT_OK(AddEntries(delta_entries));
+            snapshot_ = latest_snapshot;
+            return Status::OK();
+        }
+    }
+    // nothing indexed yet, the snapshots in between are expired, or the indexed snapshot is rolled
+    // back, possibly followed by new commits reusing its id
+    bucket_files_.clear();
+    buckets_with_deletion_.clear();
+    snapshot_ = std::nullopt;
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<FileStoreScan::RawPlan> plan,
+        scan_->WithKind(ScanMode::ALL)->WithSnapshot(latest_snapshot)->CreatePlan());
+    PAIMON_RETURN_NOT_OK(AddEntries(plan->Files()));
+    snapshot_ = latest_snapshot;
+    return Status::OK();
+}
+
+Result<bool> ConflictDetection::ReadDeltaSince(const Snapshot& indexed_snapshot,
+                                               const Snapshot& latest_snapshot,
+                                               std::vector<ManifestEntry>* delta_entries) const {
+    // snapshot files are immutable, a different one under the same id means a rollback
+    Result<Snapshot> current = snapshot_manager_->ReloadSnapshot(indexed_snapshot.Id());
+    if (!current.ok() || !(current.value() == indexed_snapshot)) {
+        return false;
+    }
+    for (int64_t id = indexed_snapshot.Id() + 1; id <= latest_snapshot.Id(); id++) {
+        std::optional<Snapshot> snapshot;
+        if (id == latest_snapshot.Id()) {
+            snapshot = latest_snapshot;
+        } else {
+            Result<Snapshot> loaded = snapshot_manager_->LoadSnapshot(id);
+            if (!loaded.ok()) {
+                // expired, fall back to a full scan
+                return false;
+            }
+            snapshot = std::move(loaded).value();
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<FileStoreScan::RawPlan> plan,
+            scan_->WithKind(ScanMode::DELTA)->WithSnapshot(snapshot.value())->CreatePlan());
+        std::vector<ManifestEntry> entries = plan->Files();
+        delta_entries->reserve(delta_entries->size() + entries.size());
+        for (auto& entry : entries) {
+            delta_entries->push_back(std::move(entry));
+        }
+    }
+    return true;
+}
+
+Status ConflictDetection::AddEntries(const std::vector<ManifestEntry>& entries) {
+    std::unordered_map<BucketKey, std::vector<ManifestEntry>> grouped_entries;
+    for (const auto& entry : entries) {
+        grouped_entries[std::make_pair(entry.Partition(), entry.Bucket())].push_back(entry);
+    }
+    for (const auto& [bucket_key, bucket_entries] : grouped_entries) {
+        BucketFiles& files = bucket_files_[bucket_key];
+        PAIMON_RETURN_NOT_OK(FileEntry::MergeEntries(bucket_entries, &files));
+        if (CheckNoDeletion(files).ok()) {
+            buckets_with_deletion_.erase(bucket_key);
+        } else {
+            buckets_with_deletion_.insert(bucket_key);
+        }
+        if (files.empty()) {
+            bucket_files_.erase(bucket_key);
+        }
+    }
+    return Status::OK();
+}
+
+Status ConflictDetection::CheckNoConflicts(const std::vector<ManifestEntry>& changes) const {
+    LinkedHashMap<BucketKey, std::vector<ManifestEntry>> grouped_changes;
+    for (const auto& entry : changes) {
+        grouped_changes[std::make_pair(entry.Partition(), entry.Bucket())].push_back(entry);
+    }
+    for (const auto& bucket_key : buckets_with_deletion_) {
+        if (grouped_changes.find(bucket_key) == grouped_changes.end()) {
+            return CheckNoDeletion(bucket_files_.at(bucket_key));
+        }
+    }
+    for (const auto& [bucket_key, bucket_changes] : grouped_changes) {
+        BucketFiles merged_files;
+        auto iter = bucket_files_.find(bucket_key);
+        if (iter != bucket_files_.end()) {
+            merged_files = iter->second;
+        }
+        PAIMON_RETURN_NOT_OK(FileEntry::MergeEntries(bucket_changes, &merged_files));
+        PAIMON_RETURN_NOT_OK(CheckNoDeletion(merged_files));
+        if (key_comparator_) {
+            PAIMON_RETURN_NOT_OK(CheckKeyRanges(bucket_key, merged_files));
+        }
+    }
+    return Status::OK();
+}
+
+Status ConflictDetection::CheckNoDeletion(const BucketFiles& files) {
+    for (const auto& [_, entry] : files) {
+        if (entry.Kind() == FileKind::Delete()) {
+            return Status::Invalid(fmt::format(
+                "Trying to delete file {} which is not previously added.", entry.FileName()));
+        }
+    }
+    return Status::OK();
+}
+
+Status ConflictDetection::CheckKeyRanges(const BucketKey& bucket_key,
+                                         const BucketFiles& files) const {
+    // files of a sorted run, i.e. a level >= 1, are intervals of keys which must not intersect
+    std::map<int32_t, std::vector<const ManifestEntry*>> levels;
+    for (const auto& [_, entry] : files) {
+        if (entry.Level() >= 1) {
+            levels[entry.Level()].push_back(&entry);
+        }
+    }
+    for (auto& [level, entries] : levels) {
+        std::sort(entries.begin(), entries.end(),
+                  [this](const ManifestEntry* lhs, const ManifestEntry* rhs) {
+                      return key_comparator_->CompareTo(lhs->MinKey(), rhs->MinKey()) < 0;
+                  });
+        for (size_t i = 0; i + 1 < entries.size(); i++) {
+            const ManifestEntry* prev = entries[i];
+            const ManifestEntry* next = entries[i + 1];
+            if (key_comparator_->CompareTo(prev->MaxKey(), next->MinKey()) >= 0) {
+                return Status::Invalid(fmt::format(
+                    "LSM conflicts detected! Key ranges of files {} and {} intersect in level {} "
+                    "of partition {} bucket {}.",
+                    prev->FileName(), next->FileName(), level, bucket_key.first.ToString(),
+                    bucket_key.second));
+            }
+        }
+    }
+    return Status::OK();
+}
+
+}  // namespace paimon
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/utils/linked_hash_map.h"
+#include "paimon/core/manifest/file_entry.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class FieldsComparator;
+class FileStoreScan;
+class SnapshotManager;
+
+/// Detects conflicts between the changes to commit and the files committed by others.
+///
+/// Files of the changed partitions are indexed by partition and bucket, together with the id of
+/// the snapshot they reflect. The index is kept between commit attempts: it is built from a full
+/// scan of the changed partitions once, and then brought up to date by reading only the delta
+/// manifests of the snapshots committed since, so the cost of a retry is proportional to the
+/// concurrent changes rather than to the table size. The indexed snapshot is compared with the
+/// one of the same id on every refresh, so an index built on a snapshot which is rolled back and
+/// committed again is rebuilt by a full scan.
+class ConflictDetection {
+ public:
+    /// @param partitions Changed partitions covered by this detection.
+    /// @param scan Scan filtered by `partitions`, null if the index is only fed by `AddEntries()`.
+    /// @param snapshot_manager Loads the snapshots committed since the indexed one.
+    /// @param key_comparator Comparator of min and max keys of data files, null for append table
+    ///                       which has no key ranges to check.
+    ConflictDetection(const std::set<std::map<std::string, std::string>>& partitions,
+                      std::unique_ptr<FileStoreScan>&& scan,
+                      const std::shared_ptr<SnapshotManager>& snapshot_manager,
+                      const std::shared_ptr<FieldsComparator>& key_comparator);
+    ~ConflictDetection();
+
+    const std::set<std::map<std::string, std::string>>& Partitions() const {
+        return partitions_;
+    }
+
+    /// Id of the snapshot the indexed files reflect, `std::nullopt` if nothing is indexed yet.
+    std::optional<int64_t> IndexedSnapshotId() const {
+        if (snapshot_) {
+            return snapshot_.value().Id();
+        }
+        return std::nullopt;
+    }
+
+    /// Bring the indexed files up to `latest_snapshot`.
+    Status Refresh(const Snapshot& latest_snapshot);
+
+    /// Index `entries`, an ADD and a DELETE of the same file cancel out.
+    Status AddEntries(const std::vector<ManifestEntry>& entries);
+
+    /// Check that `changes` can be applied on the indexed files: every deleted file must have
+    /// been added, and key ranges of files in the same LSM level >= 1 of a bucket must not
+    /// intersect. Only the buckets touched by `changes` are merged and checked.
+    Status CheckNoConflicts(const std::vector<ManifestEntry>& changes) const;
+
+ private:
+    using BucketKey = std::pair<BinaryRow, int32_t>;
+    using BucketFiles = LinkedHashMap<FileEntry::Identifier, ManifestEntry>;
+
+    Result<bool> ReadDeltaSince(const Snapshot& indexed_snapshot, const Snapshot& latest_snapshot,
+                                std::vector<ManifestEntry>* delta_entries) const;
+
+    static Status CheckNoDeletion(const BucketFiles& files);
+
+    Status CheckKeyRanges(const BucketKey& bucket_key, const BucketFiles& files) const;
+
+ private:
+    std::set<std::map<std::string, std::string>> partitions_;
+    std::unique_ptr<FileStoreScan> scan_;
+    std::shared_ptr<SnapshotManager> snapshot_manager_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+
+    // the snapshot the indexed files reflect
+    std::optional<Snapshot> snapshot_;
+    std::unordered_map<BucketKey, BucketFiles> bucket_files_;
+    // buckets holding DELETE entries of files which are not indexed
+    std::unordered_set<BucketKey> buckets_with_deletion_;
+};
+}  // namespace paimon
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/operation/conflict_detection.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/type.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/manifest/file_kind.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class ConflictDetectionTest : public testing::Test {
+ public:
+    void SetUp() override {
+        ASSERT_OK_AND_ASSIGN(
+            key_comparator_,
+            FieldsComparator::Create({DataField(0, arrow::field("k", arrow::int32()))},
+                                     /*is_ascending_order=*/true, /*use_view=*/false));
+    }
+
+    ManifestEntry CreateManifestEntry(const std::string& file_name, const FileKind& kind,
+                                      int32_t level, int32_t min_key, int32_t max_key) const {
+        auto data_file_meta = std::make_shared<DataFileMeta>(
+            file_name, /*file_size=*/1024, /*row_count=*/8,
+            BinaryRowGenerator::GenerateRow({min_key}, pool_.get()),
+            BinaryRowGenerator::GenerateRow({max_key}, pool_.get()), SimpleStats::EmptyStats(),
+            SimpleStats::EmptyStats(), /*min_sequence_number=*/0, /*max_sequence_number=*/7,
+            /*schema_id=*/0, level, /*extra_files=*/std::vector<std::optional<std::string>>(),
+            /*creation_time=*/Timestamp(0, 0), /*delete_row_count=*/0,
+            /*embedded_index=*/nullptr, /*file_source=*/std::nullopt,
+            /*value_stats_cols=*/std::nullopt, /*external_path=*/std::nullopt,
+            /*first_row_id=*/std::nullopt, /*write_cols=*/std::nullopt);
+        return ManifestEntry(kind, BinaryRow::EmptyRow(), /*bucket=*/0, /*total_buckets=*/1,
+                             data_file_meta);
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_ = GetDefaultPool();
+    std::shared_ptr<FieldsComparator> key_comparator_;
+};
+
+TEST_F(ConflictDetectionTest, TestCheckKeyRanges) {
+    ConflictDetection conflict_detection(/*partitions=*/{}, /*scan=*/nullptr,
+                                         /*snapshot_manager=*/nullptr, key_comparator_);
+    ASSERT_OK(conflict_detection.AddEntries(
+        {CreateManifestEntry("file1", FileKind::Add(), /*level=*/1, 1, 3),
+         CreateManifestEntry("file2", FileKind::Add(), /*level=*/1, 5, 7),
+         CreateManifestEntry("file3", FileKind::Add(), /*level=*/0, 1, 10)}));
+    // fits into the gap of level 1
+    ASSERT_OK(conflict_detection.CheckNoConflicts(
+        {CreateManifestEntry("file4", FileKind::Add(), /*level=*/1, 4, 4)}));
+    // level 0 files may overlap
+    ASSERT_OK(conflict_detection.CheckNoConflicts(
+        {CreateManifestEntry("file4", FileKind::Add(), /*level=*/0, 2, 6)}));
+    // other levels are not affected
+    ASSERT_OK(conflict_detection.CheckNoConflicts(
+        {CreateManifestEntry("file4", FileKind::Add(), /*level=*/2, 0, 10)}));
+    // compaction replaces file2
+    ASSERT_OK(conflict_detection.CheckNoConflicts(
+        {CreateManifestEntry("file2", FileKind::Delete(), /*level=*/1, 5, 7),
+         CreateManifestEntry("file4", FileKind::Add(), /*level=*/1, 4, 9)}));
+    ASSERT_NOK_WITH_MSG(conflict_detection.CheckNoConflicts({CreateManifestEntry(
+                            "file4", FileKind::Add(), /*level=*/1, 3, 5)}),
+                        "Key ranges of files file1 and file4 intersect in level 1");
+    ASSERT_NOK_WITH_MSG(conflict_detection.CheckNoConflicts({CreateManifestEntry(
+                            "file4", FileKind::Add(), /*level=*/1, 7, 8)}),
+                        "Key ranges of files file2 and file4 intersect in level 1");
+}
+
+TEST_F(ConflictDetectionTest, TestCheckDeletion) {
+    ConflictDetection conflict_detection(/*partitions=*/{}, /*scan=*/nullptr,
+                                         /*snapshot_manager=*/nullptr, key_comparator_);
+    ASSERT_OK(conflict_detection.AddEntries(
+        {CreateManifestEntry("file1", FileKind::Add(), /*level=*/1, 1, 3),
+         CreateManifestEntry("file2", FileKind::Add(), /*level=*/1, 5, 7)}));
+    // entries of later snapshots are merged into the index
+    ASSERT_OK(conflict_detection.AddEntries(
+        {CreateManifestEntry("file2", FileKind::Delete(), /*level=*/1, 5, 7),
+         CreateManifestEntry("file3", FileKind::Add(), /*level=*/2, 5, 7)}));
+    ASSERT_OK(conflict_detection.CheckNoConflicts(
+        {CreateManifestEntry("file3", FileKind::Delete(), /*level=*/2, 5, 7)}));
+    ASSERT_NOK_WITH_MSG(conflict_detection.CheckNoConflicts({CreateManifestEntry(
+                            "file2", FileKind::Delete(), /*level=*/1, 5, 7)}),
+                        "Trying to delete file file2 which is not previously added.");
+    ASSERT_NOK_WITH_MSG(conflict_detection.CheckNoConflicts({CreateManifestEntry(
+                            "file1", FileKind::Add(), /*level=*/1, 1, 3)}),
+                        "which is already added");
+}
+}  // namespace paimon::test
@@ -31,6 +31,7 @@
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/common/utils/scope_guard.h"
+#include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/file_kind.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/manifest/manifest_file.h"
@@ -155,8 +156,10 @@ Result<int32_t> ExpireSnapshots::ExpireUntil(int64_t earliest_snapshot_id,
     std::vector<Snapshot> retained_snapshots;
     PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(end_exclusive_id));
     retained_snapshots.push_back(snapshot);
-    std::set<std::string> skipping_sets;
-    PAIMON_RETURN_NOT_OK(GetManifestSkippingSet(retained_snapshots, &skipping_sets));
+    std::unordered_set<std::string> skipping_set;
+    PAIMON_RETURN_NOT_OK(GetManifestSkippingSet(retained_snapshots, &skipping_set));
+    deleted_manifests_.clear();
+    ScopeGuard clear_guard([this]() { deleted_manifests_.clear(); });
     for (int64_t id = begin_inclusive_id; id < end_exclusive_id; id++) {
         PAIMON_LOG_DEBUG(logger_, "Ready to delete manifests in snapshot #%ld", id);
         PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(id));
@@ -165,9 +168,9 @@ Result<int32_t> ExpireSnapshots::ExpireUntil(int64_t earliest_snapshot_id,
             continue;
         }
         PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(id));
-        PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.BaseManifestList(), skipping_sets));
-        PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.DeltaManifestList(), skipping_sets));
-        auto status = fs_->Delete(snapshot_manager_->SnapshotPath(id));
+        PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.BaseManifestList(), skipping_set));
+        PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.DeltaManifestList(), skipping_set));
+        auto status = snapshot_manager_->DeleteSnapshot(id);
         // delete quietly will ignore any status error
         (void)status;
     }
@@ -238,18 +241,21 @@ bool ExpireSnapshots::TryDeleteEmptyDirectory(const std::string& path) const {
 }
 
 Status ExpireSnapshots::CleanUnusedManifests(const std::string& manifest_list_name,
-                                             const std::set<std::string>& skipping_sets) {
+                                             const std::unordered_set<std::string>& skipping_set) {
     std::vector<ManifestFileMeta> manifest_file_metas;
     auto status = manifest_list_->Read(manifest_list_name, nullptr, &manifest_file_metas);
     if (status.ok()) {
-        std::vector<std::string> to_delete_manifests;
-        // TODO(jinli.zjw): optimize for async
+        std::vector<std::future<void>> futures;
+        ScopeGuard guard([&futures]() { Wait(futures); });
         for (const auto& manifest_file_meta : manifest_file_metas) {
-            if (skipping_sets.count(manifest_file_meta.FileName()) == 0) {
-                manifest_file_->DeleteQuietly(manifest_file_meta.FileName());
+            const std::string& file_name = manifest_file_meta.FileName();
+            if (skipping_set.count(file_name) == 0 && deleted_manifests_.insert(file_name).second) {
+                futures.push_back(Via(executor_.get(), [this, file_name]() {
+                    manifest_file_->DeleteQuietly(file_name);
+                }));
             }
         }
-        if (skipping_sets.count(manifest_list_name) == 0) {
+        if (skipping_set.count(manifest_list_name) == 0) {
             manifest_list_->DeleteQuietly(manifest_list_name);
         }
     }
@@ -259,49 +265,92 @@ Status ExpireSnapshots::CleanUnusedManifests(const std::string& manifest_list_na
 Status ExpireSnapshots::CleanUnusedDataFiles(const std::string& manifest_list_name) {
     std::vector<ManifestFileMeta> manifest_file_metas;
     auto status = manifest_list_->Read(manifest_list_name, nullptr, &manifest_file_metas);
-    if (status.ok()) {
-        std::map<std::string, ManifestEntry> data_files_to_delete;
-        for (const auto& manifest_file_meta : manifest_file_metas) {
-            std::vector<ManifestEntry> manifest_entries;
-            auto status =
-                manifest_file_->Read(manifest_file_meta.FileName(), nullptr, &manifest_entries);
-            if (!status.ok()) {
-                // cancel deletion if any exception occurs
-                PAIMON_LOG_WARN(logger_, "Failed to read some manifest files. Cancel deletion. %s",
-                                status.ToString().c_str());
-                return Status::OK();
-            } else {
-                PAIMON_RETURN_NOT_OK(GetDataFilesToDelete(manifest_entries, &data_files_to_delete));
-            }
+    if (!status.ok()) {
+        return Status::OK();
+    }
+    // read manifests concurrently, entries are applied in manifest order as a file may be added
+    // and deleted in different manifests
+    std::vector<std::future<Result<std::vector<ManifestEntry>>>> read_futures;
+    read_futures.reserve(manifest_file_metas.size());
+    for (const auto& manifest_file_meta : manifest_file_metas) {
+        read_futures.push_back(Via(
+            executor_.get(),
+            [this, &manifest_file_meta]() -> Result<std::vector<ManifestEntry>> {
+                std::vector<ManifestEntry> manifest_entries;
+                PAIMON_RETURN_NOT_OK(manifest_file_->Read(manifest_file_meta.FileName(),
+                                                          nullptr, &manifest_entries));
+                return manifest_entries;
+            }));
+    }
+    DataFilesToDelete data_files_to_delete;
+    for (const auto& manifest_entries : CollectAll(read_futures)) {
+        if (!manifest_entries.ok()) {
+            // cancel deletion if any exception occurs
+            PAIMON_LOG_WARN(logger_, "Failed to read some manifest files. Cancel deletion. %s",
+                            manifest_entries.status().ToString().c_str());
+            return Status::OK();
         }
+        PAIMON_RETURN_NOT_OK(GetDataFilesToDelete(manifest_entries.value(), &data_files_to_delete));
+    }
 
-        std::vector<std::future<void>> futures;
-        ScopeGuard guard([&futures]() { Wait(futures); });
-        for (const auto& [data_file_to_delete, entry] : data_files_to_delete) {
-            auto delete_file_path = data_file_to_delete;
-            futures.push_back(Via(executor_.get(), [this, delete_file_path]() {
-                auto status = fs_->Delete(delete_file_path);
-                // delete quietly will ignore any status error
-                (void)status;
-            }));
-            deletion_buckets_[entry.Partition()].insert(entry.Bucket());
+    // delete files bucket by bucket, the bucket path is resolved once and files of a large bucket
+    // are split into several tasks
+    std::vector<std::future<void>> futures;
+    ScopeGuard guard([&futures]() { Wait(futures); });
+    for (auto& [partition, bucket_files] : data_files_to_delete) {
+        for (auto& [bucket, file_names] : bucket_files) {
+            if (file_names.empty()) {
+                continue;
+            }
+            PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
+                                   path_factory_->BucketPath(partition, bucket));
+            std::vector<std::string> task_files;
+            for (const auto& file_name : file_names) {
+                task_files.push_back(file_name);
+                if (task_files.size() == DELETE_FILES_PER_TASK) {
+                    futures.push_back(DeleteFilesAsync(bucket_path, std::move(task_files)));
+                    task_files.clear();
+                }
+            }
+            if (!task_files.empty()) {
+                futures.push_back(DeleteFilesAsync(bucket_path, std::move(task_files)));
+            }
+            deletion_buckets_[partition].insert(bucket);
         }
     }
     return Status::OK();
 }
 
-Status ExpireSnapshots::GetDataFilesToDelete(
-    const std::vector<ManifestEntry>& data_file_entries,
-    std::map<std::string, ManifestEntry>* data_files_to_delete) const {
+std::future<void> ExpireSnapshots::DeleteFilesAsync(const std::string& dir,
+                                                   std::vector<std::string>&& file_names) const {
+    return Via(executor_.get(), [this, dir, file_names = std::move(file_names)]() {
+        for (const auto& file_name : file_names) {
+            auto status = fs_->Delete(PathUtil::JoinPath(dir, file_name));
+            // delete quietly will ignore any status error
+            (void)status;
+        }
+    });
+}
+
+Status ExpireSnapshots::GetDataFilesToDelete(const std::vector<ManifestEntry>& data_file_entries,
+                                             DataFilesToDelete* data_files_to_delete) const {
     for (const auto& entry : data_file_entries) {
-        PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
-                               path_factory_->BucketPath(entry.Partition(), entry.Bucket()));
-        std::string data_file_path = PathUtil::JoinPath(bucket_path, entry.FileName());
+        auto& file_names = (*data_files_to_delete)[entry.Partition()][entry.Bucket()];
         if (entry.Kind() == FileKind::Add()) {
-            data_files_to_delete->erase(data_file_path);
+            file_names.erase(entry.FileName());
+            for (const auto& extra_file : entry.File()->extra_files) {
+                if (extra_file) {
+                    file_names.erase(extra_file.value());
+                }
+            }
         } else if (entry.Kind() == FileKind::Delete()) {
-            // TODO(jinli.zjw): do not support extra files
-            data_files_to_delete->insert({data_file_path, entry});
+            // extra files (e.g. file index) are next to the data file
+            file_names.insert(entry.FileName());
+            for (const auto& extra_file : entry.File()->extra_files) {
+                if (extra_file) {
+                    file_names.insert(extra_file.value());
+                }
+            }
         } else {
             return Status::Invalid(
                 fmt::format("Unknown value kind {}", entry.Kind().ToByteValue()));
@@ -310,8 +359,9 @@ Status ExpireSnapshots::GetDataFilesToDelete(
     return Status::OK();
 }
 
-Status ExpireSnapshots::GetManifestSkippingSet(const std::vector<Snapshot>& retained_snapshots,
-                                               std::set<std::string>* skipping_manifest_set) const {
+Status ExpireSnapshots::GetManifestSkippingSet(
+    const std::vector<Snapshot>& retained_snapshots,
+    std::unordered_set<std::string>* skipping_manifest_set) const {
     for (const auto& snapshot : retained_snapshots) {
         skipping_manifest_set->insert(snapshot.BaseManifestList());
         skipping_manifest_set->insert(snapshot.DeltaManifestList());
@@ -17,11 +17,13 @@
 #pragma once
 
 #include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "paimon/common/data/binary_row.h"
@@ -54,16 +56,25 @@ class ExpireSnapshots {
     Result<int32_t> Expire();
 
  private:
+    // names of data files to delete, grouped by partition and bucket
+    using DataFilesToDelete =
+        std::unordered_map<BinaryRow,
+                           std::unordered_map<int32_t, std::unordered_set<std::string>>>;
+
+    static constexpr size_t DELETE_FILES_PER_TASK = 64;
+
     Result<int32_t> ExpireUntil(int64_t earliest_snapshot_id, int64_t end_exclusive_id);
 
     Status CleanUnusedDataFiles(const std::string& manifest_list_name);
     Status CleanUnusedManifests(const std::string& manifest_list_name,
-                                const std::set<std::string>& skipping_sets);
+                                const std::unordered_set<std::string>& skipping_set);
     Status CleanEmptyDirectories();
+    std::future<void> DeleteFilesAsync(const std::string& dir,
+                                       std::vector<std::string>&& file_names) const;
     Status GetDataFilesToDelete(const std::vector<ManifestEntry>& data_file_entries,
-                                std::map<std::string, ManifestEntry>* data_files_to_delete) const;
+                                DataFilesToDelete* data_files_to_delete) const;
     Status GetManifestSkippingSet(const std::vector<Snapshot>& retained_snapshots,
-                                  std::set<std::string>* skipping_manifest_set) const;
+                                  std::unordered_set<std::string>* skipping_manifest_set) const;
     bool TryDeleteEmptyDirectory(const std::string& path) const;
 
     std::shared_ptr<SnapshotManager> snapshot_manager_;
@@ -74,6 +85,8 @@ class ExpireSnapshots {
     ExpireConfig config_;
     std::shared_ptr<Executor> executor_;
     std::unordered_map<BinaryRow, std::set<std::int32_t>> deletion_buckets_;
+    // manifests deleted in current expiration, consecutive snapshots share most of base manifests
+    std::unordered_set<std::string> deleted_manifests_;
 
     std::unique_ptr<Logger> logger_;
 };
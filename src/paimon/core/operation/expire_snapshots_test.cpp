@@ -18,6 +18,8 @@
 
 #include <cstdint>
 #include <optional>
+#include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "arrow/type.h"
@@ -85,28 +87,6 @@ class ExpireSnapshotsTest : public testing::Test {
     }
     void TearDown() override {}
 
-    template <typename K, typename T>
-    static bool IsEqualMap(const std::map<K, T>& expected, const std::map<K, T>& actual) {
-        if (&expected == &actual) {
-            return true;
-        }
-        if (expected.size() != actual.size()) {
-            return false;
-        }
-        for (const auto& [key, value] : actual) {
-            auto iter = expected.find(key);
-            if (iter == expected.end()) {
-                return false;
-            }
-            if (iter->second == value) {
-                continue;
-            } else {
-                return false;
-            }
-        }
-        return true;
-    }
-
     std::unique_ptr<FileStorePathFactory> CreateFactory(const std::string& root) const {
         std::map<std::string, std::string> raw_options;
         raw_options[Options::FILE_FORMAT] = "orc";
@@ -127,8 +107,9 @@ class ExpireSnapshotsTest : public testing::Test {
         return path_factory;
     }
 
-    ManifestEntry CreateManifestEntry(const std::string& file_name, int32_t bucket,
-                                      const FileKind& kind) const {
+    ManifestEntry CreateManifestEntry(
+        const std::string& file_name, int32_t bucket, const FileKind& kind,
+        const std::vector<std::optional<std::string>>& extra_files = {}) const {
         int32_t arity = 2;
         BinaryRow row(arity);
         BinaryRowWriter writer(&row, 20, mem_pool_.get());
@@ -140,7 +121,7 @@ class ExpireSnapshotsTest : public testing::Test {
             file_name, 1024, 8, DataFileMeta::EmptyMinKey(), DataFileMeta::EmptyMaxKey(),
             SimpleStats::EmptyStats(), SimpleStats::EmptyStats(), /*min_seq_no=*/16,
             /*max_seq_no=*/32,
-            /*schema_id=*/1, /*level=*/2, /*extra_files=*/std::vector<std::optional<std::string>>(),
+            /*schema_id=*/1, /*level=*/2, extra_files,
             /*creation_time=*/Timestamp(0, 0), /*delete_row_count=*/3,
             /*embedded_index=*/nullptr, /*file_source=*/std::nullopt,
             /*external_path=*/std::nullopt,
@@ -217,36 +198,57 @@ TEST_F(ExpireSnapshotsTest, TestInvalidInput) {
 TEST_F(ExpireSnapshotsTest, TestGetDataFileToDelete) {
     auto mgr = std::make_shared<SnapshotManager>(fs_, test_data_path_);
     ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap({}));
+    using FileNames = std::unordered_set<std::string>;
     {
         ExpireSnapshots expire(mgr, path_factory_, manifest_list_, manifest_file_, fs_,
                                options.GetExpireConfig(), executor_);
-        std::map<std::string, ManifestEntry> data_file_to_delete;
+        ExpireSnapshots::DataFilesToDelete data_file_to_delete;
         std::vector<ManifestEntry> data_file_entries;
         data_file_entries.push_back(CreateManifestEntry("file1", /*bucket=*/0, FileKind::Delete()));
         data_file_entries.push_back(CreateManifestEntry("file2", /*bucket=*/1, FileKind::Delete()));
         data_file_entries.push_back(CreateManifestEntry("file1", /*bucket=*/0, FileKind::Add()));
         data_file_entries.push_back(CreateManifestEntry("file3", /*bucket=*/2, FileKind::Delete()));
         ASSERT_OK(expire.GetDataFilesToDelete(data_file_entries, &data_file_to_delete));
-        ASSERT_TRUE(
-            IsEqualMap(data_file_to_delete,
-                       {{test_data_path_ + "/f0=true/f3=3/bucket-1/file2", data_file_entries[1]},
-                        {test_data_path_ + "/f0=true/f3=3/bucket-2/file3", data_file_entries[3]}}));
+        ASSERT_EQ(data_file_to_delete.size(), 1u);
+        const auto& bucket_files = data_file_to_delete[data_file_entries[0].Partition()];
+        ASSERT_EQ(bucket_files.size(), 3u);
+        ASSERT_EQ(bucket_files.at(0), FileNames());
+        ASSERT_EQ(bucket_files.at(1), FileNames({"file2"}));
+        ASSERT_EQ(bucket_files.at(2), FileNames({"file3"}));
     }
     {
         ExpireSnapshots expire(mgr, path_factory_, manifest_list_, manifest_file_, fs_,
                                options.GetExpireConfig(), executor_);
-        std::map<std::string, ManifestEntry> data_file_to_delete;
+        ExpireSnapshots::DataFilesToDelete data_file_to_delete;
         std::vector<ManifestEntry> data_file_entries;
         data_file_entries.push_back(CreateManifestEntry("file1", /*bucket=*/0, FileKind::Add()));
         data_file_entries.push_back(CreateManifestEntry("file2", /*bucket=*/1, FileKind::Delete()));
         data_file_entries.push_back(CreateManifestEntry("file1", /*bucket=*/0, FileKind::Delete()));
         data_file_entries.push_back(CreateManifestEntry("file3", /*bucket=*/2, FileKind::Delete()));
+        data_file_entries.push_back(CreateManifestEntry("file4", /*bucket=*/2, FileKind::Delete()));
+        ASSERT_OK(expire.GetDataFilesToDelete(data_file_entries, &data_file_to_delete));
+        ASSERT_EQ(data_file_to_delete.size(), 1u);
+        const auto& bucket_files = data_file_to_delete[data_file_entries[0].Partition()];
+        ASSERT_EQ(bucket_files.size(), 3u);
+        ASSERT_EQ(bucket_files.at(0), FileNames({"file1"}));
+        ASSERT_EQ(bucket_files.at(1), FileNames({"file2"}));
+        ASSERT_EQ(bucket_files.at(2), FileNames({"file3", "file4"}));
+    }
+    {
+        // extra files (e.g. file index) are deleted together with the data file
+        ExpireSnapshots expire(mgr, path_factory_, manifest_list_, manifest_file_, fs_,
+                               options.GetExpireConfig(), executor_);
+        ExpireSnapshots::DataFilesToDelete data_file_to_delete;
+        std::vector<ManifestEntry> data_file_entries;
+        data_file_entries.push_back(CreateManifestEntry("file1.orc", /*bucket=*/0,
+                                                        FileKind::Delete(), {"file1.orc.index"}));
+        data_file_entries.push_back(CreateManifestEntry("file2.orc", /*bucket=*/0,
+                                                        FileKind::Delete(), {"file2.orc.index"}));
+        data_file_entries.push_back(CreateManifestEntry("file2.orc", /*bucket=*/0, FileKind::Add(),
+                                                        {"file2.orc.index"}));
         ASSERT_OK(expire.GetDataFilesToDelete(data_file_entries, &data_file_to_delete));
-        ASSERT_TRUE(
-            IsEqualMap(data_file_to_delete,
-                       {{test_data_path_ + "/f0=true/f3=3/bucket-0/file1", data_file_entries[2]},
-                        {test_data_path_ + "/f0=true/f3=3/bucket-1/file2", data_file_entries[1]},
-                        {test_data_path_ + "/f0=true/f3=3/bucket-2/file3", data_file_entries[3]}}));
+        const auto& bucket_files = data_file_to_delete[data_file_entries[0].Partition()];
+        ASSERT_EQ(bucket_files.at(0), FileNames({"file1.orc", "file1.orc.index"}));
     }
 }
 
@@ -33,6 +33,7 @@
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/utils/field_mapping.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/objects_cache.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/format/file_format.h"
 #include "paimon/fs/file_system.h"
@@ -104,7 +105,8 @@ Result<std::unique_ptr<FileStoreCommit>> FileStoreCommit::Create(
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<ManifestList> manifest_list,
         ManifestList::Create(options.GetFileSystem(), options.GetManifestFormat(),
-                             options.GetManifestCompression(), path_factory, ctx->GetMemoryPool()));
+                             options.GetManifestCompression(), path_factory, ctx->GetMemoryPool(),
+                             ObjectsCache::GetShared(options.GetManifestCacheMaxMemorySize())));
 
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<arrow::Schema> partition_schema,
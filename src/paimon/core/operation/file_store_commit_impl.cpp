@@ -31,6 +31,8 @@
 #include "paimon/common/data/blob_utils.h"
 #include "paimon/common/executor/future.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/timer.h"
+#include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/binary_row_partition_computer.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/scope_guard.h"
@@ -54,6 +56,7 @@
 #include "paimon/core/manifest/manifest_list.h"
 #include "paimon/core/manifest/partition_entry.h"
 #include "paimon/core/operation/append_only_file_store_scan.h"
+#include "paimon/core/operation/conflict_detection.h"
 #include "paimon/core/operation/expire_snapshots.h"
 #include "paimon/core/operation/file_store_scan.h"
 #include "paimon/core/operation/manifest_file_merger.h"
@@ -62,6 +65,7 @@
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/core/utils/fields_comparator.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/fs/file_system.h"
@@ -262,13 +266,15 @@ Status FileStoreCommitImpl::Overwrite(
     std::shared_ptr<ManifestCommittable> committable =
         CreateManifestCommittable(identifier, commit_messages, watermark);
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> compact_table_files;
     std::vector<IndexManifestEntry> append_table_index_files;
     PAIMON_RETURN_NOT_OK(CollectChanges(committable->FileCommittables(), &append_table_files,
-                                        &append_table_index_files));
+                                        &compact_table_files, &append_table_index_files));
     if (!append_table_index_files.empty()) {
         return Status::NotImplemented("Overwrite not support index for now");
     }
-    return TryOverwrite(partitions, append_table_files, identifier, watermark);
+    PAIMON_RETURN_NOT_OK(TryOverwrite(partitions, append_table_files, identifier, watermark));
+    return CommitCompactChanges(*committable, compact_table_files).status();
 }
 
 Result<int32_t> FileStoreCommitImpl::FilterAndOverwrite(
@@ -283,13 +289,17 @@ Result<int32_t> FileStoreCommitImpl::FilterAndOverwrite(
                            FilterCommitted(committables));
     if (!actual_committables.empty()) {
         std::vector<ManifestEntry> append_table_files;
+        std::vector<ManifestEntry> compact_table_files;
         std::vector<IndexManifestEntry> append_table_index_files;
         PAIMON_RETURN_NOT_OK(CollectChanges(actual_committables[0]->FileCommittables(),
-                                            &append_table_files, &append_table_index_files));
+                                            &append_table_files, &compact_table_files,
+                                            &append_table_index_files));
         if (!append_table_index_files.empty()) {
             return Status::NotImplemented("FilterAndOverwrite not support index for now");
         }
         PAIMON_RETURN_NOT_OK(TryOverwrite(partitions, append_table_files, identifier, watermark));
+        PAIMON_RETURN_NOT_OK(
+            CommitCompactChanges(*actual_committables[0], compact_table_files).status());
     }
     return actual_committables.size();
 }
@@ -354,10 +364,12 @@ Status FileStoreCommitImpl::TryOverwrite(
 
 Status FileStoreCommitImpl::Commit(const std::shared_ptr<ManifestCommittable>& committable,
                                    bool check_append_files) {
+    ScopedTimer commit_timer(metrics_.get(), CommitMetrics::COMMIT_DURATION);
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> compact_table_files;
     std::vector<IndexManifestEntry> append_table_index_files;
     PAIMON_RETURN_NOT_OK(CollectChanges(committable->FileCommittables(), &append_table_files,
-                                        &append_table_index_files));
+                                        &compact_table_files, &append_table_index_files));
 
     int32_t attempt = 0;
     if (!ignore_empty_commit_ || !append_table_files.empty() || !append_table_index_files.empty()) {
@@ -368,6 +380,9 @@ Status FileStoreCommitImpl::Commit(const std::shared_ptr<ManifestCommittable>& c
                                          Snapshot::CommitKind::Append(), check_append_files));
         attempt += cnt;
     }
+    PAIMON_ASSIGN_OR_RAISE(int32_t compact_attempt,
+                           CommitCompactChanges(*committable, compact_table_files));
+    attempt += compact_attempt;
     metrics_->SetCounter(CommitMetrics::LAST_COMMIT_ATTEMPTS, attempt);
     return Status::OK();
 }
@@ -380,6 +395,17 @@ Status FileStoreCommitImpl::Commit(
     return Commit(committable, /*check_append_files=*/false);
 }
 
+Result<int32_t> FileStoreCommitImpl::CommitCompactChanges(
+    const ManifestCommittable& committable, const std::vector<ManifestEntry>& compact_table_files) {
+    if (compact_table_files.empty()) {
+        return 0;
+    }
+    // compaction deletes files, conflicts must always be checked
+    return TryCommit(compact_table_files, /*index_entries=*/{}, committable.Identifier(),
+                     /*watermark=*/std::nullopt, committable.LogOffsets(), committable.Properties(),
+                     Snapshot::CommitKind::Compact(), /*check_append_files=*/true);
+}
+
 Result<int32_t> FileStoreCommitImpl::TryCommit(const std::vector<ManifestEntry>& delta_files,
                                                const std::vector<IndexManifestEntry>& index_entries,
                                                int64_t identifier, std::optional<int64_t> watermark,
@@ -442,8 +468,7 @@ Result<std::set<std::map<std::string, std::string>>> FileStoreCommitImpl::Change
     return partitions;
 }
 
-Result<std::vector<ManifestEntry>> FileStoreCommitImpl::ReadAllEntriesFromChangedPartitions(
-    const Snapshot& latest_snapshot,
+Result<std::unique_ptr<ConflictDetection>> FileStoreCommitImpl::CreateConflictDetection(
     const std::set<std::map<std::string, std::string>>& partitions) const {
     std::vector<std::map<std::string, std::string>> partition_filters(partitions.begin(),
                                                                       partitions.end());
@@ -451,33 +476,33 @@ Result<std::vector<ManifestEntry>> FileStoreCommitImpl::ReadAllEntriesFromChange
         std::make_shared<ScanFilter>(/*predicate=*/nullptr, partition_filters,
                                      /*bucket_filter=*/std::nullopt, /*vector_search=*/nullptr);
     PAIMON_ASSIGN_OR_RAISE(
-        auto scan, AppendOnlyFileStoreScan::Create(
-                       snapshot_manager_, schema_manager_, manifest_list_, manifest_file_,
-                       table_schema_, schema_, scan_filter, options_, executor_, memory_pool_));
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStoreScan::RawPlan> plan,
-                           scan->WithSnapshot(latest_snapshot)->CreatePlan());
-    // scan existing file metas
-    return plan->Files();
+        std::unique_ptr<FileStoreScan> scan,
+        AppendOnlyFileStoreScan::Create(snapshot_manager_, schema_manager_, manifest_list_,
+                                        manifest_file_, table_schema_, schema_, scan_filter,
+                                        options_, executor_, memory_pool_));
+    std::shared_ptr<FieldsComparator> key_comparator;
+    if (!table_schema_->PrimaryKeys().empty()) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
+                               table_schema_->TrimmedPrimaryKeys());
+        PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> trimmed_primary_key_fields,
+                               table_schema_->GetFields(trimmed_primary_keys));
+        PAIMON_ASSIGN_OR_RAISE(key_comparator,
+                               FieldsComparator::Create(trimmed_primary_key_fields,
+                                                        /*is_ascending_order=*/true,
+                                                        /*use_view=*/false));
+    }
+    return std::make_unique<ConflictDetection>(partitions, std::move(scan), snapshot_manager_,
+                                               key_comparator);
 }
 
 Status FileStoreCommitImpl::NoConflictsOrFail(const std::string& base_commit_user,
-                                              const std::vector<ManifestEntry>& base_entries,
+                                              const ConflictDetection& conflict_detection,
                                               const std::vector<ManifestEntry>& changes) const {
     ScopeGuard guard([&]() {
         PAIMON_LOG_WARN(logger_, "File deletion conflicts detected! Give up committing. %s",
                         base_commit_user.c_str());
     });
-    std::vector<ManifestEntry> all_entries = base_entries;
-    all_entries.insert(all_entries.end(), changes.begin(), changes.end());
-    std::vector<ManifestEntry> merged_entries;
-    PAIMON_RETURN_NOT_OK(FileEntry::MergeEntries(all_entries, &merged_entries));
-    for (const auto& entry : merged_entries) {
-        if (entry.Kind() == FileKind::Delete()) {
-            return Status::Invalid(fmt::format(
-                "Trying to delete file {} which is not previously added.", entry.FileName()));
-        }
-    }
-    // TODO(yonghao.fyh): check for all LSM level >= 1, key ranges of files do not intersect
+    PAIMON_RETURN_NOT_OK(conflict_detection.CheckNoConflicts(changes));
     guard.Release();
     return Status::OK();
 }
@@ -488,6 +513,7 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     std::optional<int64_t> watermark, std::map<int32_t, int64_t> log_offsets,
     const std::map<std::string, std::string>& properties, Snapshot::CommitKind commit_kind,
     const std::optional<Snapshot>& latest_snapshot, bool need_conflict_check) {
+    ScopedTimer attempt_timer(metrics_.get(), CommitMetrics::COMMIT_ATTEMPT_DURATION);
     std::vector<ManifestEntry> delta_files = delta_entries;
     int64_t start_millis = DateTimeUtils::GetCurrentUTCTimeUs() / 1000;
     int64_t new_snapshot_id = Snapshot::FIRST_SNAPSHOT_ID;
@@ -506,13 +532,16 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     }
 
     if (need_conflict_check && latest_snapshot) {
+        ScopedTimer conflict_check_timer(metrics_.get(), CommitMetrics::CONFLICT_CHECK_DURATION);
         std::set<std::map<std::string, std::string>> changed_partitions;
         PAIMON_ASSIGN_OR_RAISE(changed_partitions, ChangedPartitions(delta_files, index_entries));
-        PAIMON_ASSIGN_OR_RAISE(
-            std::vector<ManifestEntry> base_data_files,
-            ReadAllEntriesFromChangedPartitions(latest_snapshot.value(), changed_partitions));
-        PAIMON_RETURN_NOT_OK(
-            NoConflictsOrFail(latest_snapshot.value().CommitUser(), base_data_files, delta_files));
+        if (!conflict_detection_ || conflict_detection_->Partitions() != changed_partitions) {
+            PAIMON_ASSIGN_OR_RAISE(conflict_detection_,
+                                   CreateConflictDetection(changed_partitions));
+        }
+        PAIMON_RETURN_NOT_OK(conflict_detection_->Refresh(latest_snapshot.value()));
+        PAIMON_RETURN_NOT_OK(NoConflictsOrFail(latest_snapshot.value().CommitUser(),
+                                               *conflict_detection_, delta_files));
     }
 
     std::vector<ManifestFileMeta> merge_before_manifests;
@@ -548,8 +577,11 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
                                           : 0;
         std::vector<ManifestFileMeta> previous_manifests;
         // read all previous manifest files
+        Timer manifest_read_timer;
         PAIMON_RETURN_NOT_OK(
             manifest_list_->ReadDataManifests(latest_snapshot.value(), &previous_manifests));
+        metrics_->ObserveHistogram(CommitMetrics::MANIFEST_READ_DURATION,
+                                   manifest_read_timer.ElapsedUs());
         merge_before_manifests.insert(merge_before_manifests.end(), previous_manifests.begin(),
                                       previous_manifests.end());
         // read the last snapshot to complete the bucket's offsets when logOffsets does not
@@ -722,7 +754,10 @@ Result<bool> FileStoreCommitImpl::CommitSnapshotImpl(
                                entry.ToPartitionStatistics(partition_computer_.get()));
         statistics.emplace_back(std::move(partition_statistics));
     }
+    Timer atomic_store_timer;
     Result<bool> commit_result = snapshot_commit_->Commit(new_snapshot, statistics);
+    metrics_->ObserveHistogram(CommitMetrics::SNAPSHOT_ATOMIC_STORE_DURATION,
+                               atomic_store_timer.ElapsedUs());
     if (!commit_result.ok()) {
         // exception when performing the atomic rename,
         // we cannot clean up because we can't determine the success
@@ -784,6 +819,7 @@ std::shared_ptr<ManifestCommittable> FileStoreCommitImpl::CreateManifestCommitta
 Status FileStoreCommitImpl::CollectChanges(
     const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
     std::vector<ManifestEntry>* append_table_files,
+    std::vector<ManifestEntry>* compact_table_files,
     std::vector<IndexManifestEntry>* append_table_index_files) {
     for (const auto& message : commit_messages) {
         auto commit_message = std::dynamic_pointer_cast<CommitMessageImpl>(message);
@@ -808,6 +844,17 @@ Status FileStoreCommitImpl::CollectChanges(
                 append_table_index_files->emplace_back(FileKind::Add(), commit_message->Partition(),
                                                        commit_message->Bucket(), new_index_file);
             }
+            const CompactIncrement& compact_increment = commit_message->GetCompactIncrement();
+            for (const std::shared_ptr<DataFileMeta>& compact_before :
+                 compact_increment.CompactBefore()) {
+                compact_table_files->push_back(
+                    MakeEntry(FileKind::Delete(), commit_message, compact_before));
+            }
+            for (const std::shared_ptr<DataFileMeta>& compact_after :
+                 compact_increment.CompactAfter()) {
+                compact_table_files->push_back(
+                    MakeEntry(FileKind::Add(), commit_message, compact_after));
+            }
         } else {
             return Status::Invalid("fail to cast commit message to commit message impl");
         }
@@ -45,6 +45,7 @@ namespace paimon {
 
 class CommitContext;
 class CommitMessageImpl;
+class ConflictDetection;
 struct DataFileMeta;
 class ExpireSnapshots;
 class FileKind;
@@ -145,8 +146,13 @@ class FileStoreCommitImpl : public FileStoreCommit {
 
     Status CollectChanges(const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
                           std::vector<ManifestEntry>* append_table_files,
+                          std::vector<ManifestEntry>* compact_table_files,
                           std::vector<IndexManifestEntry>* append_table_index_files);
 
+    /// Commit compaction changes as a separated `Compact` snapshot, returns number of attempts.
+    Result<int32_t> CommitCompactChanges(const ManifestCommittable& committable,
+                                         const std::vector<ManifestEntry>& compact_table_files);
+
     Result<int32_t> TryCommit(const std::vector<ManifestEntry>& delta_files,
                               const std::vector<IndexManifestEntry>& index_entries,
                               int64_t identifier, std::optional<int64_t> watermark,
@@ -172,12 +178,11 @@ class FileStoreCommitImpl : public FileStoreCommit {
                              const std::optional<std::string>& old_index_manifest,
                              const std::optional<std::string>& new_index_manifest);
 
-    Result<std::vector<ManifestEntry>> ReadAllEntriesFromChangedPartitions(
-        const Snapshot& latest_snapshot,
+    Result<std::unique_ptr<ConflictDetection>> CreateConflictDetection(
         const std::set<std::map<std::string, std::string>>& partitions) const;
 
     Status NoConflictsOrFail(const std::string& base_commit_user,
-                             const std::vector<ManifestEntry>& base_entries,
+                             const ConflictDetection& conflict_detection,
                              const std::vector<ManifestEntry>& changes) const;
 
     Status CheckFilesExistence(
@@ -216,6 +221,10 @@ class FileStoreCommitImpl : public FileStoreCommit {
     std::shared_ptr<ExpireSnapshots> expire_snapshots_;
     std::shared_ptr<SchemaManager> schema_manager_;
 
+    // files of the partitions changed by the last conflict checked commit, kept between commit
+    // attempts and commits to read only the snapshots committed since
+    std::unique_ptr<ConflictDetection> conflict_detection_;
+
     std::shared_ptr<Metrics> metrics_;
     std::shared_ptr<Logger> logger_;
 };
@@ -48,6 +48,7 @@
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/operation/conflict_detection.h"
 #include "paimon/core/operation/metrics/commit_metrics.h"
 #include "paimon/core/partition/partition_statistics.h"
 #include "paimon/core/stats/simple_stats.h"
@@ -300,6 +301,16 @@ TEST_F(FileStoreCommitImplTest, TestCommit) {
     ASSERT_OK_AND_ASSIGN(uint64_t counter,
                          metrics->GetCounter(CommitMetrics::LAST_COMMIT_ATTEMPTS));
     ASSERT_EQ(1u, counter);
+    ASSERT_OK_AND_ASSIGN(HistogramStats commit_duration,
+                         metrics->GetHistogram(CommitMetrics::COMMIT_DURATION));
+    ASSERT_EQ(1u, commit_duration.count);
+    ASSERT_OK_AND_ASSIGN(HistogramStats attempt_duration,
+                         metrics->GetHistogram(CommitMetrics::COMMIT_ATTEMPT_DURATION));
+    ASSERT_EQ(1u, attempt_duration.count);
+    ASSERT_LE(attempt_duration.max, commit_duration.max);
+    ASSERT_OK_AND_ASSIGN(HistogramStats store_duration,
+                         metrics->GetHistogram(CommitMetrics::SNAPSHOT_ATOMIC_STORE_DURATION));
+    ASSERT_EQ(1u, store_duration.count);
     ASSERT_OK_AND_ASSIGN(
         bool exist, file_system_->Exists(PathUtil::JoinPath(table_path_, "snapshot/snapshot-1")));
     ASSERT_TRUE(exist);
@@ -918,6 +929,14 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
     ASSERT_OK_AND_ASSIGN(auto commit, FileStoreCommit::Create(std::move(commit_context)));
     auto commit_impl = dynamic_cast<FileStoreCommitImpl*>(commit.get());
     ASSERT_TRUE(commit_impl);
+    auto no_conflicts_or_fail = [&](const std::vector<ManifestEntry>& base_entries,
+                                    const std::vector<ManifestEntry>& changes) -> Status {
+        ConflictDetection conflict_detection(/*partitions=*/{}, /*scan=*/nullptr,
+                                             /*snapshot_manager=*/nullptr,
+                                             /*key_comparator=*/nullptr);
+        PAIMON_RETURN_NOT_OK(conflict_detection.AddEntries(base_entries));
+        return commit_impl->NoConflictsOrFail("commit_user_1", conflict_detection, changes);
+    };
     {
         std::vector<ManifestEntry> base_entries;
         base_entries.push_back(CreateManifestEntry("file1", FileKind::Add()));
@@ -932,7 +951,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         changes.push_back(CreateManifestEntry("file3", FileKind::Delete()));
         changes.push_back(CreateManifestEntry("file4", FileKind::Delete()));
         changes.push_back(CreateManifestEntry("file5", FileKind::Delete()));
-        ASSERT_OK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_OK(no_conflicts_or_fail(base_entries, changes));
     }
     {
         std::vector<ManifestEntry> base_entries;
@@ -949,7 +968,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         changes.push_back(CreateManifestEntry("file3", FileKind::Delete()));
         changes.push_back(CreateManifestEntry("file4", FileKind::Delete()));
         changes.push_back(CreateManifestEntry("file5", FileKind::Delete()));
-        ASSERT_OK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_OK(no_conflicts_or_fail(base_entries, changes));
     }
     {
         std::vector<ManifestEntry> base_entries;
@@ -961,7 +980,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         changes.push_back(CreateManifestEntry("file3", FileKind::Add()));
         changes.push_back(CreateManifestEntry("file4", FileKind::Add()));
         changes.push_back(CreateManifestEntry("file5", FileKind::Add()));
-        ASSERT_NOK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_NOK(no_conflicts_or_fail(base_entries, changes));
     }
     {
         std::vector<ManifestEntry> base_entries;
@@ -977,7 +996,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         changes.push_back(CreateManifestEntry("file3", FileKind::Add()));
         changes.push_back(CreateManifestEntry("file4", FileKind::Add()));
         changes.push_back(CreateManifestEntry("file5", FileKind::Add()));
-        ASSERT_NOK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_NOK(no_conflicts_or_fail(base_entries, changes));
     }
     {
         std::vector<ManifestEntry> base_entries;
@@ -993,7 +1012,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         changes.push_back(CreateManifestEntry("file3", FileKind::Add()));
         changes.push_back(CreateManifestEntry("file4", FileKind::Add()));
         changes.push_back(CreateManifestEntry("file5", FileKind::Add()));
-        ASSERT_NOK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_NOK(no_conflicts_or_fail(base_entries, changes));
     }
     {
         std::vector<ManifestEntry> base_entries;
@@ -1001,7 +1020,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         base_entries.push_back(CreateManifestEntry("file1", FileKind::Delete()));
 
         std::vector<ManifestEntry> changes;
-        ASSERT_OK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_OK(no_conflicts_or_fail(base_entries, changes));
     }
     {
         std::vector<ManifestEntry> base_entries;
@@ -1012,7 +1031,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         base_entries.push_back(CreateManifestEntry("file5", FileKind::Delete()));
 
         std::vector<ManifestEntry> changes;
-        ASSERT_NOK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_NOK(no_conflicts_or_fail(base_entries, changes));
     }
     {
         std::vector<ManifestEntry> base_entries;
@@ -1029,7 +1048,7 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
         changes.push_back(CreateManifestEntry("file4", FileKind::Delete()));
         changes.push_back(CreateManifestEntry("file5", FileKind::Delete()));
         changes.push_back(CreateManifestEntry("file6", FileKind::Delete()));
-        ASSERT_NOK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, changes));
+        ASSERT_NOK(no_conflicts_or_fail(base_entries, changes));
     }
 }
 
@@ -1096,6 +1115,133 @@ TEST_F(FileStoreCommitImplTest, TestTryOverwriteFromNothing) {
     ASSERT_EQ(FileKind::Add(), entries2[0].Kind());
 }
 
+TEST_F(FileStoreCommitImplTest, TestConflictDetectionReadsDeltaOfNewSnapshots) {
+    CommitContextBuilder context_builder(table_path_, "commit_user_1");
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
+                         context_builder.AddOption(Options::MANIFEST_FORMAT, "orc")
+                             .AddOption(Options::MANIFEST_TARGET_FILE_SIZE, "8mb")
+                             .AddOption(Options::FILE_SYSTEM, "local")
+                             .IgnoreEmptyCommit(true)
+                             .Finish());
+
+    ASSERT_OK_AND_ASSIGN(auto commit, FileStoreCommit::Create(std::move(commit_context)));
+    auto commit_impl = dynamic_cast<FileStoreCommitImpl*>(commit.get());
+    ASSERT_TRUE(commit_impl);
+    std::vector<std::map<std::string, std::string>> partitions = {{{"f1", "10"}}};
+    auto overwrite = [&](const std::string& file_name, int64_t commit_identifier) -> Status {
+        std::vector<ManifestEntry> changes;
+        changes.push_back(CreateManifestEntry(file_name, FileKind::Add()));
+        return commit_impl->TryOverwrite(partitions, changes, commit_identifier, std::nullopt);
+    };
+    auto indexed_file_names = [&]() {
+        std::vector<std::string> file_names;
+        for (const auto& [_, files] : commit_impl->conflict_detection_->bucket_files_) {
+            for (const auto& [identifier, entry] : files) {
+                file_names.push_back(entry.FileName());
+            }
+        }
+        return file_names;
+    };
+    // nothing to check against an empty table
+    ASSERT_OK(overwrite("new_file_1", /*commit_identifier=*/0));
+    ASSERT_FALSE(commit_impl->conflict_detection_);
+    // built from a full scan of snapshot 1
+    ASSERT_OK(overwrite("new_file_2", /*commit_identifier=*/1));
+    ASSERT_EQ(1, commit_impl->conflict_detection_->IndexedSnapshotId().value());
+    ASSERT_EQ(std::vector<std::string>({"new_file_1"}), indexed_file_names());
+    // only the delta of snapshot 2 is read
+    ConflictDetection* conflict_detection = commit_impl->conflict_detection_.get();
+    ASSERT_OK(overwrite("new_file_3", /*commit_identifier=*/2));
+    ASSERT_EQ(conflict_detection, commit_impl->conflict_detection_.get());
+    ASSERT_EQ(2, conflict_detection->IndexedSnapshotId().value());
+    ASSERT_EQ(std::vector<std::string>({"new_file_2"}), indexed_file_names());
+
+    ASSERT_OK_AND_ASSIGN(auto snapshot3, commit_impl->snapshot_manager_->LatestSnapshot());
+    ASSERT_OK(conflict_detection->Refresh(snapshot3.value()));
+    ASSERT_EQ(3, conflict_detection->IndexedSnapshotId().value());
+    ASSERT_EQ(std::vector<std::string>({"new_file_3"}), indexed_file_names());
+    // deleting a file which is already deleted by snapshot 3 conflicts
+    std::vector<ManifestEntry> changes;
+    changes.push_back(CreateManifestEntry("new_file_2", FileKind::Delete()));
+    ASSERT_NOK_WITH_MSG(conflict_detection->CheckNoConflicts(changes),
+                        "Trying to delete file new_file_2 which is not previously added.");
+}
+
+TEST_F(FileStoreCommitImplTest, TestConflictDetectionRebuiltAfterRollback) {
+    auto create_commit =
+        [&](const std::string& commit_user) -> Result<std::unique_ptr<FileStoreCommit>> {
+        CommitContextBuilder context_builder(table_path_, commit_user);
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<CommitContext> commit_context,
+                               context_builder.AddOption(Options::MANIFEST_FORMAT, "orc")
+                                   .AddOption(Options::MANIFEST_TARGET_FILE_SIZE, "8mb")
+                                   .AddOption(Options::FILE_SYSTEM, "local")
+                                   .IgnoreEmptyCommit(true)
+                                   .Finish());
+        return FileStoreCommit::Create(std::move(commit_context));
+    };
+    std::vector<std::map<std::string, std::string>> partitions = {{{"f1", "10"}}};
+    auto overwrite = [&](FileStoreCommitImpl* commit_impl, const std::string& file_name,
+                         int64_t commit_identifier) -> Status {
+        std::vector<ManifestEntry> changes;
+        changes.push_back(CreateManifestEntry(file_name, FileKind::Add()));
+        return commit_impl->TryOverwrite(partitions, changes, commit_identifier, std::nullopt);
+    };
+
+    ASSERT_OK_AND_ASSIGN(auto commit, create_commit("commit_user_1"));
+    auto commit_impl = dynamic_cast<FileStoreCommitImpl*>(commit.get());
+    ASSERT_TRUE(commit_impl);
+    ASSERT_OK(overwrite(commit_impl, "new_file_1", /*commit_identifier=*/0));
+    ASSERT_OK(overwrite(commit_impl, "new_file_2", /*commit_identifier=*/1));
+    ASSERT_OK(overwrite(commit_impl, "new_file_3", /*commit_identifier=*/2));
+    ConflictDetection* conflict_detection = commit_impl->conflict_detection_.get();
+    ASSERT_EQ(2, conflict_detection->IndexedSnapshotId().value());
+    ASSERT_OK_AND_ASSIGN(auto snapshot3, commit_impl->snapshot_manager_->LatestSnapshot());
+    ASSERT_OK(conflict_detection->Refresh(snapshot3.value()));
+    ASSERT_EQ(3, conflict_detection->IndexedSnapshotId().value());
+
+    // another writer rolls the table back to snapshot 1 and commits snapshots 2 to 4 again, while
+    // the snapshots cached by the first writer are stale
+    ASSERT_OK_AND_ASSIGN(auto commit2, create_commit("commit_user_2"));
+    auto commit_impl2 = dynamic_cast<FileStoreCommitImpl*>(commit2.get());
+    ASSERT_TRUE(commit_impl2);
+    ASSERT_OK(commit_impl2->snapshot_manager_->DeleteSnapshot(3));
+    ASSERT_OK(commit_impl2->snapshot_manager_->DeleteSnapshot(2));
+    ASSERT_OK(commit_impl2->snapshot_manager_->CommitLatestHint(1));
+    ASSERT_OK(overwrite(commit_impl2, "new_file_a", /*commit_identifier=*/0));
+    ASSERT_OK(overwrite(commit_impl2, "new_file_b", /*commit_identifier=*/1));
+    ASSERT_OK_AND_ASSIGN(auto new_snapshot3, commit_impl2->snapshot_manager_->LatestSnapshot());
+    ASSERT_EQ(3, new_snapshot3.value().Id());
+
+    auto check_indexed_files = [&](const std::vector<std::string>& expected_file_names) {
+        std::vector<std::string> file_names;
+        for (const auto& [_, files] : conflict_detection->bucket_files_) {
+            for (const auto& [identifier, entry] : files) {
+                ASSERT_EQ(FileKind::Add(), entry.Kind());
+                file_names.push_back(entry.FileName());
+            }
+        }
+        ASSERT_EQ(expected_file_names, file_names);
+    };
+    // same id as the indexed snapshot, but a different commit
+    ASSERT_OK(conflict_detection->Refresh(new_snapshot3.value()));
+    ASSERT_EQ(3, conflict_detection->IndexedSnapshotId().value());
+    check_indexed_files({"new_file_b"});
+
+    // index the rolled back snapshot 3 again, a newer snapshot on top of it is not read as a delta
+    ASSERT_OK(conflict_detection->Refresh(snapshot3.value()));
+    check_indexed_files({"new_file_3"});
+    ASSERT_OK(overwrite(commit_impl2, "new_file_c", /*commit_identifier=*/2));
+    ASSERT_OK_AND_ASSIGN(auto snapshot4, commit_impl2->snapshot_manager_->LatestSnapshot());
+    ASSERT_EQ(4, snapshot4.value().Id());
+    ASSERT_OK(conflict_detection->Refresh(snapshot4.value()));
+    ASSERT_EQ(4, conflict_detection->IndexedSnapshotId().value());
+    check_indexed_files({"new_file_c"});
+    std::vector<ManifestEntry> changes;
+    changes.push_back(CreateManifestEntry("new_file_3", FileKind::Delete()));
+    ASSERT_NOK_WITH_MSG(conflict_detection->CheckNoConflicts(changes),
+                        "Trying to delete file new_file_3 which is not previously added.");
+}
+
 TEST_F(FileStoreCommitImplTest, TestTryOverwriteThenCommit) {
     CommitContextBuilder context_builder(table_path_, "commit_user_1");
     ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
@@ -127,6 +127,14 @@ class FileStoreScan {
         return core_options_;
     }
 
+    const std::shared_ptr<TableSchema>& GetTableSchema() const {
+        return table_schema_;
+    }
+
+    const std::shared_ptr<MemoryPool>& GetMemoryPool() const {
+        return pool_;
+    }
+
     std::shared_ptr<PredicateFilter> GetNonPartitionPredicate() const {
         return predicates_;
     }
@@ -23,12 +23,9 @@
 #include "fmt/format.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/core/core_options.h"
-#include "paimon/core/mergetree/compact/lookup_merge_function.h"
 #include "paimon/core/mergetree/compact/merge_function.h"
-#include "paimon/core/mergetree/compact/reducer_merge_function_wrapper.h"
 #include "paimon/core/operation/append_only_file_store_write.h"
 #include "paimon/core/operation/key_value_file_store_write.h"
-#include "paimon/core/options/merge_engine.h"
 #include "paimon/core/postpone/postpone_bucket_file_store_write.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
@@ -47,9 +44,6 @@ class Schema;
 }  // namespace arrow
 
 namespace paimon {
-struct KeyValue;
-template <typename T>
-class MergeFunctionWrapper;
 
 Result<std::unique_ptr<FileStoreWrite>> FileStoreWrite::Create(std::unique_ptr<WriteContext> ctx) {
     if (ctx == nullptr) {
@@ -149,23 +143,18 @@ Result<std::unique_ptr<FileStoreWrite>> FileStoreWrite::Create(std::unique_ptr<W
                                FieldsComparator::Create(trimmed_primary_key_fields,
                                                         options.SequenceFieldSortOrderIsAscending(),
                                                         /*use_view=*/true));
-        auto primary_keys = schema->PrimaryKeys();
-        PAIMON_ASSIGN_OR_RAISE(
-            std::unique_ptr<MergeFunction> merge_function,
-            PrimaryKeyTableUtils::CreateMergeFunction(arrow_schema, primary_keys, options));
-        if (options.NeedLookup() && options.GetMergeEngine() != MergeEngine::FIRST_ROW) {
-            // don't wrap first row, it is already OK
-            merge_function = std::make_unique<LookupMergeFunction>(std::move(merge_function));
-        }
-        std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper =
-            std::make_shared<ReducerMergeFunctionWrapper>(std::move(merge_function));
+        // validate merge engine options eagerly, each bucket writer creates its own merge
+        // function later since merge function is stateful
+        PAIMON_RETURN_NOT_OK(
+            PrimaryKeyTableUtils::CreateMergeFunction(arrow_schema, schema->PrimaryKeys(), options)
+                .status());
         PAIMON_ASSIGN_OR_RAISE(
             std::shared_ptr<FieldsComparator> sequence_fields_comparator,
             PrimaryKeyTableUtils::CreateSequenceFieldsComparator(schema->Fields(), options));
         return std::make_unique<KeyValueFileStoreWrite>(
             file_store_path_factory, snapshot_manager, schema_manager, ctx->GetCommitUser(),
             ctx->GetRootPath(), schema, arrow_schema, partition_schema, key_comparator,
-            sequence_fields_comparator, merge_function_wrapper, options, ignore_previous_files,
+            sequence_fields_comparator, options, ignore_previous_files,
             ctx->IsStreamingMode(), ctx->IgnoreNumBucketCheck(), ctx->GetExecutor(),
             ctx->GetMemoryPool());
     }
@@ -16,12 +16,18 @@
 
 #include "paimon/core/operation/internal_read_context.h"
 
+#include <cassert>
+#include <optional>
 #include <utility>
 
+#include "fmt/format.h"
 #include "paimon/common/predicate/predicate_validator.h"
 #include "paimon/common/table/special_fields.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/core/schema/arrow_schema_validator.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/utils/branch_manager.h"
+#include "paimon/defs.h"
 #include "paimon/status.h"
 
 namespace arrow {
@@ -76,6 +82,41 @@ Result<std::unique_ptr<InternalReadContext>> InternalReadContext::Create(
         new InternalReadContext(context, table_schema, read_schema, core_options));
 }
 
+Result<std::unique_ptr<InternalReadContext>> InternalReadContext::Create(
+    const std::shared_ptr<ReadContext>& context, const std::string& branch) {
+    std::map<std::string, std::string> tmp_options = context->GetOptions();
+    std::shared_ptr<TableSchema> table_schema;
+    const auto& specific_table_schema = context->GetSpecificTableSchema();
+    if (branch == BranchManager::DEFAULT_MAIN_BRANCH && specific_table_schema) {
+        PAIMON_ASSIGN_OR_RAISE(table_schema,
+                               TableSchema::CreateFromJson(specific_table_schema.value()));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(
+            CoreOptions tmp_core_options,
+            CoreOptions::FromMap(tmp_options, context->GetFileSystemSchemeToIdentifierMap(),
+                                 context->GetSpecificFileSystem()));
+        SchemaManager schema_manager(tmp_core_options.GetFileSystem(), context->GetPath(), branch);
+        PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_schema,
+                               schema_manager.Latest());
+        if (!latest_schema) {
+            return Status::Invalid(fmt::format("schema file not found in path {}, branch {}",
+                                               context->GetPath(), branch));
+        }
+        table_schema = latest_schema.value();
+    }
+    assert(table_schema);
+
+    // merge options
+    auto options = table_schema->Options();
+    for (const auto& [key, value] : tmp_options) {
+        options[key] = value;
+    }
+    if (branch != BranchManager::DEFAULT_MAIN_BRANCH) {
+        options[Options::BRANCH] = branch;
+    }
+    return InternalReadContext::Create(context, table_schema, options);
+}
+
 InternalReadContext::InternalReadContext(const std::shared_ptr<ReadContext>& read_context,
                                          const std::shared_ptr<TableSchema>& table_schema,
                                          const std::shared_ptr<arrow::Schema>& read_schema,
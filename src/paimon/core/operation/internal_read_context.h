@@ -44,6 +44,11 @@ class InternalReadContext {
         const std::shared_ptr<TableSchema>& table_schema,
         const std::map<std::string, std::string>& options);
 
+    /// Load the latest schema of `branch` (or the specific table schema of `read_context` for the
+    /// main branch), and merge options of the schema with options of `read_context`.
+    static Result<std::unique_ptr<InternalReadContext>> Create(
+        const std::shared_ptr<ReadContext>& read_context, const std::string& branch);
+
     const CoreOptions& GetCoreOptions() const {
         return options_;
     }
@@ -19,17 +19,36 @@
 #include <optional>
 #include <vector>
 
+#include "arrow/type.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/core/compact/compact_manager.h"
+#include "paimon/core/compact/noop_compact_manager.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/key_value_file_reader_factory.h"
+#include "paimon/core/io/key_value_file_writer_factory.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/mergetree/compact/lookup_merge_function.h"
+#include "paimon/core/mergetree/compact/merge_function.h"
+#include "paimon/core/mergetree/compact/merge_tree_compact_manager.h"
+#include "paimon/core/mergetree/compact/merge_tree_compact_rewriter.h"
+#include "paimon/core/mergetree/compact/reducer_merge_function_wrapper.h"
+#include "paimon/core/mergetree/compact/universal_compaction.h"
+#include "paimon/core/mergetree/levels.h"
 #include "paimon/core/mergetree/merge_tree_writer.h"
 #include "paimon/core/operation/file_store_scan.h"
 #include "paimon/core/operation/key_value_file_store_scan.h"
+#include "paimon/core/options/changelog_producer.h"
+#include "paimon/core/options/merge_engine.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/snapshot.h"
+#include "paimon/core/utils/fields_comparator.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/objects_cache.h"
+#include "paimon/core/utils/primary_key_table_utils.h"
 #include "paimon/core/utils/snapshot_manager.h"
 
 namespace arrow {
@@ -54,7 +73,6 @@ KeyValueFileStoreWrite::KeyValueFileStoreWrite(
     const std::shared_ptr<arrow::Schema>& partition_schema,
     const std::shared_ptr<FieldsComparator>& key_comparator,
     const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
-    const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
     const CoreOptions& options, bool ignore_previous_files, bool is_streaming_mode,
     bool ignore_num_bucket_check, const std::shared_ptr<Executor>& executor,
     const std::shared_ptr<MemoryPool>& pool)
@@ -64,7 +82,6 @@ KeyValueFileStoreWrite::KeyValueFileStoreWrite(
                              ignore_num_bucket_check, executor, pool),
       key_comparator_(key_comparator),
       user_defined_seq_comparator_(user_defined_seq_comparator),
-      merge_function_wrapper_(merge_function_wrapper),
       logger_(Logger::GetLogger("KeyValueFileStoreWrite")) {}
 
 Result<std::unique_ptr<FileStoreScan>> KeyValueFileStoreWrite::CreateFileStoreScan(
@@ -72,7 +89,8 @@ Result<std::unique_ptr<FileStoreScan>> KeyValueFileStoreWrite::CreateFileStoreSc
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<ManifestList> manifest_list,
         ManifestList::Create(options_.GetFileSystem(), options_.GetManifestFormat(),
-                             options_.GetManifestCompression(), file_store_path_factory_, pool_));
+                             options_.GetManifestCompression(), file_store_path_factory_, pool_,
+                             ObjectsCache::GetShared(options_.GetManifestCacheMaxMemorySize())));
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<ManifestFile> manifest_file,
         ManifestFile::Create(options_.GetFileSystem(), options_.GetManifestFormat(),
@@ -104,11 +122,80 @@ Result<std::pair<int32_t, std::shared_ptr<BatchWriter>>> KeyValueFileStoreWrite:
                            file_store_path_factory_->CreateDataFilePathFactory(partition, bucket));
     PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
                            table_schema_->TrimmedPrimaryKeys());
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<CompactManager> compact_manager,
+                           CreateCompactManager(partition, data_file_path_factory,
+                                                trimmed_primary_keys, restore_files));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper,
+                           CreateMergeFunctionWrapper());
     auto writer = std::make_shared<MergeTreeWriter>(
         max_sequence_number, trimmed_primary_keys, data_file_path_factory, key_comparator_,
-        user_defined_seq_comparator_, merge_function_wrapper_, table_schema_->Id(), schema_,
-        options_, pool_);
+        user_defined_seq_comparator_, merge_function_wrapper, table_schema_->Id(), schema_,
+        options_, pool_, compact_manager);
     return std::pair<int32_t, std::shared_ptr<BatchWriter>>(total_buckets, writer);
 }
 
+Result<std::shared_ptr<MergeFunctionWrapper<KeyValue>>>
+KeyValueFileStoreWrite::CreateMergeFunctionWrapper() const {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<MergeFunction> merge_function,
+                           PrimaryKeyTableUtils::CreateMergeFunction(
+                               schema_, table_schema_->PrimaryKeys(), options_));
+    if (options_.NeedLookup() && options_.GetMergeEngine() != MergeEngine::FIRST_ROW) {
+        // don't wrap first row, it is already OK
+        merge_function = std::make_unique<LookupMergeFunction>(std::move(merge_function));
+    }
+    return std::make_shared<ReducerMergeFunctionWrapper>(std::move(merge_function));
+}
+
+Result<std::shared_ptr<CompactManager>> KeyValueFileStoreWrite::CreateCompactManager(
+    const BinaryRow& partition, const std::shared_ptr<DataFilePathFactory>& path_factory,
+    const std::vector<std::string>& trimmed_primary_keys,
+    const std::vector<std::shared_ptr<DataFileMeta>>& restore_files) const {
+    // Deletion vectors, lookup and full compaction changelog producer rely on compaction to
+    // maintain extra files, which is not supported yet.
+    if (options_.WriteOnly() || options_.NeedLookup() ||
+        options_.GetChangelogProducer() == ChangelogProducer::FULL_COMPACTION) {
+        return std::make_shared<NoopCompactManager>();
+    }
+    // comparator of min_key and max_key of data files
+    PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> trimmed_primary_key_fields,
+                           table_schema_->GetFields(trimmed_primary_keys));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FieldsComparator> file_key_comparator,
+                           FieldsComparator::Create(trimmed_primary_key_fields,
+                                                    /*is_ascending_order=*/true,
+                                                    /*use_view=*/false));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<Levels> levels,
+        Levels::Create(file_key_comparator, restore_files, options_.GetNumLevels()));
+
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueFileReaderFactory> reader_factory,
+                           KeyValueFileReaderFactory::Create(table_schema_, root_path_, schema_,
+                                                             partition, path_factory, options_,
+                                                             pool_));
+    arrow::FieldVector write_fields;
+    write_fields.push_back(
+        DataField::ConvertDataFieldToArrowField(SpecialFields::SequenceNumber()));
+    write_fields.push_back(DataField::ConvertDataFieldToArrowField(SpecialFields::ValueKind()));
+    write_fields.insert(write_fields.end(), schema_->fields().begin(), schema_->fields().end());
+    auto writer_factory = std::make_shared<KeyValueFileWriterFactory>(
+        table_schema_->Id(), trimmed_primary_keys, arrow::schema(write_fields), path_factory,
+        options_, pool_);
+    // merge function is stateful, compaction runs in executor concurrently with writing, so it
+    // can not share the merge function with writers
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<MergeFunction> merge_function,
+                           PrimaryKeyTableUtils::CreateMergeFunction(
+                               schema_, table_schema_->PrimaryKeys(), options_));
+    auto merge_function_wrapper =
+        std::make_shared<ReducerMergeFunctionWrapper>(std::move(merge_function));
+    auto rewriter = std::make_shared<MergeTreeCompactRewriter>(
+        std::move(reader_factory), writer_factory, key_comparator_, user_defined_seq_comparator_,
+        merge_function_wrapper, options_.GetWriteBatchSize(), pool_);
+
+    auto strategy = std::make_unique<UniversalCompaction>(
+        options_.GetCompactionMaxSizeAmplificationPercent(), options_.GetCompactionSizeRatio(),
+        options_.GetNumSortedRunsCompactionTrigger());
+    return std::make_shared<MergeTreeCompactManager>(
+        executor_, std::move(levels), std::move(strategy), file_key_comparator,
+        options_.GetCompactionFileSize(), options_.GetNumSortedRunsStopTrigger(), rewriter);
+}
+
 }  // namespace paimon
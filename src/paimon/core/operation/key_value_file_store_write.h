@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "paimon/core/mergetree/compact/merge_function_wrapper.h"
 #include "paimon/core/operation/abstract_file_store_write.h"
@@ -33,6 +34,8 @@ class Schema;
 
 namespace paimon {
 
+class CompactManager;
+class DataFilePathFactory;
 class FieldsComparator;
 class FileStoreScan;
 class ScanFilter;
@@ -44,6 +47,7 @@ class MemoryPool;
 class SchemaManager;
 class SnapshotManager;
 class TableSchema;
+struct DataFileMeta;
 struct KeyValue;
 template <typename T>
 class MergeFunctionWrapper;
@@ -59,7 +63,6 @@ class KeyValueFileStoreWrite : public AbstractFileStoreWrite {
         const std::shared_ptr<arrow::Schema>& partition_schema,
         const std::shared_ptr<FieldsComparator>& key_comparator,
         const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
-        const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
         const CoreOptions& options, bool ignore_previous_files, bool is_streaming_mode,
         bool ignore_num_bucket_check, const std::shared_ptr<Executor>& executor,
         const std::shared_ptr<MemoryPool>& pool);
@@ -71,10 +74,18 @@ class KeyValueFileStoreWrite : public AbstractFileStoreWrite {
     Result<std::unique_ptr<FileStoreScan>> CreateFileStoreScan(
         const std::shared_ptr<ScanFilter>& filter) const override;
 
+    // merge function is stateful and writers of different buckets may flush concurrently, so
+    // each writer owns its merge function
+    Result<std::shared_ptr<MergeFunctionWrapper<KeyValue>>> CreateMergeFunctionWrapper() const;
+
+    Result<std::shared_ptr<CompactManager>> CreateCompactManager(
+        const BinaryRow& partition, const std::shared_ptr<DataFilePathFactory>& path_factory,
+        const std::vector<std::string>& trimmed_primary_keys,
+        const std::vector<std::shared_ptr<DataFileMeta>>& restore_files) const;
+
  private:
     std::shared_ptr<FieldsComparator> key_comparator_;
     std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
-    std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper_;
     std::unique_ptr<Logger> logger_;
 };
 
@@ -18,6 +18,9 @@
 
 #include <cstddef>
 #include <map>
+#include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/array/array_base.h"
@@ -30,10 +33,22 @@
 #include "gtest/gtest.h"
 #include "paimon/catalog/catalog.h"
 #include "paimon/catalog/identifier.h"
+#include "paimon/common/data/data_define.h"
 #include "paimon/common/utils/path_util.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/data_increment.h"
+#include "paimon/core/operation/metrics/write_metrics.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/defs.h"
 #include "paimon/file_store_write.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
 #include "paimon/record_batch.h"
 #include "paimon/status.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/data_generator.h"
 #include "paimon/testing/utils/testharness.h"
 #include "paimon/write_context.h"
 
@@ -133,4 +148,142 @@ TEST(KeyValueFileStoreWriteTest, TestWriteWithInvalidBatch) {
         ArrowArrayRelease(&arrow_array);
     }
 }
+
+namespace {
+// write rows of 8 buckets and return row count of new files of each commit message in order, and
+// write metrics after preparing commit. For partial-update table, each key is written twice and
+// the value stats of new files are returned as well.
+void WriteAndPrepareCommit(const std::map<std::string, std::string>& options,
+                           std::vector<std::pair<int32_t, int64_t>>* bucket_row_counts,
+                           std::shared_ptr<Metrics>* metrics = nullptr,
+                           const std::string& merge_engine = "deduplicate",
+                           std::vector<std::string>* value_stats = nullptr) {
+    arrow::Schema typed_schema(
+        {arrow::field("k", arrow::int64()), arrow::field("v", arrow::utf8())});
+    ::ArrowSchema schema;
+    ASSERT_TRUE(arrow::ExportSchema(typed_schema, &schema).ok());
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    ASSERT_OK_AND_ASSIGN(auto catalog, Catalog::Create(dir->Str(), {}));
+    ASSERT_OK(catalog->CreateDatabase("foo", {}, /*ignore_if_exists=*/false));
+    ASSERT_OK(catalog->CreateTable(Identifier("foo", "bar"), &schema, /*partition_keys=*/{},
+                                   /*primary_keys=*/{"k"},
+                                   /*options=*/
+                                   {{Options::BUCKET, "8"}, {Options::MERGE_ENGINE, merge_engine}},
+                                   /*ignore_if_exists=*/false));
+    std::string table_path = PathUtil::JoinPath(dir->Str(), "foo.db/bar");
+    SchemaManager schema_manager(std::make_shared<LocalFileSystem>(), table_path);
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableSchema>> table_schema,
+                         schema_manager.Latest());
+    ASSERT_TRUE(table_schema);
+
+    auto pool = GetDefaultPool();
+    std::vector<BinaryRow> rows;
+    for (int64_t key = 0; key < 1000; ++key) {
+        rows.push_back(BinaryRowGenerator::GenerateRow({key, "value-" + std::to_string(key)},
+                                                       pool.get()));
+        if (merge_engine == "partial-update") {
+            rows.push_back(BinaryRowGenerator::GenerateRow({key, NullType()}, pool.get()));
+        }
+    }
+    DataGenerator generator(table_schema.value(), pool);
+    ASSERT_OK_AND_ASSIGN(std::vector<std::unique_ptr<RecordBatch>> batches,
+                         generator.SplitArrayByPartitionAndBucket(rows));
+
+    WriteContextBuilder builder(table_path, "test");
+    for (const auto& [key, value] : options) {
+        builder.AddOption(key, value);
+    }
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<WriteContext> write_context, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto file_store_write, FileStoreWrite::Create(std::move(write_context)));
+    for (auto& batch : batches) {
+        ASSERT_OK(file_store_write->Write(std::move(batch)));
+    }
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> messages,
+                         file_store_write->PrepareCommit(/*wait_compaction=*/false,
+                                                         /*commit_identifier=*/0));
+    for (const auto& message : messages) {
+        auto message_impl = std::dynamic_pointer_cast<CommitMessageImpl>(message);
+        ASSERT_TRUE(message_impl);
+        int64_t row_count = 0;
+        for (const auto& file : message_impl->GetNewFilesIncrement().NewFiles()) {
+            row_count += file->row_count;
+            if (value_stats) {
+                value_stats->push_back(file->value_stats.ToString());
+            }
+        }
+        bucket_row_counts->emplace_back(message_impl->Bucket(), row_count);
+    }
+    if (metrics) {
+        *metrics = file_store_write->GetMetrics();
+    }
+    ASSERT_OK(file_store_write->Close());
+}
+}  // namespace
+
+TEST(KeyValueFileStoreWriteTest, TestPrepareCommitWithParallelFlush) {
+    std::vector<std::pair<int32_t, int64_t>> serial_result;
+    WriteAndPrepareCommit({{Options::WRITE_PREPARE_COMMIT_PARALLELISM, "1"}}, &serial_result);
+    std::vector<std::pair<int32_t, int64_t>> parallel_result;
+    WriteAndPrepareCommit({{Options::WRITE_PREPARE_COMMIT_PARALLELISM, "8"}}, &parallel_result);
+
+    ASSERT_EQ(8, parallel_result.size());
+    int64_t total_row_count = 0;
+    for (const auto& [bucket, row_count] : parallel_result) {
+        ASSERT_GT(row_count, 0) << bucket;
+        total_row_count += row_count;
+    }
+    ASSERT_EQ(1000, total_row_count);
+    // commit messages are in the same order regardless of parallelism
+    ASSERT_EQ(serial_result, parallel_result);
+}
+
+TEST(KeyValueFileStoreWriteTest, TestPrepareCommitWithParallelFlushOfPartialUpdateTable) {
+    // merge function is stateful, writers flushed concurrently must not share it
+    for (int32_t i = 0; i < 5; ++i) {
+        std::vector<std::pair<int32_t, int64_t>> serial_result;
+        std::vector<std::string> serial_value_stats;
+        WriteAndPrepareCommit({{Options::WRITE_PREPARE_COMMIT_PARALLELISM, "1"}}, &serial_result,
+                              /*metrics=*/nullptr, "partial-update", &serial_value_stats);
+        std::vector<std::pair<int32_t, int64_t>> parallel_result;
+        std::vector<std::string> parallel_value_stats;
+        WriteAndPrepareCommit({{Options::WRITE_PREPARE_COMMIT_PARALLELISM, "8"}},
+                              &parallel_result, /*metrics=*/nullptr, "partial-update",
+                              &parallel_value_stats);
+
+        ASSERT_EQ(8, parallel_result.size());
+        int64_t total_row_count = 0;
+        for (const auto& [bucket, row_count] : parallel_result) {
+            total_row_count += row_count;
+        }
+        // two rows of each key are merged into one
+        ASSERT_EQ(1000, total_row_count);
+        ASSERT_EQ(serial_result, parallel_result);
+        ASSERT_EQ(serial_value_stats, parallel_value_stats);
+    }
+}
+
+TEST(KeyValueFileStoreWriteTest, TestPreemptMemoryOfLargestWriter) {
+    std::vector<std::pair<int32_t, int64_t>> unlimited_result;
+    std::shared_ptr<Metrics> unlimited_metrics;
+    WriteAndPrepareCommit({}, &unlimited_result, &unlimited_metrics);
+    ASSERT_OK_AND_ASSIGN(uint64_t preempt_count,
+                         unlimited_metrics->GetCounter(WriteMetrics::BUFFER_PREEMPT_COUNT));
+    ASSERT_EQ(0u, preempt_count);
+
+    // each write exceeds the total buffer size, so that the written writer is flushed at once
+    std::vector<std::pair<int32_t, int64_t>> limited_result;
+    std::shared_ptr<Metrics> limited_metrics;
+    WriteAndPrepareCommit({{Options::WRITE_TOTAL_BUFFER_SIZE, "1"}}, &limited_result,
+                          &limited_metrics);
+    ASSERT_OK_AND_ASSIGN(preempt_count,
+                         limited_metrics->GetCounter(WriteMetrics::BUFFER_PREEMPT_COUNT));
+    ASSERT_EQ(8u, preempt_count);
+    ASSERT_OK_AND_ASSIGN(uint64_t memory_used,
+                         limited_metrics->GetCounter(WriteMetrics::BUFFER_MEMORY_USED));
+    ASSERT_EQ(0u, memory_used);
+    // preempted data is flushed into files ahead of commit, with the same content
+    ASSERT_EQ(unlimited_result, limited_result);
+}
+
 }  // namespace paimon::test
@@ -39,6 +39,7 @@
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/file_source.h"
 #include "paimon/core/operation/internal_read_context.h"
+#include "paimon/core/operation/metrics/read_metrics.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/table/source/data_split_impl.h"
@@ -1257,6 +1258,12 @@ TEST_P(MergeFileSplitReadTest, Test09VersionWithoutInlineFieldId) {
     ASSERT_OK_AND_ASSIGN(uint64_t latency,
                          read_metrics->GetCounter("orc.read.inclusive.latency.us"));
     ASSERT_GT(latency, 0);
+    ASSERT_OK_AND_ASSIGN(HistogramStats file_open_latency,
+                         read_metrics->GetHistogram(ReadMetrics::FILE_OPEN_LATENCY));
+    ASSERT_GT(file_open_latency.count, 0);
+    ASSERT_OK_AND_ASSIGN(HistogramStats batch_latency,
+                         read_metrics->GetHistogram(ReadMetrics::READ_BATCH_LATENCY));
+    ASSERT_GT(batch_latency.count, 0);
 }
 
 INSTANTIATE_TEST_SUITE_P(UseMinHeapAndEnablePrefetchAndEnableMultiThreadProject,
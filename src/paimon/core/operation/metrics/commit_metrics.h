@@ -22,6 +22,12 @@ namespace paimon {
 class CommitMetrics {
  public:
     static constexpr char LAST_COMMIT_ATTEMPTS[] = "lastCommitAttempts";
+    // histograms, in microseconds
+    static constexpr char COMMIT_DURATION[] = "commitDuration";
+    static constexpr char COMMIT_ATTEMPT_DURATION[] = "commitAttemptDuration";
+    static constexpr char CONFLICT_CHECK_DURATION[] = "conflictCheckDuration";
+    static constexpr char MANIFEST_READ_DURATION[] = "manifestReadDuration";
+    static constexpr char SNAPSHOT_ATOMIC_STORE_DURATION[] = "snapshotAtomicStoreDuration";
 };
 
 }  // namespace paimon
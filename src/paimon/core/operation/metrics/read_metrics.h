@@ -0,0 +1,29 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+namespace paimon {
+
+/// Metrics to measure a read.
+class ReadMetrics {
+ public:
+    // histograms, in microseconds
+    static constexpr char FILE_OPEN_LATENCY[] = "fileOpenLatency";
+    static constexpr char READ_BATCH_LATENCY[] = "readBatchLatency";
+};
+
+}  // namespace paimon
@@ -0,0 +1,32 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+namespace paimon {
+
+/// Metrics to measure a write.
+class WriteMetrics {
+ public:
+    // histograms, in microseconds
+    static constexpr char FLUSH_DURATION[] = "flushDuration";
+    static constexpr char SPILL_DURATION[] = "spillDuration";
+    // counters
+    static constexpr char BUFFER_MEMORY_USED[] = "bufferMemoryUsed";
+    static constexpr char BUFFER_PREEMPT_COUNT[] = "bufferPreemptCount";
+};
+
+}  // namespace paimon
@@ -17,6 +17,7 @@
 #include "paimon/core/operation/orphan_files_cleaner_impl.h"
 
 #include <algorithm>
+#include <functional>
 #include <future>
 #include <map>
 #include <optional>
@@ -28,6 +29,8 @@
 #include "paimon/common/utils/path_util.h"
 #include "paimon/common/utils/scope_guard.h"
 #include "paimon/common/utils/string_utils.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
@@ -75,7 +78,9 @@ bool OrphanFilesCleanerImpl::SupportToClean(const std::string& file_name) {
     static std::vector<std::string> supported_formats = {".orc", ".parquet", ".avro", ".lance"};
     for (const auto& format : supported_formats) {
         if (StringUtils::StartsWith(file_name, "data-") &&
-            StringUtils::EndsWith(file_name, format)) {
+            (StringUtils::EndsWith(file_name, format) ||
+             StringUtils::EndsWith(file_name,
+                                   format + DataFilePathFactory::INDEX_PATH_SUFFIX))) {
             return true;
         }
     }
@@ -96,7 +101,7 @@ Result<std::set<std::string>> OrphanFilesCleanerImpl::Clean() {
         file_statuses_futures.push_back(
             Via(executor_.get(), [this, dir] { return TryBestListingDirs(dir); }));
     }
-    PAIMON_ASSIGN_OR_RAISE(std::set<std::string> used_file_names, GetUsedFiles());
+    PAIMON_ASSIGN_OR_RAISE(std::unordered_set<size_t> used_files, GetUsedFiles());
 
     std::set<std::string> need_to_deletes;
     std::vector<std::future<void>> futures;
@@ -112,7 +117,7 @@ Result<std::set<std::string>> OrphanFilesCleanerImpl::Clean() {
                 continue;
             }
             if (file_status->GetModificationTime() < older_than_ms_ &&
-                !used_file_names.count(file_name)) {
+                !used_files.count(FileIdentity(file_name))) {
                 if (should_be_retained_ && should_be_retained_(file_name)) {
                     continue;
                 }
@@ -220,40 +225,77 @@ std::vector<std::unique_ptr<BasicFileStatus>> OrphanFilesCleanerImpl::MinimalTry
     return file_statuses;
 }
 
-Result<std::set<std::string>> OrphanFilesCleanerImpl::GetUsedFiles() const {
-    std::set<std::string> used_files;
+size_t OrphanFilesCleanerImpl::FileIdentity(const std::string& file_name) {
+    return std::hash<std::string>()(file_name);
+}
+
+Result<std::unordered_set<size_t>> OrphanFilesCleanerImpl::GetUsedFiles() const {
+    std::unordered_set<size_t> used_files;
     // TODO(jinli.zjw): consider changelog(add tests), stats
-    used_files.insert(SnapshotManager::EARLIEST);
-    used_files.insert(SnapshotManager::LATEST);
+    used_files.insert(FileIdentity(SnapshotManager::EARLIEST));
+    used_files.insert(FileIdentity(SnapshotManager::LATEST));
     PAIMON_ASSIGN_OR_RAISE(std::vector<Snapshot> snapshots, snapshot_manager_->GetAllSnapshots());
     for (const auto& snapshot : snapshots) {
-        used_files.insert(SnapshotManager::SNAPSHOT_PREFIX + std::to_string(snapshot.Id()));
-        used_files.insert(snapshot.BaseManifestList());
-        used_files.insert(snapshot.DeltaManifestList());
-        std::vector<ManifestFileMeta> manifests;
-        PAIMON_RETURN_NOT_OK(manifest_list_->ReadIfFileExist(snapshot.BaseManifestList(),
-                                                             /*filter=*/nullptr, &manifests));
-        PAIMON_RETURN_NOT_OK(manifest_list_->ReadIfFileExist(snapshot.DeltaManifestList(),
-                                                             /*filter=*/nullptr, &manifests));
-        const std::optional<std::string>& changelog_manifest_list =
-            snapshot.ChangelogManifestList();
-        if (changelog_manifest_list) {
-            used_files.insert(changelog_manifest_list.value());
+        if (snapshot.ChangelogManifestList()) {
             return Status::NotImplemented("OrphanFilesCleaner do not support clean changelog");
         }
-        const std::optional<std::string>& index_manifest_name = snapshot.IndexManifest();
-        if (index_manifest_name) {
+        if (snapshot.IndexManifest()) {
             return Status::NotImplemented("OrphanFilesCleaner do not support clean index manifest");
             // TODO(jinli.zjw): support IndexManifestEntry and add tests
-            // used_files.insert(index_manifest_name.value());
         }
-        for (const auto& manifest : manifests) {
-            used_files.insert(manifest.FileName());
-            std::vector<ManifestEntry> manifest_entries;
-            PAIMON_RETURN_NOT_OK(manifest_file_->ReadIfFileExist(
-                manifest.FileName(), /*filter=*/nullptr, &manifest_entries));
-            for (const auto& manifest_entry : manifest_entries) {
-                used_files.insert(manifest_entry.FileName());
+    }
+
+    // read manifest lists of all snapshots concurrently
+    using ManifestsResult = Result<std::vector<ManifestFileMeta>>;
+    std::vector<std::future<ManifestsResult>> manifest_list_futures;
+    manifest_list_futures.reserve(snapshots.size());
+    for (const auto& snapshot : snapshots) {
+        used_files.insert(
+            FileIdentity(SnapshotManager::SNAPSHOT_PREFIX + std::to_string(snapshot.Id())));
+        used_files.insert(FileIdentity(snapshot.BaseManifestList()));
+        used_files.insert(FileIdentity(snapshot.DeltaManifestList()));
+        manifest_list_futures.push_back(
+            Via(executor_.get(), [this, &snapshot]() -> ManifestsResult {
+                std::vector<ManifestFileMeta> manifests;
+                PAIMON_RETURN_NOT_OK(manifest_list_->ReadIfFileExist(
+                    snapshot.BaseManifestList(), /*filter=*/nullptr, &manifests));
+                PAIMON_RETURN_NOT_OK(manifest_list_->ReadIfFileExist(
+                    snapshot.DeltaManifestList(), /*filter=*/nullptr, &manifests));
+                return manifests;
+            }));
+    }
+
+    // snapshots share most of their manifests, each distinct manifest is read only once
+    std::vector<ManifestsResult> manifest_lists = CollectAll(manifest_list_futures);
+    for (const auto& manifests : manifest_lists) {
+        PAIMON_RETURN_NOT_OK(manifests.status());
+    }
+    std::unordered_set<std::string> manifest_names;
+    std::vector<std::future<Result<std::vector<ManifestEntry>>>> manifest_futures;
+    for (const auto& manifests : manifest_lists) {
+        for (const auto& manifest : manifests.value()) {
+            if (!manifest_names.insert(manifest.FileName()).second) {
+                continue;
+            }
+            used_files.insert(FileIdentity(manifest.FileName()));
+            manifest_futures.push_back(Via(
+                executor_.get(),
+                [this, file_name = manifest.FileName()]() -> Result<std::vector<ManifestEntry>> {
+                    std::vector<ManifestEntry> manifest_entries;
+                    PAIMON_RETURN_NOT_OK(manifest_file_->ReadIfFileExist(
+                        file_name, /*filter=*/nullptr, &manifest_entries));
+                    return manifest_entries;
+                }));
+        }
+    }
+    for (const auto& manifest_entries : CollectAll(manifest_futures)) {
+        PAIMON_RETURN_NOT_OK(manifest_entries.status());
+        for (const auto& manifest_entry : manifest_entries.value()) {
+            used_files.insert(FileIdentity(manifest_entry.FileName()));
+            for (const auto& extra_file : manifest_entry.File()->extra_files) {
+                if (extra_file) {
+                    used_files.insert(FileIdentity(extra_file.value()));
+                }
             }
         }
     }
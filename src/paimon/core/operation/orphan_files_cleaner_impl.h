@@ -22,6 +22,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "paimon/core/core_options.h"
@@ -68,7 +69,11 @@ class OrphanFilesCleanerImpl : public OrphanFilesCleaner {
     std::vector<std::unique_ptr<BasicFileStatus>> MinimalTryBestListingDirs(
         const std::string& path) const;
     std::set<std::string> ListFileDirs(const std::string& path, int32_t max_level) const;
-    Result<std::set<std::string>> GetUsedFiles() const;
+    /// @return Identities of files used by any snapshot, see `FileIdentity()`.
+    Result<std::unordered_set<size_t>> GetUsedFiles() const;
+    /// Hash of file name, which is much more compact than the name. A collision only makes an
+    /// orphan file retained, a used file is never deleted.
+    static size_t FileIdentity(const std::string& file_name);
     static bool SupportToClean(const std::string& file_name);
 
  private:
@@ -47,18 +47,22 @@ TEST(OrphanFilesCleanerTest, TestSupportToClean) {
         "manifest-list-469f3a0f-f6f1-4027-91bf-d1e897e8ea23-1"));
     ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
         ".snapshot-2.13c988c3-784d-493d-8884-016ddddb1fc2.tmp"));
+    ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
+        "data-5515726b-0f0f-4556-a942-e795e9f94c4a-0.orc.index"));
+    ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
+        "data-5515726b-0f0f-4556-a942-e795e9f94c4a-0.parquet.index"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("tmp"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("snapshot-1"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("schema-0"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("bucket-0"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean(
         "changelog-ce64d06d-c4cd-456b-a1b3-ae570042620f-0.parquet"));
-    ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean(
-        "data-5515726b-0f0f-4556-a942-e795e9f94c4a-0.orc.index"));
     ASSERT_FALSE(
         OrphanFilesCleanerImpl::SupportToClean("index-aa60193d-d7cd-434f-bc1a-c1adb210e1f7-0"));
     ASSERT_FALSE(
         OrphanFilesCleanerImpl::SupportToClean("data-2d5ea1ea-77c1-47ff-bb87-19a509962a37-0.json"));
+    ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean(
+        "data-2d5ea1ea-77c1-47ff-bb87-19a509962a37-0.json.index"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean(
         "some_data-2d5ea1ea-77c1-47ff-bb87-19a509962a37-0.orc"));
 }
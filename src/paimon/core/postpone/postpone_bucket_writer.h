@@ -62,6 +62,10 @@ class PostponeBucketWriter : public BatchWriter {
 
     Result<CommitIncrement> PrepareCommit(bool wait_compaction) override;
 
+    Status FlushForCommit() override {
+        return Flush();
+    }
+
     bool IsCompacting() const override {
         return false;
     }
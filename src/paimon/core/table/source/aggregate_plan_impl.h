@@ -0,0 +1,54 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "paimon/predicate/literal.h"
+#include "paimon/table/source/aggregate_plan.h"
+
+namespace paimon {
+
+/// An implementation of `AggregatePlan`.
+class AggregatePlanImpl : public AggregatePlan {
+ public:
+    AggregatePlanImpl(const std::optional<int64_t>& snapshot_id,
+                      const std::vector<Literal>& partial_results,
+                      const std::vector<std::shared_ptr<Split>>& splits)
+        : snapshot_id_(snapshot_id), partial_results_(partial_results), splits_(splits) {}
+
+    std::optional<int64_t> SnapshotId() const override {
+        return snapshot_id_;
+    }
+
+    const std::vector<std::shared_ptr<Split>>& Splits() const override {
+        return splits_;
+    }
+
+    const std::vector<Literal>& PartialResults() const override {
+        return partial_results_;
+    }
+
+ private:
+    std::optional<int64_t> snapshot_id_;
+    std::vector<Literal> partial_results_;
+    std::vector<std::shared_ptr<Split>> splits_;
+};
+}  // namespace paimon
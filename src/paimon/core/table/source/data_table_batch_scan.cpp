@@ -23,7 +23,9 @@
 #include "paimon/core/core_options.h"
 #include "paimon/core/options/merge_engine.h"
 #include "paimon/core/table/bucket_mode.h"
+#include "paimon/core/table/source/aggregate_plan_impl.h"
 #include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/metadata_aggregator.h"
 #include "paimon/core/table/source/plan_impl.h"
 #include "paimon/core/table/source/snapshot/snapshot_reader.h"
 #include "paimon/status.h"
@@ -59,6 +61,46 @@ Result<std::shared_ptr<Plan>> DataTableBatchScan::CreatePlan() {
     return Status::Invalid("end of scan");
 }
 
+Result<std::shared_ptr<AggregatePlan>> DataTableBatchScan::CreateAggregatePlan(
+    const std::vector<AggregateCall>& aggregates) {
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<MetadataAggregator> aggregator,
+        MetadataAggregator::Create(snapshot_reader_->GetTableSchema(), aggregates,
+                                   snapshot_reader_->GetNonPartitionPredicate(),
+                                   snapshot_reader_->GetMemoryPool()));
+    if (starting_scanner_ == nullptr) {
+        PAIMON_ASSIGN_OR_RAISE(starting_scanner_, CreateStartingScanner(/*is_streaming=*/false));
+    }
+    if (!has_next_) {
+        return Status::Invalid("end of scan");
+    }
+    has_next_ = false;
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<StartingScanner::ScanResult> scan_result,
+                           starting_scanner_->Scan(snapshot_reader_));
+    auto current_scan_result =
+        std::dynamic_pointer_cast<StartingScanner::CurrentSnapshot>(scan_result);
+    if (!current_scan_result) {
+        // NoSnapshot
+        return std::make_shared<AggregatePlanImpl>(std::nullopt, aggregator->Results(),
+                                                   std::vector<std::shared_ptr<Split>>());
+    }
+    // push down limit is ignored, aggregates are over all rows
+    std::vector<std::shared_ptr<Split>> remaining_splits;
+    for (const auto& split : current_scan_result->Splits()) {
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(split);
+        if (!data_split) {
+            return Status::Invalid("DataSplit cannot cast to DataSplitImpl");
+        }
+        PAIMON_ASSIGN_OR_RAISE(bool answered, aggregator->Accumulate(*data_split));
+        if (!answered) {
+            remaining_splits.push_back(split);
+        }
+    }
+    PAIMON_ASSIGN_OR_RAISE(int64_t snapshot_id, current_scan_result->SnapshotId());
+    return std::make_shared<AggregatePlanImpl>(snapshot_id, aggregator->Results(),
+                                               remaining_splits);
+}
+
 Result<std::shared_ptr<Plan>> DataTableBatchScan::ApplyPushDownLimit(
     const std::shared_ptr<StartingScanner::ScanResult>& scan_result) const {
     auto current_scan_result =
@@ -18,10 +18,12 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "paimon/core/table/source/abstract_table_scan.h"
 #include "paimon/core/table/source/snapshot/starting_scanner.h"
 #include "paimon/result.h"
+#include "paimon/table/source/aggregate_plan.h"
 #include "paimon/table/source/plan.h"
 
 namespace paimon {
@@ -37,6 +39,9 @@ class DataTableBatchScan : public AbstractTableScan {
 
     Result<std::shared_ptr<Plan>> CreatePlan() override;
 
+    Result<std::shared_ptr<AggregatePlan>> CreateAggregatePlan(
+        const std::vector<AggregateCall>& aggregates) override;
+
     std::shared_ptr<PredicateFilter> GetNonPartitionPredicate() const {
         return snapshot_reader_->GetNonPartitionPredicate();
     }
@@ -0,0 +1,381 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/table/source/local_table_query.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/compute/api.h"
+#include "arrow/type.h"
+#include "fmt/format.h"
+#include "paimon/common/data/columnar/columnar_row.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/deletionvectors/deletion_vector.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/mergetree/compact/lookup_merge_function.h"
+#include "paimon/core/mergetree/compact/merge_function.h"
+#include "paimon/core/mergetree/compact/reducer_merge_function_wrapper.h"
+#include "paimon/core/mergetree/sorted_run.h"
+#include "paimon/core/operation/internal_read_context.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/primary_key_table_utils.h"
+#include "paimon/defs.h"
+
+namespace paimon {
+LocalTableQuery::LocalTableQuery(
+    const std::shared_ptr<FileStorePathFactory>& path_factory,
+    const std::shared_ptr<InternalReadContext>& context,
+    const std::shared_ptr<arrow::Schema>& value_schema, const std::vector<DataField>& key_fields,
+    const std::shared_ptr<FieldsComparator>& file_key_comparator,
+    const std::shared_ptr<FieldsComparator>& row_key_comparator,
+    const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+    const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
+    std::unique_ptr<LookupKeyHasher>&& key_hasher,
+    std::unique_ptr<KeyValueProjectionConsumer>&& projection_consumer,
+    const std::shared_ptr<MemoryPool>& memory_pool)
+    : pool_(memory_pool),
+      arrow_pool_(GetArrowPool(memory_pool)),
+      path_factory_(path_factory),
+      context_(context),
+      value_schema_(value_schema),
+      key_fields_(key_fields),
+      file_key_comparator_(file_key_comparator),
+      row_key_comparator_(row_key_comparator),
+      user_defined_seq_comparator_(user_defined_seq_comparator),
+      merge_function_wrapper_(merge_function_wrapper),
+      key_hasher_(std::move(key_hasher)),
+      projection_consumer_(std::move(projection_consumer)) {}
+
+LocalTableQuery::~LocalTableQuery() = default;
+
+Result<std::unique_ptr<LocalTableQuery>> LocalTableQuery::Create(
+    const std::shared_ptr<FileStorePathFactory>& path_factory,
+    const std::shared_ptr<InternalReadContext>& context,
+    const std::shared_ptr<MemoryPool>& memory_pool) {
+    const auto& table_schema = context->GetTableSchema();
+    const auto& options = context->GetCoreOptions();
+    if (table_schema->PrimaryKeys().empty()) {
+        return Status::Invalid("table query only supports table with primary keys");
+    }
+    // value of KeyValue objects contains all fields in the order of table schema, the same as
+    // compaction
+    auto value_schema = DataField::ConvertDataFieldsToArrowSchema(table_schema->Fields());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
+                           table_schema->TrimmedPrimaryKeys());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> key_fields,
+                           table_schema->GetFields(trimmed_primary_keys));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FieldsComparator> file_key_comparator,
+                           FieldsComparator::Create(key_fields, /*is_ascending_order=*/true,
+                                                    /*use_view=*/false));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FieldsComparator> row_key_comparator,
+                           FieldsComparator::Create(key_fields, /*is_ascending_order=*/true,
+                                                    /*use_view=*/true));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<FieldsComparator> user_defined_seq_comparator,
+        PrimaryKeyTableUtils::CreateSequenceFieldsComparator(table_schema->Fields(), options));
+
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<MergeFunction> merge_function,
+                           PrimaryKeyTableUtils::CreateMergeFunction(
+                               value_schema, table_schema->PrimaryKeys(), options));
+    if (options.NeedLookup() && options.GetMergeEngine() != MergeEngine::FIRST_ROW) {
+        // don't wrap first row, it is already OK
+        merge_function = std::make_unique<LookupMergeFunction>(std::move(merge_function));
+    }
+    auto merge_function_wrapper =
+        std::make_shared<ReducerMergeFunctionWrapper>(std::move(merge_function));
+
+    std::shared_ptr<arrow::Schema> read_schema = context->GetReadSchema();
+    std::vector<int32_t> read_to_value_mapping;
+    read_to_value_mapping.reserve(read_schema->num_fields());
+    for (const auto& field : read_schema->fields()) {
+        int32_t value_idx = value_schema->GetFieldIndex(field->name());
+        if (value_idx < 0) {
+            return Status::Invalid(
+                fmt::format("field {} is not supported by table query", field->name()));
+        }
+        read_to_value_mapping.push_back(value_idx);
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<KeyValueProjectionConsumer> projection_consumer,
+        KeyValueProjectionConsumer::Create(read_schema, read_to_value_mapping, memory_pool));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<LookupKeyHasher> key_hasher,
+                           LookupKeyHasher::Create(key_fields, memory_pool));
+    return std::unique_ptr<LocalTableQuery>(new LocalTableQuery(
+        path_factory, context, value_schema, key_fields, file_key_comparator, row_key_comparator,
+        user_defined_seq_comparator, merge_function_wrapper, std::move(key_hasher),
+        std::move(projection_consumer), memory_pool));
+}
+
+Status LocalTableQuery::RefreshFiles(const std::vector<std::shared_ptr<Split>>& splits) {
+    struct BucketEntry {
+        std::vector<std::shared_ptr<DataFileMeta>> files;
+        std::unordered_map<std::string, DeletionFile> deletion_file_map;
+    };
+    std::unordered_map<std::pair<BinaryRow, int32_t>, BucketEntry> bucket_entries;
+    for (const auto& split : splits) {
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(split);
+        if (!data_split) {
+            return Status::Invalid("table query only supports data splits");
+        }
+        auto& entry = bucket_entries[std::make_pair(data_split->Partition(), data_split->Bucket())];
+        const auto& data_files = data_split->DataFiles();
+        const auto& deletion_files = data_split->DeletionFiles();
+        for (size_t i = 0; i < data_files.size(); ++i) {
+            entry.files.push_back(data_files[i]);
+            if (i < deletion_files.size() && deletion_files[i]) {
+                entry.deletion_file_map.emplace(data_files[i]->file_name,
+                                                deletion_files[i].value());
+            }
+        }
+    }
+
+    const auto& options = context_->GetCoreOptions();
+    std::unordered_map<std::pair<BinaryRow, int32_t>, BucketFiles> buckets;
+    std::unordered_set<std::string> live_cache_keys;
+    for (auto& [partition_bucket, entry] : bucket_entries) {
+        const auto& [partition, bucket] = partition_bucket;
+        for (const auto& file : entry.files) {
+            live_cache_keys.insert(CacheKey(file, entry.deletion_file_map));
+        }
+        BucketFiles bucket_files;
+        PAIMON_ASSIGN_OR_RAISE(
+            bucket_files.levels,
+            Levels::Create(file_key_comparator_, entry.files, options.GetNumLevels()));
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataFilePathFactory> data_file_path_factory,
+                               path_factory_->CreateDataFilePathFactory(partition, bucket));
+        PAIMON_ASSIGN_OR_RAISE(bucket_files.reader_factory,
+                               KeyValueFileReaderFactory::Create(
+                                   context_->GetTableSchema(), context_->GetPath(), value_schema_,
+                                   partition, data_file_path_factory, options, pool_));
+        bucket_files.deletion_file_map = std::move(entry.deletion_file_map);
+        buckets.emplace(partition_bucket, std::move(bucket_files));
+    }
+    buckets_ = std::move(buckets);
+
+    // drop cached lookup files which are compacted or deleted
+    for (auto iter = lru_list_.begin(); iter != lru_list_.end();) {
+        if (live_cache_keys.count(iter->first) > 0) {
+            ++iter;
+            continue;
+        }
+        cache_memory_size_ -= iter->second->MemorySize();
+        cached_files_.erase(iter->first);
+        iter = lru_list_.erase(iter);
+    }
+    return Status::OK();
+}
+
+Result<BatchReader::ReadBatch> LocalTableQuery::Lookup(
+    const std::map<std::string, std::string>& partition, int32_t bucket, ArrowArray* keys,
+    ArrowSchema* key_schema) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> key_array,
+                                      arrow::ImportArray(keys, key_schema));
+    auto key_struct_array = std::dynamic_pointer_cast<arrow::StructArray>(key_array);
+    if (!key_struct_array) {
+        return Status::Invalid("keys of table query should be a struct array");
+    }
+    arrow::ArrayVector key_field_arrays;
+    key_field_arrays.reserve(key_fields_.size());
+    for (const auto& key_field : key_fields_) {
+        auto field_array = key_struct_array->GetFieldByName(key_field.Name());
+        if (!field_array) {
+            return Status::Invalid(
+                fmt::format("cannot find key field {} in keys", key_field.Name()));
+        }
+        if (!field_array->type()->Equals(key_field.Type())) {
+            return Status::Invalid(fmt::format("type of key field {} should be {}, but is {}",
+                                               key_field.Name(), key_field.Type()->ToString(),
+                                               field_array->type()->ToString()));
+        }
+        key_field_arrays.push_back(field_array);
+    }
+
+    PAIMON_ASSIGN_OR_RAISE(BinaryRow partition_row, path_factory_->ToBinaryRow(partition));
+    auto bucket_iter = buckets_.find(std::make_pair(partition_row, bucket));
+
+    // lookup files referred by results, the cache may evict them during this lookup
+    std::vector<std::shared_ptr<LookupFile>> pinned_files;
+    std::vector<KeyValue> results;
+    arrow::Int32Builder indices_builder(arrow_pool_.get());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(indices_builder.Reserve(key_struct_array->length()));
+    ColumnarRow key(key_field_arrays, pool_, /*row_id=*/0);
+    for (int64_t i = 0; i < key_struct_array->length(); ++i) {
+        std::optional<KeyValue> result;
+        if (bucket_iter != buckets_.end() && key_struct_array->IsValid(i)) {
+            key.SetRowId(i);
+            PAIMON_ASSIGN_OR_RAISE(result, LookupKey(bucket_iter->second, key,
+                                                     key_hasher_->Hash(key), &pinned_files));
+        }
+        if (result) {
+            indices_builder.UnsafeAppend(static_cast<int32_t>(results.size()));
+            results.push_back(std::move(result).value());
+        } else {
+            indices_builder.UnsafeAppendNull();
+        }
+    }
+    std::shared_ptr<arrow::Array> indices;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(indices_builder.Finish(&indices));
+
+    PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatch found_batch,
+                           projection_consumer_->NextBatch(results));
+    auto& [found_c_array, found_c_schema] = found_batch;
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        std::shared_ptr<arrow::Array> found_array,
+        arrow::ImportArray(found_c_array.get(), found_c_schema.get()));
+    // a null index takes a null row, so that results are aligned with keys
+    arrow::compute::ExecContext exec_context(arrow_pool_.get());
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        arrow::Datum taken,
+        arrow::compute::Take(found_array, indices, arrow::compute::TakeOptions::NoBoundsCheck(),
+                             &exec_context));
+    auto c_array = std::make_unique<ArrowArray>();
+    auto c_schema = std::make_unique<ArrowSchema>();
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        arrow::ExportArray(*taken.make_array(), c_array.get(), c_schema.get()));
+    return std::make_pair(std::move(c_array), std::move(c_schema));
+}
+
+Result<std::optional<KeyValue>> LocalTableQuery::LookupKey(
+    const BucketFiles& bucket_files, const InternalRow& key, int64_t key_hash,
+    std::vector<std::shared_ptr<LookupFile>>* pinned_files) {
+    std::vector<KeyValue> hits;
+    const Levels& levels = *bucket_files.levels;
+    for (const auto& file : levels.Level0()) {
+        PAIMON_RETURN_NOT_OK(
+            LookupFileIfInRange(bucket_files, file, key, key_hash, pinned_files, &hits));
+    }
+    for (int32_t level = 1; level <= levels.MaxLevel(); ++level) {
+        // files of a sorted run do not overlap, find the first file whose max key is not less
+        // than key
+        const auto& files = levels.RunOfLevel(level).Files();
+        auto iter = std::lower_bound(files.begin(), files.end(), key,
+                                     [this](const std::shared_ptr<DataFileMeta>& file,
+                                            const InternalRow& target) {
+                                         return file_key_comparator_->CompareTo(file->max_key,
+                                                                                target) < 0;
+                                     });
+        if (iter != files.end()) {
+            PAIMON_RETURN_NOT_OK(
+                LookupFileIfInRange(bucket_files, *iter, key, key_hash, pinned_files, &hits));
+        }
+    }
+    if (hits.empty()) {
+        return std::optional<KeyValue>();
+    }
+    // merge hits in the same order as SortMergeReader
+    std::stable_sort(hits.begin(), hits.end(), [this](const KeyValue& lhs, const KeyValue& rhs) {
+        if (user_defined_seq_comparator_ != nullptr) {
+            int32_t seq_result = user_defined_seq_comparator_->CompareTo(*lhs.value, *rhs.value);
+            if (seq_result != 0) {
+                return seq_result < 0;
+            }
+        }
+        return lhs.sequence_number < rhs.sequence_number;
+    });
+    merge_function_wrapper_->Reset();
+    for (auto& hit : hits) {
+        PAIMON_RETURN_NOT_OK(merge_function_wrapper_->Add(std::move(hit)));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::optional<KeyValue> result, merge_function_wrapper_->GetResult());
+    // the same as DropDeleteReader
+    if (!result || !result->value_kind->IsAdd()) {
+        return std::optional<KeyValue>();
+    }
+    return result;
+}
+
+Status LocalTableQuery::LookupFileIfInRange(
+    const BucketFiles& bucket_files, const std::shared_ptr<DataFileMeta>& file,
+    const InternalRow& key, int64_t key_hash,
+    std::vector<std::shared_ptr<LookupFile>>* pinned_files, std::vector<KeyValue>* hits) {
+    if (file_key_comparator_->CompareTo(key, file->min_key) < 0 ||
+        file_key_comparator_->CompareTo(key, file->max_key) > 0) {
+        return Status::OK();
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<LookupFile> lookup_file,
+                           GetOrCreateLookupFile(bucket_files, file));
+    size_t hit_count = hits->size();
+    PAIMON_RETURN_NOT_OK(lookup_file->Lookup(key, key_hash, hits));
+    if (hits->size() > hit_count) {
+        pinned_files->push_back(std::move(lookup_file));
+    }
+    return Status::OK();
+}
+
+Result<std::shared_ptr<LookupFile>> LocalTableQuery::GetOrCreateLookupFile(
+    const BucketFiles& bucket_files, const std::shared_ptr<DataFileMeta>& file) {
+    std::string cache_key = CacheKey(file, bucket_files.deletion_file_map);
+    auto iter = cached_files_.find(cache_key);
+    if (iter != cached_files_.end()) {
+        lru_list_.splice(lru_list_.begin(), lru_list_, iter->second);
+        return iter->second->second;
+    }
+    PAIMON_UNIQUE_PTR<DeletionVector> deletion_vector;
+    auto dv_iter = bucket_files.deletion_file_map.find(file->file_name);
+    if (dv_iter != bucket_files.deletion_file_map.end()) {
+        PAIMON_ASSIGN_OR_RAISE(
+            deletion_vector,
+            DeletionVector::Read(context_->GetCoreOptions().GetFileSystem().get(),
+                                 dv_iter->second, pool_.get()));
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<BatchReader> reader,
+        bucket_files.reader_factory->CreateBatchReader(file, std::move(deletion_vector)));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<LookupFile> lookup_file,
+        LookupFile::Create(std::move(reader), static_cast<int32_t>(key_fields_.size()),
+                           value_schema_, file->level, row_key_comparator_, key_hasher_.get(),
+                           pool_));
+    lru_list_.emplace_front(cache_key, lookup_file);
+    cached_files_[cache_key] = lru_list_.begin();
+    cache_memory_size_ += lookup_file->MemorySize();
+    EvictIfNeeded();
+    return lookup_file;
+}
+
+std::string LocalTableQuery::CacheKey(
+    const std::shared_ptr<DataFileMeta>& file,
+    const std::unordered_map<std::string, DeletionFile>& dv_map) {
+    // deletion vector of a file changes when it is compacted by lookup, the cached file is
+    // stale then
+    auto dv_iter = dv_map.find(file->file_name);
+    if (dv_iter == dv_map.end()) {
+        return file->file_name;
+    }
+    return fmt::format("{}#{}:{}", file->file_name, dv_iter->second.path, dv_iter->second.offset);
+}
+
+void LocalTableQuery::EvictIfNeeded() {
+    int64_t max_memory_size = context_->GetCoreOptions().GetLookupCacheMaxMemorySize();
+    while (cache_memory_size_ > max_memory_size && !lru_list_.empty()) {
+        const auto& [eldest_key, eldest_file] = lru_list_.back();
+        cache_memory_size_ -= eldest_file->MemorySize();
+        cached_files_.erase(eldest_key);
+        lru_list_.pop_back();
+    }
+}
+
+}  // namespace paimon
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/key_value_file_reader_factory.h"
+#include "paimon/core/io/key_value_projection_consumer.h"
+#include "paimon/core/key_value.h"
+#include "paimon/core/mergetree/compact/merge_function_wrapper.h"
+#include "paimon/core/mergetree/levels.h"
+#include "paimon/core/mergetree/lookup_file.h"
+#include "paimon/core/table/source/deletion_file.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/table/source/table_query.h"
+
+namespace arrow {
+class MemoryPool;
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class DataFilePathFactory;
+class FileStorePathFactory;
+class InternalReadContext;
+class InternalRow;
+class MemoryPool;
+
+/// `TableQuery` of local data files. Files of each bucket are organized in `Levels`, a key is
+/// looked up in level 0 files and one file of each higher level whose key range contains it, and
+/// the hits are merged by the merge function of the table.
+class LocalTableQuery : public TableQuery {
+ public:
+    static Result<std::unique_ptr<LocalTableQuery>> Create(
+        const std::shared_ptr<FileStorePathFactory>& path_factory,
+        const std::shared_ptr<InternalReadContext>& context,
+        const std::shared_ptr<MemoryPool>& memory_pool);
+
+    ~LocalTableQuery() override;
+
+    Status RefreshFiles(const std::vector<std::shared_ptr<Split>>& splits) override;
+
+    Result<BatchReader::ReadBatch> Lookup(const std::map<std::string, std::string>& partition,
+                                          int32_t bucket, ArrowArray* keys,
+                                          ArrowSchema* key_schema) override;
+
+    /// @return Total memory size of cached lookup files.
+    int64_t CacheMemorySize() const {
+        return cache_memory_size_;
+    }
+
+ private:
+    struct BucketFiles {
+        std::unique_ptr<Levels> levels;
+        std::unordered_map<std::string, DeletionFile> deletion_file_map;
+        std::unique_ptr<KeyValueFileReaderFactory> reader_factory;
+    };
+
+    LocalTableQuery(const std::shared_ptr<FileStorePathFactory>& path_factory,
+                    const std::shared_ptr<InternalReadContext>& context,
+                    const std::shared_ptr<arrow::Schema>& value_schema,
+                    const std::vector<DataField>& key_fields,
+                    const std::shared_ptr<FieldsComparator>& file_key_comparator,
+                    const std::shared_ptr<FieldsComparator>& row_key_comparator,
+                    const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+                    const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
+                    std::unique_ptr<LookupKeyHasher>&& key_hasher,
+                    std::unique_ptr<KeyValueProjectionConsumer>&& projection_consumer,
+                    const std::shared_ptr<MemoryPool>& memory_pool);
+
+    // Look up `key` in candidate files of a bucket and merge the hits, returns std::nullopt if
+    // the key does not exist or is deleted. Lookup files used are added to `pinned_files`, as
+    // the result may refer to them.
+    Result<std::optional<KeyValue>> LookupKey(
+        const BucketFiles& bucket_files, const InternalRow& key, int64_t key_hash,
+        std::vector<std::shared_ptr<LookupFile>>* pinned_files);
+
+    Status LookupFileIfInRange(const BucketFiles& bucket_files,
+                               const std::shared_ptr<DataFileMeta>& file, const InternalRow& key,
+                               int64_t key_hash,
+                               std::vector<std::shared_ptr<LookupFile>>* pinned_files,
+                               std::vector<KeyValue>* hits);
+
+    Result<std::shared_ptr<LookupFile>> GetOrCreateLookupFile(
+        const BucketFiles& bucket_files, const std::shared_ptr<DataFileMeta>& file);
+
+    static std::string CacheKey(const std::shared_ptr<DataFileMeta>& file,
+                                const std::unordered_map<std::string, DeletionFile>& dv_map);
+
+    void EvictIfNeeded();
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::unique_ptr<arrow::MemoryPool> arrow_pool_;
+    std::shared_ptr<FileStorePathFactory> path_factory_;
+    std::shared_ptr<InternalReadContext> context_;
+    std::shared_ptr<arrow::Schema> value_schema_;
+    std::vector<DataField> key_fields_;
+    // compares keys with min and max keys of files
+    std::shared_ptr<FieldsComparator> file_key_comparator_;
+    // compares keys with keys in lookup files
+    std::shared_ptr<FieldsComparator> row_key_comparator_;
+    std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
+    std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper_;
+    std::unique_ptr<LookupKeyHasher> key_hasher_;
+    std::unique_ptr<KeyValueProjectionConsumer> projection_consumer_;
+    std::unordered_map<std::pair<BinaryRow, int32_t>, BucketFiles> buckets_;
+
+    // most recently used lookup file at front
+    std::list<std::pair<std::string, std::shared_ptr<LookupFile>>> lru_list_;
+    std::unordered_map<std::string,
+                       std::list<std::pair<std::string, std::shared_ptr<LookupFile>>>::iterator>
+        cached_files_;
+    int64_t cache_memory_size_ = 0;
+};
+}  // namespace paimon
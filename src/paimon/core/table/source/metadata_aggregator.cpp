@@ -0,0 +1,265 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/table/source/metadata_aggregator.h"
+
+#include <exception>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "arrow/type.h"
+#include "fmt/format.h"
+#include "paimon/common/data/internal_array.h"
+#include "paimon/common/data/internal_row.h"
+#include "paimon/common/predicate/literal_converter.h"
+#include "paimon/common/predicate/predicate_filter.h"
+#include "paimon/common/predicate/predicate_utils.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/field_type_utils.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/stats/simple_stats_evolution.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/deletion_file.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+MetadataAggregator::MetadataAggregator(const std::shared_ptr<TableSchema>& table_schema,
+                                       const std::shared_ptr<arrow::Schema>& arrow_schema,
+                                       std::vector<AggregateField>&& aggregate_fields,
+                                       std::vector<Literal>&& results, bool has_predicate,
+                                       const std::shared_ptr<PredicateFilter>& negated_predicate,
+                                       std::vector<int32_t>&& predicate_field_indexes,
+                                       const std::shared_ptr<MemoryPool>& pool)
+    : pk_table_(!table_schema->PrimaryKeys().empty()),
+      schema_id_(table_schema->Id()),
+      arrow_schema_(arrow_schema),
+      aggregate_fields_(std::move(aggregate_fields)),
+      results_(std::move(results)),
+      has_predicate_(has_predicate),
+      negated_predicate_(negated_predicate),
+      predicate_field_indexes_(std::move(predicate_field_indexes)),
+      evolution_(std::make_shared<SimpleStatsEvolution>(
+          table_schema->Fields(), table_schema->Fields(), /*need_mapping=*/false, pool)) {
+    for (const auto& aggregate_field : aggregate_fields_) {
+        if (aggregate_field.kind != AggregateCall::Kind::COUNT_STAR) {
+            has_min_max_ = true;
+        }
+    }
+}
+
+Result<std::unique_ptr<MetadataAggregator>> MetadataAggregator::Create(
+    const std::shared_ptr<TableSchema>& table_schema,
+    const std::vector<AggregateCall>& aggregates,
+    const std::shared_ptr<PredicateFilter>& non_partition_predicate,
+    const std::shared_ptr<MemoryPool>& pool) {
+    if (aggregates.empty()) {
+        return Status::Invalid("aggregates of aggregate plan are empty");
+    }
+    const auto& fields = table_schema->Fields();
+    std::map<std::string, int32_t> field_name_to_idx;
+    for (size_t i = 0; i < fields.size(); i++) {
+        field_name_to_idx[fields[i].Name()] = static_cast<int32_t>(i);
+    }
+    std::vector<AggregateField> aggregate_fields;
+    std::vector<Literal> results;
+    aggregate_fields.reserve(aggregates.size());
+    results.reserve(aggregates.size());
+    for (const auto& aggregate : aggregates) {
+        if (aggregate.GetKind() == AggregateCall::Kind::COUNT_STAR) {
+            aggregate_fields.push_back({aggregate.GetKind(), -1, FieldType::BIGINT});
+            results.emplace_back(static_cast<int64_t>(0));
+            continue;
+        }
+        auto iter = field_name_to_idx.find(aggregate.GetFieldName());
+        if (iter == field_name_to_idx.end()) {
+            return Status::Invalid(fmt::format("field {} in aggregate is not found in table schema",
+                                               aggregate.GetFieldName()));
+        }
+        PAIMON_ASSIGN_OR_RAISE(FieldType field_type, FieldTypeUtils::ConvertToFieldType(
+                                                         fields[iter->second].Type()->id()));
+        aggregate_fields.push_back({aggregate.GetKind(), iter->second, field_type});
+        results.emplace_back(field_type);
+    }
+
+    std::shared_ptr<PredicateFilter> negated_predicate;
+    std::vector<int32_t> predicate_field_indexes;
+    if (non_partition_predicate) {
+        negated_predicate =
+            std::dynamic_pointer_cast<PredicateFilter>(non_partition_predicate->Negate());
+        std::set<std::string> predicate_field_names;
+        PAIMON_RETURN_NOT_OK(
+            PredicateUtils::GetAllNames(non_partition_predicate, &predicate_field_names));
+        for (const auto& field_name : predicate_field_names) {
+            auto iter = field_name_to_idx.find(field_name);
+            if (iter == field_name_to_idx.end()) {
+                return Status::Invalid(fmt::format(
+                    "field {} in predicate is not included in table schema", field_name));
+            }
+            predicate_field_indexes.push_back(iter->second);
+            PAIMON_ASSIGN_OR_RAISE(FieldType field_type, FieldTypeUtils::ConvertToFieldType(
+                                                             fields[iter->second].Type()->id()));
+            if (field_type == FieldType::FLOAT || field_type == FieldType::DOUBLE) {
+                // stats of floating point do not order NaN, a NaN row matches neither the
+                // predicate nor its negation, so stats cannot prove that every row matches
+                negated_predicate.reset();
+            }
+        }
+    }
+    return std::unique_ptr<MetadataAggregator>(new MetadataAggregator(
+        table_schema, DataField::ConvertDataFieldsToArrowSchema(fields),
+        std::move(aggregate_fields), std::move(results),
+        /*has_predicate=*/non_partition_predicate != nullptr, negated_predicate,
+        std::move(predicate_field_indexes), pool));
+}
+
+Result<bool> MetadataAggregator::Accumulate(const DataSplitImpl& split) {
+    if (!split.RawConvertible()) {
+        return false;
+    }
+    if (has_predicate_ && !negated_predicate_) {
+        return false;
+    }
+    const auto& data_files = split.DataFiles();
+    const auto& deletion_files = split.DeletionFiles();
+    // accumulate into a copy, so that a split is either fully answered or untouched
+    std::vector<Literal> results = results_;
+    for (size_t i = 0; i < data_files.size(); i++) {
+        std::optional<DeletionFile> deletion_file;
+        if (i < deletion_files.size()) {
+            deletion_file = deletion_files[i];
+        }
+        PAIMON_ASSIGN_OR_RAISE(bool answered,
+                               AccumulateFile(*data_files[i], deletion_file, &results));
+        if (!answered) {
+            return false;
+        }
+    }
+    results_ = std::move(results);
+    return true;
+}
+
+Result<bool> MetadataAggregator::AccumulateFile(const DataFileMeta& file,
+                                                const std::optional<DeletionFile>& deletion_file,
+                                                std::vector<Literal>* results) const {
+    // retract rows of pk table are only counted by delete_row_count, which is absent in old files
+    if (pk_table_ ? file.delete_row_count != std::optional<int64_t>(0)
+                  : file.delete_row_count.value_or(0) > 0) {
+        return false;
+    }
+    int64_t deleted_row_count = 0;
+    if (deletion_file) {
+        if (deletion_file.value().cardinality == std::nullopt || has_min_max_) {
+            return false;
+        }
+        deleted_row_count = deletion_file.value().cardinality.value();
+    }
+
+    SimpleStatsEvolution::EvolutionStats stats;
+    if (has_predicate_ || has_min_max_) {
+        if (file.schema_id != schema_id_) {
+            return false;
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            stats, evolution_->Evolution(file.value_stats, file.row_count, file.value_stats_cols));
+    }
+    if (has_predicate_) {
+        // null values never match the predicate, but neither do they match the negated one
+        for (int32_t field_idx : predicate_field_indexes_) {
+            if (stats.null_counts->IsNullAt(field_idx) ||
+                stats.null_counts->GetLong(field_idx) != 0) {
+                return false;
+            }
+        }
+        // every row matches the predicate if the stats prove no row matches its negation
+        try {
+            PAIMON_ASSIGN_OR_RAISE(bool may_not_match,
+                                   negated_predicate_->Test(arrow_schema_, file.row_count,
+                                                            *(stats.min_values),
+                                                            *(stats.max_values),
+                                                            *(stats.null_counts)));
+            if (may_not_match) {
+                return false;
+            }
+        } catch (const std::exception& e) {
+            return Status::Invalid(
+                fmt::format("aggregate pushdown failed for file {}, with {} error",
+                            file.file_name, e.what()));
+        } catch (...) {
+            return Status::Invalid(fmt::format(
+                "aggregate pushdown failed for file {}, with unknown error", file.file_name));
+        }
+    }
+
+    for (size_t i = 0; i < aggregate_fields_.size(); i++) {
+        const auto& aggregate_field = aggregate_fields_[i];
+        Literal& result = (*results)[i];
+        if (aggregate_field.kind == AggregateCall::Kind::COUNT_STAR) {
+            result = Literal(result.GetValue<int64_t>() + file.row_count - deleted_row_count);
+            continue;
+        }
+        if (!SupportMinMax(aggregate_field.field_type)) {
+            return false;
+        }
+        int32_t field_idx = aggregate_field.field_idx;
+        if (stats.null_counts->IsNullAt(field_idx)) {
+            return false;
+        }
+        if (stats.null_counts->GetLong(field_idx) == file.row_count) {
+            // all values are null, nothing to aggregate
+            continue;
+        }
+        bool is_min = aggregate_field.kind == AggregateCall::Kind::MIN;
+        const InternalRow& stats_row = is_min ? *(stats.min_values) : *(stats.max_values);
+        if (stats_row.IsNullAt(field_idx)) {
+            // stats are not collected
+            return false;
+        }
+        PAIMON_ASSIGN_OR_RAISE(Literal value, LiteralConverter::ConvertLiteralsFromRow(
+                                                  arrow_schema_, stats_row, field_idx,
+                                                  aggregate_field.field_type));
+        if (result.IsNull()) {
+            result = std::move(value);
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(int32_t compare, value.CompareTo(result));
+        if (is_min ? compare < 0 : compare > 0) {
+            result = std::move(value);
+        }
+    }
+    return true;
+}
+
+bool MetadataAggregator::SupportMinMax(FieldType type) {
+    switch (type) {
+        case FieldType::TINYINT:
+        case FieldType::SMALLINT:
+        case FieldType::INT:
+        case FieldType::BIGINT:
+        case FieldType::DATE:
+        case FieldType::DECIMAL:
+            return true;
+        default:
+            // stats of string and binary may be truncated, stats of timestamp may lose precision
+            // in file format and stats of floating point do not order NaN
+            return false;
+    }
+}
+
+}  // namespace paimon
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "paimon/predicate/literal.h"
+#include "paimon/result.h"
+#include "paimon/table/source/aggregate_plan.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class DataSplitImpl;
+class MemoryPool;
+class PredicateFilter;
+class SimpleStatsEvolution;
+class TableSchema;
+struct DataFileMeta;
+struct DeletionFile;
+
+/// Answers `COUNT(*)`, `MIN` and `MAX` from the metadata of data splits.
+///
+/// A split is answered only if the result is exact for every file of it:
+/// - the split is raw convertible, so its files need no merging;
+/// - files contain no retract rows, and deleted rows are known from the deletion vector
+///   cardinality (`COUNT(*)` only, `MIN` and `MAX` need files without deletion vector);
+/// - stats of the non-partition predicate fields have no nulls and prove that every row matches,
+///   which is never the case for floating point fields since their stats do not order NaN;
+/// - `MIN` and `MAX` fields have non-truncated stats in the current table schema.
+class MetadataAggregator {
+ public:
+    static Result<std::unique_ptr<MetadataAggregator>> Create(
+        const std::shared_ptr<TableSchema>& table_schema,
+        const std::vector<AggregateCall>& aggregates,
+        const std::shared_ptr<PredicateFilter>& non_partition_predicate,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    /// Merge `split` into the results if it can be answered from metadata.
+    /// @return Whether `split` is answered, results are untouched if not.
+    Result<bool> Accumulate(const DataSplitImpl& split);
+
+    const std::vector<Literal>& Results() const {
+        return results_;
+    }
+
+ private:
+    struct AggregateField {
+        AggregateCall::Kind kind;
+        int32_t field_idx;
+        FieldType field_type;
+    };
+
+    MetadataAggregator(const std::shared_ptr<TableSchema>& table_schema,
+                       const std::shared_ptr<arrow::Schema>& arrow_schema,
+                       std::vector<AggregateField>&& aggregate_fields,
+                       std::vector<Literal>&& results, bool has_predicate,
+                       const std::shared_ptr<PredicateFilter>& negated_predicate,
+                       std::vector<int32_t>&& predicate_field_indexes,
+                       const std::shared_ptr<MemoryPool>& pool);
+
+    Result<bool> AccumulateFile(const DataFileMeta& file,
+                                const std::optional<DeletionFile>& deletion_file,
+                                std::vector<Literal>* results) const;
+
+    static bool SupportMinMax(FieldType type);
+
+ private:
+    bool pk_table_;
+    int64_t schema_id_;
+    std::shared_ptr<arrow::Schema> arrow_schema_;
+    std::vector<AggregateField> aggregate_fields_;
+    std::vector<Literal> results_;
+    bool has_min_max_ = false;
+    bool has_predicate_;
+    // null if the predicate cannot be negated or decided from stats, then no split can be answered
+    std::shared_ptr<PredicateFilter> negated_predicate_;
+    std::vector<int32_t> predicate_field_indexes_;
+    std::shared_ptr<SimpleStatsEvolution> evolution_;
+};
+}  // namespace paimon
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/table/source/metadata_aggregator.h"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "arrow/api.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/predicate/predicate_filter.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/deletion_file.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/defs.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class MetadataAggregatorTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+    }
+
+    std::shared_ptr<TableSchema> CreateTableSchema(
+        const std::vector<std::string>& primary_keys) const {
+        arrow::FieldVector fields = {arrow::field("f0", arrow::int32()),
+                                     arrow::field("f1", arrow::int32()),
+                                     arrow::field("f2", arrow::float64())};
+        std::map<std::string, std::string> options;
+        options[Options::BUCKET] = "1";
+        return TableSchema::Create(/*schema_id=*/0, arrow::schema(fields),
+                                   /*partition_keys=*/{}, primary_keys, options)
+            .value();
+    }
+
+    std::shared_ptr<DataFileMeta> CreateFile(const std::string& file_name, int64_t row_count,
+                                             int32_t min_f1, int32_t max_f1,
+                                             const std::optional<int64_t>& delete_row_count) {
+        return std::make_shared<DataFileMeta>(
+            file_name, /*file_size=*/1024, row_count,
+            /*min_key=*/BinaryRow::EmptyRow(), /*max_key=*/BinaryRow::EmptyRow(),
+            /*key_stats=*/SimpleStats::EmptyStats(),
+            BinaryRowGenerator::GenerateStats({0, min_f1, 1.5}, {100, max_f1, 2.5}, {0, 0, 0},
+                                              pool_.get()),
+            /*min_sequence_number=*/0, /*max_sequence_number=*/row_count - 1, /*schema_id=*/0,
+            /*level=*/5, /*extra_files=*/std::vector<std::optional<std::string>>(),
+            /*creation_time=*/Timestamp(1721643142472ll, 0), delete_row_count,
+            /*embedded_index=*/nullptr, FileSource::Compact(),
+            /*value_stats_cols=*/std::nullopt, /*external_path=*/std::nullopt,
+            /*first_row_id=*/std::nullopt, /*write_cols=*/std::nullopt);
+    }
+
+    std::shared_ptr<DataSplitImpl> CreateSplit(
+        const std::vector<std::shared_ptr<DataFileMeta>>& data_files,
+        const std::vector<std::optional<DeletionFile>>& deletion_files = {}) const {
+        DataSplitImpl::Builder builder(BinaryRow::EmptyRow(), /*bucket=*/0,
+                                       /*bucket_path=*/"bucket-0", data_files);
+        return std::dynamic_pointer_cast<DataSplitImpl>(
+            builder.WithTotalBuckets(1)
+                .WithSnapshot(1)
+                .WithDataDeletionFiles(deletion_files)
+                .IsStreaming(false)
+                .RawConvertible(true)
+                .Build()
+                .value());
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_F(MetadataAggregatorTest, TestPrimaryKeyTable) {
+    ASSERT_OK_AND_ASSIGN(
+        auto aggregator,
+        MetadataAggregator::Create(CreateTableSchema({"f0"}),
+                                   {AggregateCall::CountStar(), AggregateCall::Max("f1")},
+                                   /*non_partition_predicate=*/nullptr, pool_));
+    ASSERT_OK_AND_ASSIGN(bool answered,
+                         aggregator->Accumulate(*CreateSplit({CreateFile("a.orc", 10, 1, 5, 0)})));
+    ASSERT_TRUE(answered);
+    // retract rows would be counted
+    ASSERT_OK_AND_ASSIGN(answered,
+                         aggregator->Accumulate(*CreateSplit({CreateFile("b.orc", 10, 1, 8, 0),
+                                                              CreateFile("c.orc", 10, 1, 9, 2)})));
+    ASSERT_FALSE(answered);
+    // delete row count is unknown in old files
+    ASSERT_OK_AND_ASSIGN(answered, aggregator->Accumulate(*CreateSplit(
+                                       {CreateFile("d.orc", 10, 1, 9, std::nullopt)})));
+    ASSERT_FALSE(answered);
+    std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(10)), Literal(5)};
+    ASSERT_EQ(expected_results, aggregator->Results());
+}
+
+TEST_F(MetadataAggregatorTest, TestDeletionVector) {
+    auto data_files = std::vector<std::shared_ptr<DataFileMeta>>(
+        {CreateFile("a.orc", 10, 1, 5, 0), CreateFile("b.orc", 20, 1, 9, 0)});
+    std::vector<std::optional<DeletionFile>> deletion_files = {
+        DeletionFile("index-0", /*offset=*/1, /*length=*/24, /*cardinality=*/3), std::nullopt};
+    {
+        ASSERT_OK_AND_ASSIGN(
+            auto aggregator,
+            MetadataAggregator::Create(CreateTableSchema({"f0"}), {AggregateCall::CountStar()},
+                                       /*non_partition_predicate=*/nullptr, pool_));
+        ASSERT_OK_AND_ASSIGN(bool answered,
+                             aggregator->Accumulate(*CreateSplit(data_files, deletion_files)));
+        ASSERT_TRUE(answered);
+        // deleted rows are unknown without cardinality
+        ASSERT_OK_AND_ASSIGN(
+            answered,
+            aggregator->Accumulate(*CreateSplit(
+                {CreateFile("c.orc", 10, 1, 5, 0)},
+                {DeletionFile("index-1", /*offset=*/1, /*length=*/24, std::nullopt)})));
+        ASSERT_FALSE(answered);
+        std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(27))};
+        ASSERT_EQ(expected_results, aggregator->Results());
+    }
+    {
+        // deleted rows may hold the min or max value
+        ASSERT_OK_AND_ASSIGN(
+            auto aggregator,
+            MetadataAggregator::Create(CreateTableSchema({"f0"}),
+                                       {AggregateCall::CountStar(), AggregateCall::Min("f1")},
+                                       /*non_partition_predicate=*/nullptr, pool_));
+        ASSERT_OK_AND_ASSIGN(bool answered,
+                             aggregator->Accumulate(*CreateSplit(data_files, deletion_files)));
+        ASSERT_FALSE(answered);
+        ASSERT_OK_AND_ASSIGN(answered, aggregator->Accumulate(*CreateSplit(
+                                           data_files, {std::nullopt, std::nullopt})));
+        ASSERT_TRUE(answered);
+        std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(30)), Literal(1)};
+        ASSERT_EQ(expected_results, aggregator->Results());
+    }
+}
+
+TEST_F(MetadataAggregatorTest, TestPredicate) {
+    auto split = CreateSplit({CreateFile("a.orc", 10, 1, 5, std::nullopt)});
+    {
+        auto predicate = std::dynamic_pointer_cast<PredicateFilter>(
+            PredicateBuilder::GreaterThan(/*field_index=*/1, /*field_name=*/"f1", FieldType::INT,
+                                          Literal(0)));
+        ASSERT_OK_AND_ASSIGN(auto aggregator,
+                             MetadataAggregator::Create(CreateTableSchema(/*primary_keys=*/{}),
+                                                        {AggregateCall::CountStar()}, predicate,
+                                                        pool_));
+        ASSERT_OK_AND_ASSIGN(bool answered, aggregator->Accumulate(*split));
+        ASSERT_TRUE(answered);
+        std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(10))};
+        ASSERT_EQ(expected_results, aggregator->Results());
+    }
+    {
+        // a NaN row matches neither the predicate nor its negation
+        auto predicate = std::dynamic_pointer_cast<PredicateFilter>(
+            PredicateBuilder::GreaterThan(/*field_index=*/2, /*field_name=*/"f2",
+                                          FieldType::DOUBLE, Literal(1.0)));
+        ASSERT_OK_AND_ASSIGN(auto aggregator,
+                             MetadataAggregator::Create(CreateTableSchema(/*primary_keys=*/{}),
+                                                        {AggregateCall::CountStar()}, predicate,
+                                                        pool_));
+        ASSERT_OK_AND_ASSIGN(bool answered, aggregator->Accumulate(*split));
+        ASSERT_FALSE(answered);
+        std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(0))};
+        ASSERT_EQ(expected_results, aggregator->Results());
+    }
+}
+
+}  // namespace paimon::test
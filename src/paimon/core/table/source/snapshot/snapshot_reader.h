@@ -89,6 +89,14 @@ class SnapshotReader {
         return scan_->GetSnapshotManager();
     }
 
+    const std::shared_ptr<TableSchema>& GetTableSchema() const {
+        return scan_->GetTableSchema();
+    }
+
+    const std::shared_ptr<MemoryPool>& GetMemoryPool() const {
+        return scan_->GetMemoryPool();
+    }
+
     std::shared_ptr<PredicateFilter> GetNonPartitionPredicate() const {
         return scan_->GetNonPartitionPredicate();
     }
@@ -16,24 +16,19 @@
 
 #include "paimon/table/source/table_read.h"
 
-#include <cassert>
-#include <map>
 #include <optional>
 #include <string>
 #include <utility>
 
-#include "fmt/format.h"
 #include "paimon/common/reader/concat_batch_reader.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/string_utils.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/operation/internal_read_context.h"
-#include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/table/source/append_only_table_read.h"
 #include "paimon/core/table/source/fallback_table_read.h"
 #include "paimon/core/table/source/key_value_table_read.h"
-#include "paimon/core/utils/branch_manager.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/defs.h"
 #include "paimon/format/file_format.h"
@@ -46,41 +41,6 @@ class Executor;
 class MemoryPool;
 
 namespace {
-Result<std::unique_ptr<InternalReadContext>> CreateInternalReadContext(
-    const std::shared_ptr<ReadContext>& context, const std::string& branch) {
-    std::map<std::string, std::string> tmp_options = context->GetOptions();
-    std::shared_ptr<TableSchema> table_schema;
-    const auto& specific_table_schema = context->GetSpecificTableSchema();
-    if (branch == BranchManager::DEFAULT_MAIN_BRANCH && specific_table_schema) {
-        PAIMON_ASSIGN_OR_RAISE(table_schema,
-                               TableSchema::CreateFromJson(specific_table_schema.value()));
-    } else {
-        PAIMON_ASSIGN_OR_RAISE(
-            CoreOptions tmp_core_options,
-            CoreOptions::FromMap(tmp_options, context->GetFileSystemSchemeToIdentifierMap(),
-                                 context->GetSpecificFileSystem()));
-        SchemaManager schema_manager(tmp_core_options.GetFileSystem(), context->GetPath(), branch);
-        PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_schema,
-                               schema_manager.Latest());
-        if (!latest_schema) {
-            return Status::Invalid(fmt::format("schema file not found in path {}, branch {}",
-                                               context->GetPath(), branch));
-        }
-        table_schema = latest_schema.value();
-    }
-    assert(table_schema);
-
-    // merge options
-    auto options = table_schema->Options();
-    for (const auto& [key, value] : tmp_options) {
-        options[key] = value;
-    }
-    if (branch != BranchManager::DEFAULT_MAIN_BRANCH) {
-        options[Options::BRANCH] = branch;
-    }
-    return InternalReadContext::Create(context, table_schema, options);
-}
-
 Result<std::unique_ptr<TableRead>> CreateTableRead(
     const std::shared_ptr<InternalReadContext>& internal_context,
     const std::shared_ptr<MemoryPool>& memory_pool, const std::shared_ptr<Executor>& executor) {
@@ -126,7 +86,7 @@ Result<std::unique_ptr<TableRead>> TableRead::Create(std::unique_ptr<ReadContext
     auto executor = context->GetExecutor();
 
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InternalReadContext> internal_context,
-                           CreateInternalReadContext(context, context->GetBranch()));
+                           InternalReadContext::Create(context, context->GetBranch()));
 
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
                            CreateTableRead(internal_context, memory_pool, executor));
@@ -140,7 +100,7 @@ Result<std::unique_ptr<TableRead>> TableRead::Create(std::unique_ptr<ReadContext
 
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<InternalReadContext> fallback_context,
-        CreateInternalReadContext(context, /*branch=*/scan_fallback_branch.value()));
+        InternalReadContext::Create(context, /*branch=*/scan_fallback_branch.value()));
 
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> fallback_table_read,
                            CreateTableRead(fallback_context, memory_pool, executor));
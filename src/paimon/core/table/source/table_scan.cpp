@@ -51,6 +51,7 @@
 #include "paimon/core/utils/fields_comparator.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/index_file_path_factories.h"
+#include "paimon/core/utils/objects_cache.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/format/file_format.h"
 #include "paimon/result.h"
@@ -78,10 +79,12 @@ class TableScanImpl {
         auto snapshot_manager = std::make_shared<SnapshotManager>(fs, context->GetPath());
         // TODO(liancheng.lsz): support fallback branch in scan
         auto schema_manager = std::make_shared<SchemaManager>(fs, context->GetPath());
+        std::shared_ptr<ObjectsCache> manifest_cache =
+            ObjectsCache::GetShared(core_options.GetManifestCacheMaxMemorySize());
         PAIMON_ASSIGN_OR_RAISE(
             std::shared_ptr<ManifestList> manifest_list,
             ManifestList::Create(fs, manifest_file_format, core_options.GetManifestCompression(),
-                                 path_factory, memory_pool));
+                                 path_factory, memory_pool, manifest_cache));
         PAIMON_ASSIGN_OR_RAISE(
             std::shared_ptr<arrow::Schema> partition_schema,
             FieldMapping::GetPartitionSchema(arrow_schema, table_schema->PartitionKeys()));
@@ -149,6 +152,11 @@ class TableScanImpl {
     }
 };
 
+Result<std::shared_ptr<AggregatePlan>> TableScan::CreateAggregatePlan(
+    const std::vector<AggregateCall>& aggregates) {
+    return Status::NotImplemented("aggregate pushdown is not supported by this scan");
+}
+
 Result<std::unique_ptr<TableScan>> TableScan::Create(std::unique_ptr<ScanContext> context) {
     if (context == nullptr) {
         return Status::Invalid("scan context is null pointer");
@@ -22,6 +22,7 @@
 
 #include "gtest/gtest.h"
 #include "paimon/defs.h"
+#include "paimon/predicate/literal.h"
 #include "paimon/scan_context.h"
 #include "paimon/status.h"
 #include "paimon/testing/utils/testharness.h"
@@ -39,6 +40,19 @@ TEST(TableScanTest, TestNoSnapshot) {
     ASSERT_TRUE(plan->Splits().empty());
 }
 
+TEST(TableScanTest, TestAggregateNoSnapshot) {
+    std::string path = paimon::test::GetDataDir() +
+                       "/orc/append_table_with_nested_type.db/append_table_with_nested_type/";
+    ScanContextBuilder builder(path);
+    builder.AddOption(Options::FILE_FORMAT, "orc");
+    ASSERT_OK_AND_ASSIGN(auto context, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(context)));
+    ASSERT_OK_AND_ASSIGN(auto plan, table_scan->CreateAggregatePlan({AggregateCall::CountStar()}));
+    ASSERT_FALSE(plan->SnapshotId());
+    ASSERT_TRUE(plan->IsExact());
+    ASSERT_EQ(std::vector<Literal>({Literal(static_cast<int64_t>(0))}), plan->PartialResults());
+}
+
 TEST(TableScanTest, TestNonExistTable) {
     std::string path = paimon::test::GetDataDir() + "/non-exist.db/non-exist/";
     ScanContextBuilder builder(path);
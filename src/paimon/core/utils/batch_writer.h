@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "paimon/result.h"
+#include "paimon/status.h"
 
 struct ArrowArray;
 
@@ -42,6 +44,20 @@ class BatchWriter {
     /// @param wait_compaction if this method need to wait for current compaction to complete
     /// @return Incremental files in this snapshot cycle
     virtual Result<CommitIncrement> PrepareCommit(bool wait_compaction) = 0;
+    /// Flush buffered records into files ahead of `PrepareCommit(bool)`, which then only needs to
+    /// sync compaction and drain the increment. Writers of different buckets may be flushed
+    /// concurrently on the write executor, so this must not block on compaction.
+    virtual Status FlushForCommit() = 0;
+    /// Memory occupied by buffered records of this writer, in bytes, including the data buffered by
+    /// the format writers of open files. Writers which do not buffer records occupy no memory.
+    virtual int64_t MemoryOccupancy() const {
+        return 0;
+    }
+    /// Release the memory of buffered records, by flushing them into files or spilling them to
+    /// local disk. Called when the total memory of writers exceeds the shared budget.
+    virtual Status FlushMemory() {
+        return Status::OK();
+    }
     /// Check if a compaction is in progress, or if a compaction result remains to be fetched.
     virtual bool IsCompacting() const = 0;
     /// Close this writer, the call will delete newly generated but not committed files.
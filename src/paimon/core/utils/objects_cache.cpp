@@ -0,0 +1,157 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/objects_cache.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "paimon/common/fs/resolving_file_system.h"
+#include "paimon/fs/file_system.h"
+
+namespace paimon {
+ObjectsCache::ObjectsCache(int64_t max_memory_size, const std::shared_ptr<MemoryPool>& pool)
+    : max_memory_size_(max_memory_size), pool_(pool) {}
+
+std::shared_ptr<ObjectsCache> ObjectsCache::GetShared(int64_t max_memory_size) {
+    if (max_memory_size <= 0) {
+        return nullptr;
+    }
+    static std::mutex shared_mutex;
+    static std::shared_ptr<ObjectsCache> shared_cache;
+    std::lock_guard<std::mutex> guard(shared_mutex);
+    if (!shared_cache) {
+        shared_cache = std::make_shared<ObjectsCache>(max_memory_size, GetMemoryPool());
+    } else {
+        shared_cache->EnsureCapacity(max_memory_size);
+    }
+    return shared_cache;
+}
+
+std::string ObjectsCache::MakeKey(const std::shared_ptr<FileSystem>& file_system,
+                                  const std::string& path) {
+    if (auto resolving_fs = dynamic_cast<const ResolvingFileSystem*>(file_system.get())) {
+        return "resolving:" + resolving_fs->Identity() + ":" + path;
+    }
+    // an address may be reused by another file system once the former is released, so each
+    // live instance is given a unique id that is never reused
+    static std::mutex scopes_mutex;
+    static std::map<const FileSystem*, std::pair<std::weak_ptr<FileSystem>, int64_t>> scopes;
+    static int64_t next_scope_id = 0;
+    int64_t scope_id;
+    {
+        std::lock_guard<std::mutex> guard(scopes_mutex);
+        auto iter = scopes.find(file_system.get());
+        if (iter != scopes.end() && iter->second.first.lock() == file_system) {
+            scope_id = iter->second.second;
+        } else {
+            for (auto scope_iter = scopes.begin(); scope_iter != scopes.end();) {
+                if (scope_iter->second.first.expired()) {
+                    scope_iter = scopes.erase(scope_iter);
+                } else {
+                    ++scope_iter;
+                }
+            }
+            scope_id = next_scope_id++;
+            scopes[file_system.get()] = {file_system, scope_id};
+        }
+    }
+    return "fs-" + std::to_string(scope_id) + ":" + path;
+}
+
+std::shared_ptr<const ObjectsCache::Rows> ObjectsCache::Get(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    lru_list_.splice(lru_list_.begin(), lru_list_, iter->second);
+    return iter->second->rows;
+}
+
+BinaryRow ObjectsCache::CopyRow(const BinaryRow& row) const {
+    return row.Copy(pool_.get());
+}
+
+void ObjectsCache::Put(const std::string& key, Rows&& rows) {
+    int64_t memory_size = MemorySizeOf(rows);
+    if (memory_size > MaxMemorySize()) {
+        return;
+    }
+    auto cached_rows = std::make_shared<const Rows>(std::move(rows));
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (entries_.find(key) != entries_.end()) {
+        // cached by a concurrent reader
+        return;
+    }
+    lru_list_.push_front(Entry{key, std::move(cached_rows), memory_size});
+    entries_[key] = lru_list_.begin();
+    memory_size_ += memory_size;
+    EvictIfNeeded();
+}
+
+void ObjectsCache::Invalidate(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return;
+    }
+    memory_size_ -= iter->second->memory_size;
+    lru_list_.erase(iter->second);
+    entries_.erase(iter);
+}
+
+void ObjectsCache::EnsureCapacity(int64_t max_memory_size) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    max_memory_size_ = std::max(max_memory_size_, max_memory_size);
+}
+
+int64_t ObjectsCache::MaxMemorySize() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return max_memory_size_;
+}
+
+int64_t ObjectsCache::MemorySize() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return memory_size_;
+}
+
+size_t ObjectsCache::Size() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return entries_.size();
+}
+
+int64_t ObjectsCache::MemorySizeOf(const Rows& rows) {
+    // count the segments behind rows rather than their logical size, which may be much smaller
+    int64_t memory_size = static_cast<int64_t>(rows.size() * sizeof(BinaryRow));
+    for (const auto& row : rows) {
+        for (const auto& segment : row.GetSegments()) {
+            memory_size += segment.Size();
+        }
+    }
+    return memory_size;
+}
+
+void ObjectsCache::EvictIfNeeded() {
+    while (memory_size_ > max_memory_size_ && !lru_list_.empty()) {
+        const Entry& eldest = lru_list_.back();
+        memory_size_ -= eldest.memory_size;
+        entries_.erase(eldest.key);
+        lru_list_.pop_back();
+    }
+}
+}  // namespace paimon
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon {
+class FileSystem;
+
+/// A thread-safe LRU cache for the objects of meta files (e.g., manifest files and manifest
+/// lists), keyed by file system scope and file path. Meta files are immutable once written, so
+/// cached objects never go stale. Objects are kept in their compact `BinaryRow` form, which is
+/// allocated from the memory pool of the cache, and the total memory held by cached rows is
+/// bounded by `max_memory_size`.
+class ObjectsCache {
+ public:
+    using Rows = std::vector<BinaryRow>;
+
+    ObjectsCache(int64_t max_memory_size, const std::shared_ptr<MemoryPool>& pool);
+
+    /// Get the process-wide cache shared by all meta files, the capacity of the cache is the
+    /// largest `max_memory_size` requested so far.
+    ///
+    /// @return The shared cache, or nullptr if `max_memory_size` is not positive.
+    static std::shared_ptr<ObjectsCache> GetShared(int64_t max_memory_size);
+
+    /// Files of different file systems may share the same path, so the key of a file is its path
+    /// prefixed by the scope of its file system. `ResolvingFileSystem`s with the same identity
+    /// share a scope, any other file system instance has a scope of its own.
+    ///
+    /// @return Key of the file at `path` of `file_system`.
+    static std::string MakeKey(const std::shared_ptr<FileSystem>& file_system,
+                               const std::string& path);
+
+    /// @return Cached rows of `key`, or nullptr if absent.
+    std::shared_ptr<const Rows> Get(const std::string& key);
+
+    /// Copy `row` into an exactly-sized segment allocated from the memory pool of cache, so that
+    /// memory of the source row can be released at once.
+    BinaryRow CopyRow(const BinaryRow& row) const;
+
+    /// Cache `rows` copied by `CopyRow()` with `key`, least recently used entries are evicted
+    /// when the cache is full. Rows larger than the cache are not cached.
+    void Put(const std::string& key, Rows&& rows);
+
+    void Invalidate(const std::string& key);
+
+    /// Enlarge the capacity of cache, a smaller `max_memory_size` is ignored.
+    void EnsureCapacity(int64_t max_memory_size);
+
+    int64_t MaxMemorySize() const;
+    /// @return Total memory held by cached rows.
+    int64_t MemorySize() const;
+    /// @return Number of cached entries.
+    size_t Size() const;
+
+ private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const Rows> rows;
+        int64_t memory_size;
+    };
+
+    static int64_t MemorySizeOf(const Rows& rows);
+    // Precondition: caller holds `mutex_`
+    void EvictIfNeeded();
+
+    mutable std::mutex mutex_;
+    int64_t max_memory_size_;
+    int64_t memory_size_ = 0;
+    std::shared_ptr<MemoryPool> pool_;
+    // most recently used entry at front
+    std::list<Entry> lru_list_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+};
+}  // namespace paimon
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/objects_cache.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row_writer.h"
+#include "paimon/common/fs/resolving_file_system.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class ObjectsCacheTest : public testing::Test {
+ public:
+    ObjectsCache::Rows GenerateRows(const ObjectsCache& cache,
+                                    const std::vector<int64_t>& values) const {
+        ObjectsCache::Rows rows;
+        for (int64_t value : values) {
+            rows.push_back(cache.CopyRow(BinaryRowGenerator::GenerateRow({value}, pool_.get())));
+        }
+        return rows;
+    }
+
+ private:
+    std::shared_ptr<MemoryPool> pool_ = GetDefaultPool();
+};
+
+TEST_F(ObjectsCacheTest, TestGetAndPut) {
+    ObjectsCache cache(/*max_memory_size=*/1024 * 1024, GetDefaultPool());
+    ASSERT_FALSE(cache.Get("file-0"));
+    ObjectsCache::Rows rows = GenerateRows(cache, {1, 2, 3});
+    cache.Put("file-0", ObjectsCache::Rows(rows));
+    auto cached_rows = cache.Get("file-0");
+    ASSERT_TRUE(cached_rows);
+    ASSERT_EQ(rows, *cached_rows);
+    ASSERT_EQ(1, cache.Size());
+    ASSERT_GT(cache.MemorySize(), 0);
+
+    // put an existing key is ignored
+    int64_t memory_size = cache.MemorySize();
+    cache.Put("file-0", GenerateRows(cache, {4}));
+    ASSERT_EQ(rows, *cache.Get("file-0"));
+    ASSERT_EQ(memory_size, cache.MemorySize());
+
+    cache.Invalidate("file-0");
+    ASSERT_FALSE(cache.Get("file-0"));
+    ASSERT_EQ(0, cache.Size());
+    ASSERT_EQ(0, cache.MemorySize());
+}
+
+TEST_F(ObjectsCacheTest, TestEvictLeastRecentlyUsed) {
+    auto pool = std::shared_ptr<MemoryPool>(GetMemoryPool());
+    ObjectsCache probe(/*max_memory_size=*/1024 * 1024, pool);
+    probe.Put("probe", GenerateRows(probe, {0}));
+    int64_t entry_size = probe.MemorySize();
+    ASSERT_GT(pool->CurrentUsage(), 0);
+    probe.Invalidate("probe");
+
+    ObjectsCache cache(/*max_memory_size=*/entry_size * 2, GetDefaultPool());
+    cache.Put("file-0", GenerateRows(cache, {0}));
+    cache.Put("file-1", GenerateRows(cache, {1}));
+    // touch file-0, so that file-1 is the least recently used one
+    ASSERT_TRUE(cache.Get("file-0"));
+    cache.Put("file-2", GenerateRows(cache, {2}));
+    ASSERT_EQ(2, cache.Size());
+    ASSERT_EQ(entry_size * 2, cache.MemorySize());
+    ASSERT_TRUE(cache.Get("file-0"));
+    ASSERT_FALSE(cache.Get("file-1"));
+    ASSERT_TRUE(cache.Get("file-2"));
+
+    // rows larger than the cache are not cached
+    cache.Put("file-3", GenerateRows(cache, {3, 4, 5}));
+    ASSERT_FALSE(cache.Get("file-3"));
+    ASSERT_EQ(2, cache.Size());
+
+    cache.EnsureCapacity(entry_size * 5);
+    cache.Put("file-3", GenerateRows(cache, {3, 4, 5}));
+    ASSERT_TRUE(cache.Get("file-3"));
+    ASSERT_EQ(3, cache.Size());
+}
+
+TEST_F(ObjectsCacheTest, TestMemorySizeOfSegments) {
+    auto pool = GetDefaultPool();
+    ObjectsCache cache(/*max_memory_size=*/1024 * 1024, pool);
+    BinaryRow row(1);
+    BinaryRowWriter writer(&row, 32 * 1024, pool.get());
+    writer.WriteLong(0, 1);
+    writer.Complete();
+    ASSERT_LT(row.GetSizeInBytes(), 1024);
+
+    // the whole segment behind the row is counted
+    cache.Put("file-0", ObjectsCache::Rows({row}));
+    ASSERT_GE(cache.MemorySize(), 32 * 1024);
+    cache.Invalidate("file-0");
+
+    // a copied row holds an exactly-sized segment
+    BinaryRow copied_row = cache.CopyRow(row);
+    ASSERT_EQ(row, copied_row);
+    ASSERT_EQ(1, copied_row.GetSegments().size());
+    ASSERT_EQ(row.GetSizeInBytes(), copied_row.GetSegments()[0].Size());
+    cache.Put("file-0", ObjectsCache::Rows({copied_row}));
+    ASSERT_LT(cache.MemorySize(), 1024);
+}
+
+TEST_F(ObjectsCacheTest, TestMakeKey) {
+    // resolving file systems with the same identity share keys
+    std::shared_ptr<FileSystem> resolving_fs1 = std::make_shared<ResolvingFileSystem>(
+        std::map<std::string, std::string>(), "local", std::map<std::string, std::string>());
+    std::shared_ptr<FileSystem> resolving_fs2 = std::make_shared<ResolvingFileSystem>(
+        std::map<std::string, std::string>(), "local", std::map<std::string, std::string>());
+    std::shared_ptr<FileSystem> resolving_fs3 = std::make_shared<ResolvingFileSystem>(
+        std::map<std::string, std::string>({{"file", "local"}}), "local",
+        std::map<std::string, std::string>());
+    ASSERT_EQ(ObjectsCache::MakeKey(resolving_fs1, "/tmp/file"),
+              ObjectsCache::MakeKey(resolving_fs2, "/tmp/file"));
+    ASSERT_NE(ObjectsCache::MakeKey(resolving_fs1, "/tmp/file"),
+              ObjectsCache::MakeKey(resolving_fs1, "/tmp/file2"));
+    ASSERT_NE(ObjectsCache::MakeKey(resolving_fs1, "/tmp/file"),
+              ObjectsCache::MakeKey(resolving_fs3, "/tmp/file"));
+
+    // other file systems have a scope of each instance
+    std::shared_ptr<FileSystem> local_fs1 = std::make_shared<LocalFileSystem>();
+    std::shared_ptr<FileSystem> local_fs2 = std::make_shared<LocalFileSystem>();
+    std::string key1 = ObjectsCache::MakeKey(local_fs1, "/tmp/file");
+    ASSERT_EQ(key1, ObjectsCache::MakeKey(local_fs1, "/tmp/file"));
+    ASSERT_NE(key1, ObjectsCache::MakeKey(local_fs2, "/tmp/file"));
+    ASSERT_NE(key1, ObjectsCache::MakeKey(resolving_fs1, "/tmp/file"));
+    // a new file system never reuses the key of a released one, even at the same address
+    local_fs1.reset();
+    std::shared_ptr<FileSystem> local_fs3 = std::make_shared<LocalFileSystem>();
+    ASSERT_NE(key1, ObjectsCache::MakeKey(local_fs3, "/tmp/file"));
+}
+
+TEST_F(ObjectsCacheTest, TestShared) {
+    ASSERT_FALSE(ObjectsCache::GetShared(/*max_memory_size=*/0));
+    auto cache = ObjectsCache::GetShared(/*max_memory_size=*/1024);
+    ASSERT_TRUE(cache);
+    ASSERT_EQ(cache, ObjectsCache::GetShared(/*max_memory_size=*/2048));
+    ASSERT_GE(cache->MaxMemorySize(), 2048);
+    ASSERT_EQ(cache, ObjectsCache::GetShared(/*max_memory_size=*/512));
+    ASSERT_GE(cache->MaxMemorySize(), 2048);
+}
+}  // namespace paimon::test
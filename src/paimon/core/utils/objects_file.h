@@ -32,6 +32,7 @@
 #include "paimon/core/io/meta_to_arrow_array_converter.h"
 #include "paimon/core/utils/manifest_meta_reader.h"
 #include "paimon/core/utils/object_serializer.h"
+#include "paimon/core/utils/objects_cache.h"
 #include "paimon/core/utils/path_factory.h"
 #include "paimon/format/format_writer.h"
 #include "paimon/format/reader_builder.h"
@@ -40,7 +41,8 @@
 #include "paimon/record_batch.h"
 
 namespace paimon {
-/// A file which contains several `T`s, provides read and write.
+/// A file which contains several `T`s, provides read and write. If `cache` is set, objects of
+/// the files read are cached and later reads of the same file do not touch the file system.
 class PredicateFilter;
 template <typename T>
 class ObjectsFile {
@@ -50,7 +52,8 @@ class ObjectsFile {
                 const std::shared_ptr<WriterBuilder>& writer_builder,
                 std::unique_ptr<ObjectSerializer<T>>&& serializer, const std::string& compression,
                 const std::shared_ptr<PathFactory>& path_factory,
-                const std::shared_ptr<MemoryPool>& pool);
+                const std::shared_ptr<MemoryPool>& pool,
+                const std::shared_ptr<ObjectsCache>& cache = nullptr);
 
     virtual ~ObjectsFile() = default;
 
@@ -62,6 +65,9 @@ class ObjectsFile {
 
     void DeleteQuietly(const std::string& file_name) {
         std::string path = path_factory_->ToPath(file_name);
+        if (cache_) {
+            cache_->Invalidate(ObjectsCache::MakeKey(file_system_, path));
+        }
         auto status = file_system_->Delete(path);
         // delete quietly will ignore any status error
         (void)status;
@@ -77,9 +83,19 @@ class ObjectsFile {
     std::unique_ptr<MetaToArrowArrayConverter> to_array_converter_;
 
  private:
+    Status ReadFromFile(const std::string& file_name, const std::string& file_path,
+                        const std::function<Result<bool>(const T&)>& filter,
+                        std::vector<T>* result) const;
+    Status ReadFromCache(const std::string& file_name, const std::string& file_path,
+                         const std::function<Result<bool>(const T&)>& filter,
+                         std::vector<T>* result) const;
+    static Status Collect(T&& obj, const std::function<Result<bool>(const T&)>& filter,
+                          std::vector<T>* result);
+
     std::shared_ptr<FileSystem> file_system_;
     std::shared_ptr<ReaderBuilder> reader_builder_;
     std::string compression_;
+    std::shared_ptr<ObjectsCache> cache_;
 };
 
 template <typename T>
@@ -89,16 +105,16 @@ ObjectsFile<T>::ObjectsFile(const std::shared_ptr<FileSystem>& file_system,
                             std::unique_ptr<ObjectSerializer<T>>&& serializer,
                             const std::string& compression,
                             const std::shared_ptr<PathFactory>& path_factory,
-                            const std::shared_ptr<MemoryPool>& pool)
+                            const std::shared_ptr<MemoryPool>& pool,
+                            const std::shared_ptr<ObjectsCache>& cache)
     : path_factory_(path_factory),
       pool_(pool),
       serializer_(std::move(serializer)),
       writer_builder_(std::move(writer_builder)),
       file_system_(file_system),
       reader_builder_(std::move(reader_builder)),
-      compression_(compression) {
-    // TODO(xinyu.lxy): add cache
-}
+      compression_(compression),
+      cache_(cache) {}
 
 template <typename T>
 Status ObjectsFile<T>::ReadIfFileExist(const std::string& file_name,
@@ -117,6 +133,61 @@ Status ObjectsFile<T>::Read(const std::string& file_name,
                             const std::function<Result<bool>(const T&)>& filter,
                             std::vector<T>* result) const {
     std::string file_path = path_factory_->ToPath(file_name);
+    if (cache_) {
+        return ReadFromCache(file_name, file_path, filter, result);
+    }
+    return ReadFromFile(file_name, file_path, filter, result);
+}
+
+template <typename T>
+Status ObjectsFile<T>::ReadFromCache(const std::string& file_name, const std::string& file_path,
+                                     const std::function<Result<bool>(const T&)>& filter,
+                                     std::vector<T>* result) const {
+    std::string cache_key = ObjectsCache::MakeKey(file_system_, file_path);
+    std::shared_ptr<const ObjectsCache::Rows> rows = cache_->Get(cache_key);
+    if (rows) {
+        result->reserve(result->size() + rows->size());
+        for (const auto& row : *rows) {
+            PAIMON_ASSIGN_OR_RAISE(T obj, serializer_->FromRow(row));
+            PAIMON_RETURN_NOT_OK(Collect(std::move(obj), filter, result));
+        }
+        return Status::OK();
+    }
+    // cache all objects of the file, filter is applied after that
+    std::vector<T> objects;
+    PAIMON_RETURN_NOT_OK(ReadFromFile(file_name, file_path, /*filter=*/nullptr, &objects));
+    ObjectsCache::Rows new_rows;
+    new_rows.reserve(objects.size());
+    for (const auto& obj : objects) {
+        // the serialized row holds a large segment, compact it before serializing the next one
+        PAIMON_ASSIGN_OR_RAISE(BinaryRow row, serializer_->ToRow(obj));
+        new_rows.push_back(cache_->CopyRow(row));
+    }
+    cache_->Put(cache_key, std::move(new_rows));
+    result->reserve(result->size() + objects.size());
+    for (auto& obj : objects) {
+        PAIMON_RETURN_NOT_OK(Collect(std::move(obj), filter, result));
+    }
+    return Status::OK();
+}
+
+template <typename T>
+Status ObjectsFile<T>::Collect(T&& obj, const std::function<Result<bool>(const T&)>& filter,
+                               std::vector<T>* result) {
+    if (filter) {
+        PAIMON_ASSIGN_OR_RAISE(bool filter_res, filter(obj));
+        if (!filter_res) {
+            return Status::OK();
+        }
+    }
+    result->push_back(std::move(obj));
+    return Status::OK();
+}
+
+template <typename T>
+Status ObjectsFile<T>::ReadFromFile(const std::string& file_name, const std::string& file_path,
+                                    const std::function<Result<bool>(const T&)>& filter,
+                                    std::vector<T>* result) const {
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> file_input_stream,
                            file_system_->Open(file_path));
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileBatchReader> batch_reader,
@@ -140,14 +211,7 @@ Status ObjectsFile<T>::Read(const std::string& file_name,
         for (int64_t i = 0; i < struct_array->length(); i++) {
             ColumnarRow row(struct_array->fields(), pool_, i);
             PAIMON_ASSIGN_OR_RAISE(T obj, serializer_->FromRow(row));
-            if (filter) {
-                PAIMON_ASSIGN_OR_RAISE(bool filter_res, filter(obj));
-                if (filter_res) {
-                    result->push_back(std::move(obj));
-                }
-            } else {
-                result->push_back(std::move(obj));
-            }
+            PAIMON_RETURN_NOT_OK(Collect(std::move(obj), filter, result));
         }
     }
     reader->Close();
@@ -38,7 +38,10 @@ SnapshotManager::SnapshotManager(const std::shared_ptr<FileSystem>& fs,
 
 SnapshotManager::SnapshotManager(const std::shared_ptr<FileSystem>& fs,
                                  const std::string& root_path, const std::string& branch)
-    : fs_(fs), root_path_(root_path), branch_(BranchManager::NormalizeBranch(branch)) {}
+    : fs_(fs),
+      root_path_(root_path),
+      branch_(BranchManager::NormalizeBranch(branch)),
+      cache_(std::make_shared<SnapshotCache>()) {}
 
 SnapshotManager::~SnapshotManager() = default;
 
@@ -68,7 +71,57 @@ Result<std::optional<Snapshot>> SnapshotManager::LatestSnapshotOfUser(const std:
 }
 
 Result<Snapshot> SnapshotManager::LoadSnapshot(int64_t snapshot_id) const {
-    return Snapshot::FromPath(fs_, SnapshotPath(snapshot_id));
+    std::optional<Snapshot> cached = GetCachedSnapshot(snapshot_id);
+    if (cached) {
+        return std::move(cached).value();
+    }
+    PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, Snapshot::FromPath(fs_, SnapshotPath(snapshot_id)));
+    PutCachedSnapshot(snapshot);
+    return snapshot;
+}
+
+Result<Snapshot> SnapshotManager::ReloadSnapshot(int64_t snapshot_id) const {
+    PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, Snapshot::FromPath(fs_, SnapshotPath(snapshot_id)));
+    RemoveCachedSnapshot(snapshot_id);
+    PutCachedSnapshot(snapshot);
+    return snapshot;
+}
+
+Status SnapshotManager::DeleteSnapshot(int64_t snapshot_id) const {
+    RemoveCachedSnapshot(snapshot_id);
+    return fs_->Delete(SnapshotPath(snapshot_id));
+}
+
+std::optional<Snapshot> SnapshotManager::GetCachedSnapshot(int64_t snapshot_id) const {
+    std::lock_guard<std::mutex> guard(cache_->mutex);
+    auto iter = cache_->entries.find(snapshot_id);
+    if (iter == cache_->entries.end()) {
+        return std::nullopt;
+    }
+    cache_->lru_list.splice(cache_->lru_list.begin(), cache_->lru_list, iter->second);
+    return *iter->second;
+}
+
+void SnapshotManager::RemoveCachedSnapshot(int64_t snapshot_id) const {
+    std::lock_guard<std::mutex> guard(cache_->mutex);
+    auto iter = cache_->entries.find(snapshot_id);
+    if (iter != cache_->entries.end()) {
+        cache_->lru_list.erase(iter->second);
+        cache_->entries.erase(iter);
+    }
+}
+
+void SnapshotManager::PutCachedSnapshot(const Snapshot& snapshot) const {
+    std::lock_guard<std::mutex> guard(cache_->mutex);
+    if (cache_->entries.find(snapshot.Id()) != cache_->entries.end()) {
+        return;
+    }
+    cache_->lru_list.push_front(snapshot);
+    cache_->entries[snapshot.Id()] = cache_->lru_list.begin();
+    while (cache_->lru_list.size() > SNAPSHOT_CACHE_SIZE) {
+        cache_->entries.erase(cache_->lru_list.back().Id());
+        cache_->lru_list.pop_back();
+    }
 }
 
 Result<std::optional<Snapshot>> SnapshotManager::LatestSnapshot() const {
@@ -82,9 +135,23 @@ Result<std::optional<Snapshot>> SnapshotManager::LatestSnapshot() const {
 }
 
 Result<std::optional<int64_t>> SnapshotManager::LatestSnapshotId() const {
-    return FindLatest(
-        SnapshotDirectory(), std::string(SNAPSHOT_PREFIX),
-        [this](int64_t snapshot_id) -> std::string { return SnapshotPath(snapshot_id); });
+    std::optional<int64_t> latest_known_id;
+    {
+        std::lock_guard<std::mutex> guard(cache_->mutex);
+        latest_known_id = cache_->latest_known_id;
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::optional<int64_t> latest_id,
+        FindLatest(
+            SnapshotDirectory(), std::string(SNAPSHOT_PREFIX),
+            [this](int64_t snapshot_id) -> std::string { return SnapshotPath(snapshot_id); },
+            latest_known_id));
+    {
+        // the latest id may go backwards after a rollback
+        std::lock_guard<std::mutex> guard(cache_->mutex);
+        cache_->latest_known_id = latest_id;
+    }
+    return latest_id;
 }
 
 Result<std::optional<int64_t>> SnapshotManager::EarliestSnapshotId() const {
@@ -130,12 +197,23 @@ Result<std::optional<int64_t>> SnapshotManager::FindEarliest(
 
 Result<std::optional<int64_t>> SnapshotManager::FindLatest(
     const std::string& dir, const std::string& prefix,
-    const std::function<std::string(int64_t)>& path_func) const {
+    const std::function<std::string(int64_t)>& path_func,
+    const std::optional<int64_t>& latest_known_id) const {
     PAIMON_ASSIGN_OR_RAISE(bool is_exist, fs_->Exists(dir));
     if (!is_exist) {
         return std::optional<int64_t>();
     }
     std::optional<int64_t> snapshot_id = ReadHint(LATEST, dir);
+    // the hint is written after the snapshot, the latest id seen before may be newer, unless it
+    // has been rolled back since then
+    if (latest_known_id != std::nullopt && latest_known_id.value() > 0 &&
+        (snapshot_id == std::nullopt || snapshot_id.value() < latest_known_id.value())) {
+        PAIMON_ASSIGN_OR_RAISE(bool is_known_exist,
+                               fs_->Exists(path_func(latest_known_id.value())));
+        if (is_known_exist) {
+            snapshot_id = latest_known_id;
+        }
+    }
     if (snapshot_id != std::nullopt && snapshot_id.value() > 0) {
         int64_t next_snapshot = snapshot_id.value() + 1;
         // it is the latest only there is no next one
@@ -144,11 +222,41 @@ Result<std::optional<int64_t>> SnapshotManager::FindLatest(
         if (!is_exist) {
             return snapshot_id;
         }
+        PAIMON_ASSIGN_OR_RAISE(int64_t latest_id, ProbeLatest(next_snapshot, path_func));
+        return std::optional<int64_t>(latest_id);
     }
     return FindByListFiles([](int64_t lhs, int64_t rhs) -> int64_t { return std::max(lhs, rhs); },
                            dir, prefix);
 }
 
+Result<int64_t> SnapshotManager::ProbeLatest(
+    int64_t start_id, const std::function<std::string(int64_t)>& path_func) const {
+    // find a missing id with doubling steps, then binary search in (exist_id, missing_id)
+    int64_t exist_id = start_id;
+    int64_t missing_id = start_id;
+    int64_t step = 1;
+    while (true) {
+        int64_t probe_id = exist_id + step;
+        PAIMON_ASSIGN_OR_RAISE(bool is_exist, fs_->Exists(path_func(probe_id)));
+        if (!is_exist) {
+            missing_id = probe_id;
+            break;
+        }
+        exist_id = probe_id;
+        step *= 2;
+    }
+    while (missing_id - exist_id > 1) {
+        int64_t mid_id = exist_id + (missing_id - exist_id) / 2;
+        PAIMON_ASSIGN_OR_RAISE(bool is_exist, fs_->Exists(path_func(mid_id)));
+        if (is_exist) {
+            exist_id = mid_id;
+        } else {
+            missing_id = mid_id;
+        }
+    }
+    return exist_id;
+}
+
 Result<std::optional<int64_t>> SnapshotManager::FindByListFiles(
     const std::function<int64_t(int64_t, int64_t)> reducer_func, const std::string& dir,
     const std::string& prefix) const {
@@ -18,22 +18,32 @@
 
 #include <cstdint>
 #include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "paimon/core/snapshot.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
 #include "paimon/type_fwd.h"
 
 namespace paimon {
 
-class Snapshot;
 class FileSystem;
 
 /// Manager for `Snapshot`, providing utility methods related to paths and snapshot hints.
+///
+/// Snapshot files are immutable once committed, so loaded snapshots are kept in a small LRU cache
+/// keyed by snapshot id, which is shared by copies of the manager. The latest snapshot id is
+/// discovered by probing forward from the LATEST hint (or the latest id seen by this manager),
+/// which costs O(log n) existence checks for n missed snapshots instead of listing the snapshot
+/// directory. A long-lived manager therefore polls new snapshots at a cost independent of the
+/// length of the snapshot history.
 class SnapshotManager {
  public:
     static constexpr char SNAPSHOT_PREFIX[] = "snapshot-";
@@ -53,6 +63,11 @@ class SnapshotManager {
     Status CommitLatestHint(int64_t snapshot_id);
     Status CommitEarliestHint(int64_t snapshot_id);
     Result<Snapshot> LoadSnapshot(int64_t snapshot_id) const;
+    /// Load the snapshot of `snapshot_id` from its file bypassing the snapshot cache, and replace
+    /// the cached one, which may be stale if the snapshot is rolled back and committed again.
+    Result<Snapshot> ReloadSnapshot(int64_t snapshot_id) const;
+    /// Delete the snapshot file of `snapshot_id` and drop it from the snapshot cache.
+    Status DeleteSnapshot(int64_t snapshot_id) const;
     Result<std::optional<int64_t>> EarliestSnapshotId() const;
     Result<std::optional<int64_t>> LatestSnapshotId() const;
     Result<bool> SnapshotExists(int64_t snapshot_id) const;
@@ -62,6 +77,16 @@ class SnapshotManager {
  private:
     static constexpr int32_t READ_HINT_RETRY_NUM = 3;
     static constexpr int32_t READ_HINT_RETRY_INTERVAL = 1;
+    static constexpr size_t SNAPSHOT_CACHE_SIZE = 64;
+
+    struct SnapshotCache {
+        std::mutex mutex;
+        // most recently used snapshot at front
+        std::list<Snapshot> lru_list;
+        std::unordered_map<int64_t, std::list<Snapshot>::iterator> entries;
+        // latest snapshot id found by this manager last time, used as the start of probing
+        std::optional<int64_t> latest_known_id;
+    };
 
     std::string BranchPath() const;
 
@@ -70,17 +95,28 @@ class SnapshotManager {
         const std::function<std::string(int64_t)>& path_func) const;
     Result<std::optional<int64_t>> FindLatest(
         const std::string& dir, const std::string& prefix,
-        const std::function<std::string(int64_t)>& path_func) const;
+        const std::function<std::string(int64_t)>& path_func,
+        const std::optional<int64_t>& latest_known_id) const;
+    /// @pre `start_id` exists.
+    /// @return The largest existing id reached from `start_id` by exponential probing followed by
+    ///         binary search, assuming ids are continuous.
+    Result<int64_t> ProbeLatest(int64_t start_id,
+                                const std::function<std::string(int64_t)>& path_func) const;
     Result<std::optional<int64_t>> FindByListFiles(
         const std::function<int64_t(int64_t, int64_t)> reducer_func, const std::string& dir,
         const std::string& prefix) const;
     std::optional<int64_t> ReadHint(const std::string& file_name, const std::string& dir) const;
     Status CommitHint(int64_t snapshot_id, const std::string& file_name, const std::string& dir);
 
+    std::optional<Snapshot> GetCachedSnapshot(int64_t snapshot_id) const;
+    void PutCachedSnapshot(const Snapshot& snapshot) const;
+    void RemoveCachedSnapshot(int64_t snapshot_id) const;
+
  private:
     std::shared_ptr<FileSystem> fs_;
     std::string root_path_;
     std::string branch_;
+    std::shared_ptr<SnapshotCache> cache_;
 };
 
 }  // namespace paimon
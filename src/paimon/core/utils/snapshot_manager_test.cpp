@@ -151,4 +151,86 @@ TEST(SnapshotManagerTest, TestCommitLatestHint) {
     ASSERT_TRUE(exists);
 }
 
+TEST(SnapshotManagerTest, TestFindLatestWithStaleHint) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    std::string table_path = dir->Str();
+    std::string test_data_path = paimon::test::GetDataDir() + "/orc/append_09.db/append_09";
+    ASSERT_TRUE(TestUtil::CopyDirectory(test_data_path, table_path));
+
+    auto file_system = std::make_shared<LocalFileSystem>();
+    for (int64_t hint : {1, 2, 3, 4, 5}) {
+        // a fresh manager has no latest id in memory, the latest is probed from the hint
+        SnapshotManager mgr(file_system, table_path);
+        ASSERT_OK(mgr.CommitLatestHint(hint));
+        ASSERT_OK_AND_ASSIGN(std::optional<int64_t> latest_snapshot_id, mgr.LatestSnapshotId());
+        ASSERT_EQ(latest_snapshot_id.value(), 5);
+    }
+
+    SnapshotManager mgr(file_system, table_path);
+    ASSERT_OK_AND_ASSIGN(std::optional<int64_t> latest_snapshot_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(latest_snapshot_id.value(), 5);
+    // copy snapshot 5 as new snapshots 6 and 7 without updating the hint
+    std::string content;
+    ASSERT_OK(file_system->ReadFile(mgr.SnapshotPath(5), &content));
+    ASSERT_OK(file_system->WriteFile(mgr.SnapshotPath(6), content, /*overwrite=*/false));
+    ASSERT_OK(file_system->WriteFile(mgr.SnapshotPath(7), content, /*overwrite=*/false));
+    ASSERT_OK(mgr.CommitLatestHint(1));
+    ASSERT_OK_AND_ASSIGN(latest_snapshot_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(latest_snapshot_id.value(), 7);
+}
+
+TEST(SnapshotManagerTest, TestFindLatestAfterRollback) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    std::string table_path = dir->Str();
+    std::string test_data_path = paimon::test::GetDataDir() + "/orc/append_09.db/append_09";
+    ASSERT_TRUE(TestUtil::CopyDirectory(test_data_path, table_path));
+
+    auto file_system = std::make_shared<LocalFileSystem>();
+    SnapshotManager mgr(file_system, table_path);
+    ASSERT_OK_AND_ASSIGN(std::optional<int64_t> latest_snapshot_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(latest_snapshot_id.value(), 5);
+    // rollback to snapshot 3 by another process, the latest id in memory is gone
+    std::string content;
+    ASSERT_OK(file_system->ReadFile(mgr.SnapshotPath(4), &content));
+    ASSERT_OK(file_system->Delete(mgr.SnapshotPath(5)));
+    ASSERT_OK(file_system->Delete(mgr.SnapshotPath(4)));
+    ASSERT_OK(mgr.CommitLatestHint(3));
+    ASSERT_OK_AND_ASSIGN(latest_snapshot_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(latest_snapshot_id.value(), 3);
+    // new snapshot after rollback is probed from the hint
+    ASSERT_OK(file_system->WriteFile(mgr.SnapshotPath(4), content, /*overwrite=*/false));
+    ASSERT_OK_AND_ASSIGN(latest_snapshot_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(latest_snapshot_id.value(), 4);
+}
+
+TEST(SnapshotManagerTest, TestSnapshotCache) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    std::string table_path = dir->Str();
+    std::string test_data_path = paimon::test::GetDataDir() + "/orc/append_09.db/append_09";
+    ASSERT_TRUE(TestUtil::CopyDirectory(test_data_path, table_path));
+
+    auto file_system = std::make_shared<LocalFileSystem>();
+    SnapshotManager mgr(file_system, table_path);
+    ASSERT_OK_AND_ASSIGN(Snapshot snapshot3, mgr.LoadSnapshot(3));
+    ASSERT_OK_AND_ASSIGN(Snapshot snapshot4, mgr.LoadSnapshot(4));
+
+    // snapshots are immutable, the cached one is returned even if the file is gone
+    ASSERT_OK(file_system->Delete(mgr.SnapshotPath(3)));
+    ASSERT_OK_AND_ASSIGN(Snapshot cached_snapshot3, mgr.LoadSnapshot(3));
+    ASSERT_EQ(cached_snapshot3, snapshot3);
+    // copies of manager share the cache
+    SnapshotManager copied_mgr = mgr;
+    ASSERT_OK_AND_ASSIGN(cached_snapshot3, copied_mgr.LoadSnapshot(3));
+    ASSERT_EQ(cached_snapshot3, snapshot3);
+
+    // deleting snapshot through manager invalidates the cache
+    ASSERT_OK(mgr.DeleteSnapshot(4));
+    ASSERT_OK_AND_ASSIGN(bool exists, mgr.SnapshotExists(4));
+    ASSERT_FALSE(exists);
+    ASSERT_NOK(mgr.LoadSnapshot(4));
+}
+
 }  // namespace paimon::test
@@ -16,18 +16,19 @@
 
 #include "paimon/format/avro/avro_adaptor.h"
 
-#include <utility>
+#include <cstddef>
+#include <memory>
 
 #include "arrow/api.h"
 #include "arrow/array/array_base.h"
-#include "arrow/c/abi.h"
-#include "arrow/c/bridge.h"
 #include "arrow/ipc/json_simple.h"
+#include "avro/Decoder.hh"
+#include "avro/Encoder.hh"
+#include "avro/Generic.hh"
 #include "avro/GenericDatum.hh"
+#include "avro/Stream.hh"
 #include "gtest/gtest.h"
-#include "paimon/common/utils/arrow/mem_utils.h"
-#include "paimon/core/utils/manifest_meta_reader.h"
-#include "paimon/format/avro/avro_record_converter.h"
+#include "paimon/format/avro/avro_direct_decoder.h"
 #include "paimon/format/avro/avro_schema_converter.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/status.h"
@@ -62,17 +63,26 @@ TEST(AvroAdaptorTest, Simple) {
     ASSERT_OK_AND_ASSIGN(std::vector<::avro::GenericDatum> datums,
                          adaptor.ConvertArrayToGenericDatums(array, avro_schema));
     ASSERT_EQ(4, datums.size());
-    ASSERT_OK_AND_ASSIGN(auto record_converter,
-                         AvroRecordConverter::Create(data_type, GetDefaultPool()));
-    auto read_batch_result = record_converter->NextBatch(datums);
-    ASSERT_OK(read_batch_result);
-    auto [c_array, c_schema] = std::move(read_batch_result).value();
 
-    auto arrow_array = arrow::ImportArray(c_array.get(), c_schema.get()).ValueOrDie();
-    auto arrow_pool = GetArrowPool(GetDefaultPool());
-    ASSERT_OK_AND_ASSIGN(arrow_array, ManifestMetaReader::AlignArrayWithSchema(
-                                          arrow_array, data_type, arrow_pool.get()));
-    ASSERT_TRUE(array->Equals(arrow_array));
+    // encode datums and decode them back to check the round trip
+    std::unique_ptr<::avro::OutputStream> out = ::avro::memoryOutputStream();
+    ::avro::EncoderPtr encoder = ::avro::binaryEncoder();
+    encoder->init(*out);
+    for (const auto& datum : datums) {
+        ::avro::GenericWriter::write(*encoder, datum);
+    }
+    encoder->flush();
+    std::unique_ptr<::avro::InputStream> in = ::avro::memoryInputStream(*out);
+    ::avro::DecoderPtr decoder = ::avro::binaryDecoder();
+    decoder->init(*in);
+    ASSERT_OK_AND_ASSIGN(
+        std::unique_ptr<AvroDirectDecoder> direct_decoder,
+        AvroDirectDecoder::Create(avro_schema.root(), data_type, GetDefaultPool()));
+    for (size_t i = 0; i < datums.size(); ++i) {
+        ASSERT_OK(direct_decoder->Decode(decoder.get()));
+    }
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::Array> arrow_array, direct_decoder->Finish());
+    ASSERT_TRUE(array->Equals(arrow_array)) << arrow_array->ToString();
 }
 
 }  // namespace paimon::avro::test
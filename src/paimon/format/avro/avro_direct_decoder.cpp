@@ -0,0 +1,449 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/format/avro/avro_direct_decoder.h"
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/array/builder_base.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_decimal.h"
+#include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "avro/Exception.hh"
+#include "avro/LogicalType.hh"
+#include "avro/Types.hh"
+#include "fmt/format.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/date_time_utils.h"
+
+namespace paimon::avro {
+
+AvroDirectDecoder::AvroDirectDecoder(const std::shared_ptr<arrow::DataType>& read_type,
+                                     std::unique_ptr<arrow::MemoryPool>&& arrow_pool,
+                                     std::unique_ptr<arrow::StructBuilder>&& struct_builder,
+                                     DecodeFunc&& decode_func)
+    : read_type_(read_type),
+      arrow_pool_(std::move(arrow_pool)),
+      struct_builder_(std::move(struct_builder)),
+      decode_func_(std::move(decode_func)) {}
+
+Result<std::unique_ptr<AvroDirectDecoder>> AvroDirectDecoder::Create(
+    const ::avro::NodePtr& writer_schema, const std::shared_ptr<arrow::DataType>& read_type,
+    const std::shared_ptr<MemoryPool>& pool) {
+    if (!writer_schema || !read_type || read_type->id() != arrow::Type::STRUCT) {
+        return Status::Invalid("avro direct decoder needs a writer schema and a struct read type");
+    }
+    auto arrow_pool = GetArrowPool(pool);
+    std::unique_ptr<arrow::ArrayBuilder> array_builder;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        arrow::MakeBuilder(arrow_pool.get(), read_type, &array_builder));
+    auto struct_builder =
+        arrow::internal::checked_pointer_cast<arrow::StructBuilder>(std::move(array_builder));
+    PAIMON_ASSIGN_OR_RAISE(DecodeFunc decode_func,
+                           MakeDecodeFunc(writer_schema, struct_builder.get()));
+    return std::unique_ptr<AvroDirectDecoder>(new AvroDirectDecoder(
+        read_type, std::move(arrow_pool), std::move(struct_builder), std::move(decode_func)));
+}
+
+Status AvroDirectDecoder::Reserve(int64_t num_records) {
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(struct_builder_->Reserve(num_records));
+    for (int32_t i = 0; i < struct_builder_->num_fields(); i++) {
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(struct_builder_->field_builder(i)->Reserve(num_records));
+    }
+    return Status::OK();
+}
+
+Result<std::shared_ptr<arrow::Array>> AvroDirectDecoder::Finish() {
+    std::shared_ptr<arrow::Array> array;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(struct_builder_->Finish(&array));
+    return array;
+}
+
+::avro::NodePtr AvroDirectDecoder::ResolveNode(const ::avro::NodePtr& node) {
+    if (node->type() == ::avro::AVRO_SYMBOLIC) {
+        return ::avro::resolveSymbol(node);
+    }
+    return node;
+}
+
+Status AvroDirectDecoder::TypeMismatch(const ::avro::NodePtr& node, const arrow::DataType& type) {
+    return Status::TypeError(fmt::format("cannot read avro type {} (logical type {}) as {}",
+                                         ::avro::toString(node->type()),
+                                         static_cast<int32_t>(node->logicalType().type()),
+                                         type.ToString()));
+}
+
+Result<AvroDirectDecoder::DecodeFunc> AvroDirectDecoder::MakeDecodeFunc(
+    const ::avro::NodePtr& avro_node, arrow::ArrayBuilder* builder) {
+    ::avro::NodePtr node = ResolveNode(avro_node);
+    if (node->type() != ::avro::AVRO_UNION) {
+        return MakeNonNullDecodeFunc(node, builder);
+    }
+    // paimon writes nullable fields as union [null, type]
+    if (node->leaves() != 2 || node->leafAt(0)->type() != ::avro::AVRO_NULL) {
+        return Status::Invalid("not support avro union other than [null, type]");
+    }
+    PAIMON_ASSIGN_OR_RAISE(DecodeFunc value_func, MakeNonNullDecodeFunc(node->leafAt(1), builder));
+    return DecodeFunc([builder, value_func](::avro::Decoder* decoder) -> arrow::Status {
+        if (decoder->decodeUnionIndex() == 0) {
+            decoder->decodeNull();
+            return builder->AppendNull();
+        }
+        return value_func(decoder);
+    });
+}
+
+Result<AvroDirectDecoder::DecodeFunc> AvroDirectDecoder::MakeNonNullDecodeFunc(
+    const ::avro::NodePtr& avro_node, arrow::ArrayBuilder* builder) {
+    ::avro::NodePtr node = ResolveNode(avro_node);
+    const arrow::DataType& type = *builder->type();
+    auto logical_type = node->logicalType().type();
+    switch (node->type()) {
+        case ::avro::AVRO_BOOL: {
+            if (type.id() != arrow::Type::BOOL) {
+                return TypeMismatch(node, type);
+            }
+            auto* typed_builder = arrow::internal::checked_cast<arrow::BooleanBuilder*>(builder);
+            return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                return typed_builder->Append(decoder->decodeBool());
+            });
+        }
+        case ::avro::AVRO_INT: {
+            // avro stores tinyint, smallint, int and date as int
+            switch (type.id()) {
+                case arrow::Type::INT8: {
+                    auto* typed_builder =
+                        arrow::internal::checked_cast<arrow::Int8Builder*>(builder);
+                    return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                        return typed_builder->Append(static_cast<int8_t>(decoder->decodeInt()));
+                    });
+                }
+                case arrow::Type::INT16: {
+                    auto* typed_builder =
+                        arrow::internal::checked_cast<arrow::Int16Builder*>(builder);
+                    return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                        return typed_builder->Append(static_cast<int16_t>(decoder->decodeInt()));
+                    });
+                }
+                case arrow::Type::INT32: {
+                    auto* typed_builder =
+                        arrow::internal::checked_cast<arrow::Int32Builder*>(builder);
+                    return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                        return typed_builder->Append(decoder->decodeInt());
+                    });
+                }
+                case arrow::Type::DATE32: {
+                    auto* typed_builder =
+                        arrow::internal::checked_cast<arrow::Date32Builder*>(builder);
+                    return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                        return typed_builder->Append(decoder->decodeInt());
+                    });
+                }
+                default:
+                    return TypeMismatch(node, type);
+            }
+        }
+        case ::avro::AVRO_LONG: {
+            if (type.id() == arrow::Type::INT64 && logical_type == ::avro::LogicalType::NONE) {
+                auto* typed_builder = arrow::internal::checked_cast<arrow::Int64Builder*>(builder);
+                return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                    return typed_builder->Append(decoder->decodeLong());
+                });
+            }
+            if (type.id() != arrow::Type::TIMESTAMP) {
+                return TypeMismatch(node, type);
+            }
+            DateTimeUtils::TimeType src_time_type;
+            switch (logical_type) {
+                case ::avro::LogicalType::TIMESTAMP_MILLIS:
+                case ::avro::LogicalType::LOCAL_TIMESTAMP_MILLIS:
+                    src_time_type = DateTimeUtils::MILLISECOND;
+                    break;
+                case ::avro::LogicalType::TIMESTAMP_MICROS:
+                case ::avro::LogicalType::LOCAL_TIMESTAMP_MICROS:
+                    src_time_type = DateTimeUtils::MICROSECOND;
+                    break;
+                case ::avro::LogicalType::TIMESTAMP_NANOS:
+                case ::avro::LogicalType::LOCAL_TIMESTAMP_NANOS:
+                    src_time_type = DateTimeUtils::NANOSECOND;
+                    break;
+                default:
+                    return TypeMismatch(node, type);
+            }
+            auto* typed_builder = arrow::internal::checked_cast<arrow::TimestampBuilder*>(builder);
+            auto ts_type =
+                arrow::internal::checked_pointer_cast<arrow::TimestampType>(builder->type());
+            DateTimeUtils::TimeType dst_time_type =
+                DateTimeUtils::GetTimeTypeFromArrowType(ts_type);
+            if (src_time_type == dst_time_type) {
+                return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                    return typed_builder->Append(decoder->decodeLong());
+                });
+            }
+            return DecodeFunc(
+                [typed_builder, src_time_type, dst_time_type](::avro::Decoder* decoder) {
+                    int64_t value = DateTimeUtils::TimestampConverter(decoder->decodeLong(),
+                                                                      src_time_type, dst_time_type,
+                                                                      dst_time_type)
+                                        .first;
+                    return typed_builder->Append(value);
+                });
+        }
+        case ::avro::AVRO_FLOAT: {
+            if (type.id() != arrow::Type::FLOAT) {
+                return TypeMismatch(node, type);
+            }
+            auto* typed_builder = arrow::internal::checked_cast<arrow::FloatBuilder*>(builder);
+            return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                return typed_builder->Append(decoder->decodeFloat());
+            });
+        }
+        case ::avro::AVRO_DOUBLE: {
+            if (type.id() != arrow::Type::DOUBLE) {
+                return TypeMismatch(node, type);
+            }
+            auto* typed_builder = arrow::internal::checked_cast<arrow::DoubleBuilder*>(builder);
+            return DecodeFunc([typed_builder](::avro::Decoder* decoder) {
+                return typed_builder->Append(decoder->decodeDouble());
+            });
+        }
+        case ::avro::AVRO_STRING: {
+            if (type.id() != arrow::Type::STRING && type.id() != arrow::Type::BINARY) {
+                return TypeMismatch(node, type);
+            }
+            // StringBuilder is a BinaryBuilder, the buffer is reused by all values
+            auto* typed_builder = arrow::internal::checked_cast<arrow::BinaryBuilder*>(builder);
+            auto buffer = std::make_shared<std::string>();
+            return DecodeFunc([typed_builder, buffer](::avro::Decoder* decoder) {
+                decoder->decodeString(*buffer);
+                return typed_builder->Append(buffer->data(), buffer->size());
+            });
+        }
+        case ::avro::AVRO_BYTES: {
+            auto buffer = std::make_shared<std::vector<uint8_t>>();
+            if (logical_type == ::avro::LogicalType::DECIMAL) {
+                if (type.id() != arrow::Type::DECIMAL128) {
+                    return TypeMismatch(node, type);
+                }
+                auto* typed_builder =
+                    arrow::internal::checked_cast<arrow::Decimal128Builder*>(builder);
+                return DecodeFunc([typed_builder, buffer](::avro::Decoder* decoder) {
+                    // unscaled value in big-endian two's-complement
+                    decoder->decodeBytes(*buffer);
+                    ARROW_ASSIGN_OR_RAISE(
+                        arrow::Decimal128 value,
+                        arrow::Decimal128::FromBigEndian(buffer->data(),
+                                                         static_cast<int32_t>(buffer->size())));
+                    return typed_builder->Append(value);
+                });
+            }
+            if (type.id() != arrow::Type::STRING && type.id() != arrow::Type::BINARY) {
+                return TypeMismatch(node, type);
+            }
+            auto* typed_builder = arrow::internal::checked_cast<arrow::BinaryBuilder*>(builder);
+            return DecodeFunc([typed_builder, buffer](::avro::Decoder* decoder) {
+                decoder->decodeBytes(*buffer);
+                return typed_builder->Append(buffer->data(),
+                                             static_cast<int32_t>(buffer->size()));
+            });
+        }
+        case ::avro::AVRO_ARRAY: {
+            if (type.id() != arrow::Type::LIST) {
+                return TypeMismatch(node, type);
+            }
+            auto* list_builder = arrow::internal::checked_cast<arrow::ListBuilder*>(builder);
+            PAIMON_ASSIGN_OR_RAISE(DecodeFunc item_func,
+                                   MakeDecodeFunc(node->leafAt(0), list_builder->value_builder()));
+            return DecodeFunc([list_builder, item_func](::avro::Decoder* decoder) {
+                ARROW_RETURN_NOT_OK(list_builder->Append());
+                for (size_t n = decoder->arrayStart(); n != 0; n = decoder->arrayNext()) {
+                    for (size_t i = 0; i < n; i++) {
+                        ARROW_RETURN_NOT_OK(item_func(decoder));
+                    }
+                }
+                return arrow::Status::OK();
+            });
+        }
+        case ::avro::AVRO_MAP: {
+            if (type.id() != arrow::Type::MAP) {
+                return TypeMismatch(node, type);
+            }
+            auto* map_builder = arrow::internal::checked_cast<arrow::MapBuilder*>(builder);
+            PAIMON_ASSIGN_OR_RAISE(
+                DecodeFunc key_func,
+                MakeNonNullDecodeFunc(node->leafAt(0), map_builder->key_builder()));
+            PAIMON_ASSIGN_OR_RAISE(DecodeFunc value_func,
+                                   MakeDecodeFunc(node->leafAt(1), map_builder->item_builder()));
+            return DecodeFunc([map_builder, key_func, value_func](::avro::Decoder* decoder) {
+                ARROW_RETURN_NOT_OK(map_builder->Append());
+                for (size_t n = decoder->mapStart(); n != 0; n = decoder->mapNext()) {
+                    for (size_t i = 0; i < n; i++) {
+                        ARROW_RETURN_NOT_OK(key_func(decoder));
+                        ARROW_RETURN_NOT_OK(value_func(decoder));
+                    }
+                }
+                return arrow::Status::OK();
+            });
+        }
+        case ::avro::AVRO_RECORD: {
+            if (type.id() != arrow::Type::STRUCT) {
+                return TypeMismatch(node, type);
+            }
+            return MakeRecordDecodeFunc(
+                node, arrow::internal::checked_cast<arrow::StructBuilder*>(builder));
+        }
+        default:
+            return TypeMismatch(node, type);
+    }
+}
+
+Result<AvroDirectDecoder::DecodeFunc> AvroDirectDecoder::MakeRecordDecodeFunc(
+    const ::avro::NodePtr& node, arrow::StructBuilder* builder) {
+    const auto& struct_type =
+        arrow::internal::checked_cast<const arrow::StructType&>(*builder->type());
+    std::unordered_map<std::string, int32_t> read_field_indices;
+    for (int32_t i = 0; i < struct_type.num_fields(); i++) {
+        read_field_indices[struct_type.field(i)->name()] = i;
+    }
+    // decode or skip each field in writer order, as avro binary data has no field offsets
+    std::vector<DecodeFunc> field_funcs;
+    field_funcs.reserve(node->leaves());
+    size_t matched_fields = 0;
+    for (size_t i = 0; i < node->leaves(); i++) {
+        auto iter = read_field_indices.find(node->nameAt(i));
+        if (iter == read_field_indices.end()) {
+            PAIMON_ASSIGN_OR_RAISE(SkipFunc skip_func, MakeSkipFunc(node->leafAt(i)));
+            field_funcs.emplace_back([skip_func](::avro::Decoder* decoder) {
+                skip_func(decoder);
+                return arrow::Status::OK();
+            });
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            DecodeFunc field_func,
+            MakeDecodeFunc(node->leafAt(i), builder->field_builder(iter->second)));
+        field_funcs.push_back(std::move(field_func));
+        matched_fields++;
+    }
+    if (matched_fields != read_field_indices.size()) {
+        for (const auto& field : struct_type.fields()) {
+            size_t pos = 0;
+            if (!node->nameIndex(field->name(), pos)) {
+                return Status::Invalid(
+                    fmt::format("Field {} is not found in avro schema.", field->name()));
+            }
+        }
+        return Status::Invalid("duplicate field names in avro read type");
+    }
+    return DecodeFunc([builder, field_funcs](::avro::Decoder* decoder) -> arrow::Status {
+        ARROW_RETURN_NOT_OK(builder->Append());
+        for (const auto& field_func : field_funcs) {
+            ARROW_RETURN_NOT_OK(field_func(decoder));
+        }
+        return arrow::Status::OK();
+    });
+}
+
+Result<AvroDirectDecoder::SkipFunc> AvroDirectDecoder::MakeSkipFunc(
+    const ::avro::NodePtr& avro_node) {
+    ::avro::NodePtr node = ResolveNode(avro_node);
+    switch (node->type()) {
+        case ::avro::AVRO_NULL:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->decodeNull(); });
+        case ::avro::AVRO_BOOL:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->decodeBool(); });
+        case ::avro::AVRO_INT:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->decodeInt(); });
+        case ::avro::AVRO_LONG:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->decodeLong(); });
+        case ::avro::AVRO_FLOAT:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->decodeFloat(); });
+        case ::avro::AVRO_DOUBLE:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->decodeDouble(); });
+        case ::avro::AVRO_STRING:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->skipString(); });
+        case ::avro::AVRO_BYTES:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->skipBytes(); });
+        case ::avro::AVRO_FIXED: {
+            size_t fixed_size = node->fixedSize();
+            return SkipFunc(
+                [fixed_size](::avro::Decoder* decoder) { decoder->skipFixed(fixed_size); });
+        }
+        case ::avro::AVRO_ENUM:
+            return SkipFunc([](::avro::Decoder* decoder) { decoder->decodeEnum(); });
+        case ::avro::AVRO_UNION: {
+            std::vector<SkipFunc> branch_funcs;
+            for (size_t i = 0; i < node->leaves(); i++) {
+                PAIMON_ASSIGN_OR_RAISE(SkipFunc branch_func, MakeSkipFunc(node->leafAt(i)));
+                branch_funcs.push_back(std::move(branch_func));
+            }
+            return SkipFunc([branch_funcs](::avro::Decoder* decoder) {
+                size_t branch = decoder->decodeUnionIndex();
+                if (branch >= branch_funcs.size()) {
+                    throw ::avro::Exception(
+                        fmt::format("invalid avro union index {}", branch));
+                }
+                branch_funcs[branch](decoder);
+            });
+        }
+        case ::avro::AVRO_RECORD: {
+            std::vector<SkipFunc> field_funcs;
+            for (size_t i = 0; i < node->leaves(); i++) {
+                PAIMON_ASSIGN_OR_RAISE(SkipFunc field_func, MakeSkipFunc(node->leafAt(i)));
+                field_funcs.push_back(std::move(field_func));
+            }
+            return SkipFunc([field_funcs](::avro::Decoder* decoder) {
+                for (const auto& field_func : field_funcs) {
+                    field_func(decoder);
+                }
+            });
+        }
+        case ::avro::AVRO_ARRAY: {
+            PAIMON_ASSIGN_OR_RAISE(SkipFunc item_func, MakeSkipFunc(node->leafAt(0)));
+            // blocks written with byte size are skipped at once, skipArray() returns the item
+            // count of the first block without byte size
+            return SkipFunc([item_func](::avro::Decoder* decoder) {
+                for (size_t n = decoder->skipArray(); n != 0; n = decoder->arrayNext()) {
+                    for (size_t i = 0; i < n; i++) {
+                        item_func(decoder);
+                    }
+                }
+            });
+        }
+        case ::avro::AVRO_MAP: {
+            PAIMON_ASSIGN_OR_RAISE(SkipFunc value_func, MakeSkipFunc(node->leafAt(1)));
+            return SkipFunc([value_func](::avro::Decoder* decoder) {
+                for (size_t n = decoder->skipMap(); n != 0; n = decoder->mapNext()) {
+                    for (size_t i = 0; i < n; i++) {
+                        decoder->skipString();
+                        value_func(decoder);
+                    }
+                }
+            });
+        }
+        default:
+            return Status::NotImplemented(
+                fmt::format("not support skip avro type {}", ::avro::toString(node->type())));
+    }
+}
+
+}  // namespace paimon::avro
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "arrow/api.h"
+#include "avro/Decoder.hh"
+#include "avro/Node.hh"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class ArrayBuilder;
+class DataType;
+class MemoryPool;
+class StructBuilder;
+}  // namespace arrow
+
+namespace paimon::avro {
+
+// AvroDirectDecoder decodes avro binary records straight into arrow builders, without
+// materializing a GenericDatum per record. The avro writer schema is resolved against the arrow
+// read type once when the decoder is created: record fields absent in the read type are skipped
+// at byte level, and fields are matched by name so the read type may project and reorder them.
+// Builders are created once and reused across batches.
+class AvroDirectDecoder {
+ public:
+    static Result<std::unique_ptr<AvroDirectDecoder>> Create(
+        const ::avro::NodePtr& writer_schema, const std::shared_ptr<arrow::DataType>& read_type,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    // Decode one record from `decoder` and append it to the builders. Avro errors are thrown as
+    // ::avro::Exception.
+    Status Decode(::avro::Decoder* decoder) {
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(decode_func_(decoder));
+        return Status::OK();
+    }
+
+    Status Reserve(int64_t num_records);
+
+    // Finish all decoded records as a struct array of read type, builders are reset and can be
+    // used for the next batch.
+    Result<std::shared_ptr<arrow::Array>> Finish();
+
+    const std::shared_ptr<arrow::DataType>& ReadType() const {
+        return read_type_;
+    }
+
+ private:
+    using DecodeFunc = std::function<arrow::Status(::avro::Decoder* decoder)>;
+    using SkipFunc = std::function<void(::avro::Decoder* decoder)>;
+
+    AvroDirectDecoder(const std::shared_ptr<arrow::DataType>& read_type,
+                      std::unique_ptr<arrow::MemoryPool>&& arrow_pool,
+                      std::unique_ptr<arrow::StructBuilder>&& struct_builder,
+                      DecodeFunc&& decode_func);
+
+    static Result<DecodeFunc> MakeDecodeFunc(const ::avro::NodePtr& node,
+                                             arrow::ArrayBuilder* builder);
+    static Result<DecodeFunc> MakeNonNullDecodeFunc(const ::avro::NodePtr& node,
+                                                    arrow::ArrayBuilder* builder);
+    static Result<DecodeFunc> MakeRecordDecodeFunc(const ::avro::NodePtr& node,
+                                                   arrow::StructBuilder* builder);
+    static Result<SkipFunc> MakeSkipFunc(const ::avro::NodePtr& node);
+
+    static ::avro::NodePtr ResolveNode(const ::avro::NodePtr& node);
+    static Status TypeMismatch(const ::avro::NodePtr& node, const arrow::DataType& type);
+
+ private:
+    std::shared_ptr<arrow::DataType> read_type_;
+    std::unique_ptr<arrow::MemoryPool> arrow_pool_;
+    std::unique_ptr<arrow::StructBuilder> struct_builder_;
+    DecodeFunc decode_func_;
+};
+
+}  // namespace paimon::avro
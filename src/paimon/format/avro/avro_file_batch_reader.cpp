@@ -21,8 +21,6 @@
 #include <vector>
 
 #include "arrow/c/bridge.h"
-#include "avro/Generic.hh"
-#include "avro/GenericDatum.hh"
 #include "fmt/format.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/format/avro/avro_schema_converter.h"
@@ -30,12 +28,14 @@
 
 namespace paimon::avro {
 
-AvroFileBatchReader::AvroFileBatchReader(
-    std::unique_ptr<::avro::DataFileReader<::avro::GenericDatum>>&& reader,
-    std::unique_ptr<AvroRecordConverter>&& record_converter, int32_t batch_size)
+AvroFileBatchReader::AvroFileBatchReader(std::unique_ptr<::avro::DataFileReaderBase>&& reader,
+                                         std::unique_ptr<AvroDirectDecoder>&& decoder,
+                                         int32_t batch_size,
+                                         const std::shared_ptr<MemoryPool>& pool)
     : reader_(std::move(reader)),
-      record_converter_(std::move(record_converter)),
-      batch_size_(batch_size) {}
+      decoder_(std::move(decoder)),
+      batch_size_(batch_size),
+      pool_(pool) {}
 
 AvroFileBatchReader::~AvroFileBatchReader() {
     DoClose();
@@ -49,44 +49,40 @@ void AvroFileBatchReader::DoClose() {
 }
 
 Result<std::unique_ptr<AvroFileBatchReader>> AvroFileBatchReader::Create(
-    std::unique_ptr<::avro::DataFileReader<::avro::GenericDatum>>&& reader, int32_t batch_size,
+    std::unique_ptr<::avro::DataFileReaderBase>&& reader, int32_t batch_size,
     const std::shared_ptr<MemoryPool>& pool) {
     if (batch_size <= 0) {
         return Status::Invalid(
             fmt::format("invalid batch size {}, must be larger than 0", batch_size));
     }
-    const auto& avro_read_schema = reader->readerSchema();
+    // read all fields of the file until SetReadSchema() is called
+    const auto& avro_file_schema = reader->dataSchema();
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<::arrow::DataType> arrow_data_type,
-                           AvroSchemaConverter::AvroSchemaToArrowDataType(avro_read_schema));
-    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<AvroRecordConverter> record_converter,
-                           AvroRecordConverter::Create(arrow_data_type, pool));
+                           AvroSchemaConverter::AvroSchemaToArrowDataType(avro_file_schema));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<AvroDirectDecoder> decoder,
+        AvroDirectDecoder::Create(avro_file_schema.root(), arrow_data_type, pool));
     return std::unique_ptr<AvroFileBatchReader>(
-        new AvroFileBatchReader(std::move(reader), std::move(record_converter), batch_size));
+        new AvroFileBatchReader(std::move(reader), std::move(decoder), batch_size, pool));
 }
 
 Result<BatchReader::ReadBatch> AvroFileBatchReader::NextBatch() {
-    std::vector<::avro::GenericDatum> datums;
-    datums.reserve(batch_size_);
     try {
-        for (int32_t i = 0; i < batch_size_; i++) {
-            ::avro::GenericDatum datum(reader_->readerSchema());
-            if (!reader_->read(datum)) {
-                // reach eof
-                break;
-            }
-            if (datum.type() != ::avro::AVRO_RECORD) {
-                return Status::Invalid(
-                    fmt::format("avro reader next batch failed. invalid datum type: {}",
-                                ::avro::toString(datum.type())));
-            }
-            datums.emplace_back(datum);
+        PAIMON_RETURN_NOT_OK(decoder_->Reserve(batch_size_));
+        int32_t num_rows = 0;
+        while (num_rows < batch_size_ && reader_->hasMore()) {
+            reader_->decr();
+            PAIMON_RETURN_NOT_OK(decoder_->Decode(&reader_->decoder()));
+            num_rows++;
         }
-        if (datums.empty()) {
+        if (num_rows == 0) {
             return BatchReader::MakeEofBatch();
         }
-        // TODO(jinli.zjw) when support SetReadSchema(), may need convert file timestamp (milli) to
-        // target read type timestamp(second)
-        return record_converter_->NextBatch(datums);
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> array, decoder_->Finish());
+        auto c_array = std::make_unique<::ArrowArray>();
+        auto c_schema = std::make_unique<::ArrowSchema>();
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, c_array.get(), c_schema.get()));
+        return std::make_pair(std::move(c_array), std::move(c_schema));
     } catch (const ::avro::Exception& e) {
         return Status::Invalid(fmt::format("avro reader next batch failed. {}", e.what()));
     } catch (const std::exception& e) {
@@ -99,8 +95,25 @@ Result<BatchReader::ReadBatch> AvroFileBatchReader::NextBatch() {
 Status AvroFileBatchReader::SetReadSchema(::ArrowSchema* read_schema,
                                           const std::shared_ptr<Predicate>& predicate,
                                           const std::optional<RoaringBitmap32>& selection_bitmap) {
-    assert(false);
-    return Status::NotImplemented("avro reader not support set read schema");
+    // avro has no statistics or page index, predicate and selection bitmap are applied by the
+    // caller as SupportPreciseBitmapSelection() is false
+    if (!read_schema) {
+        return Status::Invalid("SetReadSchema failed: read schema cannot be nullptr");
+    }
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_read_schema,
+                                      arrow::ImportSchema(read_schema));
+    auto read_type = arrow::struct_(arrow_read_schema->fields());
+    try {
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<AvroDirectDecoder> decoder,
+            AvroDirectDecoder::Create(reader_->dataSchema().root(), read_type, pool_));
+        decoder_ = std::move(decoder);
+    } catch (const ::avro::Exception& e) {
+        return Status::Invalid(fmt::format("avro reader set read schema failed. {}", e.what()));
+    } catch (const std::exception& e) {
+        return Status::Invalid(fmt::format("avro reader set read schema failed. {}", e.what()));
+    }
+    return Status::OK();
 }
 
 Result<std::unique_ptr<::ArrowSchema>> AvroFileBatchReader::GetFileSchema() const {
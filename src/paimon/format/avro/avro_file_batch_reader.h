@@ -21,7 +21,7 @@
 #include <vector>
 
 #include "avro/DataFile.hh"
-#include "paimon/format/avro/avro_record_converter.h"
+#include "paimon/format/avro/avro_direct_decoder.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/reader/file_batch_reader.h"
 #include "paimon/result.h"
@@ -31,7 +31,7 @@ namespace paimon::avro {
 class AvroFileBatchReader : public FileBatchReader {
  public:
     static Result<std::unique_ptr<AvroFileBatchReader>> Create(
-        std::unique_ptr<::avro::DataFileReader<::avro::GenericDatum>>&& reader, int32_t batch_size,
+        std::unique_ptr<::avro::DataFileReaderBase>&& reader, int32_t batch_size,
         const std::shared_ptr<MemoryPool>& pool);
 
     ~AvroFileBatchReader() override;
@@ -69,13 +69,14 @@ class AvroFileBatchReader : public FileBatchReader {
  private:
     void DoClose();
 
-    AvroFileBatchReader(std::unique_ptr<::avro::DataFileReader<::avro::GenericDatum>>&& reader,
-                        std::unique_ptr<AvroRecordConverter>&& record_converter,
-                        int32_t batch_size);
+    AvroFileBatchReader(std::unique_ptr<::avro::DataFileReaderBase>&& reader,
+                        std::unique_ptr<AvroDirectDecoder>&& decoder, int32_t batch_size,
+                        const std::shared_ptr<MemoryPool>& pool);
 
-    std::unique_ptr<::avro::DataFileReader<::avro::GenericDatum>> reader_;
-    std::unique_ptr<AvroRecordConverter> record_converter_;
+    std::unique_ptr<::avro::DataFileReaderBase> reader_;
+    std::unique_ptr<AvroDirectDecoder> decoder_;
     const int32_t batch_size_;
+    std::shared_ptr<MemoryPool> pool_;
     bool close_ = false;
 };
 
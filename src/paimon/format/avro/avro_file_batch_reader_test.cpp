@@ -17,6 +17,7 @@
 #include "paimon/format/avro/avro_file_batch_reader.h"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -200,6 +201,63 @@ TEST_F(AvroFileBatchReaderTest, TestReadAllTypes) {
     ASSERT_TRUE(expected_array->Equals(result_array)) << result_array->ToString();
 }
 
+TEST_F(AvroFileBatchReaderTest, TestSetReadSchema) {
+    std::string path = paimon::test::GetDataDir() + "/avro/data/avro_all_types";
+    ASSERT_OK_AND_ASSIGN(auto reader_builder, file_format_->CreateReaderBuilder(/*batch_size=*/2));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<InputStream> in, fs_->Open(path));
+    ASSERT_OK_AND_ASSIGN(auto batch_reader, reader_builder->Build(in));
+
+    // project and reorder fields, unread fields (including list and struct) are skipped
+    arrow::FieldVector fields = {
+        arrow::field("f16", arrow::decimal128(19, 19)),
+        arrow::field("f7", arrow::utf8()),
+        arrow::field("f1", arrow::int8()),
+        arrow::field("f11", arrow::struct_({arrow::field("f1", arrow::int64())})),
+    };
+    auto read_schema = arrow::schema(fields);
+    ::ArrowSchema c_read_schema;
+    ASSERT_TRUE(arrow::ExportSchema(*read_schema, &c_read_schema).ok());
+    ASSERT_OK(batch_reader->SetReadSchema(&c_read_schema, /*predicate=*/nullptr,
+                                          /*selection_bitmap=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(auto result_array,
+                         ::paimon::test::ReadResultCollector::CollectResult(batch_reader.get()));
+
+    std::shared_ptr<arrow::ChunkedArray> expected_array;
+    auto array_status =
+        arrow::ipc::internal::json::ChunkedArrayFromJSON(arrow::struct_(fields), {R"([
+        ["0.1234567890987654321", "aa", 127, [null]],
+        [null, null, -128, [2]],
+        [null, null, null, null]
+    ])"},
+                                                         &expected_array);
+    ASSERT_TRUE(array_status.ok()) << array_status.ToString();
+    ASSERT_TRUE(result_array->Equals(expected_array)) << result_array->ToString();
+    ASSERT_TRUE(expected_array->Equals(result_array));
+}
+
+TEST_F(AvroFileBatchReaderTest, TestSetReadSchemaWithInvalidField) {
+    std::string path = paimon::test::GetDataDir() + "/avro/data/avro_all_types";
+    ASSERT_OK_AND_ASSIGN(auto reader_builder, file_format_->CreateReaderBuilder(/*batch_size=*/2));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<InputStream> in, fs_->Open(path));
+    ASSERT_OK_AND_ASSIGN(auto batch_reader, reader_builder->Build(in));
+    {
+        auto read_schema = arrow::schema({arrow::field("non_exist", arrow::int32())});
+        ::ArrowSchema c_read_schema;
+        ASSERT_TRUE(arrow::ExportSchema(*read_schema, &c_read_schema).ok());
+        ASSERT_NOK_WITH_MSG(batch_reader->SetReadSchema(&c_read_schema, /*predicate=*/nullptr,
+                                                        /*selection_bitmap=*/std::nullopt),
+                            "Field non_exist is not found in avro schema");
+    }
+    {
+        auto read_schema = arrow::schema({arrow::field("f7", arrow::int32())});
+        ::ArrowSchema c_read_schema;
+        ASSERT_TRUE(arrow::ExportSchema(*read_schema, &c_read_schema).ok());
+        ASSERT_NOK_WITH_MSG(batch_reader->SetReadSchema(&c_read_schema, /*predicate=*/nullptr,
+                                                        /*selection_bitmap=*/std::nullopt),
+                            "cannot read avro type string");
+    }
+}
+
 TEST_P(AvroFileBatchReaderTest, TestReadTimestampTypes) {
     auto enable_tz = GetParam();
     std::string timezone_str = enable_tz ? "Asia/Tokyo" : "Asia/Shanghai";
@@ -231,11 +289,19 @@ TEST_P(AvroFileBatchReaderTest, TestReadTimestampTypes) {
     auto expected_file_schema = arrow::schema(fields);
     ASSERT_TRUE(result_file_schema->Equals(expected_file_schema)) << result_file_schema->ToString();
 
+    // avro has no second precision, ts_sec/ts_tz_sec are stored as milli and converted back to
+    // second by read schema
+    fields[0] = arrow::field("ts_sec", arrow::timestamp(arrow::TimeUnit::SECOND));
+    fields[3] = arrow::field("ts_tz_sec", arrow::timestamp(arrow::TimeUnit::SECOND, timezone));
+    auto read_schema = arrow::schema(fields);
+    ::ArrowSchema c_read_schema;
+    ASSERT_TRUE(arrow::ExportSchema(*read_schema, &c_read_schema).ok());
+    ASSERT_OK(batch_reader->SetReadSchema(&c_read_schema, /*predicate=*/nullptr,
+                                          /*selection_bitmap=*/std::nullopt));
+
     // check array
     ASSERT_OK_AND_ASSIGN(auto result_array,
                          ::paimon::test::ReadResultCollector::CollectResult(batch_reader.get()));
-    // TODO(jinli.zjw) after support SetReadSchema, need change ts_sec/ts_tz_sec type from milli
-    // to second
     std::shared_ptr<arrow::ChunkedArray> expected_array;
     auto array_status =
         arrow::ipc::internal::json::ChunkedArrayFromJSON(arrow::struct_(fields), {R"([
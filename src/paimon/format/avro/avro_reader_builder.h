@@ -45,8 +45,10 @@ class AvroReaderBuilder : public ReaderBuilder {
         try {
             PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<::avro::InputStream> in,
                                    AvroInputStreamImpl::Create(path, BUFFER_SIZE, pool_));
-            auto data_file_reader =
-                std::make_unique<::avro::DataFileReader<::avro::GenericDatum>>(std::move(in));
+            // records are decoded by AvroDirectDecoder from the raw block decoder, there is no
+            // GenericDatum in between
+            auto data_file_reader = std::make_unique<::avro::DataFileReaderBase>(std::move(in));
+            data_file_reader->init();
             return AvroFileBatchReader::Create(std::move(data_file_reader), batch_size_, pool_);
         } catch (const ::avro::Exception& e) {
             return Status::Invalid(fmt::format("build avro reader failed. {}", e.what()));
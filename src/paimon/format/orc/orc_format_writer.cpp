@@ -184,6 +184,11 @@ Result<bool> OrcFormatWriter::ReachTargetSize(bool suggested_check, int64_t targ
     return false;
 }
 
+int64_t OrcFormatWriter::GetBufferedSize() const {
+    // the pool is owned by this writer, so what it holds are the row batch and stripe buffers
+    return orc_memory_pool_ ? orc_memory_pool_->AllocatedBytes() : 0;
+}
+
 Result<uint64_t> OrcFormatWriter::GetEstimateLength() const {
     try {
         return output_stream_->getLength() + writer_options_.getStripeSize();
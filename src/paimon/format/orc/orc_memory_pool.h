@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 #include "orc/MemoryPool.hh"
@@ -30,6 +32,7 @@ class OrcMemoryPool : public ::orc::MemoryPool {
     char* malloc(uint64_t size) override {
         char* ret = reinterpret_cast<char*>(pool_->Malloc(size));
         alloc_map_.Insert(reinterpret_cast<size_t>(ret), size);
+        allocated_bytes_ += static_cast<int64_t>(size);
         return ret;
     }
     void free(char* p) override {
@@ -37,13 +40,20 @@ class OrcMemoryPool : public ::orc::MemoryPool {
         if (size) {
             pool_->Free(p, size.value());
             alloc_map_.Erase(reinterpret_cast<size_t>(p));
+            allocated_bytes_ -= static_cast<int64_t>(size.value());
         } else {
             assert(false);
             pool_->Free(p, /*size=*/0);
         }
     }
 
+    /// Bytes allocated through this pool and not freed yet.
+    int64_t AllocatedBytes() const {
+        return allocated_bytes_.load();
+    }
+
  private:
+    std::atomic<int64_t> allocated_bytes_ = 0;
     ConcurrentHashMap<size_t, uint64_t> alloc_map_;
     std::shared_ptr<paimon::MemoryPool> pool_;
 };
@@ -0,0 +1,392 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/format/parquet/page_index_filter.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+
+#include "fmt/format.h"
+#include "paimon/defs.h"
+#include "paimon/predicate/compound_predicate.h"
+#include "paimon/predicate/leaf_predicate.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate.h"
+#include "parquet/file_reader.h"
+#include "parquet/page_index.h"
+#include "parquet/types.h"
+
+namespace paimon::parquet {
+
+namespace {
+template <typename ParquetType, typename Converter>
+bool DecodeTypedMinMaxValues(const ::parquet::ColumnIndex& column_index, Converter&& converter,
+                             std::vector<Literal>* min_values, std::vector<Literal>* max_values,
+                             const FieldType& field_type) {
+    const auto* typed_index =
+        dynamic_cast<const ::parquet::TypedColumnIndex<ParquetType>*>(&column_index);
+    if (typed_index == nullptr) {
+        return false;
+    }
+    const auto& null_pages = typed_index->null_pages();
+    const auto& mins = typed_index->min_values();
+    const auto& maxs = typed_index->max_values();
+    if (mins.size() != null_pages.size() || maxs.size() != null_pages.size()) {
+        return false;
+    }
+    min_values->reserve(null_pages.size());
+    max_values->reserve(null_pages.size());
+    for (size_t i = 0; i < null_pages.size(); i++) {
+        if (null_pages[i]) {
+            min_values->emplace_back(field_type);
+            max_values->emplace_back(field_type);
+        } else {
+            min_values->push_back(converter(mins[i]));
+            max_values->push_back(converter(maxs[i]));
+        }
+    }
+    return true;
+}
+}  // namespace
+
+PageIndexFilter::PageIndexFilter(
+    const std::shared_ptr<::parquet::PageIndexReader>& page_index_reader,
+    const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+    const std::shared_ptr<Predicate>& predicate)
+    : page_index_reader_(page_index_reader),
+      leaf_column_indices_(leaf_column_indices),
+      predicate_(predicate) {}
+
+Result<std::unique_ptr<PageIndexFilter>> PageIndexFilter::Create(
+    ::parquet::ParquetFileReader* file_reader,
+    const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+    const std::shared_ptr<Predicate>& predicate, const std::vector<int32_t>& row_groups) {
+    if (!file_reader || !predicate) {
+        return Status::Invalid("create page index filter failed: file reader or predicate is null");
+    }
+    std::set<int32_t> columns;
+    CollectLeafColumns(predicate, leaf_column_indices, &columns);
+    if (columns.empty() || row_groups.empty()) {
+        return std::unique_ptr<PageIndexFilter>();
+    }
+    try {
+        std::shared_ptr<::parquet::PageIndexReader> page_index_reader =
+            file_reader->GetPageIndexReader();
+        if (!page_index_reader) {
+            return std::unique_ptr<PageIndexFilter>();
+        }
+        // page indexes of all row groups are stored together, hint the reader to load them in a
+        // few coalesced reads instead of one read per column chunk
+        ::parquet::PageIndexSelection selection;
+        selection.column_index = true;
+        selection.offset_index = true;
+        page_index_reader->WillNeed(row_groups,
+                                    std::vector<int32_t>(columns.begin(), columns.end()),
+                                    selection);
+        return std::unique_ptr<PageIndexFilter>(
+            new PageIndexFilter(page_index_reader, leaf_column_indices, predicate));
+    } catch (const std::exception& e) {
+        return Status::Invalid(
+            fmt::format("create page index filter failed, with {} error", e.what()));
+    }
+}
+
+void PageIndexFilter::CollectLeafColumns(
+    const std::shared_ptr<Predicate>& predicate,
+    const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+    std::set<int32_t>* columns) {
+    if (auto leaf_predicate = std::dynamic_pointer_cast<LeafPredicate>(predicate)) {
+        auto iter = leaf_column_indices.find(leaf_predicate->FieldName());
+        if (iter != leaf_column_indices.end()) {
+            columns->insert(iter->second);
+        }
+        return;
+    }
+    if (auto compound_predicate = std::dynamic_pointer_cast<CompoundPredicate>(predicate)) {
+        for (const auto& child : compound_predicate->Children()) {
+            CollectLeafColumns(child, leaf_column_indices, columns);
+        }
+    }
+}
+
+Result<PageIndexFilter::RowRanges> PageIndexFilter::CalculateRowRanges(
+    int32_t row_group, const std::pair<uint64_t, uint64_t>& row_group_range) {
+    try {
+        return CalculateRowRanges(predicate_, row_group, row_group_range);
+    } catch (const std::exception& e) {
+        return Status::Invalid(fmt::format(
+            "calculate row ranges of row group {} by page index failed, with {} error", row_group,
+            e.what()));
+    }
+}
+
+Result<PageIndexFilter::RowRanges> PageIndexFilter::CalculateRowRanges(
+    const std::shared_ptr<Predicate>& predicate, int32_t row_group,
+    const std::pair<uint64_t, uint64_t>& row_group_range) {
+    if (auto leaf_predicate = std::dynamic_pointer_cast<LeafPredicate>(predicate)) {
+        return CalculateLeafRowRanges(leaf_predicate, row_group, row_group_range);
+    }
+    auto compound_predicate = std::dynamic_pointer_cast<CompoundPredicate>(predicate);
+    if (!compound_predicate) {
+        return Status::Invalid("invalid predicate, must be leaf or compound");
+    }
+    auto function_type = compound_predicate->GetFunction().GetType();
+    if (function_type != Function::Type::AND && function_type != Function::Type::OR) {
+        return Status::Invalid(
+            fmt::format("invalid predicate type {}", static_cast<int32_t>(function_type)));
+    }
+    const auto& children = compound_predicate->Children();
+    RowRanges result;
+    for (size_t i = 0; i < children.size(); i++) {
+        PAIMON_ASSIGN_OR_RAISE(RowRanges child_ranges,
+                               CalculateRowRanges(children[i], row_group, row_group_range));
+        if (i == 0) {
+            result = std::move(child_ranges);
+        } else if (function_type == Function::Type::AND) {
+            result = Intersect(result, child_ranges);
+        } else {
+            result = Union(result, child_ranges);
+        }
+        if (function_type == Function::Type::AND && result.empty()) {
+            break;
+        }
+    }
+    return result;
+}
+
+Result<PageIndexFilter::RowRanges> PageIndexFilter::CalculateLeafRowRanges(
+    const std::shared_ptr<LeafPredicate>& predicate, int32_t row_group,
+    const std::pair<uint64_t, uint64_t>& row_group_range) {
+    const RowRanges all_rows = {row_group_range};
+    auto iter = leaf_column_indices_.find(predicate->FieldName());
+    if (iter == leaf_column_indices_.end()) {
+        return all_rows;
+    }
+    std::shared_ptr<::parquet::RowGroupPageIndexReader> row_group_reader =
+        page_index_reader_->RowGroup(row_group);
+    if (!row_group_reader) {
+        return all_rows;
+    }
+    std::shared_ptr<::parquet::ColumnIndex> column_index =
+        row_group_reader->GetColumnIndex(iter->second);
+    std::shared_ptr<::parquet::OffsetIndex> offset_index =
+        row_group_reader->GetOffsetIndex(iter->second);
+    if (!column_index || !offset_index) {
+        return all_rows;
+    }
+    const auto& page_locations = offset_index->page_locations();
+    const auto& null_pages = column_index->null_pages();
+    if (page_locations.size() != null_pages.size()) {
+        return all_rows;
+    }
+    std::vector<Literal> min_values;
+    std::vector<Literal> max_values;
+    PAIMON_ASSIGN_OR_RAISE(bool decoded, DecodeMinMaxValues(*column_index,
+                                                            predicate->GetFieldType(),
+                                                            &min_values, &max_values));
+    if (!decoded) {
+        return all_rows;
+    }
+    const auto& [row_group_start, row_group_end] = row_group_range;
+    uint64_t row_group_rows = row_group_end - row_group_start;
+    RowRanges result;
+    for (size_t i = 0; i < page_locations.size(); i++) {
+        auto page_start = static_cast<uint64_t>(page_locations[i].first_row_index);
+        uint64_t page_end = i + 1 < page_locations.size()
+                                ? static_cast<uint64_t>(page_locations[i + 1].first_row_index)
+                                : row_group_rows;
+        if (page_start >= page_end || page_end > row_group_rows) {
+            return Status::Invalid(
+                fmt::format("invalid page location [{}, {}) in row group {} with {} rows",
+                            page_start, page_end, row_group, row_group_rows));
+        }
+        auto row_count = static_cast<int64_t>(page_end - page_start);
+        std::optional<int64_t> null_count;
+        if (null_pages[i]) {
+            null_count = row_count;
+        } else if (column_index->has_null_counts()) {
+            null_count = column_index->null_counts()[i];
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            bool may_match,
+            TestPage(predicate->GetFunction().GetType(), predicate->Literals(), min_values[i],
+                     max_values[i], null_pages[i], null_count, row_count));
+        if (!may_match) {
+            continue;
+        }
+        if (!result.empty() && result.back().second == row_group_start + page_start) {
+            result.back().second = row_group_start + page_end;
+        } else {
+            result.emplace_back(row_group_start + page_start, row_group_start + page_end);
+        }
+    }
+    return result;
+}
+
+Result<bool> PageIndexFilter::DecodeMinMaxValues(const ::parquet::ColumnIndex& column_index,
+                                                 const FieldType& field_type,
+                                                 std::vector<Literal>* min_values,
+                                                 std::vector<Literal>* max_values) {
+    switch (field_type) {
+        case FieldType::BOOLEAN:
+            return DecodeTypedMinMaxValues<::parquet::BooleanType>(
+                column_index, [](bool value) { return Literal(value); }, min_values, max_values,
+                field_type);
+        case FieldType::TINYINT:
+            return DecodeTypedMinMaxValues<::parquet::Int32Type>(
+                column_index, [](int32_t value) { return Literal(static_cast<int8_t>(value)); },
+                min_values, max_values, field_type);
+        case FieldType::SMALLINT:
+            return DecodeTypedMinMaxValues<::parquet::Int32Type>(
+                column_index, [](int32_t value) { return Literal(static_cast<int16_t>(value)); },
+                min_values, max_values, field_type);
+        case FieldType::INT:
+            return DecodeTypedMinMaxValues<::parquet::Int32Type>(
+                column_index, [](int32_t value) { return Literal(value); }, min_values,
+                max_values, field_type);
+        case FieldType::DATE:
+            return DecodeTypedMinMaxValues<::parquet::Int32Type>(
+                column_index, [](int32_t value) { return Literal(FieldType::DATE, value); },
+                min_values, max_values, field_type);
+        case FieldType::BIGINT:
+            return DecodeTypedMinMaxValues<::parquet::Int64Type>(
+                column_index, [](int64_t value) { return Literal(value); }, min_values,
+                max_values, field_type);
+        case FieldType::FLOAT:
+            return DecodeTypedMinMaxValues<::parquet::FloatType>(
+                column_index, [](float value) { return Literal(value); }, min_values, max_values,
+                field_type);
+        case FieldType::DOUBLE:
+            return DecodeTypedMinMaxValues<::parquet::DoubleType>(
+                column_index, [](double value) { return Literal(value); }, min_values,
+                max_values, field_type);
+        case FieldType::STRING:
+        case FieldType::BINARY:
+            return DecodeTypedMinMaxValues<::parquet::ByteArrayType>(
+                column_index,
+                [field_type](const ::parquet::ByteArray& value) {
+                    return Literal(field_type, reinterpret_cast<const char*>(value.ptr),
+                                   value.len);
+                },
+                min_values, max_values, field_type);
+        default:
+            // timestamp and decimal may be stored in several physical types and units, do not
+            // prune by page index
+            return false;
+    }
+}
+
+Result<bool> PageIndexFilter::TestPage(Function::Type function_type,
+                                       const std::vector<Literal>& literals,
+                                       const Literal& min_value, const Literal& max_value,
+                                       bool null_page, const std::optional<int64_t>& null_count,
+                                       int64_t row_count) {
+    switch (function_type) {
+        case Function::Type::IS_NULL:
+            return null_page || null_count == std::nullopt || null_count.value() > 0;
+        case Function::Type::IS_NOT_NULL:
+            return !null_page && (null_count == std::nullopt || null_count.value() < row_count);
+        default:
+            break;
+    }
+    // the rest functions never match null values
+    if (null_page) {
+        return false;
+    }
+    if (min_value.IsNull() || max_value.IsNull()) {
+        return true;
+    }
+    if (function_type == Function::Type::NOT_IN) {
+        return true;
+    }
+    if (function_type == Function::Type::IN) {
+        for (const auto& literal : literals) {
+            if (literal.IsNull()) {
+                continue;
+            }
+            PAIMON_ASSIGN_OR_RAISE(int32_t min_res, literal.CompareTo(min_value));
+            PAIMON_ASSIGN_OR_RAISE(int32_t max_res, literal.CompareTo(max_value));
+            if (min_res >= 0 && max_res <= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+    if (literals.empty()) {
+        return Status::Invalid(
+            fmt::format("predicate type {} needs literal", static_cast<int32_t>(function_type)));
+    }
+    const Literal& literal = literals[0];
+    if (literal.IsNull()) {
+        return false;
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t min_res, literal.CompareTo(min_value));
+    PAIMON_ASSIGN_OR_RAISE(int32_t max_res, literal.CompareTo(max_value));
+    switch (function_type) {
+        case Function::Type::EQUAL:
+            return min_res >= 0 && max_res <= 0;
+        case Function::Type::NOT_EQUAL:
+            return min_res != 0 || max_res != 0;
+        case Function::Type::LESS_THAN:
+            return min_res > 0;
+        case Function::Type::LESS_OR_EQUAL:
+            return min_res >= 0;
+        case Function::Type::GREATER_THAN:
+            return max_res < 0;
+        case Function::Type::GREATER_OR_EQUAL:
+            return max_res <= 0;
+        default:
+            return true;
+    }
+}
+
+PageIndexFilter::RowRanges PageIndexFilter::Intersect(const RowRanges& left,
+                                                      const RowRanges& right) {
+    RowRanges result;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < left.size() && j < right.size()) {
+        uint64_t start = std::max(left[i].first, right[j].first);
+        uint64_t end = std::min(left[i].second, right[j].second);
+        if (start < end) {
+            result.emplace_back(start, end);
+        }
+        if (left[i].second < right[j].second) {
+            i++;
+        } else {
+            j++;
+        }
+    }
+    return result;
+}
+
+PageIndexFilter::RowRanges PageIndexFilter::Union(const RowRanges& left, const RowRanges& right) {
+    RowRanges merged;
+    merged.reserve(left.size() + right.size());
+    std::merge(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(merged));
+    RowRanges result;
+    for (const auto& range : merged) {
+        if (!result.empty() && range.first <= result.back().second) {
+            result.back().second = std::max(result.back().second, range.second);
+        } else {
+            result.push_back(range);
+        }
+    }
+    return result;
+}
+
+}  // namespace paimon::parquet
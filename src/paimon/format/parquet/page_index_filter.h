@@ -0,0 +1,109 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "paimon/predicate/function.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace parquet {
+class ColumnIndex;
+class PageIndexReader;
+class ParquetFileReader;
+}  // namespace parquet
+
+namespace paimon {
+class LeafPredicate;
+class Literal;
+class Predicate;
+enum class FieldType;
+}  // namespace paimon
+
+namespace paimon::parquet {
+
+// PageIndexFilter evaluates a paimon predicate against the page index of parquet row groups. The
+// column index provides min/max/null statistics of each page, and the offset index provides the
+// first row of each page. The result is the row ranges of pages which may contain matching rows.
+//
+// Only predicates on top-level primitive columns of boolean, integral, floating point, date,
+// string and binary type are evaluated, other predicates are assumed to match all rows.
+class PageIndexFilter {
+ public:
+    // sorted and non-overlapping [start, end) row ranges in file row numbers
+    using RowRanges = std::vector<std::pair<uint64_t, uint64_t>>;
+
+    // @param leaf_column_indices maps top-level primitive field names to parquet leaf columns.
+    // Return nullptr if the predicate does not reference any column with page index.
+    static Result<std::unique_ptr<PageIndexFilter>> Create(
+        ::parquet::ParquetFileReader* file_reader,
+        const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+        const std::shared_ptr<Predicate>& predicate, const std::vector<int32_t>& row_groups);
+
+    // Return the row ranges of `row_group` which may contain rows matching the predicate, the
+    // whole row group range is returned if the row group has no page index.
+    Result<RowRanges> CalculateRowRanges(int32_t row_group,
+                                         const std::pair<uint64_t, uint64_t>& row_group_range);
+
+    static RowRanges Intersect(const RowRanges& left, const RowRanges& right);
+    static RowRanges Union(const RowRanges& left, const RowRanges& right);
+
+ private:
+    PageIndexFilter(const std::shared_ptr<::parquet::PageIndexReader>& page_index_reader,
+                    const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+                    const std::shared_ptr<Predicate>& predicate);
+
+    static void CollectLeafColumns(
+        const std::shared_ptr<Predicate>& predicate,
+        const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+        std::set<int32_t>* columns);
+
+    Result<RowRanges> CalculateRowRanges(const std::shared_ptr<Predicate>& predicate,
+                                         int32_t row_group,
+                                         const std::pair<uint64_t, uint64_t>& row_group_range);
+
+    Result<RowRanges> CalculateLeafRowRanges(
+        const std::shared_ptr<LeafPredicate>& predicate, int32_t row_group,
+        const std::pair<uint64_t, uint64_t>& row_group_range);
+
+    // Decode min/max values of all pages to literals of `field_type`, null page has null literals.
+    // Return false if the physical type of column index is not compatible with `field_type`.
+    static Result<bool> DecodeMinMaxValues(const ::parquet::ColumnIndex& column_index,
+                                           const FieldType& field_type,
+                                           std::vector<Literal>* min_values,
+                                           std::vector<Literal>* max_values);
+
+    static Result<bool> TestPage(Function::Type function_type, const std::vector<Literal>& literals,
+                                 const Literal& min_value, const Literal& max_value,
+                                 bool null_page, const std::optional<int64_t>& null_count,
+                                 int64_t row_count);
+
+ private:
+    std::shared_ptr<::parquet::PageIndexReader> page_index_reader_;
+    std::unordered_map<std::string, int32_t> leaf_column_indices_;
+    std::shared_ptr<Predicate> predicate_;
+};
+
+}  // namespace paimon::parquet
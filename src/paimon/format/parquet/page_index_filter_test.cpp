@@ -0,0 +1,187 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/format/parquet/page_index_filter.h"
+
+#include <string>
+
+#include "arrow/api.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/defs.h"
+#include "paimon/format/parquet/parquet_format_writer.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/testing/utils/testharness.h"
+#include "parquet/file_reader.h"
+#include "parquet/properties.h"
+
+namespace paimon::parquet::test {
+
+class PageIndexFilterTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        dir_ = paimon::test::UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+        file_path_ = PathUtil::JoinPath(dir_->Str(), "test.parquet");
+        // f0: [0, 100), f1: null for the first 10 rows, "s{f0:03d}" for the rest.
+        // each page holds 10 rows
+        arrow::FieldVector fields = {arrow::field("f0", arrow::int32()),
+                                     arrow::field("f1", arrow::utf8())};
+        auto arrow_type = arrow::struct_(fields);
+        arrow::StructBuilder struct_builder(
+            arrow_type, arrow::default_memory_pool(),
+            {std::make_shared<arrow::Int32Builder>(), std::make_shared<arrow::StringBuilder>()});
+        auto int_builder = static_cast<arrow::Int32Builder*>(struct_builder.field_builder(0));
+        auto string_builder = static_cast<arrow::StringBuilder*>(struct_builder.field_builder(1));
+        for (int32_t i = 0; i < 100; ++i) {
+            ASSERT_TRUE(struct_builder.Append().ok());
+            ASSERT_TRUE(int_builder->Append(i).ok());
+            if (i < 10) {
+                ASSERT_TRUE(string_builder->AppendNull().ok());
+            } else {
+                ASSERT_TRUE(string_builder->Append(fmt::format("s{:03d}", i)).ok());
+            }
+        }
+        std::shared_ptr<arrow::Array> src_array;
+        ASSERT_TRUE(struct_builder.Finish(&src_array).ok());
+
+        auto fs = std::make_shared<LocalFileSystem>();
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<OutputStream> out,
+                             fs->Create(file_path_, /*overwrite=*/true));
+        ::parquet::WriterProperties::Builder builder;
+        builder.write_batch_size(10);
+        builder.data_pagesize(1);
+        builder.disable_dictionary();
+        builder.enable_write_page_index();
+        ASSERT_OK_AND_ASSIGN(
+            auto format_writer,
+            ParquetFormatWriter::Create(out, arrow::schema(fields), builder.build(),
+                                        GetArrowPool(GetDefaultPool())));
+        auto arrow_array = std::make_unique<ArrowArray>();
+        ASSERT_TRUE(arrow::ExportArray(*src_array, arrow_array.get()).ok());
+        ASSERT_OK(format_writer->AddBatch(arrow_array.get()));
+        ASSERT_OK(format_writer->Flush());
+        ASSERT_OK(format_writer->Finish());
+        ASSERT_OK(out->Flush());
+        ASSERT_OK(out->Close());
+        file_reader_ = ::parquet::ParquetFileReader::OpenFile(file_path_, /*memory_map=*/false);
+    }
+
+    PageIndexFilter::RowRanges CalculateRowRanges(
+        const std::shared_ptr<Predicate>& predicate) const {
+        EXPECT_OK_AND_ASSIGN(std::unique_ptr<PageIndexFilter> filter,
+                             PageIndexFilter::Create(file_reader_.get(), leaf_column_indices_,
+                                                     predicate, /*row_groups=*/{0}));
+        EXPECT_TRUE(filter);
+        EXPECT_OK_AND_ASSIGN(PageIndexFilter::RowRanges row_ranges,
+                             filter->CalculateRowRanges(/*row_group=*/0, {0, 100}));
+        return row_ranges;
+    }
+
+ private:
+    std::unique_ptr<paimon::test::UniqueTestDirectory> dir_;
+    std::string file_path_;
+    std::unique_ptr<::parquet::ParquetFileReader> file_reader_;
+    std::unordered_map<std::string, int32_t> leaf_column_indices_ = {{"f0", 0}, {"f1", 1}};
+};
+
+TEST_F(PageIndexFilterTest, TestLeafPredicate) {
+    using RowRanges = PageIndexFilter::RowRanges;
+    ASSERT_EQ(RowRanges({{20, 30}}),
+              CalculateRowRanges(PredicateBuilder::Equal(0, "f0", FieldType::INT, Literal(25))));
+    ASSERT_EQ(RowRanges({{0, 100}}), CalculateRowRanges(PredicateBuilder::NotEqual(
+                                         0, "f0", FieldType::INT, Literal(25))));
+    ASSERT_EQ(RowRanges({{0, 20}}), CalculateRowRanges(PredicateBuilder::LessThan(
+                                        0, "f0", FieldType::INT, Literal(15))));
+    ASSERT_EQ(RowRanges({{0, 10}}), CalculateRowRanges(PredicateBuilder::LessOrEqual(
+                                        0, "f0", FieldType::INT, Literal(9))));
+    ASSERT_EQ(RowRanges({{90, 100}}), CalculateRowRanges(PredicateBuilder::GreaterOrEqual(
+                                          0, "f0", FieldType::INT, Literal(95))));
+    ASSERT_EQ(RowRanges(), CalculateRowRanges(PredicateBuilder::GreaterThan(
+                               0, "f0", FieldType::INT, Literal(99))));
+    ASSERT_EQ(RowRanges({{0, 10}, {50, 60}}),
+              CalculateRowRanges(PredicateBuilder::In(0, "f0", FieldType::INT,
+                                                      {Literal(5), Literal(57), Literal(200)})));
+    ASSERT_EQ(RowRanges({{0, 100}}),
+              CalculateRowRanges(PredicateBuilder::NotIn(0, "f0", FieldType::INT, {Literal(5)})));
+
+    ASSERT_EQ(RowRanges({{0, 10}}),
+              CalculateRowRanges(PredicateBuilder::IsNull(1, "f1", FieldType::STRING)));
+    ASSERT_EQ(RowRanges({{10, 100}}),
+              CalculateRowRanges(PredicateBuilder::IsNotNull(1, "f1", FieldType::STRING)));
+    std::string value = "s055";
+    ASSERT_EQ(RowRanges({{50, 60}}),
+              CalculateRowRanges(PredicateBuilder::Equal(
+                  1, "f1", FieldType::STRING,
+                  Literal(FieldType::STRING, value.data(), value.size()))));
+}
+
+TEST_F(PageIndexFilterTest, TestCompoundPredicate) {
+    using RowRanges = PageIndexFilter::RowRanges;
+    ASSERT_OK_AND_ASSIGN(
+        auto or_predicate,
+        PredicateBuilder::Or({PredicateBuilder::LessThan(0, "f0", FieldType::INT, Literal(5)),
+                              PredicateBuilder::GreaterThan(0, "f0", FieldType::INT, Literal(94)),
+                              PredicateBuilder::Equal(0, "f0", FieldType::INT, Literal(8))}));
+    ASSERT_EQ(RowRanges({{0, 10}, {90, 100}}), CalculateRowRanges(or_predicate));
+
+    ASSERT_OK_AND_ASSIGN(
+        auto and_predicate,
+        PredicateBuilder::And(
+            {PredicateBuilder::GreaterOrEqual(0, "f0", FieldType::INT, Literal(30)),
+             PredicateBuilder::LessThan(0, "f0", FieldType::INT, Literal(50)),
+             PredicateBuilder::IsNotNull(1, "f1", FieldType::STRING)}));
+    ASSERT_EQ(RowRanges({{30, 50}}), CalculateRowRanges(and_predicate));
+
+    // predicate on field without page index matches all rows
+    ASSERT_OK_AND_ASSIGN(
+        auto unknown_field_predicate,
+        PredicateBuilder::And({PredicateBuilder::Equal(0, "f0", FieldType::INT, Literal(30)),
+                               PredicateBuilder::Equal(2, "f2", FieldType::INT, Literal(30))}));
+    ASSERT_EQ(RowRanges({{30, 40}}), CalculateRowRanges(unknown_field_predicate));
+}
+
+TEST_F(PageIndexFilterTest, TestNoPageIndexColumn) {
+    ASSERT_OK_AND_ASSIGN(
+        std::unique_ptr<PageIndexFilter> filter,
+        PageIndexFilter::Create(file_reader_.get(), leaf_column_indices_,
+                                PredicateBuilder::Equal(2, "f2", FieldType::INT, Literal(30)),
+                                /*row_groups=*/{0}));
+    ASSERT_FALSE(filter);
+}
+
+TEST(PageIndexFilterRowRangesTest, TestIntersectAndUnion) {
+    using RowRanges = PageIndexFilter::RowRanges;
+    RowRanges left = {{0, 10}, {20, 30}, {50, 60}};
+    RowRanges right = {{5, 25}, {30, 40}, {55, 70}};
+    ASSERT_EQ(RowRanges({{5, 10}, {20, 25}, {55, 60}}), PageIndexFilter::Intersect(left, right));
+    ASSERT_EQ(RowRanges({{0, 40}, {50, 70}}), PageIndexFilter::Union(left, right));
+    ASSERT_EQ(RowRanges(), PageIndexFilter::Intersect(left, RowRanges()));
+    ASSERT_EQ(left, PageIndexFilter::Union(left, RowRanges()));
+}
+
+}  // namespace paimon::parquet::test
@@ -38,6 +38,7 @@
 #include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/options_utils.h"
+#include "paimon/format/parquet/page_index_filter.h"
 #include "paimon/format/parquet/parquet_field_id_converter.h"
 #include "paimon/format/parquet/parquet_format_defs.h"
 #include "paimon/format/parquet/parquet_timestamp_converter.h"
@@ -120,10 +121,15 @@ Status ParquetFileBatchReader::SetReadSchema(
 
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Schema> file_schema, reader_->GetSchema());
     std::unordered_map<std::string, std::vector<int32_t>> field_index_map;
+    // top-level primitive fields, whose leaf column may have page index
+    std::unordered_map<std::string, int32_t> leaf_column_indices;
     int32_t i = 0;
     for (const auto& field : file_schema->fields()) {
         std::vector<int32_t> v;
         FlattenSchema(field->type(), &i, &v);
+        if (field->type()->num_fields() == 0 && v.size() == 1) {
+            leaf_column_indices[field->name()] = v[0];
+        }
         field_index_map[field->name()] = v;
     }
 
@@ -147,6 +153,17 @@ Status ParquetFileBatchReader::SetReadSchema(
         PAIMON_ASSIGN_OR_RAISE(row_groups,
                                FilterRowGroupsByBitmap(selection_bitmap.value(), row_groups));
     }
+    if (predicate && !row_groups.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(
+            bool enable_page_index,
+            OptionsUtils::GetValueFromMap<bool>(options_, PARQUET_READ_ENABLE_PAGE_INDEX,
+                                                DEFAULT_PARQUET_READ_ENABLE_PAGE_INDEX));
+        if (enable_page_index) {
+            PAIMON_ASSIGN_OR_RAISE(row_groups,
+                                   FilterRowGroupsByPageIndex(predicate, selection_bitmap,
+                                                              leaf_column_indices, row_groups));
+        }
+    }
 
     read_data_type_ = arrow::struct_(read_schema->fields());
     read_row_groups_ = row_groups;
@@ -221,6 +238,54 @@ Result<std::vector<int32_t>> ParquetFileBatchReader::FilterRowGroupsByBitmap(
     return target_row_groups;
 }
 
+Result<std::vector<int32_t>> ParquetFileBatchReader::FilterRowGroupsByPageIndex(
+    const std::shared_ptr<Predicate>& predicate,
+    const std::optional<RoaringBitmap32>& selection_bitmap,
+    const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+    const std::vector<int32_t>& src_row_groups) const {
+    PAIMON_ASSIGN_OR_RAISE(
+        uint32_t predicate_node_count_limit,
+        OptionsUtils::GetValueFromMap<uint32_t>(options_, PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT,
+                                                DEFAULT_PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT));
+    uint32_t node_count = 0;
+    PredicateConverter::CollectNodeCount(predicate, &node_count);
+    if (node_count > predicate_node_count_limit) {
+        return src_row_groups;
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<PageIndexFilter> page_index_filter,
+        PageIndexFilter::Create(reader_->GetFileReader()->parquet_reader(), leaf_column_indices,
+                                predicate, src_row_groups));
+    if (!page_index_filter) {
+        return src_row_groups;
+    }
+    const auto& all_row_group_ranges = reader_->GetAllRowGroupRanges();
+    std::vector<int32_t> target_row_groups;
+    target_row_groups.reserve(src_row_groups.size());
+    for (const auto& row_group_idx : src_row_groups) {
+        if (static_cast<size_t>(row_group_idx) >= all_row_group_ranges.size()) {
+            return Status::Invalid(
+                fmt::format("src row group {} not in row group meta", row_group_idx));
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            PageIndexFilter::RowRanges row_ranges,
+            page_index_filter->CalculateRowRanges(row_group_idx,
+                                                  all_row_group_ranges[row_group_idx]));
+        // a row group is read only if some page may match the predicate and contains selected rows
+        bool selected = false;
+        for (const auto& [start_row_idx, end_row_idx] : row_ranges) {
+            if (!selection_bitmap || selection_bitmap->ContainsAny(start_row_idx, end_row_idx)) {
+                selected = true;
+                break;
+            }
+        }
+        if (selected) {
+            target_row_groups.push_back(row_group_idx);
+        }
+    }
+    return target_row_groups;
+}
+
 Result<BatchReader::ReadBatch> ParquetFileBatchReader::NextBatch() {
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::RecordBatch> batch, reader_->Next());
     if (batch == nullptr) {
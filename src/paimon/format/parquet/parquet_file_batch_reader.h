@@ -23,6 +23,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -161,6 +162,14 @@ class ParquetFileBatchReader : public PrefetchFileBatchReader {
     Result<std::vector<int32_t>> FilterRowGroupsByBitmap(
         const RoaringBitmap32& bitmap, const std::vector<int32_t>& src_row_groups) const;
 
+    // filter row groups by page index: a row group is skipped if none of its pages may match the
+    // predicate, or the pages which may match contain no row in selection bitmap.
+    Result<std::vector<int32_t>> FilterRowGroupsByPageIndex(
+        const std::shared_ptr<Predicate>& predicate,
+        const std::optional<RoaringBitmap32>& selection_bitmap,
+        const std::unordered_map<std::string, int32_t>& leaf_column_indices,
+        const std::vector<int32_t>& src_row_groups) const;
+
  private:
     std::map<std::string, std::string> options_;
     // hold the lifecycle of arrow memory pool.
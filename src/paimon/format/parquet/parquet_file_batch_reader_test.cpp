@@ -102,12 +102,16 @@ class ParquetFileBatchReaderTest : public ::testing::Test,
 
     void WriteArray(const std::string& file_path, const std::shared_ptr<arrow::Array>& src_array,
                     const std::shared_ptr<arrow::Schema>& arrow_schema, int64_t write_batch_size,
-                    bool enable_dictionary, int64_t max_row_group_length) const {
+                    bool enable_dictionary, int64_t max_row_group_length,
+                    int64_t data_page_size = ::parquet::kDefaultDataPageSize,
+                    bool enable_page_index = false) const {
         ASSERT_OK_AND_ASSIGN(std::shared_ptr<OutputStream> out,
                              fs_->Create(file_path, /*overwrite=*/true));
         ::parquet::WriterProperties::Builder builder;
         builder.write_batch_size(write_batch_size);
         builder.max_row_group_length(max_row_group_length);
+        builder.data_pagesize(data_page_size);
+        enable_page_index ? builder.enable_write_page_index() : builder.disable_write_page_index();
         enable_dictionary ? builder.enable_dictionary() : builder.disable_dictionary();
         auto writer_properties = builder.build();
         ASSERT_OK_AND_ASSIGN(auto format_writer, ParquetFormatWriter::Create(
@@ -513,6 +517,64 @@ TEST_F(ParquetFileBatchReaderTest, TestPredicateAndBitmapPushDown) {
     }
 }
 
+TEST_F(ParquetFileBatchReaderTest, TestPageIndexPushDown) {
+    arrow::FieldVector fields = {arrow::field("f0", arrow::int32())};
+    auto arrow_type = arrow::struct_(fields);
+    arrow::StructBuilder struct_builder(arrow_type, arrow::default_memory_pool(),
+                                        {std::make_shared<arrow::Int32Builder>()});
+    auto int_builder = static_cast<arrow::Int32Builder*>(struct_builder.field_builder(0));
+    int32_t length = 1024;
+    for (int32_t i = 0; i < length; ++i) {
+        ASSERT_TRUE(struct_builder.Append().ok());
+        // the first 64 rows are small values, the rest are large values
+        ASSERT_TRUE(int_builder->Append(i < 64 ? i : i + 10000).ok());
+    }
+    // data file:
+    // rowGroup0: [0, 512), rowGroup1: [512, 1024), each page holds 64 rows
+    std::shared_ptr<arrow::Array> src_array;
+    ASSERT_TRUE(struct_builder.Finish(&src_array).ok());
+    auto arrow_schema = arrow::schema(fields);
+    WriteArray(file_path_, src_array, arrow_schema, /*write_batch_size=*/64,
+               /*enable_dictionary=*/false, /*max_row_group_length=*/512, /*data_page_size=*/1,
+               /*enable_page_index=*/true);
+
+    auto read_with_options = [&](const std::shared_ptr<Predicate>& predicate,
+                                 const std::optional<RoaringBitmap32>& bitmap,
+                                 const std::map<std::string, std::string>& options)
+        -> std::shared_ptr<arrow::ChunkedArray> {
+        EXPECT_OK_AND_ASSIGN(auto input_stream, fs_->Open(file_path_));
+        auto file_length = fs_->GetFileStatus(file_path_).value()->GetLen();
+        auto in_stream =
+            std::make_unique<ParquetInputStreamImpl>(std::move(input_stream), pool_, file_length);
+        auto parquet_batch_reader = PrepareParquetFileBatchReader(
+            std::move(in_stream), options, arrow_schema, predicate, bitmap, length);
+        EXPECT_OK_AND_ASSIGN(
+            std::shared_ptr<arrow::ChunkedArray> result_array,
+            paimon::test::ReadResultCollector::CollectResult(parquet_batch_reader.get()));
+        return result_array;
+    };
+    {
+        // row group stats of rowGroup0 [0, 10511] match the predicate, but no page does
+        auto predicate = PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0",
+                                                 FieldType::INT, Literal(5000));
+        ASSERT_FALSE(read_with_options(predicate, std::nullopt, {}));
+        auto result_array = read_with_options(predicate, std::nullopt,
+                                              {{PARQUET_READ_ENABLE_PAGE_INDEX, "false"}});
+        auto expected_array = arrow::ChunkedArray::Make({src_array->Slice(0, 512)}).ValueOrDie();
+        ASSERT_TRUE(result_array->Equals(expected_array)) << result_array->ToString();
+    }
+    {
+        // matched pages of rowGroup0 are [0, 64) and [64, 128), but bitmap selects row 300 only
+        auto predicate = PredicateBuilder::In(/*field_index=*/0, /*field_name=*/"f0",
+                                              FieldType::INT, {Literal(5), Literal(10100)});
+        ASSERT_FALSE(read_with_options(predicate, RoaringBitmap32::From({300}), {}));
+
+        auto result_array = read_with_options(predicate, RoaringBitmap32::From({100}), {});
+        auto expected_array = arrow::ChunkedArray::Make({src_array->Slice(0, 512)}).ValueOrDie();
+        ASSERT_TRUE(result_array->Equals(expected_array)) << result_array->ToString();
+    }
+}
+
 TEST_F(ParquetFileBatchReaderTest, TestReadNoField) {
     // if only read partition fields, format reader will set empty read schema
     std::string file_name = paimon::test::GetDataDir() +
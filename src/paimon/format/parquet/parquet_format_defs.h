@@ -34,6 +34,9 @@ static inline const char PARQUET_COMPRESSION_CODEC_ZSTD_LEVEL[] =
     "parquet.compression.codec.zstd.level";
 static inline const char PARQUET_COMPRESSION_CODEC_ZLIB_LEVEL[] = "zlib.compress.level";
 static inline const char PARQUET_COMPRESSION_CODEC_BROTLI_LEVEL[] = "compression.brotli.quality";
+// write column index and offset index of each column chunk, which allows readers to prune pages
+static inline const char PARQUET_WRITE_ENABLE_PAGE_INDEX[] = "parquet.write.enable-page-index";
+static constexpr bool DEFAULT_PARQUET_WRITE_ENABLE_PAGE_INDEX = true;
 
 // read
 static inline const char PARQUET_READ_EXECUTOR_THREAD_COUNT[] =
@@ -44,6 +47,10 @@ static inline const char PARQUET_READ_CACHE_OPTION_PREFETCH_LIMIT[] =
     "parquet.read.cache-option.prefetch-limit";
 static inline const char PARQUET_READ_CACHE_OPTION_RANGE_SIZE_LIMIT[] =
     "parquet.read.cache-option.range-size-limit";
+// use column index and offset index (if present) to prune row groups whose pages cannot match the
+// predicate or the selection bitmap
+static inline const char PARQUET_READ_ENABLE_PAGE_INDEX[] = "parquet.read.enable-page-index";
+static constexpr bool DEFAULT_PARQUET_READ_ENABLE_PAGE_INDEX = true;
 
 // stack-overflow may happen while the number of predicate node is too large, limit the number of
 // predicate nodes. Predicate will not be pushdown when exceed limit.
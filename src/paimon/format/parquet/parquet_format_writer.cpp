@@ -84,6 +84,10 @@ Result<bool> ParquetFormatWriter::ReachTargetSize(bool suggested_check, int64_t
     return false;
 }
 
+int64_t ParquetFormatWriter::GetBufferedSize() const {
+    return writer_ ? writer_->GetBufferedSize() : 0;
+}
+
 Result<uint64_t> ParquetFormatWriter::GetEstimateLength() const {
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(int64_t written_bytes, out_->Tell());
     return writer_->GetBufferedSize() + written_bytes;
@@ -64,6 +64,8 @@ class ParquetFormatWriter : public FormatWriter {
 
     Result<bool> ReachTargetSize(bool suggested_check, int64_t target_size) const override;
 
+    int64_t GetBufferedSize() const override;
+
     std::shared_ptr<Metrics> GetWriterMetrics() const override {
         return metrics_;
     }
@@ -51,12 +51,13 @@ class PredicateConverter {
 
     static arrow::compute::Expression AlwaysTrue();
 
+    // count predicate nodes after IN and NOT_IN are expanded
+    static void CollectNodeCount(const std::shared_ptr<Predicate>& predicate, uint32_t* node_count);
+
  private:
     static Result<arrow::compute::Expression> InnerConvert(
         const std::shared_ptr<Predicate>& predicate);
 
-    static void CollectNodeCount(const std::shared_ptr<Predicate>& predicate, uint32_t* node_count);
-
     static Result<arrow::compute::Expression> ConvertCompound(
         const std::shared_ptr<CompoundPredicate>& compound_predicate);
 
@@ -317,6 +317,44 @@ LuminaIndexReader::LuminaIndexReader(
       searcher_(std::move(searcher)),
       searcher_with_filter_(std::move(searcher_with_filter)) {}
 
+::lumina::extensions::SearchWithFilterExtension::Filter LuminaIndexReader::CreateBitmapFilter(
+    const std::shared_ptr<const RoaringBitmap64>& bitmap) const {
+    auto roaring_filter = [bitmap](::lumina::core::vector_id_t id) -> bool {
+        return bitmap->Contains(static_cast<int64_t>(id));
+    };
+    if (range_end_ >= kMaxDenseFilterRows) {
+        return roaring_filter;
+    }
+    // Flattening costs a pass over words of the whole shard, which only pays off if the filter
+    // selects a large fraction of rows, otherwise few candidates are tested against the bitmap.
+    int64_t dense_cardinality = (range_end_ + 1) / kMinDenseFilterRatio;
+    int64_t cardinality = 0;
+    auto count_iter = bitmap->Begin();
+    while (cardinality < dense_cardinality && count_iter != bitmap->End() &&
+           *count_iter <= range_end_) {
+        ++cardinality;
+        ++count_iter;
+    }
+    if (cardinality < dense_cardinality) {
+        return roaring_filter;
+    }
+    // Flatten the selected rows into plain words, so that testing a candidate visited by the
+    // search costs one word load instead of a roaring container lookup.
+    auto max_id = static_cast<uint64_t>(range_end_);
+    auto words = std::make_shared<std::vector<uint64_t>>(max_id / 64 + 1, 0);
+    for (auto iter = bitmap->Begin(); iter != bitmap->End(); ++iter) {
+        auto id = static_cast<uint64_t>(*iter);
+        if (id > max_id) {
+            break;
+        }
+        (*words)[id >> 6] |= (1ull << (id & 63));
+    }
+    return [words, max_id](::lumina::core::vector_id_t id) -> bool {
+        auto row_id = static_cast<uint64_t>(id);
+        return row_id <= max_id && ((*words)[row_id >> 6] >> (row_id & 63)) & 1ull;
+    };
+}
+
 Result<std::shared_ptr<VectorSearchGlobalIndexResult>> LuminaIndexReader::VisitVectorSearch(
     const std::shared_ptr<VectorSearch>& vector_search) {
     if (vector_search->predicate) {
@@ -347,7 +385,21 @@ Result<std::shared_ptr<VectorSearchGlobalIndexResult>> LuminaIndexReader::VisitV
 
     ::lumina::api::Query lumina_query(vector_search->query.data(), vector_search->query.size());
     ::lumina::api::LuminaSearcher::SearchResult search_result;
-    if (!vector_search->pre_filter) {
+    if (vector_search->pre_filter && vector_search->pre_filter_bitmap) {
+        return Status::Invalid("pre_filter and pre_filter_bitmap in VectorSearch conflict");
+    }
+    if (vector_search->pre_filter_bitmap) {
+        const auto& bitmap = vector_search->pre_filter_bitmap;
+        if (!bitmap->ContainsAny(0, range_end_ + 1)) {
+            // no indexed row survives the filter
+            return std::make_shared<BitmapVectorSearchGlobalIndexResult>(RoaringBitmap64(),
+                                                                         std::vector<float>());
+        }
+        PAIMON_ASSIGN_OR_RAISE_FROM_LUMINA(
+            search_result,
+            searcher_with_filter_->SearchWithFilter(lumina_query, CreateBitmapFilter(bitmap),
+                                                    search_options, *pool_));
+    } else if (!vector_search->pre_filter) {
         PAIMON_ASSIGN_OR_RAISE_FROM_LUMINA(search_result,
                                            searcher_->Search(lumina_query, search_options, *pool_));
     } else {
@@ -127,6 +127,10 @@ class LuminaIndexReader : public GlobalIndexReader {
     Result<std::shared_ptr<VectorSearchGlobalIndexResult>> VisitVectorSearch(
         const std::shared_ptr<VectorSearch>& vector_search) override;
 
+    std::optional<VectorSearch::DistanceType> GetDistanceType() const override {
+        return index_info_.distance_type;
+    }
+
     Result<std::shared_ptr<GlobalIndexResult>> VisitIsNotNull() override {
         return BitmapGlobalIndexResult::FromRanges({Range(0, range_end_)});
     }
@@ -185,6 +189,15 @@ class LuminaIndexReader : public GlobalIndexReader {
     static Result<LuminaIndexReader::IndexInfo> GetIndexInfo(const GlobalIndexIOMeta& io_meta);
 
  private:
+    ::lumina::extensions::SearchWithFilterExtension::Filter CreateBitmapFilter(
+        const std::shared_ptr<const RoaringBitmap64>& bitmap) const;
+
+ private:
+    // shards with more rows test the roaring bitmap directly rather than a flattened copy
+    static constexpr int64_t kMaxDenseFilterRows = 64 * 1024 * 1024;
+    // a filter is flattened only if it selects at least 1/kMinDenseFilterRatio of rows
+    static constexpr int64_t kMinDenseFilterRatio = 8;
+
     int64_t range_end_;
     LuminaIndexReader::IndexInfo index_info_;
     std::shared_ptr<LuminaMemoryPool> pool_;
@@ -249,6 +249,52 @@ TEST_F(LuminaGlobalIndexTest, TestWithFilter) {
     }
 }
 
+TEST_F(LuminaGlobalIndexTest, TestWithBitmapFilter) {
+    auto test_root_dir = paimon::test::UniqueTestDirectory::Create();
+    ASSERT_TRUE(test_root_dir);
+    std::string test_root = test_root_dir->Str();
+
+    ASSERT_OK_AND_ASSIGN(auto meta,
+                         WriteGlobalIndex(test_root, data_type_, options_, array_, Range(0, 3)));
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         CreateGlobalIndexReader(test_root, data_type_, options_, meta));
+    auto search_with_bitmap = [&](int32_t limit, const std::vector<int64_t>& row_ids) {
+        auto vector_search = std::make_shared<VectorSearch>(
+            /*field_name=*/"f0", limit, query_, /*filter=*/nullptr,
+            /*predicate=*/nullptr, /*distance_type=*/std::nullopt, /*options=*/options_);
+        return reader->VisitVectorSearch(vector_search->ReplacePreFilterBitmap(
+            std::make_shared<RoaringBitmap64>(RoaringBitmap64::From(row_ids))));
+    };
+    {
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result, search_with_bitmap(/*limit=*/2, {0, 1, 2}));
+        CheckResult(vector_search_result, {1l, 2l}, {2.01f, 2.21f});
+    }
+    {
+        // row ids out of the index range are ignored
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result,
+                             search_with_bitmap(/*limit=*/4, {0, 2, 3, 100}));
+        CheckResult(vector_search_result, {3l, 2l, 0l}, {0.01f, 2.21f, 4.21f});
+    }
+    {
+        // no row survives the filter
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result, search_with_bitmap(/*limit=*/4, {4, 5}));
+        CheckResult(vector_search_result, {}, {});
+        ASSERT_OK_AND_ASSIGN(vector_search_result, search_with_bitmap(/*limit=*/4, {}));
+        CheckResult(vector_search_result, {}, {});
+    }
+    {
+        // a callback together with a bitmap is ambiguous
+        auto vector_search = std::make_shared<VectorSearch>(
+            /*field_name=*/"f0", /*limit=*/2, query_, /*filter=*/nullptr,
+            /*predicate=*/nullptr, /*distance_type=*/std::nullopt, /*options=*/options_);
+        auto both_filters = vector_search->ReplacePreFilterBitmap(
+            std::make_shared<RoaringBitmap64>(RoaringBitmap64::From({0, 1})));
+        both_filters->pre_filter = [](int64_t id) -> bool { return id < 3; };
+        ASSERT_NOK_WITH_MSG(reader->VisitVectorSearch(both_filters),
+                            "pre_filter and pre_filter_bitmap in VectorSearch conflict");
+    }
+}
+
 TEST_F(LuminaGlobalIndexTest, TestInvalidInputs) {
     auto test_root_dir = paimon::test::UniqueTestDirectory::Create();
     ASSERT_TRUE(test_root_dir);
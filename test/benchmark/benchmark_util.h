@@ -0,0 +1,273 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "benchmark/benchmark.h"
+#include "paimon/api.h"
+#include "paimon/catalog/catalog.h"
+#include "paimon/catalog/identifier.h"
+#include "paimon/commit_context.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/defs.h"
+#include "paimon/file_store_commit.h"
+#include "paimon/file_store_write.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/predicate.h"
+#include "paimon/read_context.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/record_batch.h"
+#include "paimon/result.h"
+#include "paimon/scan_context.h"
+#include "paimon/status.h"
+#include "paimon/table/source/plan.h"
+#include "paimon/table/source/table_read.h"
+#include "paimon/table/source/table_scan.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/data_generator.h"
+#include "paimon/testing/utils/testharness.h"
+#include "paimon/write_context.h"
+
+namespace paimon::benchmark {
+
+/// Run `func`, which takes the benchmark state and returns `Status`, as the body of a benchmark.
+/// The benchmark is skipped with the error message if `func` fails.
+template <typename Func>
+void RunBenchmark(::benchmark::State& state, Func&& func) {
+    Status status = func(state);
+    if (!status.ok()) {
+        state.SkipWithError(status.ToString().c_str());
+    }
+}
+
+/// Schema of synthetic tables, `k` is the primary key of primary key tables.
+inline std::shared_ptr<arrow::Schema> SyntheticSchema() {
+    return arrow::schema({arrow::field("k", arrow::int64()), arrow::field("v0", arrow::int32()),
+                          arrow::field("v1", arrow::utf8()), arrow::field("v2", arrow::float64())});
+}
+
+/// Generate `num_rows` rows of `SyntheticSchema()` with keys [key_start, key_start + num_rows).
+inline std::vector<BinaryRow> GenerateRows(int64_t key_start, int64_t num_rows, MemoryPool* pool) {
+    std::vector<BinaryRow> rows;
+    rows.reserve(num_rows);
+    for (int64_t i = 0; i < num_rows; i++) {
+        int64_t key = key_start + i;
+        rows.push_back(test::BinaryRowGenerator::GenerateRow(
+            {key, static_cast<int32_t>(key % 1000), "value-" + std::to_string(key % 100),
+             static_cast<double>(key) * 0.5},
+            pool));
+    }
+    return rows;
+}
+
+/// Generate an arrow array of `SyntheticSchema()` with keys [key_start, key_start + num_rows).
+inline Result<std::shared_ptr<arrow::Array>> GenerateArray(int64_t key_start, int64_t num_rows) {
+    arrow::Int64Builder k_builder;
+    arrow::Int32Builder v0_builder;
+    arrow::StringBuilder v1_builder;
+    arrow::DoubleBuilder v2_builder;
+    for (int64_t i = 0; i < num_rows; i++) {
+        int64_t key = key_start + i;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(k_builder.Append(key));
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(v0_builder.Append(static_cast<int32_t>(key % 1000)));
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(v1_builder.Append("value-" + std::to_string(key % 100)));
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(v2_builder.Append(static_cast<double>(key) * 0.5));
+    }
+    arrow::ArrayVector children(4);
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(k_builder.Finish(&children[0]));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(v0_builder.Finish(&children[1]));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(v1_builder.Finish(&children[2]));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(v2_builder.Finish(&children[3]));
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        std::shared_ptr<arrow::Array> array,
+        arrow::StructArray::Make(children, SyntheticSchema()->fields()));
+    return array;
+}
+
+/// Read all batches of `batch_reader`, and return the number of rows read.
+inline Result<int64_t> DrainReader(BatchReader* batch_reader) {
+    int64_t num_rows = 0;
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatch batch, batch_reader->NextBatch());
+        if (BatchReader::IsEofBatch(batch)) {
+            break;
+        }
+        num_rows += batch.first->length;
+        ArrowArrayRelease(batch.first.get());
+        ArrowSchemaRelease(batch.second.get());
+    }
+    batch_reader->Close();
+    return num_rows;
+}
+
+/// A table of `SyntheticSchema()` on local file system in a temporary directory, which wraps
+/// write, commit, scan and read of the table for benchmarks.
+class BenchmarkTable {
+ public:
+    static Result<std::unique_ptr<BenchmarkTable>> Create(
+        const std::vector<std::string>& primary_keys,
+        const std::map<std::string, std::string>& options) {
+        auto dir = test::UniqueTestDirectory::Create();
+        if (dir == nullptr) {
+            return Status::IOError("failed to create benchmark directory");
+        }
+        std::map<std::string, std::string> table_options = options;
+        table_options[Options::FILE_SYSTEM] = "local";
+        // only check the key, allow to commit to primary key table and local file system
+        table_options["enable-object-store-catalog-in-inte-test"] = "";
+        table_options["enable-pk-commit-in-inte-test"] = "";
+        table_options["enable-object-store-commit-in-inte-test"] = "";
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<Catalog> catalog,
+                               Catalog::Create(dir->Str(), table_options));
+        PAIMON_RETURN_NOT_OK(
+            catalog->CreateDatabase("foo", table_options, /*ignore_if_exists=*/false));
+        ::ArrowSchema c_schema;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*SyntheticSchema(), &c_schema));
+        PAIMON_RETURN_NOT_OK(catalog->CreateTable(Identifier("foo", "bar"), &c_schema,
+                                                  /*partition_keys=*/{}, primary_keys,
+                                                  table_options, /*ignore_if_exists=*/false));
+        std::string table_path = PathUtil::JoinPath(dir->Str(), "foo.db/bar");
+
+        auto pool = GetDefaultPool();
+        SchemaManager schema_manager(std::make_shared<LocalFileSystem>(), table_path);
+        PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> table_schema,
+                               schema_manager.Latest());
+        if (!table_schema) {
+            return Status::Invalid("failed to load schema of benchmark table");
+        }
+        auto generator = std::make_unique<test::DataGenerator>(table_schema.value(), pool);
+
+        std::string commit_user = "benchmark_user";
+        WriteContextBuilder write_context_builder(table_path, commit_user);
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<WriteContext> write_context,
+            write_context_builder.SetOptions(table_options).WithStreamingMode(true).Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileStoreWrite> write,
+                               FileStoreWrite::Create(std::move(write_context)));
+        CommitContextBuilder commit_context_builder(table_path, commit_user);
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<CommitContext> commit_context,
+                               commit_context_builder.SetOptions(table_options).Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileStoreCommit> commit,
+                               FileStoreCommit::Create(std::move(commit_context)));
+        return std::unique_ptr<BenchmarkTable>(new BenchmarkTable(
+            std::move(dir), table_path, table_options, std::move(generator), std::move(write),
+            std::move(commit), pool));
+    }
+
+    /// Generate record batches split by bucket of rows with keys [key_start, key_start + num_rows).
+    Result<std::vector<std::unique_ptr<RecordBatch>>> GenerateBatches(int64_t key_start,
+                                                                      int64_t num_rows) {
+        std::vector<BinaryRow> rows = GenerateRows(key_start, num_rows, pool_.get());
+        return generator_->SplitArrayByPartitionAndBucket(rows);
+    }
+
+    Result<std::vector<std::shared_ptr<CommitMessage>>> Write(
+        std::vector<std::unique_ptr<RecordBatch>>&& batches) {
+        for (auto& batch : batches) {
+            PAIMON_RETURN_NOT_OK(write_->Write(std::move(batch)));
+        }
+        return write_->PrepareCommit(/*wait_compaction=*/false, commit_identifier_);
+    }
+
+    Status Commit(const std::vector<std::shared_ptr<CommitMessage>>& commit_messages) {
+        return commit_->Commit(commit_messages, commit_identifier_++);
+    }
+
+    /// Write and commit rows with keys [key_start, key_start + num_rows) as a new snapshot.
+    Status WriteAndCommit(int64_t key_start, int64_t num_rows) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::unique_ptr<RecordBatch>> batches,
+                               GenerateBatches(key_start, num_rows));
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<CommitMessage>> commit_messages,
+                               Write(std::move(batches)));
+        return Commit(commit_messages);
+    }
+
+    /// Plan the latest snapshot of the table in batch mode.
+    Result<std::vector<std::shared_ptr<Split>>> Scan(
+        const std::shared_ptr<Predicate>& predicate = nullptr) const {
+        ScanContextBuilder scan_context_builder(table_path_);
+        scan_context_builder.SetOptions(options_).WithStreamingMode(false);
+        if (predicate) {
+            scan_context_builder.SetPredicate(predicate);
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ScanContext> scan_context,
+                               scan_context_builder.Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableScan> scan,
+                               TableScan::Create(std::move(scan_context)));
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> plan, scan->CreatePlan());
+        return plan->Splits();
+    }
+
+    /// Read all rows of `splits`, and return the number of rows read.
+    Result<int64_t> Read(const std::vector<std::shared_ptr<Split>>& splits,
+                         const std::shared_ptr<Predicate>& predicate = nullptr) const {
+        ReadContextBuilder read_context_builder(table_path_);
+        read_context_builder.SetOptions(options_);
+        if (predicate) {
+            read_context_builder.SetPredicate(predicate);
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReadContext> read_context,
+                               read_context_builder.Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
+                               TableRead::Create(std::move(read_context)));
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> batch_reader,
+                               table_read->CreateReader(splits));
+        return DrainReader(batch_reader.get());
+    }
+
+ private:
+    BenchmarkTable(std::unique_ptr<test::UniqueTestDirectory>&& dir, const std::string& table_path,
+                   const std::map<std::string, std::string>& options,
+                   std::unique_ptr<test::DataGenerator>&& generator,
+                   std::unique_ptr<FileStoreWrite>&& write,
+                   std::unique_ptr<FileStoreCommit>&& commit,
+                   const std::shared_ptr<MemoryPool>& pool)
+        : dir_(std::move(dir)),
+          table_path_(table_path),
+          options_(options),
+          generator_(std::move(generator)),
+          write_(std::move(write)),
+          commit_(std::move(commit)),
+          pool_(pool) {}
+
+ private:
+    std::unique_ptr<test::UniqueTestDirectory> dir_;
+    std::string table_path_;
+    std::map<std::string, std::string> options_;
+    std::unique_ptr<test::DataGenerator> generator_;
+    std::unique_ptr<FileStoreWrite> write_;
+    std::unique_ptr<FileStoreCommit> commit_;
+    std::shared_ptr<MemoryPool> pool_;
+    int64_t commit_identifier_ = 0;
+};
+
+}  // namespace paimon::benchmark
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark/benchmark_util.h"
+#include "paimon/defs.h"
+#include "paimon/status.h"
+
+namespace paimon::benchmark {
+
+constexpr int64_t kRowsPerCommit = 1000;
+
+// Commit a new snapshot of `state.range(0)` buckets (one new data file for each bucket) to a table
+// with `state.range(1)` existing snapshots in each iteration. Writing is excluded from timing.
+Status Commit(::benchmark::State& state) {
+    int64_t num_buckets = state.range(0);
+    int64_t num_snapshots = state.range(1);
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<BenchmarkTable> table,
+        BenchmarkTable::Create(/*primary_keys=*/{"k"},
+                               {{Options::BUCKET, std::to_string(num_buckets)},
+                                {Options::WRITE_ONLY, "true"}}));
+    int64_t key_start = 0;
+    for (int64_t i = 0; i < num_snapshots; i++) {
+        PAIMON_RETURN_NOT_OK(table->WriteAndCommit(key_start, kRowsPerCommit));
+        key_start += kRowsPerCommit;
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::unique_ptr<RecordBatch>> batches,
+                               table->GenerateBatches(key_start, kRowsPerCommit));
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<CommitMessage>> commit_messages,
+                               table->Write(std::move(batches)));
+        key_start += kRowsPerCommit;
+        state.ResumeTiming();
+        PAIMON_RETURN_NOT_OK(table->Commit(commit_messages));
+    }
+    state.SetItemsProcessed(state.iterations());
+    return Status::OK();
+}
+
+void BM_Commit(::benchmark::State& state) {
+    RunBenchmark(state, Commit);
+}
+
+BENCHMARK(BM_Commit)
+    ->ArgNames({"buckets", "snapshots"})
+    ->ArgsProduct({{1, 16}, {1, 64}})
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace paimon::benchmark
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "benchmark/benchmark.h"
+#include "benchmark/benchmark_util.h"
+#include "paimon/common/data/blob_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/file_format_factory.h"
+#include "paimon/format/format_writer.h"
+#include "paimon/format/reader_builder.h"
+#include "paimon/format/writer_builder.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/reader/file_batch_reader.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::benchmark {
+
+constexpr int64_t kNumRows = 100000;
+constexpr int64_t kNumBlobRows = 10000;
+constexpr int64_t kBlobSize = 4096;
+constexpr int32_t kBatchSize = 1024;
+
+// blob format only accepts a single blob field, others use the synthetic schema
+Result<std::shared_ptr<arrow::Array>> GenerateFormatArray(const std::string& file_format) {
+    if (file_format != "blob") {
+        return GenerateArray(/*key_start=*/0, kNumRows);
+    }
+    arrow::LargeBinaryBuilder blob_builder;
+    std::string blob(kBlobSize, 'a');
+    for (int64_t i = 0; i < kNumBlobRows; i++) {
+        blob[i % kBlobSize] = static_cast<char>('a' + i % 26);
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(blob_builder.Append(blob));
+    }
+    arrow::ArrayVector children(1);
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(blob_builder.Finish(&children[0]));
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        std::shared_ptr<arrow::Array> array,
+        arrow::StructArray::Make(children, {BlobUtils::ToArrowField("blob")}));
+    return array;
+}
+
+Status WriteFile(const FileFormat& file_format, const std::shared_ptr<arrow::Array>& array,
+                 const std::shared_ptr<FileSystem>& fs, const std::string& path) {
+    auto schema = arrow::schema(array->type()->fields());
+    ::ArrowSchema c_schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &c_schema));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<WriterBuilder> writer_builder,
+                           file_format.CreateWriterBuilder(&c_schema, kBatchSize));
+    std::shared_ptr<OutputStream> out;
+    std::unique_ptr<FormatWriter> writer;
+    if (auto direct_writer_builder = dynamic_cast<DirectWriterBuilder*>(writer_builder.get())) {
+        PAIMON_ASSIGN_OR_RAISE(writer, direct_writer_builder->BuildFromPath(path));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(out, fs->Create(path, /*overwrite=*/true));
+        PAIMON_ASSIGN_OR_RAISE(writer, writer_builder->Build(out, "zstd"));
+    }
+    for (int64_t offset = 0; offset < array->length(); offset += kBatchSize) {
+        ::ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(
+            arrow::ExportArray(*array->Slice(offset, kBatchSize), &c_array));
+        PAIMON_RETURN_NOT_OK(writer->AddBatch(&c_array));
+    }
+    PAIMON_RETURN_NOT_OK(writer->Flush());
+    PAIMON_RETURN_NOT_OK(writer->Finish());
+    if (out) {
+        PAIMON_RETURN_NOT_OK(out->Flush());
+        PAIMON_RETURN_NOT_OK(out->Close());
+    }
+    return Status::OK();
+}
+
+Result<int64_t> ReadFile(const FileFormat& file_format,
+                         const std::shared_ptr<arrow::Schema>& schema,
+                         const std::shared_ptr<FileSystem>& fs, const std::string& path) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReaderBuilder> reader_builder,
+                           file_format.CreateReaderBuilder(kBatchSize));
+    std::unique_ptr<FileBatchReader> reader;
+    if (file_format.Identifier() == "lance") {
+        // lance do not support stream build with input stream
+        PAIMON_ASSIGN_OR_RAISE(reader, reader_builder->Build(path));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> in, fs->Open(path));
+        PAIMON_ASSIGN_OR_RAISE(reader, reader_builder->Build(in));
+    }
+    ::ArrowSchema c_schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &c_schema));
+    PAIMON_RETURN_NOT_OK(
+        reader->SetReadSchema(&c_schema, /*predicate=*/nullptr, /*selection_bitmap=*/std::nullopt));
+    return DrainReader(reader.get());
+}
+
+Status FormatWrite(::benchmark::State& state, const std::string& identifier) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileFormat> file_format,
+                           FileFormatFactory::Get(identifier, /*options=*/{}));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> array, GenerateFormatArray(identifier));
+    auto dir = test::UniqueTestDirectory::Create();
+    if (dir == nullptr) {
+        return Status::IOError("failed to create benchmark directory");
+    }
+    std::shared_ptr<FileSystem> fs = std::make_shared<LocalFileSystem>();
+    std::string path = PathUtil::JoinPath(dir->Str(), "file." + identifier);
+    for (auto _ : state) {
+        PAIMON_RETURN_NOT_OK(WriteFile(*file_format, array, fs, path));
+        state.PauseTiming();
+        PAIMON_RETURN_NOT_OK(fs->Delete(path));
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * array->length());
+    return Status::OK();
+}
+
+Status FormatRead(::benchmark::State& state, const std::string& identifier) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileFormat> file_format,
+                           FileFormatFactory::Get(identifier, /*options=*/{}));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> array, GenerateFormatArray(identifier));
+    auto dir = test::UniqueTestDirectory::Create();
+    if (dir == nullptr) {
+        return Status::IOError("failed to create benchmark directory");
+    }
+    std::shared_ptr<FileSystem> fs = std::make_shared<LocalFileSystem>();
+    std::string path = PathUtil::JoinPath(dir->Str(), "file." + identifier);
+    PAIMON_RETURN_NOT_OK(WriteFile(*file_format, array, fs, path));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileStatus> file_status, fs->GetFileStatus(path));
+    auto file_size = static_cast<int64_t>(file_status->GetLen());
+    auto schema = arrow::schema(array->type()->fields());
+    for (auto _ : state) {
+        PAIMON_ASSIGN_OR_RAISE(int64_t num_rows, ReadFile(*file_format, schema, fs, path));
+        if (num_rows != array->length()) {
+            return Status::Invalid("unexpected number of rows read ", num_rows);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * array->length());
+    state.SetBytesProcessed(state.iterations() * file_size);
+    return Status::OK();
+}
+
+void BM_FormatWrite(::benchmark::State& state, const std::string& identifier) {
+    RunBenchmark(state, [&](::benchmark::State& st) { return FormatWrite(st, identifier); });
+}
+
+void BM_FormatRead(::benchmark::State& state, const std::string& identifier) {
+    RunBenchmark(state, [&](::benchmark::State& st) { return FormatRead(st, identifier); });
+}
+
+// formats which are not enabled in build are skipped with error
+#define PAIMON_FORMAT_BENCHMARK(identifier)                                  \
+    BENCHMARK_CAPTURE(BM_FormatWrite, identifier, std::string(#identifier)) \
+        ->Unit(::benchmark::kMillisecond)                                    \
+        ->UseRealTime();                                                     \
+    BENCHMARK_CAPTURE(BM_FormatRead, identifier, std::string(#identifier))  \
+        ->Unit(::benchmark::kMillisecond)                                    \
+        ->UseRealTime()
+
+PAIMON_FORMAT_BENCHMARK(parquet);
+PAIMON_FORMAT_BENCHMARK(orc);
+PAIMON_FORMAT_BENCHMARK(avro);
+PAIMON_FORMAT_BENCHMARK(lance);
+PAIMON_FORMAT_BENCHMARK(blob);
+
+}  // namespace paimon::benchmark
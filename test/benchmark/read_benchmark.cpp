@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark/benchmark_util.h"
+#include "paimon/defs.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/status.h"
+
+namespace paimon::benchmark {
+
+constexpr int64_t kNumKeys = 100000;
+
+// Read all rows of a primary key table with `state.range(0)` overlapped sorted runs in each
+// iteration. Each commit rewrites all keys and compaction is disabled, so that every commit adds a
+// sorted run which has to be merged on read.
+Status MergeRead(::benchmark::State& state) {
+    int64_t num_sorted_runs = state.range(0);
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BenchmarkTable> table,
+                           BenchmarkTable::Create(/*primary_keys=*/{"k"},
+                                                  {{Options::BUCKET, "1"},
+                                                   {Options::WRITE_ONLY, "true"}}));
+    for (int64_t i = 0; i < num_sorted_runs; i++) {
+        PAIMON_RETURN_NOT_OK(table->WriteAndCommit(/*key_start=*/0, kNumKeys));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<Split>> splits, table->Scan());
+    for (auto _ : state) {
+        PAIMON_ASSIGN_OR_RAISE(int64_t num_rows, table->Read(splits));
+        if (num_rows != kNumKeys) {
+            return Status::Invalid("unexpected number of merged rows ", num_rows);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * num_sorted_runs * kNumKeys);
+    return Status::OK();
+}
+
+// Read an append table with a predicate which selects 1 / `state.range(0)` of rows.
+Status PredicateFilterRead(::benchmark::State& state) {
+    int64_t selectivity = state.range(0);
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BenchmarkTable> table,
+                           BenchmarkTable::Create(/*primary_keys=*/{}, {{Options::BUCKET, "-1"}}));
+    PAIMON_RETURN_NOT_OK(table->WriteAndCommit(/*key_start=*/0, kNumKeys));
+    // v0 is key % 1000
+    auto predicate = PredicateBuilder::LessThan(
+        /*field_index=*/1, "v0", FieldType::INT, Literal(static_cast<int32_t>(1000 / selectivity)));
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<Split>> splits, table->Scan(predicate));
+    int64_t num_rows = 0;
+    for (auto _ : state) {
+        PAIMON_ASSIGN_OR_RAISE(num_rows, table->Read(splits, predicate));
+    }
+    state.counters["selected_rows"] = static_cast<double>(num_rows);
+    state.SetItemsProcessed(state.iterations() * kNumKeys);
+    return Status::OK();
+}
+
+void BM_MergeRead(::benchmark::State& state) {
+    RunBenchmark(state, MergeRead);
+}
+
+void BM_PredicateFilterRead(::benchmark::State& state) {
+    RunBenchmark(state, PredicateFilterRead);
+}
+
+BENCHMARK(BM_MergeRead)->DenseRange(1, 9, 2)->Unit(::benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_PredicateFilterRead)
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace paimon::benchmark
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark/benchmark_util.h"
+#include "paimon/defs.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/status.h"
+
+namespace paimon::benchmark {
+
+constexpr int64_t kRowsPerCommit = 100;
+
+// Plan the latest snapshot of a table with `state.range(0)` manifest files in each iteration, each
+// commit adds one manifest file as manifest merge is disabled.
+Status CreatePlan(::benchmark::State& state, const std::map<std::string, std::string>& options,
+                  const std::shared_ptr<Predicate>& predicate) {
+    int64_t num_manifests = state.range(0);
+    std::map<std::string, std::string> table_options = options;
+    table_options[Options::MANIFEST_MERGE_MIN_COUNT] = std::to_string(num_manifests + 1);
+    table_options[Options::BUCKET] = "-1";
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BenchmarkTable> table,
+                           BenchmarkTable::Create(/*primary_keys=*/{}, table_options));
+    for (int64_t i = 0; i < num_manifests; i++) {
+        PAIMON_RETURN_NOT_OK(table->WriteAndCommit(i * kRowsPerCommit, kRowsPerCommit));
+    }
+    int64_t num_splits = 0;
+    for (auto _ : state) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<Split>> splits,
+                               table->Scan(predicate));
+        num_splits = static_cast<int64_t>(splits.size());
+    }
+    state.counters["splits"] = static_cast<double>(num_splits);
+    state.SetItemsProcessed(state.iterations() * num_manifests);
+    return Status::OK();
+}
+
+void BM_CreatePlan(::benchmark::State& state) {
+    RunBenchmark(state, [](::benchmark::State& st) {
+        return CreatePlan(st, /*options=*/{}, /*predicate=*/nullptr);
+    });
+}
+
+void BM_CreatePlanWithManifestCache(::benchmark::State& state) {
+    RunBenchmark(state, [](::benchmark::State& st) {
+        return CreatePlan(st, {{Options::MANIFEST_CACHE_MAX_MEMORY_SIZE, "256mb"}},
+                          /*predicate=*/nullptr);
+    });
+}
+
+// only the first manifest file contains matched data files
+void BM_CreatePlanWithPredicate(::benchmark::State& state) {
+    auto predicate = PredicateBuilder::LessThan(/*field_index=*/0, "k", FieldType::BIGINT,
+                                                Literal(static_cast<int64_t>(kRowsPerCommit)));
+    RunBenchmark(state, [&](::benchmark::State& st) {
+        return CreatePlan(st, /*options=*/{}, predicate);
+    });
+}
+
+BENCHMARK(BM_CreatePlan)->RangeMultiplier(4)->Range(4, 256)->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_CreatePlanWithManifestCache)
+    ->RangeMultiplier(4)
+    ->Range(4, 256)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_CreatePlanWithPredicate)
+    ->RangeMultiplier(4)
+    ->Range(4, 256)
+    ->Unit(::benchmark::kMicrosecond);
+
+}  // namespace paimon::benchmark
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark/benchmark_util.h"
+#include "paimon/defs.h"
+#include "paimon/status.h"
+
+namespace paimon::benchmark {
+
+// Write `state.range(0)` rows into a new table and flush them into data files in each iteration.
+// Table creation, data generation and cleanup are excluded from timing.
+Status WriteTable(::benchmark::State& state, const std::vector<std::string>& primary_keys,
+                  const std::map<std::string, std::string>& options) {
+    int64_t num_rows = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BenchmarkTable> table,
+                               BenchmarkTable::Create(primary_keys, options));
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::unique_ptr<RecordBatch>> batches,
+                               table->GenerateBatches(/*key_start=*/0, num_rows));
+        state.ResumeTiming();
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<CommitMessage>> commit_messages,
+                               table->Write(std::move(batches)));
+        ::benchmark::DoNotOptimize(commit_messages);
+        state.PauseTiming();
+        table.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+    return Status::OK();
+}
+
+void BM_AppendWrite(::benchmark::State& state, const std::string& file_format) {
+    RunBenchmark(state, [&](::benchmark::State& st) {
+        return WriteTable(st, /*primary_keys=*/{},
+                          {{Options::FILE_FORMAT, file_format}, {Options::BUCKET, "-1"}});
+    });
+}
+
+void BM_PrimaryKeyWrite(::benchmark::State& state, const std::string& file_format) {
+    RunBenchmark(state, [&](::benchmark::State& st) {
+        return WriteTable(st, /*primary_keys=*/{"k"},
+                          {{Options::FILE_FORMAT, file_format}, {Options::BUCKET, "4"}});
+    });
+}
+
+BENCHMARK_CAPTURE(BM_AppendWrite, parquet, std::string("parquet"))
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_AppendWrite, orc, std::string("orc"))
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_PrimaryKeyWrite, parquet, std::string("parquet"))
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_PrimaryKeyWrite, orc, std::string("orc"))
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace paimon::benchmark
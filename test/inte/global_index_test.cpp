@@ -349,6 +349,99 @@ TEST_P(GlobalIndexTest, TestWriteIndex) {
     }
 }
 
+TEST_P(GlobalIndexTest, TestWriteIndexInParallelShards) {
+    CreateTable();
+    std::string table_path = PathUtil::JoinPath(dir_->Str(), "foo.db/bar");
+    auto schema = arrow::schema(fields_);
+
+    std::vector<std::string> write_cols = schema->field_names();
+    auto src_array = arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(fields_), R"([
+["Alice", 10, 1, 11.1],
+["Bob", 10, 1, 12.1],
+["Emily", 10, 0, 13.1],
+["Tony", 10, 0, 14.1],
+["Lucy", 20, 1, 15.1],
+["Bob", 10, 1, 16.1],
+["Tony", 20, 0, 17.1],
+["Alice", 20, null, 18.1]
+    ])")
+                         .ValueOrDie();
+
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs, WriteArray(table_path, write_cols, src_array));
+    ASSERT_OK(Commit(table_path, commit_msgs));
+
+    std::map<std::string, std::string> build_options = {
+        {Options::GLOBAL_INDEX_BUILD_SHARD_ROWS, "3"},
+        {Options::GLOBAL_INDEX_BUILD_PARALLELISM, "2"}};
+    ASSERT_OK_AND_ASSIGN(auto split, ScanData(table_path, /*partition_filters=*/{}));
+    {
+        // the last shard mismatches the data, index files of the other shards are deleted
+        ASSERT_NOK_WITH_MSG(
+            GlobalIndexWriteTask::WriteIndex(
+                table_path, "f0", "bitmap",
+                std::make_shared<IndexedSplitImpl>(split, std::vector<Range>({Range(0, 8)})),
+                build_options, pool_),
+            "specified range length 3 mismatch indexed range length 2");
+        std::vector<std::unique_ptr<BasicFileStatus>> index_files;
+        ASSERT_OK(dir_->GetFileSystem()->ListDir(PathUtil::JoinPath(table_path, "index"),
+                                                 &index_files));
+        ASSERT_TRUE(index_files.empty());
+    }
+    ASSERT_OK_AND_ASSIGN(auto index_commit_msg, GlobalIndexWriteTask::WriteIndex(
+                                                    table_path, "f0", "bitmap",
+                                                    std::make_shared<IndexedSplitImpl>(
+                                                        split, std::vector<Range>({Range(0, 7)})),
+                                                    build_options, pool_));
+    auto index_commit_msg_impl = std::dynamic_pointer_cast<CommitMessageImpl>(index_commit_msg);
+    ASSERT_TRUE(index_commit_msg_impl);
+
+    // check commit message, each shard has its own index file
+    std::vector<std::shared_ptr<IndexFileMeta>> expected_index_file_metas;
+    for (const auto& shard_range : {Range(0, 2), Range(3, 5), Range(6, 7)}) {
+        GlobalIndexMeta expected_global_index_meta(
+            shard_range.from, shard_range.to, /*index_field_id=*/0,
+            /*extra_field_ids=*/std::nullopt, /*index_meta=*/nullptr);
+        expected_index_file_metas.push_back(std::make_shared<IndexFileMeta>(
+            "bitmap", /*file_name=*/"fake_index_file", /*file_size=*/10,
+            /*row_count=*/shard_range.Count(), /*dv_ranges=*/std::nullopt,
+            /*external_path=*/std::nullopt, expected_global_index_meta));
+    }
+    DataIncrement expected_data_increment(std::move(expected_index_file_metas));
+    auto expected_commit_message = std::make_shared<CommitMessageImpl>(
+        /*partition=*/BinaryRow::EmptyRow(), /*bucket=*/0, /*total_buckets=*/std::nullopt,
+        expected_data_increment, CompactIncrement({}, {}, {}));
+    ASSERT_TRUE(expected_commit_message->TEST_Equal(*index_commit_msg_impl));
+    ASSERT_OK(Commit(table_path, {index_commit_msg}));
+
+    // results of all shards are merged by evaluator
+    ASSERT_OK_AND_ASSIGN(auto global_index_scan,
+                         GlobalIndexScan::Create(table_path, /*snapshot_id=*/std::nullopt,
+                                                 /*partitions=*/std::nullopt, /*options=*/{},
+                                                 /*file_system=*/nullptr, pool_));
+    ASSERT_OK_AND_ASSIGN(std::vector<Range> ranges, global_index_scan->GetRowRangeList());
+    ASSERT_EQ(ranges, std::vector<Range>({Range(0, 7)}));
+    ASSERT_OK_AND_ASSIGN(auto range_scanner, global_index_scan->CreateRangeScan(Range(0, 7)));
+    auto scanner_impl = std::dynamic_pointer_cast<RowRangeGlobalIndexScannerImpl>(range_scanner);
+    ASSERT_TRUE(scanner_impl);
+    ASSERT_OK_AND_ASSIGN(auto evaluator, scanner_impl->CreateIndexEvaluator());
+    {
+        auto predicate =
+            PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0", FieldType::STRING,
+                                    Literal(FieldType::STRING, "Alice", 5));
+        ASSERT_OK_AND_ASSIGN(auto index_result,
+                             evaluator->Evaluate(predicate, /*vector_search=*/nullptr));
+        ASSERT_EQ(index_result.value()->ToString(), "{0,7}");
+    }
+    {
+        auto predicate =
+            PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0", FieldType::STRING,
+                                    Literal(FieldType::STRING, "Tony", 4));
+        ASSERT_OK_AND_ASSIGN(auto index_result,
+                             evaluator->Evaluate(predicate, /*vector_search=*/nullptr));
+        ASSERT_EQ(index_result.value()->ToString(), "{3,6}");
+    }
+}
+
 TEST_P(GlobalIndexTest, TestWriteIndexWithPartition) {
     CreateTable(/*partition_keys=*/{"f1"});
     std::string table_path = PathUtil::JoinPath(dir_->Str(), "foo.db/bar");
@@ -1489,6 +1582,125 @@ TEST_P(GlobalIndexTest, TestDataEvolutionBatchScanWithVectorSearch) {
     }
 }
 
+TEST_P(GlobalIndexTest, TestDataEvolutionBatchScanWithShardedVectorSearch) {
+    arrow::FieldVector fields = {
+        arrow::field("f0", arrow::utf8()), arrow::field("f1", arrow::list(arrow::float32())),
+        arrow::field("f2", arrow::int32()), arrow::field("f3", arrow::float64())};
+    std::map<std::string, std::string> lumina_write_options = {{"lumina.index.dimension", "4"},
+                                                               {"lumina.index.type", "bruteforce"},
+                                                               {"lumina.distance.metric", "l2"},
+                                                               {"lumina.encoding.type", "rawf32"}};
+    std::map<std::string, std::string> lumina_read_options = {
+        {"lumina.search.parallel_number", "10"}};
+
+    auto schema = arrow::schema(fields);
+    std::map<std::string, std::string> options = {{Options::MANIFEST_FORMAT, "orc"},
+                                                  {Options::FILE_FORMAT, GetParam()},
+                                                  {Options::FILE_SYSTEM, "local"},
+                                                  {Options::ROW_TRACKING_ENABLED, "true"},
+                                                  {Options::DATA_EVOLUTION_ENABLED, "true"}};
+    CreateTable(/*partition_keys=*/{}, schema, options);
+
+    std::string table_path = PathUtil::JoinPath(dir_->Str(), "foo.db/bar");
+    std::vector<std::string> write_cols = schema->field_names();
+
+    auto src_array = std::dynamic_pointer_cast<arrow::StructArray>(
+        arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(fields), R"([
+["Alice", [0.0, 0.0, 0.0, 0.0], 10, 11.1],
+["Bob", [0.0, 1.0, 0.0, 1.0], 10, 12.1],
+["Emily", [1.0, 0.0, 1.0, 0.0], 10, 13.1],
+["Tony", [1.0, 1.0, 1.0, 1.0], 10, 14.1],
+["Lucy", [10.0, 10.0, 10.0, 10.0], 20, 15.1],
+["Bob", [10.0, 11.0, 10.0, 11.0], 20, 16.1],
+["Tony", [11.0, 10.0, 11.0, 10.0], 20, 17.1],
+["Alice", [11.0, 11.0, 11.0, 11.0], 20, 18.1],
+["Paul", [10.0, 10.0, 10.0, 10.0], 20, 19.1]
+    ])")
+            .ValueOrDie());
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs, WriteArray(table_path, write_cols, src_array));
+    ASSERT_OK(Commit(table_path, commit_msgs));
+
+    // build lumina index incrementally in two shards
+    ASSERT_OK(WriteIndex(table_path, /*partition_filters=*/{}, "f1", "lumina",
+                         /*options=*/lumina_write_options, Range(0, 3)));
+    ASSERT_OK(WriteIndex(table_path, /*partition_filters=*/{}, "f1", "lumina",
+                         /*options=*/lumina_write_options, Range(4, 8)));
+
+    auto read_cols = write_cols;
+    read_cols.push_back("_INDEX_SCORE");
+    auto result_fields = fields;
+    result_fields.insert(result_fields.begin(), SpecialFields::ValueKind().ArrowField());
+    result_fields.insert(result_fields.end(), SpecialFields::IndexScore().ArrowField());
+    std::vector<float> query = {1.0f, 1.0f, 1.0f, 1.1f};
+    {
+        // each shard is searched in its own range, top-k of all ranges is merged
+        auto vector_search = std::make_shared<VectorSearch>(
+            "f1", /*limit=*/2, query, /*filter=*/nullptr,
+            /*predicate=*/nullptr, /*distance_type=*/std::nullopt, /*options=*/lumina_read_options);
+        ASSERT_OK_AND_ASSIGN(auto plan, ScanGlobalIndexAndData(table_path, /*predicate=*/nullptr,
+                                                               vector_search, lumina_read_options));
+        auto expected_array =
+            arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(result_fields), R"([
+[0, "Bob", [0.0, 1.0, 0.0, 1.0], 10, 12.1, 2.01],
+[0, "Tony", [1.0, 1.0, 1.0, 1.0], 10, 14.1, 0.01]
+    ])")
+                .ValueOrDie();
+        ASSERT_OK(ReadData(table_path, read_cols, expected_array, /*predicate=*/nullptr, plan));
+    }
+    {
+        // a range scanner covering both shards searches and merges them itself
+        ASSERT_OK_AND_ASSIGN(auto global_index_scan,
+                             GlobalIndexScan::Create(table_path, /*snapshot_id=*/std::nullopt,
+                                                     /*partitions=*/std::nullopt,
+                                                     lumina_read_options,
+                                                     /*file_system=*/nullptr, pool_));
+        ASSERT_OK_AND_ASSIGN(auto range_scanner, global_index_scan->CreateRangeScan(Range(0, 8)));
+        auto scanner_impl =
+            std::dynamic_pointer_cast<RowRangeGlobalIndexScannerImpl>(range_scanner);
+        ASSERT_TRUE(scanner_impl);
+        ASSERT_OK_AND_ASSIGN(auto evaluator, scanner_impl->CreateIndexEvaluator());
+        auto vector_search = std::make_shared<VectorSearch>(
+            "f1", /*limit=*/3, query,
+            /*filter=*/[](int64_t row_id) { return row_id != 3; },
+            /*predicate=*/nullptr, /*distance_type=*/std::nullopt, /*options=*/lumina_read_options);
+        ASSERT_OK_AND_ASSIGN(auto index_result,
+                             evaluator->Evaluate(/*predicate=*/nullptr, vector_search));
+        ASSERT_TRUE(index_result);
+        ASSERT_EQ(index_result.value()->ToString(), "row ids: {0,1,2}, scores: {4.21,2.01,2.21}");
+
+        // bitmap pre-filter is sliced into each shard
+        auto bitmap_vector_search = vector_search->ReplacePreFilterBitmap(
+            std::make_shared<RoaringBitmap64>(RoaringBitmap64::From({1, 5, 8})));
+        ASSERT_OK_AND_ASSIGN(index_result,
+                             evaluator->Evaluate(/*predicate=*/nullptr, bitmap_vector_search));
+        ASSERT_TRUE(index_result);
+        ASSERT_EQ(index_result.value()->ToString(),
+                  "row ids: {1,5,8}, scores: {2.01,360.01,322.21}");
+    }
+
+    // bitmap index covers both lumina shards, so they are searched in one range
+    ASSERT_OK(WriteIndex(table_path, /*partition_filters=*/{}, "f0", "bitmap", /*options=*/{},
+                         Range(0, 8)));
+    {
+        // predicate result is pushed down to each shard
+        auto predicate =
+            PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0", FieldType::STRING,
+                                    Literal(FieldType::STRING, "Bob", 3));
+        auto vector_search = std::make_shared<VectorSearch>(
+            "f1", /*limit=*/1, query, /*filter=*/nullptr,
+            /*predicate=*/nullptr, VectorSearch::DistanceType::EUCLIDEAN,
+            /*options=*/lumina_read_options);
+        ASSERT_OK_AND_ASSIGN(auto plan, ScanGlobalIndexAndData(table_path, predicate, vector_search,
+                                                               lumina_read_options));
+        auto expected_array =
+            arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(result_fields), R"([
+[0, "Bob", [0.0, 1.0, 0.0, 1.0], 10, 12.1, 2.01]
+    ])")
+                .ValueOrDie();
+        ASSERT_OK(ReadData(table_path, read_cols, expected_array, predicate, plan));
+    }
+}
+
 TEST_P(GlobalIndexTest, TestDataEvolutionBatchScanWithOnlyOnePartitionHasIndex) {
     CreateTable(/*partition_keys=*/{"f1"});
     std::string table_path = PathUtil::JoinPath(dir_->Str(), "foo.db/bar");
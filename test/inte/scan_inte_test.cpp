@@ -44,6 +44,7 @@
 #include "paimon/result.h"
 #include "paimon/scan_context.h"
 #include "paimon/status.h"
+#include "paimon/table/source/aggregate_plan.h"
 #include "paimon/table/source/plan.h"
 #include "paimon/table/source/startup_mode.h"
 #include "paimon/table/source/table_scan.h"
@@ -521,6 +522,87 @@ TEST_F(ScanInteTest, TestScanAppendWithSnapshot3WithBucketFilter) {
     CheckResult(expected_data_splits, result_data_splits);
 }
 
+TEST_F(ScanInteTest, TestAggregateAppendWithSnapshot3) {
+    std::string table_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
+    ScanContextBuilder context_builder(table_path);
+    context_builder.AddOption(Options::SCAN_SNAPSHOT_ID, "3");
+    ASSERT_OK_AND_ASSIGN(auto scan_context, context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+    ASSERT_OK_AND_ASSIGN(
+        auto aggregate_plan,
+        table_scan->CreateAggregatePlan({AggregateCall::CountStar(), AggregateCall::Min("f2"),
+                                         AggregateCall::Max("f2"), AggregateCall::Min("f1")}));
+    ASSERT_EQ(aggregate_plan->SnapshotId().value(), 3);
+    // all files are raw convertible append files with full stats
+    ASSERT_TRUE(aggregate_plan->IsExact());
+    std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(10)), Literal(0),
+                                             Literal(1), Literal(10)};
+    ASSERT_EQ(expected_results, aggregate_plan->PartialResults());
+    ASSERT_NOK_WITH_MSG(table_scan->CreateAggregatePlan({AggregateCall::CountStar()}),
+                        "end of scan");
+}
+
+TEST_F(ScanInteTest, TestAggregateAppendWithSnapshot3WithUnsupportedField) {
+    std::string table_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
+    ScanContextBuilder context_builder(table_path);
+    context_builder.AddOption(Options::SCAN_SNAPSHOT_ID, "3");
+    ASSERT_OK_AND_ASSIGN(auto scan_context, context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+    ASSERT_NOK_WITH_MSG(table_scan->CreateAggregatePlan({AggregateCall::Max("non-exist")}),
+                        "field non-exist in aggregate is not found in table schema");
+    // stats of string field may be truncated, so every split needs to be read
+    ASSERT_OK_AND_ASSIGN(auto aggregate_plan, table_scan->CreateAggregatePlan(
+                                                  {AggregateCall::CountStar(),
+                                                   AggregateCall::Min("f0")}));
+    ASSERT_FALSE(aggregate_plan->IsExact());
+    ASSERT_EQ(3u, aggregate_plan->Splits().size());
+    std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(0)),
+                                             Literal(FieldType::STRING)};
+    ASSERT_EQ(expected_results, aggregate_plan->PartialResults());
+}
+
+TEST_F(ScanInteTest, TestAggregateAppendWithSnapshot3WithPredicate) {
+    std::string table_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
+    auto predicate = PredicateBuilder::GreaterThan(/*field_index=*/2, /*field_name=*/"f2",
+                                                   FieldType::INT, Literal(0));
+    ScanContextBuilder context_builder(table_path);
+    context_builder.SetPredicate(predicate).AddOption(Options::SCAN_SNAPSHOT_ID, "3");
+    ASSERT_OK_AND_ASSIGN(auto scan_context, context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+    ASSERT_OK_AND_ASSIGN(
+        auto aggregate_plan,
+        table_scan->CreateAggregatePlan({AggregateCall::CountStar(), AggregateCall::Max("f2")}));
+    ASSERT_EQ(aggregate_plan->SnapshotId().value(), 3);
+
+    // f2 of partition10 bucket1 is 0 and is filtered out, f2 of the other files is 1, so all of
+    // their rows match the predicate
+    ASSERT_TRUE(aggregate_plan->IsExact());
+    std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(3)), Literal(1)};
+    ASSERT_EQ(expected_results, aggregate_plan->PartialResults());
+}
+
+TEST_F(ScanInteTest, TestAggregateAppendWithSnapshot3WithFloatingPredicate) {
+    std::string table_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
+    auto predicate = PredicateBuilder::GreaterThan(/*field_index=*/3, /*field_name=*/"f3",
+                                                   FieldType::DOUBLE, Literal(13.0));
+    ScanContextBuilder context_builder(table_path);
+    context_builder.SetPredicate(predicate).AddOption(Options::SCAN_SNAPSHOT_ID, "3");
+    ASSERT_OK_AND_ASSIGN(auto scan_context, context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+    ASSERT_OK_AND_ASSIGN(
+        auto aggregate_plan,
+        table_scan->CreateAggregatePlan({AggregateCall::CountStar(), AggregateCall::Max("f2")}));
+    ASSERT_EQ(aggregate_plan->SnapshotId().value(), 3);
+
+    // f3 of partition20 is 14.1, but stats of double do not order NaN, so even files whose stats
+    // all match the predicate need to be read
+    ASSERT_FALSE(aggregate_plan->IsExact());
+    std::vector<Literal> expected_results = {Literal(static_cast<int64_t>(0)),
+                                             Literal(FieldType::INT)};
+    ASSERT_EQ(expected_results, aggregate_plan->PartialResults());
+    ASSERT_FALSE(aggregate_plan->Splits().empty());
+}
+
 TEST_F(ScanInteTest, TestScanAppendWithStreamWithDefaultMode) {
     // from snapshot is specified
     std::string table_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
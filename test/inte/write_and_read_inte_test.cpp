@@ -23,6 +23,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
 #include "arrow/type.h"
 #include "gtest/gtest.h"
 #include "paimon/common/utils/date_time_utils.h"
@@ -30,9 +32,12 @@
 #include "paimon/common/utils/string_utils.h"
 #include "paimon/defs.h"
 #include "paimon/fs/file_system.h"
+#include "paimon/read_context.h"
+#include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
 #include "paimon/table/source/startup_mode.h"
+#include "paimon/table/source/table_query.h"
 #include "paimon/testing/utils/test_helper.h"
 #include "paimon/testing/utils/testharness.h"
 
@@ -675,6 +680,92 @@ std::vector<std::pair<std::string, std::string>> GetTestValuesForWriteAndReadInt
     return values;
 }
 
+TEST_P(WriteAndReadInteTest, TestPKTableQuery) {
+    arrow::FieldVector fields = {
+        arrow::field("pk", arrow::utf8()),
+        arrow::field("f1", arrow::int32()),
+        arrow::field("f2", arrow::float64()),
+    };
+    auto schema = arrow::schema(fields);
+    auto [file_format, file_system] = GetParam();
+    std::map<std::string, std::string> options = {
+        {Options::MANIFEST_FORMAT, "orc"}, {Options::FILE_FORMAT, file_format},
+        {Options::BUCKET, "1"},            {Options::FILE_SYSTEM, file_system},
+    };
+    if (file_system == "jindo") {
+        options = AddOptionsForJindo(options);
+    }
+    ASSERT_OK_AND_ASSIGN(auto helper, TestHelper::Create(test_dir_, schema, /*partition_keys=*/{},
+                                                         /*primary_keys=*/{"pk"}, options,
+                                                         /*is_streaming_mode=*/true));
+    int64_t commit_identifier = 0;
+    std::string data_1 = R"([
+            ["lucy", 14, 5.2],
+            ["dog", 1, 4.1],
+            ["banana", 2, 3.0],
+            ["mouse", 100, 10.3]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch_1,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data_1,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs,
+                         helper->WriteAndCommit(std::move(batch_1), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    std::string data_2 = R"([
+            ["apple", 20, 23.0],
+            ["mouse", 200, 20.3],
+            ["dog", 21, 24.1],
+            ["lucy", 14, 5.2]
+    ])";
+    ASSERT_OK_AND_ASSIGN(
+        std::unique_ptr<RecordBatch> batch_2,
+        TestHelper::MakeRecordBatch(
+            arrow::struct_(fields), data_2, /*partition_map=*/{}, /*bucket=*/0,
+            {RecordBatch::RowKind::INSERT, RecordBatch::RowKind::UPDATE_AFTER,
+             RecordBatch::RowKind::UPDATE_AFTER, RecordBatch::RowKind::DELETE}));
+    ASSERT_OK_AND_ASSIGN(commit_msgs,
+                         helper->WriteAndCommit(std::move(batch_2), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<Split>> data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt));
+
+    ReadContextBuilder read_context_builder(PathUtil::JoinPath(test_dir_, "foo.db/bar"));
+    read_context_builder.SetOptions(options).SetReadSchema({"f2", "pk"});
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ReadContext> read_context, read_context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<TableQuery> table_query,
+                         TableQuery::Create(std::move(read_context)));
+    ASSERT_OK(table_query->RefreshFiles(data_splits));
+
+    auto key_type = arrow::struct_({arrow::field("pk", arrow::utf8())});
+    auto keys = arrow::ipc::internal::json::ArrayFromJSON(
+                    key_type, R"([["dog"], ["lucy"], ["cat"], ["apple"], ["banana"], ["mouse"]])")
+                    .ValueOrDie();
+    ::ArrowArray c_keys;
+    ::ArrowSchema c_key_schema;
+    ASSERT_TRUE(arrow::ExportArray(*keys, &c_keys, &c_key_schema).ok());
+    ASSERT_OK_AND_ASSIGN(BatchReader::ReadBatch result,
+                         table_query->Lookup(/*partition=*/{}, /*bucket=*/0, &c_keys,
+                                             &c_key_schema));
+    auto& [c_result, c_result_schema] = result;
+    auto result_array = arrow::ImportArray(c_result.get(), c_result_schema.get()).ValueOrDie();
+    auto expected = arrow::ipc::internal::json::ArrayFromJSON(
+                        arrow::struct_({arrow::field("f2", arrow::float64()),
+                                        arrow::field("pk", arrow::utf8())}),
+                        R"([[24.1, "dog"], null, null, [23.0, "apple"], [3.0, "banana"],
+                            [20.3, "mouse"]])")
+                        .ValueOrDie();
+    ASSERT_TRUE(expected->Equals(result_array)) << result_array->ToString();
+
+    // key fields must be given
+    auto wrong_keys = arrow::ipc::internal::json::ArrayFromJSON(
+                          arrow::struct_({arrow::field("f1", arrow::int32())}), "[[1]]")
+                          .ValueOrDie();
+    ASSERT_TRUE(arrow::ExportArray(*wrong_keys, &c_keys, &c_key_schema).ok());
+    ASSERT_NOK_WITH_MSG(
+        table_query->Lookup(/*partition=*/{}, /*bucket=*/0, &c_keys, &c_key_schema),
+        "cannot find key field pk");
+}
+
 INSTANTIATE_TEST_SUITE_P(FileFormatAndFileSystem, WriteAndReadInteTest,
                          ::testing::ValuesIn(GetTestValuesForWriteAndReadInteTest()));
 